@@ -0,0 +1,181 @@
+;;; loaddefs.el --- automatically extracted autoloads
+;;
+;;; Code:
+
+
+;;;### (autoloads nil "ede/cpp-root" "cpp-root.el" "0dd597221cc371bf5067532de89ad469")
+;;; Generated autoloads from cpp-root.el
+
+(eieio-defclass-autoload 'ede-cpp-root-project '(ede-project eieio-instance-tracker) "ede/cpp-root" "EDE cpp-root project class.\nEach directory needs a project file to control it.")
+
+;;;***
+
+;;;### (autoloads nil "ede/custom" "custom.el" "080a8e0044ffea4ef3ebc0687b8d82f0")
+;;; Generated autoloads from custom.el
+
+(autoload 'ede-customize-project "ede/custom" "\
+Edit fields of the current project through EIEIO & Custom.
+
+\(fn)" t nil)
+
+(defalias 'customize-project 'ede-customize-project)
+
+(autoload 'ede-customize-current-target "ede/custom" "\
+Edit fields of the current target through EIEIO & Custom.
+
+\(fn)" t nil)
+
+(defalias 'customize-target 'ede-customize-current-target)
+
+(autoload 'ede-project-sort-targets "ede/custom" "\
+Create a custom-like buffer for sorting targets of current project.
+
+\(fn)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/dired" "dired.el" "0ed7623f20ae3f517b41c25bbdba5346")
+;;; Generated autoloads from dired.el
+
+(autoload 'ede-dired-minor-mode "ede/dired" "\
+A minor mode that should only be activated in DIRED buffers.
+If ARG is nil or a positive number, force on, if
+negative, force off.
+
+\(fn &optional ARG)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/emacs" "emacs.el" "0b2f02e8b30dbcffed8ff506015faa40")
+;;; Generated autoloads from emacs.el
+
+(ede-add-project-autoload (make-instance 'ede-project-autoload :name "EMACS ROOT" :file 'ede/emacs :proj-file "src/emacs.c" :load-type 'ede-emacs-load :class-sym 'ede-emacs-project :new-p nil :safe-p t) 'unique)
+
+;;;***
+
+;;;### (autoloads nil "ede/files" "files.el" "57634a49f73ac0a2ac39849d1d441866")
+;;; Generated autoloads from files.el
+
+(autoload 'ede-find-file "ede/files" "\
+Find FILE in project.  FILE can be specified without a directory.
+There is no completion at the prompt.  FILE is searched for within
+the current EDE project.
+
+\(fn FILE)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/generic" "generic.el" "f2ccd7e775ab4529c949b20037a131ee")
+;;; Generated autoloads from generic.el
+
+(autoload 'ede-enable-generic-projects "ede/generic" "\
+Enable generic project loaders.
+
+\(fn)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/linux" "linux.el" "82faa65865197042ef94de80e4f6e0d3")
+;;; Generated autoloads from linux.el
+
+(autoload 'ede-linux-load "ede/linux" "\
+Return an Linux Project object if there is a match.
+Return nil if there isn't one.
+Argument DIR is the directory it is created for.
+ROOTPROJ is nil, since there is only one project.
+
+\(fn DIR &optional ROOTPROJ)" nil nil)
+
+(ede-add-project-autoload (make-instance 'ede-project-autoload :name "LINUX ROOT" :file 'ede/linux :proj-file "scripts/ver_linux" :load-type 'ede-linux-load :class-sym 'ede-linux-project :new-p nil :safe-p t) 'unique)
+
+;;;***
+
+;;;### (autoloads nil "ede/locate" "locate.el" "74012578180b0d9273a2fa3ef6790f67")
+;;; Generated autoloads from locate.el
+
+(autoload 'ede-enable-locate-on-project "ede/locate" "\
+Enable an EDE locate feature on PROJECT.
+Attempt to guess which project locate style to use
+based on `ede-locate-setup-options'.
+
+\(fn &optional PROJECT)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/make" "make.el" "7ebfcab574e34be4ef091a935dc676ba")
+;;; Generated autoloads from make.el
+
+(autoload 'ede-make-check-version "ede/make" "\
+Check the version of GNU Make installed.
+The check passes if the MAKE version is no high enough, or if it
+is not GNU make.
+If NOERROR is non-nil, return t for success, nil for failure.
+If NOERROR is nil, then throw an error on failure.  Return t otherwise.
+
+\(fn &optional NOERROR)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/speedbar" "speedbar.el" "b509d01dc0ddf75774537b17a9ed752d")
+;;; Generated autoloads from speedbar.el
+
+(autoload 'ede-speedbar-file-setup "ede/speedbar" "\
+Setup some keybindings in the Speedbar File display.
+
+\(fn)" nil nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/system" "system.el" "ddf8860f2177fde08464575719e324ab")
+;;; Generated autoloads from system.el
+
+(autoload 'ede-web-browse-home "ede/system" "\
+Browse the home page of the current project.
+
+\(fn)" t nil)
+
+(autoload 'ede-edit-web-page "ede/system" "\
+Edit the web site for this project.
+
+\(fn)" t nil)
+
+(autoload 'ede-upload-distribution "ede/system" "\
+Upload the current distribution to the correct location.
+Use /user@ftp.site.com: file names for FTP sites.
+Download tramp, and use /r:machine: for names on remote sites w/out FTP access.
+
+\(fn)" t nil)
+
+(autoload 'ede-upload-html-documentation "ede/system" "\
+Upload the current distributions documentation as HTML.
+Use /user@ftp.site.com: file names for FTP sites.
+Download tramp, and use /r:machine: for names on remote sites w/out FTP access.
+
+\(fn)" t nil)
+
+(autoload 'ede-vc-project-directory "ede/system" "\
+Run `vc-dir' on the current project.
+
+\(fn)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/util" "util.el" "afb58e11b42678c0cd01373638e79f20")
+;;; Generated autoloads from util.el
+
+(autoload 'ede-update-version "ede/util" "\
+Update the current projects main version number.
+Argument NEWVERSION is the version number to use in the current project.
+
+\(fn NEWVERSION)" t nil)
+
+;;;***
+
+(provide 'loaddefs)
+;; Local Variables:
+;; version-control: never
+;; no-byte-compile: t
+;; no-update-autoloads: t
+;; coding: utf-8
+;; End:
+;;; loaddefs.el ends here
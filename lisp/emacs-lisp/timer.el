@@ -169,12 +169,11 @@ fire repeatedly that many seconds apart."
 	   (integerp (timer--usecs timer))
 	   (integerp (timer--psecs timer))
 	   (timer--function timer))
-      (let ((timers (if idle timer-idle-list timer-list))
-	    last)
-	;; Skip all timers to trigger before the new one.
-	(while (and timers (timer--time-less-p (car timers) timer))
-	  (setq last timers
-		timers (cdr timers)))
+      (let* ((timers (if idle timer-idle-list timer-list))
+	     ;; Skip all timers to trigger before the new one.
+	     (last (timer--insertion-point timer timers)))
+	(if last
+	    (setq timers (cdr last)))
 	(if reuse-cell
 	    (progn
 	      (setcar reuse-cell timer)
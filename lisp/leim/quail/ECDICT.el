@@ -0,0 +1,7844 @@
+;; Quail package `chinese-ecdict
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: ECDICT.tit
+
+;; # -*- coding: cn-big5 -*-
+;; AUTORELOAD:	YES
+;; AUTOSTUDY:	NO
+;; FULLCODE:	YES
+;; LXDIC:	NO
+;; # HANZI input table for cxterm
+;; # Generated from ECDICT.cit by cit2tit
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 1
+;; ENCODE:	BIG5
+;; MULTICHOICE:	YES
+;; PROMPT: Ji^~j
+;; #
+;; COMMENT Copyright 1993 Oct 18 by Nelson Chin. (cyl@ifcss.org)
+;; COMMENT Last Modified:  1994 Feb 26
+;; COMMENT Permission to use/modify/copy for any purpose is hereby granted.
+;; COMMENT Absolutely no fee and no warranties.
+;; COMMENT
+;; COMMENT use <CTRL-f> to move to the right
+;; COMMENT use <CTRL-b> to move to the left
+;; COMMENT cizu taken from crl.nmsu.edu:pub/chinese/eng-chi.b5
+;; COMMENT built on top of usercz-b5 from cxterm-nf package
+;; # define keys
+;; VALIDINPUTKEY:	!"\043\040$%&'()*+,-./0123456789:;<=>?@[\134]^_`abcdefghijkl
+;; VALIDINPUTKEY:	mnopqrstuvwxyz{|}~
+;; SELECTKEY:	_\040
+;; SELECTKEY:	1
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	\006
+;; MOVELEFT:	\002
+;; REPEATKEY:	\020\022
+;; # the following line must not be removed
+;; # BEGINDICTIONARY
+;; BEGINPHRASE
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-ecdict" "Chinese-BIG5" "^~"
+ t
+"Ji^~j
+
+ Copyright 1993 Oct 18 by Nelson Chin. (cyl@ifcss.org)
+ Last Modified:  1994 Feb 26
+ Permission to use/modify/copy for any purpose is hereby granted.
+ Absolutely no fee and no warranties.
+
+ use <CTRL-f> to move to the right
+ use <CTRL-b> to move to the left
+ cizu taken from crl.nmsu.edu:pub/chinese/eng-chi.b5
+ built on top of usercz-b5 from cxterm-nf package
+
+In this input method, you enter a Chinese (Big5) character or word
+by typing the corresponding English word.  For example, if you type
+\"computer\", \"q\" is input.
+
+\\<quail-translation-docstring>
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   
+   )
+ nil nil nil nil)
+
+(quail-define-rules
+("!" ["I" "T"])
+("\"" ["" "" "" "" ""])
+("#" ["" ""])
+("$" ["L" "D" "F" "G"])
+("%" ["H"])
+("&" ["" ""])
+("'" ["" "" "" ""])
+("(" ["]" "e" "}" "_" "g" "u" "y" "x" "|"])
+(")" ["^" "f" "~" "`" "h" "v" "z" "w" "{"])
+("*" ["" "" "S" "N" ""])
+("+" ["" "" "" "U" "t" ""])
+("," ["A" "M" "B" "N"])
+("-" ["" "" "V" "" "w" ""])
+("." ["D" "C" "E" "O" "P" "K" "L" "" "" "X" ""])
+("/" ["" "A" "" "" "@" "B"])
+("0" ["" "" ""])
+("1" ["" "" "" ""])
+("2" ["" "" "" ""])
+("3" ["" "" ""])
+("4" ["" "" ""])
+("5" ["" "" ""])
+("6" ["" "" ""])
+("7" ["" "" ""])
+("8" ["" "" ""])
+("9" ["" "" ""])
+(":" ["G" "J" "R"])
+(";" ["F" "Q"])
+("<" ["q" "" "m" "o" "s" ""])
+("=" ["" "" "" "" ""])
+(">" ["r" "" "n" "p" "t" ""])
+("?" ["H" "S"])
+("@" ["I" ""])
+("[" ["i" "" "k"])
+("\\" ["@" "B" "" "A"])
+("]" ["j" "" "l"])
+("^" ["s"])
+("_" ["Z" "\"])
+("`" ["" "" "" ""])
+("graph" ["b" "c" "d" "e" "f" "g" "h" "i" "j" "k" "l" "m" "n" "o" "p" "q" "r" "s" "t" "u" "v" "w" "x" "y" "z" "{" "|" "}" "~" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("logo" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("math" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("symbol" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "@" "A" "B"])
+("unit" ["C" "D" "E" "F" "G" "H" "I" "P" "Q" "R" "S" "T" "U" "V" "W" "X" "Y" "Z" "[" "\" "]" "^" "_" "`" "a"])
+("{" ["a" "" "c"])
+("|" ["U" "" "Y" "x" ""])
+("}" ["b" "" "d"])
+("~" ["" "\" ""])
+(" " ["@"])
+("a" ["" ""])
+("b" ["" ""])
+("c" ["" ""])
+("d" ["" ""])
+("e" ["" ""])
+("f" ["" ""])
+("g" ["" ""])
+("h" ["" ""])
+("i" ["" ""])
+("j" ["" ""])
+("k" ["" ""])
+("l" ["" ""])
+("m" ["" ""])
+("n" ["" ""])
+("o" ["" ""])
+("p" ["" ""])
+("q" ["" ""])
+("r" ["" ""])
+("s" ["" ""])
+("t" ["" ""])
+("u" ["" ""])
+("v" ["" ""])
+("w" ["@" ""])
+("x" ["A" ""])
+("y" ["B" ""])
+("z" ["C" ""])
+("a" ["@"])
+("abacus" ["L"])
+("abalone" ["j"])
+("abandon" [""])
+("abase" ["S"])
+("abash" ["ϲ۷\"])
+("abbey" ["|"])
+("abbot" ["k׹D|"])
+("abbreviate" ["Yg"])
+("abdicate" ["h" ""])
+("abdomen" [""])
+("abduct" [""])
+("abductor" [""])
+("abhor" ["c" "h"])
+("abide" ["u"])
+("ability" ["O"])
+("able" ["O"])
+("abnormal" ["`"])
+("aboard" ["bMW"])
+("abolish" [""])
+("about" ["j"])
+("above" ["bȤW"])
+("abrasive" ["ʼF"])
+("abridge" [""])
+("abroad" ["b~"])
+("abrupt" ["M"])
+("absence" ["ʮu" "ʥF"])
+("absent" ["ʮu"])
+("absolute" ["諸"])
+("absorb" ["l"])
+("absorption" ["l" "M"])
+("abstract" ["H" "jn"])
+("absurd" ["i"])
+("abundance" ["״I"])
+("abundant" ["״I"])
+("abuse" ["h" "ݥ"])
+("academic" ["ǳN"])
+("academy" ["M|"])
+("accent" ["" "Ľ"])
+("accept" [""])
+("acceptable" ["XN"])
+("access" ["q"])
+("accessible" [""])
+("accident" ["N~"])
+("accidental" ["N~"])
+("acclaim" ["wI" "ܪ"])
+("accommodate" ["A"])
+("accompany" ["P" ""])
+("accomplish" ["" ""])
+("accord" ["M" "@P"])
+("accumulate" ["n" "W["])
+("accuracy" ["T" "K"])
+("accurate" ["T"])
+("accusation" ["o" "oW"])
+("accuse" ["i" "d"])
+("accustom" ["ϲߺD"])
+("ace" ["\I"])
+("ache" ["kh"])
+("achieve" [""])
+("achievement" ["N"])
+("acid" ["ĩ"])
+("acknowledge" ["{" "ӻ{"])
+("acknowledgment" [""])
+("acquaint" ["q"])
+("acquaintance" ["" ""])
+("acquire" ["o"])
+("acquisition" ["ì"])
+("acre" ["^a"])
+("add" ["["])
+("addict" ["}"])
+("additional" ["["])
+("address" ["a}" "t"])
+("adequate" [""])
+("adhere" ["" "Tu"])
+("adieu" ["A|"])
+("adjacent" [""])
+("adjective" ["ήe"])
+("adjoin" ["s" "ss"])
+("adjourn" ["|"])
+("adjust" ["վ"])
+("administer" ["޲z"])
+("admirable" ["OHܨت"])
+("admiral" ["x`qO"])
+("admiration" ["g"])
+("admire" ["qA" "g"])
+("admission" ["ӻ{" "\i"])
+("admit" ["e\" "ۦ"])
+("adopt" ["i" "ĥ"])
+("adoption" ["i" "ĥ"])
+("adore" ["R"])
+("adult" ["H"])
+("advance" ["" "wI"])
+("advanced" ["Ū"])
+("advantage" ["u" "Qq"])
+("adventure" ["_I"])
+("adverb" ["Ƶ"])
+("adversary" ["ܪ"])
+("adversity" ["f"])
+("advertise" ["nsi"])
+("advertisement" ["si"])
+("advice" ["i"])
+("advise" ["i"])
+("adviser" ["ɱб"])
+("advocate" ["j"])
+("aeroplane" [""])
+("affair" ["ƥ"])
+("affect" ["vT"])
+("affection" ["R"])
+("affectionate" ["`R"])
+("affinity" ["ÿ"])
+("affirm" ["_"])
+("afflict" ["i"])
+("afford" ["OH"])
+("afloat" ["B"])
+("afraid" ["`"])
+("after" [""])
+("afternoon" ["U"])
+("afterwards" [""])
+("again" ["A@"])
+("age" ["~"])
+("aged" ["~Ѫ"])
+("agency" ["Nz"])
+("agent" ["NzH"])
+("aggravate" ["E"])
+("aggregate" ["E"])
+("aggressive" ["լ"])
+("agitate" ["Ͱ"])
+("agitation" ["Ͱ"])
+("ago" ["He"])
+("agonize" ["дo"])
+("agony" ["дo"])
+("agree" ["PN"])
+("agreeable" ["AN"])
+("agreement" [""])
+("agricultural" ["A~"])
+("agriculture" ["A~"])
+("ahead" [""])
+("aid" ["U"])
+("ail" ["Wo"])
+("ailment" ["f"])
+("aim" ["" "ت"])
+("air" ["Ů"])
+("airline" ["Ťq"])
+("airmail" ["Ŷl"])
+("airplane" [""])
+("airport" [""])
+("airship" [""])
+("airy" ["q"])
+("aisle" ["LD"])
+("alarm" ["ĵ"])
+("album" ["ï"])
+("alcohol" ["s"])
+("ale" ["s"])
+("alert" ["ĵ"])
+("algebra" ["N"])
+("alien" ["~ꪺ"])
+("alike" ["ۦP"])
+("alive" [""])
+("alkali" ["P"])
+("all" ["Ҧ"])
+("alley" ["" "p|"])
+("alliance" ["P"])
+("allied" ["P"])
+("alligator" ["s"])
+("allow" ["\"])
+("allowance" ["zK"])
+("ally" ["P"])
+("almanac" ["~Ų"])
+("almighty" ["j઺"])
+("almond" [""])
+("almost" ["XG"])
+("aloft" ["bB"])
+("alone" ["W۪"])
+("along" ["u" "@P"])
+("alongside" ["bȮ"])
+("aloud" ["n"])
+("alphabet" ["r"])
+("alpine" ["s"])
+("already" ["wg"])
+("also" ["]" ""])
+("altar" [""])
+("alter" [""])
+("alteration" [""])
+("alternate" ["y" ""])
+("alternative" [""])
+("although" ["M"])
+("altitude" [""])
+("altogether" ["`@"])
+("aluminum" ["T"])
+("always" ["û"])
+("am" ["O"])
+("amateur" ["~l"])
+("amaze" ["_"])
+("amazement" ["岧"])
+("amazing" ["H"])
+("ambassador" ["j"])
+("amber" ["["])
+("ambition" [""])
+("ambitious" ["ߪ"])
+("ambulance" ["@"])
+("ambush" ["I"])
+("amen" [""])
+("amend" ["ץ"])
+("amendment" ["ץ"])
+("america" ["w"])
+("amiable" ["iR" "ˤ"])
+("amid" ["bȤ"])
+("amiss" ["~"])
+("ammonia" [""])
+("ammunition" ["u" "x"])
+("among" ["bȤ"])
+("amount" ["ƶq"])
+("ample" ["״I"])
+("amuse" ["ϮT"])
+("amusement" ["T" ""])
+("amusing" ["쪺"])
+("an" ["@"])
+("analysis" ["R"])
+("analyze" ["ѪR"])
+("anatomy" ["ѭ"])
+("ancestor" [""])
+("ancestral" [""])
+("anchor" [""])
+("ancient" ["jѪ"])
+("and" ["M"])
+("anecdote" ["c" "_D"])
+("anew" ["s"])
+("angel" ["Ѩ"])
+("anger" [""])
+("angle" ["" ""])
+("angrily" ["a"])
+("angry" ["㪺"])
+("anguish" ["hW" "дe"])
+("animal" ["ʪ"])
+("ankle" ["}"])
+("annals" ["s~v"])
+("annex" ["[" "X"])
+("annihilate" [""])
+("anniversary" ["P~"])
+("announce" ["ŧG"])
+("announcement" ["qi" "i"])
+("annoy" ["Wo"])
+("annoyance" ["дo"])
+("annual" ["P~"])
+("anoint" ["o"])
+("another" ["t@"])
+("anoxia" ["ʮg"])
+("answer" ["^" ""])
+("ant" [""])
+("antagonist" ["" "Ĥ"])
+("antarctic" ["n"])
+("antecedent" [""])
+("antelope" ["ܦ"])
+("antenna" ["Ĳ" "ѽu"])
+("anthracite" ["LϷ"])
+("anticipate" ["w" "w"])
+("anticipation" [""])
+("antique" ["j"])
+("antiquity" ["j" "jN"])
+("anvil" ["Kz"])
+("anxiety" ["J"])
+("anxious" ["J檺"])
+("any" [""])
+("anybody" ["H"])
+("anyhow" ["Lצp"])
+("anyone" ["H"])
+("anything" ["Lצ"])
+("anyway" ["Lצp"])
+("anywhere" ["LצB"])
+("apart" ["}"])
+("apartment" ["J"])
+("ape" ["L"])
+("aperture" ["ե" "_"])
+("apiece" ["Uۦa"])
+("apologize" ["Dp"])
+("apology" ["Dp"])
+("apostle" ["Ϯ{"])
+("apostrophe" ["ٲŸ"])
+("appall" ["宣"])
+("appalling" ["H"])
+("apparatus" [""])
+("apparel" ["A"])
+("apparent" ["㪺"])
+("appeal" ["WD"])
+("appear" ["X{"])
+("appearance" ["X{" "~"])
+("appendix" ["" "z"])
+("appetite" [""])
+("applaud" ["x" "g"])
+("applause" ["n" "g"])
+("apple" ["īG"])
+("appliance" ["Ψ"])
+("applicant" ["ӽФH"])
+("application" ["ӽЮ"])
+("apply" ["ӽ" ""])
+("appoint" ["R" "w"])
+("appointment" ["¾" "|"])
+("appreciate" ["PE" ""])
+("appreciation" ["W" ""])
+("apprehend" ["F"])
+("apprehension" ["z"])
+("apprentice" ["Ǯ{"])
+("approach" [""])
+("appropriate" ["A"])
+("appropriation" [""])
+("approval" ["٦" "\i"])
+("approve" [""])
+("approximate" ["j"])
+("apricot" [""])
+("april" ["|"])
+("apron" [""])
+("apt" ["A"])
+("arbitrary" ["HN"])
+("arbitration" [""])
+("arbor" ["" "b"])
+("arc" ["" ""])
+("arch" ["" ""])
+("archbishop" ["jD"])
+("archer" ["}b"])
+("architect" ["ؿvv"])
+("architectural" ["ؿvǪ"])
+("architecture" ["ؿv"])
+("arctic" ["_"])
+("ardent" ["P"])
+("ardor" [""])
+("arduous" ["Im" "x"])
+("are" ["O"])
+("area" ["n" "d"])
+("arena" ["v޳"])
+("argue" [""])
+("argument" ["G"])
+("arise" ["_" "X{"])
+("aristocracy" ["Qڪ|"])
+("aristocrat" ["Qڽת"])
+("aristocratic" ["Qڤ"])
+("arithmetic" ["N"])
+("ark" [""])
+("arm" ["u"])
+("armament" ["x"])
+("armchair" ["aI"])
+("armistice" [""])
+("armor" [""])
+("arms" ["Z"])
+("army" ["x" "x"])
+("around" ["j" ""])
+("arouse" ["" "E_"])
+("arrange" ["w"])
+("arrangement" ["z"])
+("array" ["ƦC"])
+("arrest" ["e"])
+("arrival" ["F"])
+("arrive" ["F"])
+("arrow" ["bY"])
+("art" ["N"])
+("artery" ["ʯ"])
+("article" ["峹"])
+("artificial" ["Hy"])
+("artillery" ["j"])
+("artisan" ["uK"])
+("artist" ["Na"])
+("artistic" ["N"])
+("as" ["p"])
+("ascend" ["W@"])
+("ascent" ["W@"])
+("ascertain" ["Tw"])
+("ash" [""])
+("ashamed" ["۷\"])
+("ashore" ["W"])
+("asia" ["Ȭw"])
+("aside" ["b"])
+("ask" [""])
+("asleep" ["ε۪"])
+("aspect" ["ˤl"])
+("asphalt" ["wC"])
+("aspiration" ["t"])
+("aspire" [""])
+("ass" ["jl"])
+("assail" [""])
+("assault" ["ŧ"])
+("assay" ["ժ"])
+("assemble" ["զX"])
+("assembly" ["|"])
+("assent" ["٦P"])
+("assert" ["n"])
+("assertion" ["_"])
+("asset" ["겣"])
+("assign" [""])
+("assignment" ["" "JD"])
+("assist" ["U"])
+("assistance" ["U"])
+("assistant" ["U"])
+("associate" ["pQ"])
+("association" ["|"])
+("assume" ["w"])
+("assumption" ["r"])
+("assurance" ["O"])
+("assure" ["O"])
+("astonish" ["ϦY"])
+("astonishing" ["i媺"])
+("astonishment" ["j"])
+("astound" ["j"])
+("astray" [""])
+("astronomer" ["ѤǮa"])
+("astronomy" ["Ѥ"])
+("asylum" ["@"])
+("at" ["b"])
+("athlete" ["Bʮa"])
+("athletic" ["Bʪ"])
+("atlantic" ["jv"])
+("atlas" ["ja"])
+("atmosphere" ["j" "^"])
+("atom" ["l"])
+("atomic" ["l"])
+("attach" ["W"])
+("attachment" [""])
+("attack" [""])
+("attain" ["o"])
+("attempt" [""])
+("attend" ["Xu"])
+("attendance" ["Xu"])
+("attendant" ["H"])
+("attention" ["`N"])
+("attic" ["ռ"])
+("attire" ["A"])
+("attitude" ["A"])
+("attorney" ["߮v"])
+("attract" ["l"])
+("attraction" ["l"])
+("attractive" ["ޤH`N"])
+("attribute" ["ݩ"])
+("auction" [""])
+("audible" ["ťo"])
+("audience" ["ť" "["])
+("august" ["K"])
+("aunt" ["h" ""])
+("austere" ["YF"])
+("australia" ["Dw"])
+("authentic" ["u"])
+("author" ["@a"])
+("authoritative" ["vª"])
+("authority" ["v"])
+("authorize" ["v"])
+("auto" ["T"])
+("automatic" ["۰ʪ"])
+("automobile" ["T"])
+("autumn" ["u"])
+("available" ["io쪺"])
+("avenge" ["_"])
+("avenue" ["j"])
+("average" ["" "@"])
+("aviation" [""])
+("avoid" ["קK"])
+("awake" [""])
+("awaken" ["s"])
+("award" ["~"])
+("aware" ["`N"])
+("away" ["b"])
+("awful" ["iȪ"])
+("awkward" ["©媺"])
+("ax" ["Y"])
+("axis" ["b"])
+("axle" ["b"])
+("azure" ["Ŧ⪺"])
+("baby" [""])
+("bachelor" ["Ǥh"])
+("back" ["I"])
+("backbone" ["ᰩ"])
+("background" ["I"])
+("backward" ["V"])
+("bacon" ["t"])
+("bacteria" ["ӵ"])
+("bad" ["a"])
+("badge" [""])
+("badly" ["D`"])
+("badminton" ["Фy"])
+("baffle" ["۰d" "}a"])
+("bag" ["Ul"])
+("baggage" [""])
+("bait" [""])
+("bake" ["M"])
+("baker" ["ѥ]v"])
+("baking" ["M"])
+("balance" ["" "tB"])
+("balcony" ["O" "]["])
+("bald" ["rr"])
+("ball" ["y"])
+("ballad" ["uq" ""])
+("balloon" ["y"])
+("ballot" ["ﲼ"])
+("balm" ["oI"])
+("balmy" ["ڭ"])
+("banana" [""])
+("band" ["al" "ֶ"])
+("bandage" ["^a"])
+("bandit" ["js" "g"])
+("bane" ["r`"])
+("bang" [""])
+("banish" ["v" "ƥ"])
+("banishment" ["Xv" "y"])
+("bank" ["Ȧ" ""])
+("banker" ["Ȧa"])
+("banking" ["Ȧ~"])
+("bankruptcy" ["}"])
+("banner" ["X"])
+("banquet" ["b|"])
+("baptism" ["~§"])
+("bar" ["sY" "ê"])
+("barbarian" ["ZH"])
+("barbarous" ["Z"])
+("barber" ["zvv"])
+("bard" ["֤H"])
+("bare" ["rr"])
+("barefoot" [""])
+("barefooted" [""])
+("barely" ["XG" "ȶ"])
+("bargain" ["R" "ĳ"])
+("barge" ["" "C"])
+("bark" [""])
+("barley" ["j"])
+("barn" ["\" "\"])
+("barometer" ["p"])
+("baron" ["k"])
+("barrack" ["d"])
+("barrel" ["j" ""])
+("barren" [""])
+("barrier" ["]" "ê"])
+("base" ["¦"])
+("baseball" ["βy"])
+("basement" ["aU"])
+("bashful" ["Ȳ۪"])
+("basic" ["򥻪"])
+("basin" ["" "֦a"])
+("basis" ["ڥ"])
+("basket" ["xl"])
+("basketball" ["xy"])
+("bass" ["C"])
+("bat" ["y" ""])
+("bath" ["ND" "D"])
+("bathe" ["~"])
+("bathroom" ["D"])
+("battalion" ["x"])
+("batter" ["s"])
+("battery" ["q" "O"])
+("battle" ["Ԫ"])
+("battleship" ["DOĥ"])
+("bawl" ["I"])
+("bay" ["W"])
+("bayonet" ["M"])
+("bazaar" [""])
+("be" ["O"])
+("beach" ["y"])
+("bead" ["]l"])
+("beak" ["L"])
+("beam" ["" ""])
+("bean" ["l"])
+("bear" ["" "Ԩ"])
+("beard" ["GŽ"])
+("bearer" ["t"])
+("bearing" ["A" "m"])
+("beast" ["~"])
+("beat" ["V" ""])
+("beaten" ["h" "}"])
+("beating" ["@" ""])
+("beau" ["n"])
+("beautiful" ["R"])
+("beauty" ["H"])
+("beaver" ["W"])
+("because" ["]"])
+("beckon" ["IY۩I"])
+("become" ["ܦ"])
+("bed" [""])
+("bedroom" ["׫"])
+("bedside" ["ɰ"])
+("bedtime" ["Nɶ"])
+("bee" [""])
+("beech" ["Ѥ"])
+("beef" [""])
+("beer" ["s"])
+("beet" [""])
+("beetle" [""])
+("befall" ["DJ" "{"])
+("before" ["He"])
+("beforehand" ["w"])
+("befriend" ["U"])
+("beg" ["D"])
+("beggar" ["^"])
+("begin" ["}l"])
+("beginner" ["Ǫ"])
+("beginning" ["}Y"])
+("behalf" ["Qq"])
+("behave" ["|"])
+("behavior" ["欰"])
+("behead" ["٭"])
+("behind" ["b"])
+("behold" ["`"])
+("being" ["ͩR" "sb"])
+("belief" ["H"])
+("believe" ["۫H"])
+("believer" ["H{"])
+("bell" [""])
+("belle" ["H"])
+("bellow" ["q"])
+("bellows" ["c"])
+("belly" [""])
+("belong" ["ݩ"])
+("belongings" ["Ҧ"])
+("beloved" ["߷R"])
+("below" ["bȤU"])
+("belt" ["al"])
+("bench" [""])
+("bend" ["s"])
+("beneath" ["bU"])
+("beneficial" ["Q"])
+("benefit" ["Qq"])
+("benevolent" ["O"])
+("bent" ["s"])
+("bequeath" [""])
+("berry" ["ߪG"])
+("berth" ["צ"])
+("beseech" ["@"])
+("beset" ["]"])
+("beside" ["bȤ"])
+("besides" ["~"])
+("besiege" [""])
+("best" ["̦n"])
+("bestow" ["»P"])
+("bet" [""])
+("betray" ["X" "Iq"])
+("better" ["n"])
+("between" ["bȤ"])
+("betwixt" [""])
+("beverage" [""])
+("bewail" ["d"])
+("beware" ["p"])
+("bewilder" ["xb"])
+("bewitch" ["gb"])
+("beyond" ["WL"])
+("bias" ["t"])
+("bib" [""])
+("bible" ["tg"])
+("bicycle" ["ۦ樮"])
+("bid" ["X"])
+("big" ["j"])
+("bill" ["b" "r"])
+("billiards" ["pƪ"])
+("billion" ["Q"])
+("billow" ["j"])
+("bin" ["cl"])
+("bind" ["]"])
+("binding" [""])
+("biography" ["ǰO"])
+("biology" ["ͪ"])
+("birch" [""])
+("bird" [""])
+("birth" ["X"])
+("birthday" ["ͤ"])
+("birthplace" ["Xͦa"])
+("birthright" ["ͦv"])
+("biscuit" ["氮"])
+("bishop" ["D"])
+("bit" ["@I"])
+("bite" ["r"])
+("bitter" ["W"])
+("bituminous" ["wC"])
+("black" ["¦"])
+("blackberry" ["²l"])
+("blackboard" ["ªO"])
+("blacksmith" ["KK"])
+("blade" ["M"])
+("blame" ["d"])
+("blank" ["ťժ"])
+("blanket" [""])
+("blast" ["e" "z"])
+("blaze" ["K"])
+("bleach" ["}"])
+("bleed" ["y"])
+("blend" ["VX"])
+("bless" ["O"])
+("blessed" ["֪"])
+("blessing" [""])
+("blind" ["M"])
+("blink" ["K"])
+("blister" ["w"])
+("block" ["" "q"])
+("blockade" [""])
+("blond" ["v"])
+("blood" [""])
+("bloody" ["ݧԪ"])
+("bloom" ["}"])
+("blossom" ["s"])
+("blot" ["ò"])
+("blouse" ["Wm"])
+("blow" ["j"])
+("blue" ["Ŧ"])
+("bluff" ["in"])
+("blunder" ["j"])
+("blunt" ["w"])
+("blur" ["ag"])
+("blush" ["`"])
+("boar" [""])
+("board" ["O"])
+("boarder" ["HJ"])
+("boast" ["۸"])
+("boat" ["p"])
+("body" [""])
+("boil" ["N" "N}"])
+("bold" ["jx"])
+("bolt" [""])
+("bomb" ["u"])
+("bond" ["Ҩ"])
+("bone" [""])
+("bonnet" ["ĬU"])
+("bonus" ["Q"])
+("book" [""])
+("bookcase" ["Ѭ["])
+("bookkeeper" ["Ob"])
+("booklet" ["pUl"])
+("bookseller" ["ѩ"])
+("boot" ["u"])
+("booth" ["ul"])
+("border" [""])
+("bore" ["p"])
+("born" ["ѩʪ"])
+("borough" [""])
+("borrow" [""])
+("bosom" [""])
+("boss" ["Wq"])
+("botanical" ["Ӫ"])
+("botany" ["Ӫ"])
+("both" ["̪"])
+("bother" ["Z"])
+("bottle" ["~l"])
+("bottom" [""])
+("boulder" ["Y"])
+("bounce" ["ø,h"])
+("boundary" ["ɭ"])
+("bouquet" [""])
+("bow" ["}"])
+("bowel" ["z"])
+("bowl" ["@J"])
+("box" ["c"])
+("boxing" [""])
+("boy" ["kĤl"])
+("boyish" ["Ĥl"])
+("brace" ["W"])
+("bracelet" ["N"])
+("bracket" ["["])
+("brag" ["j"])
+("braid" ["v|"])
+("brain" [""])
+("branch" ["K" "䩱"])
+("brand" ["Ӽ"])
+("brass" [""])
+("brave" ["i"])
+("bravery" ["^i"])
+("bread" ["ѥ]"])
+("breadth" [""])
+("break" ["}"])
+("breakfast" ["\"])
+("breast" [""])
+("breath" [""])
+("breathe" ["Il"])
+("breathless" ["ݳݪ"])
+("breed" ["~"])
+("breeding" [""])
+("breeze" ["M"])
+("brew" ["Cy"])
+("bribe" ["쵸"])
+("brick" ["j"])
+("bride" ["sQ"])
+("bridegroom" ["s"])
+("bridge" [""])
+("brief" ["u²"])
+("briefly" ["²a"])
+("brigade" [""])
+("bright" ["G"])
+("brightness" ["G"])
+("brilliant" ["{G,~"])
+("bring" ["a"])
+("brisk" ["⪺"])
+("bristle" [""])
+("brittle" ["H"])
+("broad" ["諸"])
+("broadcast" ["s"])
+("broil" ["N"])
+("broken" ["}"])
+("broker" ["gH"])
+("bronze" ["C"])
+("brooch" ["ݰw"])
+("brook" ["pe"])
+("broom" [""])
+("broth" ["M"])
+("brother" ["S"])
+("brow" [""])
+("brown" ["Ŧ"])
+("bruise" [""])
+("brush" [""])
+("brutal" ["~ʪ"])
+("brute" ["Lzʪ"])
+("bubble" ["w"])
+("buck" [""])
+("bucket" [""])
+("buckle" ["a"])
+("bud" [""])
+("budget" ["w"])
+("buff" ["L"])
+("buffalo" [""])
+("bug" [""])
+("build" ["ؿv"])
+("building" ["ؿv"])
+("bulb" ["qOw"])
+("bulge" ["Ȱ_"])
+("bulk" ["j"])
+("bull" [""])
+("bulldog" ["Y"])
+("bullet" ["lu"])
+("bulletin" [""])
+("bullion" ["ȶ"])
+("bump" ["I"])
+("bun" ["ѥ]"])
+("bunch" [""])
+("bundle" ["" ""])
+("bungalow" [""])
+("bunk" ["ɾQ"])
+("bunny" ["߹"])
+("buoy" ["B"])
+("burden" ["t"])
+("bureau" ["" "" "B"])
+("burglar" ["ѵs"])
+("burial" ["§"])
+("burn" ["N"])
+("burst" ["}"])
+("bury" ["I"])
+("bus" ["@T"])
+("bush" [""])
+("business" ["ӷ~"])
+("busy" [""])
+("but" ["O"])
+("butcher" ["O"])
+("butler" ["ĤHZ"])
+("butter" ["o"])
+("butterfly" [""])
+("button" ["l"])
+("buy" ["R"])
+("buzz" ["qܹan"])
+("by" ["g" "b"])
+("cab" ["p"])
+("cabbage" ["ŵ"])
+("cabin" ["p"])
+("cabinet" ["pdo"])
+("cable" ["q"])
+("cafe" ["@ة"])
+("cage" ["Ţ"])
+("cake" [""])
+("calcium" ["t"])
+("calculate" ["p"])
+("calculation" ["p"])
+("calendar" [""])
+("calf" ["p"])
+("call" [",s"])
+("calm" ["NR"])
+("calorie" ["d"])
+("camel" ["dm"])
+("camera" ["Ӭ۾"])
+("camp" ["S"])
+("campaign" ["vﬡ"])
+("campus" ["ն"])
+("can" [""])
+("canada" ["[j"])
+("canal" ["Be"])
+("canary" [""])
+("cancel" [""])
+("cancer" [""])
+("candidate" ["ԿH"])
+("candle" [""])
+("candor" ["waN"])
+("candy" ["}G"])
+("cane" ["̽" ""])
+("cannon" ["j"])
+("cannot" [""])
+("canoe" ["W"])
+("canopy" ["O" ""])
+("canto" ["g"])
+("canton" ["" "p"])
+("canvas" ["|"])
+("canyon" ["l"])
+("cap" ["KU" "Ml"])
+("capable" ["~F"])
+("capacity" ["eq" "O"])
+("cape" [""])
+("caper" [""])
+("capital" ["" "ꥻ"])
+("capitalist" ["ꥻa"])
+("captain" ["ⶤ"])
+("captive" ["R"])
+("captivity" ["}T"])
+("capture" [""])
+("car" ["T"])
+("caramel" ["J}"])
+("caravan" ["Ӷ"])
+("carbon" ["Ƽg"])
+("carbonic" ["tҪ"])
+("carcass" ["e"])
+("card" ["d" "ȵP"])
+("cardinal" ["Dn"])
+("care" ["U" "ޤ"])
+("career" ["¾~" "g"])
+("careful" ["pߪ"])
+("careless" ["ʤߪ"])
+("caress" [""])
+("cargo" ["f"])
+("carnival" ["Ŧ~ط|"])
+("carol" ["|q"])
+("carp" ["U"])
+("carpenter" ["K"])
+("carpet" ["a"])
+("carriage" ["" "["])
+("carrier" ["ťĥ"])
+("carrot" ["ڽ"])
+("carry" ["hB"])
+("cart" ["Ԩ"])
+("carve" ["J"])
+("cascade" ["pr"])
+("case" ["l" "פl"])
+("casement" ["l"])
+("cash" ["{"])
+("cashier" ["Xǭ"])
+("cask" [""])
+("casket" ["p첰"])
+("cast" ["" ""])
+("castle" [""])
+("casual" ["D"])
+("cat" [""])
+("catalog" ["ؿ"])
+("cataract" ["xy" "k"])
+("catastrophe" ["a" "d@"])
+("catch" [""])
+("catcher" [""])
+("category" [""])
+("caterpillar" [""])
+("cathedral" ["jа"])
+("catholic" ["ѥD"])
+("cattle" ["" "ab"])
+("cause" ["z" "ؼ"])
+("caution" ["p" "ĵi"])
+("cautious" ["pߪ"])
+("cavalier" ["Mh" "L"])
+("cavalry" ["ML"])
+("cave" ["}"])
+("cavern" ["ja}"])
+("cavity" ["W}"])
+("cease" [""])
+("cedar" ["v"])
+("ceiling" ["ѪO"])
+("celebrate" ["y"])
+("celebrated" ["ۦW"])
+("celebration" ["§"])
+("celery" [""])
+("celestial" ["ѤW"])
+("cell" ["ӭM" "K"])
+("cellar" ["aU"])
+("celluloid" ["H"])
+("cement" ["d"])
+("cemetery" ["Ӧa"])
+("censure" ["d"])
+("census" ["Hfլd"])
+("cent" ["@"])
+("center" [""])
+("centigram" ["J"])
+("centiliter" [""])
+("centimeter" [""])
+("central" ["ߪ"])
+("century" ["@"])
+("cereal" ["\"])
+("ceremony" ["§"])
+("certain" ["T"])
+("certainly" ["Ma"])
+("certainty" ["@Lð"])
+("certificate" [""])
+("chain" ["l"])
+("chair" ["Ȥl"])
+("chairman" ["Du" "|"])
+("chalk" [""])
+("challenge" ["D"])
+("chamber" ["ж" "ĳ|"])
+("chamberlain" [""])
+("champion" ["ax"])
+("chance" ["|"])
+("chancellor" ["j"])
+("chandelier" ["QO"])
+("change" [""])
+("channel" ["l" "~|"])
+("chant" ["q"])
+("chaos" [""])
+("chap" ["a" "r"])
+("chapel" ["p§"])
+("chaplain" ["v"])
+("chapter" ["g" "|"])
+("character" ["ʮ"])
+("characteristic" ["Sx"])
+("charcoal" ["쬴"])
+("charge" ["i" "Ob"])
+("charger" ["Rq"])
+("chariot" ["|"])
+("charitable" ["O"])
+("charity" ["Oc"])
+("charm" ["yO"])
+("charming" ["gH"])
+("chart" ["a" "Ϫ"])
+("charter" ["S\"])
+("chase" ["lv"])
+("chasm" [""])
+("chaste" ["Dw"])
+("chat" [""])
+("chatter" ["㤣"])
+("chauffeur" ["q"])
+("cheap" ["Ky"])
+("cheat" ["F"])
+("check" ["b" "ˬd"])
+("cheek" ["yU"])
+("cheer" ["wI" "ܪ"])
+("cheerful" ["r֪"])
+("cheerily" ["r֦a"])
+("cheery" ["ּ֪"])
+("cheese" ["T"])
+("chemical" ["ƾǪ"])
+("chemise" ["kΤ"])
+("chemist" ["ƾǮa"])
+("chemistry" ["ƾ"])
+("cherish" ["÷R"])
+("cherry" [""])
+("chess" ["v"])
+("chest" ["ݳ"])
+("chestnut" ["ߤl"])
+("chew" ["CZ"])
+("chick" ["p"])
+("chicken" [""])
+("chide" ["ܥw"])
+("chief" ["S"])
+("chiefly" ["hba"])
+("child" ["p"])
+("childhood" ["~"])
+("childish" ["Ĥl"])
+("chill" ["HN"])
+("chilly" ["HN"])
+("chime" ["M"])
+("chimney" ["ϧw"])
+("chin" ["U"])
+("china" ["" ""])
+("chinese" ["H"])
+("chink" ["_"])
+("chip" ["H"])
+("chirp" ["γsn"])
+("chisel" ["wl"])
+("chivalry" ["Mh"])
+("chocolate" ["JO"])
+("choice" [""])
+("choir" ["۸֯Z"])
+("choke" [""])
+("cholera" ["N"])
+("choose" [""])
+("chop" ["" ""])
+("chord" ["^"])
+("chorus" ["X۹"])
+("chosen" ["諸"])
+("christ" [""])
+("christian" ["Ю{"])
+("christmas" ["tϸ`"])
+("chronicle" ["s~v"])
+("chuckle" [""])
+("church" ["а"])
+("churchman" ["Фh" "v"])
+("churchyard" ["аӦa"])
+("cider" ["G" "Gs"])
+("cigar" ["X"])
+("cigaret" ["ȷ"])
+("cinder" ["Ѯh"])
+("cinema" ["qv|"])
+("cinnamon" ["׮"])
+("circle" [""])
+("circuit" ["q"])
+("circular" ["ꪺ"])
+("circulate" ["`"])
+("circulation" ["oB"])
+("circumference" ["P"])
+("circumstance" ["ҹJ"])
+("circus" [""])
+("cite" [""])
+("citizen" [""])
+("city" [""])
+("civic" [""])
+("civil" ["ƪ"])
+("civilian" [""])
+("civilization" [""])
+("civilize" [""])
+("claim" [""])
+("clam" ["F"])
+("clan" [""])
+("clap" [""])
+("class" ["" "ǯ"])
+("classic" ["j嬣"])
+("classical" ["j媺"])
+("classification" [""])
+("classify" [""])
+("classmate" ["PZP"])
+("classroom" ["Ы"])
+("clause" ["uy"])
+("claw" [""])
+("clay" ["dg"])
+("clean" ["M"])
+("cleaner" ["M侹"])
+("clear" ["M"])
+("clearly" ["a"])
+("cleave" ["A}"])
+("clergy" ["Фh"])
+("clergyman" ["v"])
+("clerk" ["ѰO"])
+("clever" ["o"])
+("client" ["U"])
+("cliff" ["a"])
+("climate" [""])
+("climax" ["I"])
+("climb" [""])
+("cling" ["H"])
+("clinic" ["E"])
+("clip" ["ȧ"])
+("cloak" ["O"])
+("cloakroom" ["U"])
+("clock" [""])
+("cloister" ["x|"])
+("close" [""])
+("closet" ["o"])
+("cloth" [""])
+("clothes" ["A"])
+("clothing" ["A"])
+("cloud" [""])
+("cloudy" ["Ѫ"])
+("clown" ["p"])
+("club" ["Ҵ"])
+("clumsy" ["©媺"])
+("cluster" [""])
+("coach" ["Ȩ"])
+("coal" [""])
+("coarse" ["ʦH"])
+("coast" [""])
+("coat" ["~M"])
+("cobweb" ["j"])
+("cock" [""])
+("cocktail" ["s"])
+("cocoa" ["ii"])
+("coconut" ["l"])
+("code" ["X"])
+("coffee" ["@"])
+("coffin" ["ç"])
+("coil" [""])
+("coin" ["w"])
+("coincidence" ["X"])
+("cold" ["N" "˭"])
+("collapse" ["U" "Y"])
+("collar" ["w"])
+("colleague" ["P"])
+("collect" [""])
+("collection" [""])
+("college" ["ǰ|"])
+("colonel" ["xW"])
+("colonial" ["ޥ"])
+("colony" ["ޥa"])
+("color" ["C"])
+("colorful" ["Im"])
+("colt" ["p"])
+("column" ["W"])
+("comb" [""])
+("combat" ["԰"])
+("combination" ["X"])
+("combine" ["X"])
+("combustion" ["UN"])
+("come" [""])
+("comedy" ["߼@"])
+("comet" ["kP"])
+("comfort" ["w"])
+("comfortable" ["ΪA"])
+("comforter" ["ֳQ"])
+("comic" ["s"])
+("comical" ["ƽ]"])
+("coming" ["{"])
+("comma" ["rI"])
+("command" ["RO"])
+("commander" ["x"])
+("commandment" ["٫"])
+("commence" ["}l" "ۤ"])
+("commencement" ["}l"])
+("commend" [""])
+("comment" [""])
+("commentary" [""])
+("commerce" ["T"])
+("commercial" ["ӰȪ"])
+("commission" [""])
+("commissioner" ["e"])
+("commit" ["e" "ʸT"])
+("committee" ["e|"])
+("commodity" ["ӫ~"])
+("common" ["@P"])
+("commonplace" ["Z"])
+("commonwealth" ["p"])
+("commotion" ["ɶ" ""])
+("commune" ["K"])
+("communicate" ["q"])
+("communication" ["p"])
+("communion" [""])
+("communism" ["@Dq"])
+("communist" ["@ҭ"])
+("community" ["" ""])
+("compact" ["K" "p"])
+("companion" ["P"])
+("companionship" ["ͽ"])
+("company" ["q" ""])
+("comparable" ["i"])
+("comparative" [""])
+("comparatively" ["a"])
+("compare" [""])
+("comparison" [""])
+("compartment" ["j"])
+("compass" ["ùL" "P"])
+("compassion" ["P"])
+("compel" ["j"])
+("compensate" ["v"])
+("compensation" ["v"])
+("compete" ["v"])
+("competent" ["F"])
+("competition" [""])
+("competitive" ["v"])
+("competitor" [""])
+("compile" ["s"])
+("complain" [""])
+("complaint" ["i"])
+("complement" ["["])
+("complete" [""])
+("completion" [""])
+("complex" ["ƦX"])
+("complexion" ["" "ζ"])
+("complicate" ["c"])
+("complicated" ["a"])
+("complication" ["ȯ"])
+("compliment" ["g" "DP"])
+("comply" ["PN"])
+("compose" ["զ"])
+("composed" ["wM"])
+("composer" ["@a"])
+("composition" ["@"])
+("composure" ["R"])
+("compound" ["ƦX"])
+("comprehend" ["F"])
+("comprehensive" ["sx"])
+("compress" [""])
+("comprise" ["]t"])
+("compromise" [""])
+("compulsory" ["j"])
+("compute" ["p"])
+("computer" ["q"])
+("comrade" ["P"])
+("conceal" [""])
+("concede" ["ӻ{" "B"])
+("conceit" ["ۭt" "N"])
+("conceivable" ["iQ"])
+("conceive" ["cQ" "F"])
+("concentrate" ["M" "@Y" "" "M"])
+("concentration" ["M" "@Y"])
+("conception" ["QO"])
+("concern" ["`"])
+("concerned" [""])
+("concerning" [""])
+("concert" ["ַ|"])
+("concession" ["B"])
+("concise" ["²"])
+("conclude" [""])
+("conclusion" ["" ""])
+("concord" ["M"])
+("concrete" ["b"])
+("condemn" ["Ϲ"])
+("condense" ["Y"])
+("condition" ["" "p"])
+("conduct" ["Bz" "޾"])
+("conductor" [""])
+("cone" ["@"])
+("confederacy" ["P"])
+("confederate" ["P"])
+("confederation" ["P"])
+("confer" ["{"])
+("conference" ["Q|"])
+("confess" ["ӻ{" "b"])
+("confession" ["ۥծ"])
+("confide" ["H"])
+("confidence" ["۫H" "K"])
+("confident" ["TH"])
+("confidential" ["K"])
+("confine" [""])
+("confirm" ["ҹ"])
+("confirmation" ["ҩ"])
+("confiscate" ["S"])
+("conflict" ["Ĭ"])
+("conform" ["ŦX"])
+("confound" ["Y"])
+("confront" [""])
+("confuse" ["V"])
+("confusion" ["g"])
+("congenial" ["Nۧ몺"])
+("congratulate" ["P" "yP"])
+("congratulation" ["P"])
+("congregation" ["X"])
+("congress" ["|"])
+("congressman" ["|ĳ"])
+("conjecture" [""])
+("conjugation" ["sX"])
+("conjunction" ["s"])
+("conjure" ["]k"])
+("connect" ["s"])
+("connection" ["pô"])
+("conquer" ["A"])
+("conqueror" ["A"])
+("conquest" ["ӧQ"])
+("conscience" ["}"])
+("conscientious" ["}ߪ"])
+("conscious" ["NѪ"])
+("consciousness" ["N"])
+("consecrate" ["^m"])
+("consent" ["PN"])
+("consequence" ["G"])
+("consequent" ["Ӧ"])
+("consequently" ["]"])
+("conservation" ["O@"])
+("conservative" ["Ou"])
+("conserve" ["Os"])
+("consider" ["Ҽ{"])
+("considerable" ["ȱoҼ{"])
+("considerably" ["D`a"])
+("considerate" ["K"])
+("consideration" ["U{"])
+("considering" ["NȦӨ"])
+("consign" [""])
+("consist" ["]t"])
+("consistent" ["@P"])
+("consolation" [""])
+("console" ["w"])
+("consolidate" ["dT"])
+("consonant" ["l"])
+("consort" ["t"])
+("conspicuous" ["㪺"])
+("conspiracy" [""])
+("conspire" ["Ͽ"])
+("constable" ["ĵx"])
+("constancy" ["["])
+("constant" ["ܪ"])
+("constantly" ["a"])
+("constellation" ["Py"])
+("constituent" ["|v"])
+("constitute" ["զ"])
+("constitution" ["cy" "˪k"])
+("constraint" ["T"])
+("construct" ["c"])
+("construction" ["ؿv"])
+("constructive" ["س]ʪ"])
+("consul" [""])
+("consult" ["б" "Ӷq"])
+("consultation" ["|ĳ"])
+("consume" [""])
+("consumer" ["O"])
+("consummate" [""])
+("consumption" ["Ӷq"])
+("contact" ["Ĳ"])
+("contagious" ["|ǬV"])
+("contain" ["e"])
+("contemplate" ["`" "H"])
+("contemplation" ["H" ""])
+("contemporary" ["PɥN"])
+("contempt" [""])
+("contemptuous" [""])
+("contend" ["v" ""])
+("content" ["ϺN"])
+("contented" [""])
+("contention" ["I"])
+("contentment" [""])
+("contest" ["v"])
+("continent" ["j"])
+("continental" ["j"])
+("continual" ["_"])
+("continuation" ["~"])
+("continue" ["~"])
+("continuous" ["s"])
+("contract" [""])
+("contraction" ["Yu"])
+("contractor" ["ӥ]H"])
+("contradict" ["Ĳ"])
+("contrary" ["ۤ"])
+("contrast" [""])
+("contribute" ["Z" "^m"])
+("contribution" [""])
+("control" [""])
+("controversy" ["ת"])
+("convenience" ["KQ"])
+("convenient" ["KQ"])
+("convent" ["k׹D"])
+("convention" ["|ĳ"])
+("conventional" ["DҪ"])
+("conversation" ["͸"])
+("conversion" ["ܴ"])
+("convert" ["ഫ"])
+("convey" ["ǹF"])
+("convict" ["wo" "}"])
+("conviction" ["o"])
+("convince" ["ϫHA"])
+("convincing" ["ϤHHA"])
+("cook" ["N" "pq"])
+("cookery" ["iճN"])
+("cookie" ["氮"])
+("cool" ["D"])
+("cooperate" ["XO"])
+("cooperation" ["X@"])
+("cooperative" ["X@"])
+("coordinate" ["y"])
+("cope" ["I"])
+("copper" [""])
+("copy" ["ƥ" ""])
+("copyright" ["v"])
+("coral" [""])
+("cord" ["÷l"])
+("core" ["֤"])
+("cork" ["n"])
+("corn" ["ɸ"])
+("corner" [""])
+("corporal" ["骺"])
+("corporation" ["q"])
+("corps" ["x"])
+("corpse" [""])
+("correct" ["諸"])
+("correction" ["勵"])
+("correctly" ["Ta"])
+("correspond" ["" "qH"])
+("correspondent" ["qH" "@P"])
+("corridor" ["Y"])
+("corrupt" ["a"])
+("corruption" ["G"])
+("cost" [""])
+("costly" ["Q"])
+("costume" ["A"])
+("cot" ["T"])
+("cottage" ["T"])
+("cotton" [""])
+("couch" ["δ"])
+("cough" ["y"])
+("council" ["ĳ|"])
+("counselor" ["U"])
+("count" ["p"])
+("countenance" ["e"])
+("counter" ["dO"])
+("counterfeit" ["y"])
+("countless" ["Ƥɪ"])
+("country" [""])
+("county" ["p"])
+("couple" ["@"])
+("courage" ["i"])
+("courageous" ["xq"])
+("course" ["{"])
+("court" ["k|"])
+("courteous" ["§"])
+("courtesy" ["§"])
+("courtyard" ["x"])
+("cousin" ["" ""])
+("covenant" ["t"])
+("cover" ["л\"])
+("cow" [""])
+("coward" [""])
+("cowardice" ["xp"])
+("cowboy" ["J"])
+("cozy" ["ξA"])
+("crab" [""])
+("crack" ["z"])
+("cracker" ["z"])
+("crackle" [""])
+("cradle" ["nx"])
+("craft" [""])
+("crafty" ["⪺"])
+("cram" ["" "O"])
+("cramp" ["l"])
+("crane" ["_"])
+("crash" ["H"])
+("crate" ["Oc"])
+("crave" [""])
+("crawl" [""])
+("crayon" [""])
+("craze" ["g"])
+("crazy" ["og"])
+("cream" ["o"])
+("create" ["гy"])
+("creation" ["Ч@"])
+("creature" ["ʪ"])
+("credit" ["H"])
+("creditor" ["vH"])
+("creed" ["иq"])
+("creep" [""])
+("crescent" ["s"])
+("crest" ["a"])
+("crew" ["H"])
+("cricket" [""])
+("crime" ["Ǹo"])
+("criminal" ["o"])
+("crimson" ["A"])
+("cripple" ["ٮ`"])
+("crisis" ["M"])
+("crisp" ["ܪ"])
+("critic" ["a"])
+("critical" ["M檺"])
+("criticism" [""])
+("criticize" ["Dĳ"])
+("crocodile" ["s"])
+("crook" ["},Fl"])
+("crop" ["A@"])
+("cross" ["e"])
+("crow" ["Q~"])
+("crowd" ["s"])
+("crowded" [""])
+("crown" ["a"])
+("crude" ["W"])
+("cruel" ["ݻŪ"])
+("cruelty" ["ݻ"])
+("cruise" ["|"])
+("crumb" ["h"])
+("crumble" ["˸H"])
+("crumple" ["˽K"])
+("crusade" ["Qrx"])
+("crush" ["H"])
+("crust" ["ѥ]"])
+("cry" ["" ""])
+("crystal" [""])
+("cub" ["~"])
+("cube" ["ߤ"])
+("cubic" ["ߤ骺"])
+("cuckoo" ["Y"])
+("cucumber" [""])
+("cuff" ["Sf"])
+("cultivate" ["i"])
+("cultivation" ["i"])
+("culture" [""])
+("cunning" ["⪺"])
+("cup" ["M"])
+("cupboard" ["Jd"])
+("curb" [""])
+("cure" ["v¡"])
+("curiosity" ["n_"])
+("curious" ["n_ߪ"])
+("curl" [""])
+("curly" [""])
+("currency" ["f"])
+("current" ["{ɪ"])
+("curse" ["AG"])
+("curtail" [""])
+("curtain" [""])
+("curve" ["s"])
+("cushion" ["Ԥl"])
+("custody" ["O"])
+("custom" ["ߺD" "U"])
+("customary" ["ߺDʪ"])
+("customer" ["U"])
+("cut" [""])
+("cute" ["iR"])
+("cycle" ["g" "M"])
+("cylinder" ["W"])
+("cynical" ["ջ"])
+("cypress" ["f"])
+("dad" [""])
+("daffodil" ["zP"])
+("dagger" ["uC"])
+("dahlia" ["ѪǨd"])
+("daily" ["C骺"])
+("dainty" [""])
+("dairy" ["TA~"])
+("daisy" [""])
+("dam" [""])
+("damage" ["l`"])
+("dame" ["QH"])
+("damn" ["G|"])
+("damp" [""])
+("dance" ["R"])
+("dancer" ["RЮa"])
+("dancing" ["R"])
+("danger" ["MI"])
+("dangerous" ["MI"])
+("dangle" ["Q"])
+("dare" [""])
+("daring" ["xj"])
+("dark" ["·t"])
+("darken" ["ܷt" "ܶ"])
+("darkly" ["·ta"])
+("darkness" ["·t"])
+("darling" ["߷RH"])
+("darn" ["_"])
+("dart" ["" "g"])
+("dash" ["ļ"])
+("data" ["" "ƾ"])
+("date" ["" "|"])
+("daughter" ["k"])
+("dawn" [""])
+("day" ["" "դ"])
+("daybreak" ["" "}"])
+("daylight" ["ձ"])
+("daytime" ["鶡"])
+("daze" ["wt"])
+("dazzle" ["ģ"])
+("dead" [""])
+("deadly" ["P"])
+("deaf" ["Ť"])
+("deafen" ["ϦŤ"])
+("deal" ["" "A"])
+("dealer" [""])
+("dealing" ["" "橹"])
+("dean" ["|"])
+("dear" ["˷R"])
+("dearly" ["˷Ra"])
+("death" ["`"])
+("debate" ["G"])
+("debt" ["Ű"])
+("debtor" ["ŰȤH"])
+("decade" ["Q~"])
+("decagram" ["QJ"])
+("decaliter" [""])
+("decameter" ["V"])
+("decay" ["I"])
+("decease" ["`"])
+("deceased" ["`"])
+("deceit" ["ޭp"])
+("deceive" ["F"])
+("december" ["QG"])
+("decency" ["欰"])
+("decent" ["XA"])
+("decide" ["Mw"])
+("decided" ["Tw"])
+("decigram" [""])
+("decimeter" ["o"])
+("decision" ["Mw"])
+("decisive" ["Mwʪ"])
+("deck" ["ҪO"])
+("declaration" ["n"])
+("declare" ["ŧG"])
+("decline" ["U"])
+("decompose" ["I"])
+("decorate" ["˹"])
+("decorative" ["˹"])
+("decrease" [""])
+("decree" ["kO"])
+("dedicate" ["^m"])
+("deed" [""])
+("deem" ["H"])
+("deep" ["`"])
+("deepen" ["[`"])
+("deeply" ["b`B"])
+("deer" [""])
+("defeat" [""])
+("defect" ["L"])
+("defective" [""])
+("defence" ["m"])
+("defend" ["u"])
+("defendant" ["Qi"])
+("defender" ["u"])
+("defense" ["m"])
+("defensive" ["۽ê"])
+("defer" ["w"])
+("deferent" [""])
+("defiance" ["D"])
+("deficiency" ["ʥF"])
+("deficient" ["ʥF"])
+("defile" ["ż"])
+("define" ["Uwq"])
+("definite" ["֩w"])
+("definition" ["wq"])
+("deformity" ["ݼo"])
+("defy" ["A"])
+("degenerate" ["hB"])
+("degradation" ["K¾"])
+("degrade" [""])
+("degree" ["׼" ""])
+("deity" [""])
+("delay" [""])
+("delegate" ["N"])
+("delegation" ["N"])
+("deliberate" ["ԷV"])
+("deliberation" [""])
+("delicacy" ["P"])
+("delicate" [""])
+("delicious" [""])
+("delight" ["ֽ"])
+("delightful" ["r֪"])
+("deliver" ["ǰe" ""])
+("deliverance" [""])
+("delivery" ["ǰe" "Y"])
+("dell" ["ը"])
+("delta" ["Tw"])
+("deluge" ["x"])
+("delusion" ["۷Q"])
+("demand" ["nD"])
+("demeanor" ["A"])
+("democracy" ["DFv"])
+("democrat" ["DDq"])
+("democratic" ["DFv"])
+("demon" ["c]"])
+("demonstrate" ["ܽd" "ܫ"])
+("demonstration" ["ܽd" "ܫ"])
+("den" ["~"])
+("denial" ["_{"])
+("denomination" ["W" "O"])
+("denote" ["" ""])
+("denounce" ["}d"])
+("dense" ["YK"])
+("density" ["K"])
+("dental" [""])
+("dentist" [""])
+("deny" ["_{"])
+("depart" ["}"])
+("department" ["" "t"])
+("departure" ["ҵ{"])
+("depend" ["̾a"])
+("dependence" [""])
+("dependent" ["̿઺"])
+("depict" ["yz"])
+("deplore" ["dh"])
+("depose" ["K¾"])
+("deposit" ["s"])
+("depot" ["ܮw"])
+("depress" ["C" "S"])
+("depression" [""])
+("deprive" [""])
+("depth" ["`"])
+("deputy" ["ƪ"])
+("derision" ["M"])
+("derive" ["o" "_"])
+("descend" ["U"])
+("descendant" [""])
+("descent" ["" ""])
+("describe" ["yz" "e"])
+("description" ["ԭz"])
+("desert" ["Fz"])
+("deserve" ["o"])
+("design" ["]p" "Ϯ"])
+("designate" ["w"])
+("desirability" ["iB"])
+("desirable" ["XN"])
+("desire" [""])
+("desirous" ["檺"])
+("desk" ["Ѯ"])
+("desolate" ["D"])
+("desolation" [""])
+("despair" [""])
+("despairing" ["檺"])
+("despatch" ["oe" "ѨM"])
+("desperate" ["D`"])
+("desperation" [""])
+("despise" [""])
+("despite" [""])
+("dessert" ["I"])
+("destination" ["تa"])
+("destine" ["ww" "w"])
+("destiny" ["RB"])
+("destitute" ["ʥF"])
+("destroy" ["}a"])
+("destruction" ["a"])
+("destructive" ["}a"])
+("detach" ["}"])
+("detachment" ["}"])
+("detail" ["Ӹ`"])
+("detain" ["d"])
+("detect" ["d"])
+("detective" [""])
+("determination" ["M"])
+("determine" ["UM"])
+("determined" ["Mߪ"])
+("detest" [""])
+("devastate" ["a"])
+("develop" ["oi"])
+("development" ["oi"])
+("device" ["˸m" "]"])
+("devil" ["]"])
+("devise" ["]p"])
+("devote" ["^m"])
+("devoted" ["۪"])
+("devotion" [""])
+("devour" ["]"])
+("dew" ["S"])
+("dewy" ["aS"])
+("dexterity" ["F"])
+("diagram" ["Ϫ"])
+("dial" [""])
+("dialect" ["訥"])
+("dialogue" [""])
+("diameter" ["|"])
+("diamond" ["p"])
+("diary" ["O"])
+("dice" ["l"])
+("dictate" ["ťg"])
+("dictation" ["ťg"])
+("dictator" ["W"])
+("diction" ["Φr"])
+("dictionary" ["r"])
+("die" [""])
+("diet" ["i"])
+("difference" ["tO"])
+("difficult" ["x"])
+("diffuse" ["X"])
+("dig" [""])
+("digest" [""])
+("digestion" [""])
+("digestive" ["ƪ"])
+("dignify" ["ϰQ"])
+("dignity" ["LY"])
+("dilate" ["Ͽ"])
+("dilemma" ["ih"])
+("diligence" ["ԫj"])
+("diligent" ["ԫj"])
+("dim" ["t"])
+("dime" ["@ȹ"])
+("dimension" ["jp"])
+("diminish" ["Yp"])
+("diminutive" ["p"])
+("dimple" ["s"])
+("dine" ["ο"])
+("dinner" ["\"])
+("dip" ["@U"])
+("diplomacy" ["~"])
+("diplomatic" ["~ê"])
+("direct" ["" ""])
+("direction" [""])
+("directly" ["a"])
+("director" ["" "" ""])
+("dirt" ["żF"])
+("dirty" ["ż"])
+("disable" ["ϵL"])
+("disadvantage" ["Q"])
+("disagree" ["PN"])
+("disagreeable" ["r֪"])
+("disappear" ["a,"])
+("disappoint" ["ϥ"])
+("disappointment" [""])
+("disapproval" ["٦"])
+("disapprove" ["٦"])
+("disarm" ["ox"])
+("disarmament" ["x"])
+("disaster" ["G"])
+("disastrous" [""])
+("discard" ["߱"])
+("discern" ["ѧO"])
+("discharge" ["ƥX"])
+("disciple" ["{"])
+("discipline" ["W"])
+("disclose" ["o"])
+("discomfort" ["w"])
+("discontent" [""])
+("discord" ["թM"])
+("discount" ["馩"])
+("discourage" [""])
+("discover" ["o{"])
+("discovery" ["so{"])
+("discreet" ["ԷV"])
+("discretion" ["V"])
+("discuss" ["ӽ"])
+("discussion" ["Q"])
+("disdain" [""])
+("disease" ["f"])
+("disfigure" [""])
+("disgrace" ["d"])
+("disguise" [""])
+("disgust" ["Ϲ"])
+("dish" ["L" ""])
+("dishonest" ["۹ꪺ"])
+("dishonor" ["WAƪ"])
+("disk" ["L"])
+("dislike" ["c"])
+("dismiss" ["Ѵ"])
+("dismount" ["U"])
+("disobey" ["ťR"])
+("disorder" ["V"])
+("dispatch" ["S"])
+("dispense" ["t" "t"])
+("disperse" ["X"])
+("displace" ["m"])
+("display" ["C"])
+("displease" ["ϥͮ"])
+("displeasure" [""])
+("disposal" ["B"])
+("dispose" ["tm"])
+("disposition" ["NV"])
+("dispute" ["n"])
+("disregard" ["mץ~"])
+("dissect" ["ѭ"])
+("dissension" ["NX"])
+("dissolution" ["Ѱ"])
+("dissolve" ["" ""])
+("distance" ["Z"])
+("distant" [""])
+("distill" ["]H"])
+("distinct" ["P"])
+("distinction" ["V"])
+("distinctive" ["WS"])
+("distinctly" ["a"])
+("distinguish" ["ϧO"])
+("distort" ["ˬn"])
+("distract" ["`N"])
+("distress" ["Wo"])
+("distribute" ["o"])
+("distribution" ["o"])
+("district" ["a"])
+("distrust" ["H"])
+("disturb" ["Ͷ"])
+("disturbance" ["̰"])
+("ditch" [""])
+("dive" [""])
+("diverse" ["UU"])
+("diversity" ["h"])
+("divert" ["V"])
+("divide" [","])
+("dividend" ["Q"])
+("divine" ["t"])
+("divinity" [""])
+("division" ["" ""])
+("divorce" ["B"])
+("dizzy" ["Yw"])
+("do" [""])
+("dock" ["XY"])
+("doctor" ["v" "դh"])
+("doctrine" ["иq"])
+("document" [""])
+("dog" [""])
+("doll" [""])
+("dollar" [""])
+("dolly" ["v"])
+("domain" [""])
+("dome" ["γ"])
+("domestic" [""])
+("dominant" ["uժ"])
+("dominate" ["t"])
+("dominion" ["Dv"])
+("donate" [""])
+("donation" [""])
+("done" ["F"])
+("donkey" ["jl"])
+("doom" [""])
+("door" [""])
+("doorway" ["f"])
+("dormitory" ["J"])
+("dose" ["@A"])
+("dot" ["I"])
+("double" [""])
+("doubt" ["h"])
+("doubtful" ["iê"])
+("doubtless" ["Læa"])
+("dough" ["{"])
+("doughnut" ["o"])
+("dove" ["F"])
+("down" ["VU"])
+("downfall" ["S"])
+("downstairs" ["ӤU"])
+("downtown" ["x"])
+("downward" ["VU"])
+("dozen" ["@"])
+("draft" [""])
+("drag" [","])
+("dragonfly" ["f"])
+("drain" ["Ƥ"])
+("drainage" ["Ƥ"])
+("dramatic" ["@ʪ"])
+("drapery" ["b"])
+("drastic" ["EP"])
+("draw" ["" "ñg"])
+("drawer" ["P"])
+("drawing" ["ϵe"])
+("dread" ["D``"])
+("dreadful" ["iȪ"])
+("dream" [""])
+("dreary" ["ª"])
+("drench" ["z"])
+("dress" [""])
+("dressing" ["ը"])
+("dressmaker" ["k˵_v"])
+("drift" ["}"])
+("drill" ["Vm"])
+("drink" [","])
+("drip" ["wU"])
+("drive" ["r"])
+("driver" ["q"])
+("droop" ["U"])
+("drop" ["w"])
+("drought" [""])
+("drown" ["ϷĦ"])
+("drowsy" ["QΪ"])
+("drug" ["ī~"])
+("druggist" ["İ"])
+("drum" [""])
+("drunkard" ["s"])
+("dry" [""])
+("duchess" ["ҤH"])
+("duck" ["n"])
+("due" ["|O"])
+("duel" ["M"])
+("duke" [""])
+("dull" ["w"])
+("duly" ["Ma"])
+("dumb" ["ת"])
+("dump" ["߱"])
+("duplicate" ["ƥ"])
+("durable" ["@[O"])
+("duration" ["["])
+("during" ["bȴ"])
+("dusk" [""])
+("dusky" ["t"])
+("dust" ["ǹ"])
+("dusty" ["ЮJ"])
+("duty" ["d"])
+("dwarf" ["Gl"])
+("dwell" ["~"])
+("dwelling" ["J"])
+("dye" ["V"])
+("dying" [""])
+("dynamite" [""])
+("dynamo" ["oq"])
+("dynasty" [""])
+("each" ["C"])
+("eager" ["檺"])
+("eagle" ["N"])
+("ear" [""])
+("earl" ["B"])
+("early" [""])
+("earn" ["ȱo"])
+("earnest" ["{u"])
+("earning" ["J"])
+("earth" ["ay" "g["])
+("earthquake" ["a_"])
+("earthworm" ["LC"])
+("ease" ["y"])
+("easily" ["ea"])
+("east" ["F" "F"])
+("eastern" ["F誺"])
+("eastward" ["VF"])
+("easy" ["e"])
+("eat" ["Y"])
+("eaves" ["ò"])
+("ebb" ["h"])
+("ebony" ["Q"])
+("eccentric" ["jǪ"])
+("echo" ["^n"])
+("eclipse" ["k" "k"])
+("economic" ["gپǪ"])
+("economical" ["`"])
+("economics" ["gپ"])
+("economist" ["gپǮa"])
+("economy" ["g٨"])
+("ecstasy" ["g"])
+("eddy" ["x"])
+("edge" ["t"])
+("edifice" ["jH"])
+("edit" ["s"])
+("edition" [""])
+("editor" ["Ds"])
+("editorial" [""])
+("educate" ["|"])
+("education" ["Ш|"])
+("educational" ["Ш|"])
+("eel" [""])
+("effect" ["ĪG"])
+("effective" ["Ī"])
+("efficiency" ["Ĳv"])
+("efficient" ["Ī"])
+("effort" ["VO"])
+("egg" ["J"])
+("eight" ["K"])
+("eighteen" ["QK"])
+("eighteenth" ["ĤQK"])
+("eighth" ["ĤK"])
+("eightieth" ["ĤKQ"])
+("eighty" ["KQ"])
+("either" ["G̤@"])
+("elaborate" ["륩"])
+("elapse" ["uh"])
+("elastic" ["Pa"])
+("elbow" ["y"])
+("elder" ["e"])
+("elderly" ["Ѧ~"])
+("eldest" ["̦~"])
+("elect" [""])
+("election" ["|"])
+("elector" ["|v"])
+("electric" ["qO"])
+("electrical" ["q"])
+("electricity" ["q"])
+("electron" ["ql"])
+("elegance" ["" "u"])
+("elegant" [""])
+("element" [""])
+("elementary" ["򥻪"])
+("elephant" ["H"])
+("elevate" [""])
+("elevation" [""])
+("elevator" ["q"])
+("eleven" ["Q@"])
+("eleventh" ["ĤQ@"])
+("elf" ["pF"])
+("eliminate" ["^O" "h"])
+("elk" ["G"])
+("elm" [""])
+("eloquence" ["f~"])
+("eloquent" ["G"])
+("else" ["O"])
+("elsewhere" ["OB"])
+("embark" ["f"])
+("embarrass" ["ϧx~"])
+("embarrassment" ["x~"])
+("embassy" ["j]"])
+("ember" ["lu"])
+("emblem" ["Hx"])
+("embody" ["Ϩ"])
+("embrace" ["֩"])
+("embroider" ["¸"])
+("embroidery" ["¸~"])
+("emerald" ["BA"])
+("emerge" ["X{"])
+("emergency" ["ƥ"])
+("emigrant" [""])
+("eminence" ["WHh"])
+("eminent" ["DW"])
+("emit" ["oX"])
+("emotion" [""])
+("emotional" ["ƪ"])
+("emperor" ["ӫ"])
+("emphasis" ["j"])
+("emphasize" ["j"])
+("empire" ["Ұ"])
+("employee" [""])
+("employer" ["D"])
+("employment" ["¾~"])
+("empress" ["k"])
+("empty" ["Ū"])
+("emulator" ["v"])
+("enable" ["ϡȯ"])
+("enact" ["w" "t"])
+("enamel" ["e" ""])
+("encamp" [""])
+("enchant" ["۴b"])
+("enchantment" ["]k"])
+("encircle" ["¶"])
+("enclose" ["¶" "H"])
+("enclosure" ["" ""])
+("encounter" ["DJ"])
+("encourage" ["y"])
+("encyclopedia" ["ʬ"])
+("end" ["I"])
+("endeavor" ["VO"])
+("ending" [""])
+("endless" ["La"])
+("endow" ["U"])
+("endurance" ["@O"])
+("endure" ["["])
+("enemy" ["ĤH"])
+("energetic" ["O"])
+("energy" ["O"])
+("enforce" ["j"])
+("enforcement" ["j"])
+("engage" ["w"])
+("engagement" ["qB"])
+("engine" [""])
+("engineer" ["u{v"])
+("engineering" ["u{"])
+("england" ["^"])
+("english" ["^" "^H"])
+("engrave" ["n"])
+("enhance" [""])
+("enjoy" ["ɨ"])
+("enjoyment" ["ֽ"])
+("enlarge" ["XR"])
+("enlighten" ["ҵo"])
+("enlist" ["xl"])
+("enmity" ["ķN"])
+("enormous" ["j"])
+("enough" [""])
+("enrage" ["E"])
+("enrich" ["ϡ״I"])
+("enroll" ["nO"])
+("ensign" ["Xm"])
+("ensue" ["t_"])
+("entail" ["ɭP"])
+("enter" ["iJ"])
+("enterprise" ["~"])
+("entertain" ["ګ"])
+("entertainment" ["T"])
+("enthusiasm" [""])
+("enthusiastic" ["ժ"])
+("entice" ["b"])
+("entire" [""])
+("entirely" ["a"])
+("entitle" [""])
+("entrance" ["Jf"])
+("entreat" ["D"])
+("entreaty" ["D"])
+("entrust" ["I"])
+("entry" ["if"])
+("enumerate" ["C|"])
+("envelope" ["H"])
+("envious" ["r}"])
+("environment" [""])
+("envy" ["r}"])
+("epic" ["v"])
+("epidemic" ["yf"])
+("episcopal" ["DЪ"])
+("episode" [""])
+("epistle" ["ѫH"])
+("epitaph" ["ӻx"])
+("epoch" ["ɥN"])
+("equal" ["۵"])
+("equality" [""])
+("equally" ["۵a"])
+("equation" ["{"])
+("equator" ["D"])
+("equip" ["˸m"])
+("equipment" ["˳"])
+("equity" [""])
+("equivalent" ["۵"])
+("era" [""])
+("eraser" ["ַg"])
+("ere" ["["])
+("erect" ["ߪ"])
+("err" ["ǿ"])
+("errand" ["Xt"])
+("error" ["~"])
+("eruption" ["zo"])
+("escalator" ["۰ʼӱ"])
+("escape" ["k"])
+("escort" ["@e"])
+("especial" ["SO"])
+("esquire" ["kʴL"])
+("essay" ["פ"])
+("essence" [""])
+("essential" ["n"])
+("essentially" ["W"])
+("establish" ["]" "w"])
+("establishment" ["w" "]I"])
+("estate" ["a"])
+("esteem" ["L" "{"])
+("estimate" ["p"])
+("estimation" ["p"])
+("eternal" ["û"])
+("eternity" ["ë"])
+("ether" ["H"])
+("ethics" ["۲z"])
+("etiquette" ["§" "§`"])
+("etymology" ["y"])
+("europe" ["ڬw"])
+("european" ["ڬw"])
+("evade" ["W"])
+("evaporate" ["]o"])
+("evaporation" ["]o"])
+("eve" ["ei"])
+("even" [""])
+("evening" ["ı,"])
+("evenly" ["Ŧa"])
+("event" ["ƥ"])
+("eventual" ["̫᪺"])
+("eventually" ["ש"])
+("ever" ["g"])
+("evergreen" ["`"])
+("everlasting" ["ä["])
+("evermore" ["g`a"])
+("every" ["C,C@"])
+("everybody" ["CӤH"])
+("everyday" ["CѪ"])
+("everyone" ["CӤH"])
+("everything" ["@ƪ"])
+("everywhere" ["B"])
+("evidence" ["Ҿ"])
+("evident" ["㪺"])
+("evil" ["ca"])
+("evolution" ["i"])
+("evolve" ["XM"])
+("ewe" [""])
+("exact" ["K"])
+("exactly" ["n"])
+("exaggerate" ["ؤj"])
+("exaggeration" ["رi"])
+("exalt" ["°"])
+("examination" ["ˬd" "Ҹ"])
+("examine" ["ˬd"])
+("example" ["d"])
+("exasperate" ["ϫ"])
+("excavation" [""])
+("exceed" ["WL"])
+("exceeding" ["Lת"])
+("excel" ["ӹL"])
+("excellence" ["V"])
+("excellent" ["uq"])
+("except" ["F~"])
+("exception" ["ҥ~"])
+("exceptional" ["`"])
+("excess" ["Lq"])
+("excessive" ["Lת"])
+("exchange" [""])
+("excite" ["E_"])
+("excitement" [""])
+("exciting" ["ϿĪ"])
+("exclaim" ["I"])
+("exclamation" ["s"])
+("exclude" ["ư"])
+("exclusive" ["ߤ@"])
+("excursion" [""])
+("excuse" [""])
+("execute" ["i"])
+("execution" [""])
+("executive" ["DޤH"])
+("exempt" ["K"])
+("exercise" ["B,Vm"])
+("exert" ["ϹB"])
+("exertion" ["ɤO"])
+("exhaust" ["κ"])
+("exhaustion" ["ܺ"])
+("exhibit" ["o" "C"])
+("exhibition" ["i"])
+("exile" ["y"])
+("exist" ["sb"])
+("existence" ["sb"])
+("exit" ["Xf"])
+("expand" ["Ͽ"])
+("expanse" ["e"])
+("expansion" [""])
+("expect" ["w"])
+("expectation" [""])
+("expedient" ["o"])
+("expedition" [""])
+("expel" ["vX"])
+("expend" ["O"])
+("expenditure" ["}"])
+("expense" ["O"])
+("expensive" [""])
+("experience" ["g"])
+("experienced" ["g窺"])
+("experiment" [""])
+("experimental" ["ʪ"])
+("expert" ["Ma"])
+("expire" ["" ""])
+("explain" [""])
+("explanation" [""])
+("explode" ["z"])
+("exploit" ["Z"])
+("exploration" ["I"])
+("explore" ["I"])
+("explorer" ["I"])
+("explosion" ["zo"])
+("explosive" ["zo"])
+("export" ["X" "Xf"])
+("expose" ["nS" "SX"])
+("exposition" ["i|"])
+("exposure" ["nS"])
+("express" ["F"])
+("expression" [""])
+("exquisite" [""])
+("extend" ["X" ""])
+("extension" ["i" ""])
+("extensive" ["sժ"])
+("extent" ["{" ""])
+("exterior" ["~"])
+("external" ["~Ϊ"])
+("extinct" ["w"])
+("extinguish" [""])
+("extra" ["B~"])
+("extract" ["ޥX" "X"])
+("extraordinary" ["D`"])
+("extravagance" ["NL"])
+("extravagant" ["NLת"])
+("extreme" ["ݪ"])
+("extremely" ["ݦa"])
+("extremity" [""])
+("exultation" ["j"])
+("eye" [""])
+("eyebrow" ["ܤ"])
+("eyelid" [""])
+("fable" ["J"])
+("fabric" ["´~"])
+("fabulous" ["n"])
+("face" ["y"])
+("facilitate" ["Ϯe"])
+("facility" ["]"])
+("fact" ["ƹ"])
+("faction" ["t"])
+("factor" ["n" "]l"])
+("factory" ["ut"])
+("faculty" ["~,б"])
+("fade" ["Ʀ"])
+("fail" ["ή"])
+("failure" [""])
+("faint" ["ҽk"])
+("fair" ["M"])
+("fairy" ["Pk"])
+("fairyland" ["P"])
+("faith" ["H"])
+("faithful" ["ꪺ"])
+("falcon" ["N"])
+("fall" ["U"])
+("false" ["~"])
+("falsehood" ["갰"])
+("falter" ["n"])
+("fame" ["nA"])
+("familiar" ["x"])
+("familiarity" ["x"])
+("family" ["ax"])
+("famine" [""])
+("famous" ["XW"])
+("fan" ["l"])
+("fancy" ["N"])
+("fantastic" ["_"])
+("far" [""])
+("fare" ["BO"])
+("farewell" ["eO"])
+("farm" ["A" ""])
+("farmer" ["AH"])
+("farmhouse" ["A"])
+("farmyard" ["Aax|"])
+("faroff" [""])
+("farther" ["󻷪"])
+("farthest" ["̻"])
+("fascinate" ["g"])
+("fascination" ["yO"])
+("fashion" ["y" "ɩ|"])
+("fashionable" ["y檺"])
+("fast" ["ֳt"])
+("fasten" ["j"])
+("fat" ["έD"])
+("fatal" [""])
+("fate" ["RB"])
+("father" [""])
+("fathom" ["@"])
+("fatigue" ["h"])
+("fault" ["L" "I"])
+("favor" ["R"])
+("favorable" ["ų\"])
+("favorite" ["̳߷R"])
+("fawn" ["^"])
+("fear" ["`"])
+("fearful" ["iȪ"])
+("fearless" ["Ȫ"])
+("feast" ["b" "`"])
+("feat" ["\Z"])
+("feather" ["Ф"])
+("feature" ["Sx" "Sg"])
+("february" ["G"])
+("federal" ["p"])
+("federation" ["p"])
+("fee" ["O"])
+("feeble" ["Iz"])
+("feebly" ["Iza"])
+("feed" ["}i"])
+("feeder" ["}i"])
+("feel" ["Pı"])
+("feeling" ["Pı" "߱"])
+("feign" [""])
+("fellow" ["P"])
+("fellowship" ["ͽ"])
+("felt" ["Pı" ""])
+("female" ["۩"])
+("feminine" ["ʪ"])
+("fence" ["X"])
+("fencing" ["CN"])
+("ferment" ["o" "C"])
+("fern" [""])
+("ferry" ["f"])
+("fertile" ["ΨU"])
+("fertility" ["ʹޤO"])
+("fertilize" ["I"])
+("fertilizer" ["ή"])
+("fervor" [""])
+("festival" ["`y"])
+("fetch" ["" ""])
+("fetter" ["}"])
+("feud" ["@"])
+("feudal" ["ʫت"])
+("fever" ["oN"])
+("feverish" ["oN"])
+("few" ["ּƪ"])
+("fickle" ["hܪ"])
+("fiction" ["cp"])
+("fiddle" ["p^"])
+("fidelity" [""])
+("field" ["г" "Գ"])
+("fiend" ["c]"])
+("fierce" ["r"])
+("fiery" ["p"])
+("fifteen" ["Q"])
+("fifteenth" ["ĤQ"])
+("fifth" ["Ĥ"])
+("fiftieth" ["ĤQ"])
+("fifty" ["Q"])
+("fig" ["LG"])
+("fight" ["" "M"])
+("fighter" ["԰"])
+("fighting" ["Ԩ"])
+("figure" ["~" "Ʀr"])
+("filament" [""])
+("file" ["ɮ"])
+("fill" ["R"])
+("film" [""])
+("filter" ["L"])
+("filthy" ["ż"])
+("fin" ["_"])
+("final" ["̫᪺"])
+("finally" ["̫a"])
+("finance" ["]F"])
+("financial" ["]F"])
+("find" ["" "o{"])
+("finding" ["o{"])
+("fine" [""])
+("finger" [""])
+("finish" [""])
+("fir" ["׾"])
+("fire" [""])
+("firefly" ["ä"])
+("fireman" [""])
+("fireplace" ["l"])
+("fireside" ["l"])
+("firework" ["Ϥ"])
+("firm" ["q" "T"])
+("firmament" ["a"])
+("firmly" ["T"])
+("firmness" ["T"])
+("first" ["Ĥ@"])
+("first-class" ["Ĥ@y"])
+("fiscal" ["]F"])
+("fish" [""])
+("fisher" [""])
+("fisherman" [""])
+("fist" ["Y"])
+("fit" ["XA"])
+("fitness" ["AX"])
+("five" [""])
+("fix" ["w" "ײz"])
+("fixed" ["Tw"])
+("fixture" ["˸m"])
+("flag" ["Xm"])
+("flake" [""])
+("flame" ["K"])
+("flaming" ["UN"])
+("flank" [""])
+("flannel" [""])
+("flap" ["祴"])
+("flare" ["{G"])
+("flash" ["{"])
+("flask" ["V~"])
+("flat" ["Z"])
+("flatten" ["˥" ""])
+("flatter" ["^"])
+("flatterer" ["^Ӫ"])
+("flattery" ["A"])
+("flavor" ["D"])
+("flaw" [""])
+("flax" ["ȳ"])
+("flea" ["D"])
+("flee" ["k"])
+("fleece" ["Ϥ"])
+("fleet" ["ĥ"])
+("flesh" [""])
+("flexible" ["uʪ"])
+("flicker" ["{{"])
+("flight" ["{"])
+("fling" ["" ""])
+("flirt" ["ձ"])
+("flit" ["L"])
+("float" ["}B"])
+("flock" ["s"])
+("flood" ["x"])
+("floor" ["aO"])
+("flop" ["" ""])
+("flora" ["Ӫs"])
+("flounder" ["س"])
+("flour" ["ѯ"])
+("flourish" [""])
+("flow" ["y"])
+("flower" [""])
+("flowery" ["p᪺"])
+("fluffy" ["P"])
+("fluid" ["y骺"])
+("flush" ["o" "TS"])
+("flute" [""])
+("flutter" ["\"])
+("fly" [""])
+("flying" ["檺"])
+("foam" ["wj"])
+("focus" ["JI"])
+("fodder" [""])
+("foe" ["ĤH"])
+("fog" [""])
+("foggy" ["Uk"])
+("foil" [""])
+("fold" ["P|"])
+("foliage" ["l"])
+("folk" ["aH"])
+("follow" ["q"])
+("follower" ["H{"])
+("following" ["UC"])
+("folly" [""])
+("fond" ["߷R"])
+("fondness" ["ݦn"])
+("food" [""])
+("fool" ["bl"])
+("foolish" ["i"])
+("foot" ["}"])
+("football" ["Vy"])
+("footing" ["`b"])
+("footstep" ["}B"])
+("for" ["F"])
+("forage" ["}"])
+("forbear" ["e"])
+("forbid" ["T"])
+("forbidden" ["QT"])
+("force" ["O"])
+("forcibly" ["ja"])
+("ford" ["AL"])
+("fore" ["e"])
+("forecast" ["w"])
+("forefather" [""])
+("forefinger" [""])
+("forehead" ["eB"])
+("foreign" ["~ꪺ"])
+("foreigner" ["~H"])
+("foreman" ["uY"])
+("foremost" ["̪쪺"])
+("foresee" ["w"])
+("foresight" [""])
+("forest" ["˪L"])
+("foretell" ["w"])
+("forever" ["ûa"])
+("forfeit" ["QS"])
+("forge" ["s"])
+("forget" ["ѰO"])
+("forgive" [""])
+("forgiveness" ["Ǯ"])
+("fork" ["e"])
+("forlorn" ["檺"])
+("form" ["Ϊ" ""])
+("formal" [""])
+("formality" [""])
+("formally" ["a"])
+("formation" ["Φ"])
+("former" ["He"])
+("formerly" ["qe"])
+("formidable" ["i"])
+("formula" [""])
+("formulate" ["ΧΦ"])
+("forsake" [""])
+("fort" ["S"])
+("forth" ["Ve"])
+("forthwith" ["ߨ"])
+("fortification" ["v"])
+("fortify" ["[j"])
+("fortitude" ["Ԥ"])
+("fortnight" ["P"])
+("fortress" [""])
+("fortunate" ["B"])
+("fortune" ["RB"])
+("forty" ["|Q"])
+("forum" ["}Q׷|"])
+("forward" ["be"])
+("fossil" ["ƥ"])
+("foster" ["i|"])
+("foul" ["ǳW"])
+("found" ["Х"])
+("foundation" ["¦"])
+("founder" ["Хߪ"])
+("fountain" ["Qu"])
+("four" ["|"])
+("fourteen" ["Q|"])
+("fourth" ["ĥ|"])
+("fowl" ["V"])
+("fox" [""])
+("fraction" [""])
+("fracture" ["}"])
+("fragile" ["H"])
+("fragment" ["H"])
+("fragrance" ["⭻"])
+("fragrant" ["⭻"])
+("frail" ["ܮz"])
+("frailty" ["ܮz"])
+("frame" ["۬["])
+("framework" ["["])
+("franc" ["k"])
+("france" ["k"])
+("frank" ["v"])
+("frankness" ["Z"])
+("frantic" ["gɪ"])
+("fraternity" ["S̷|"])
+("fraud" ["F"])
+("freak" ["ǽϪ"])
+("freckle" [""])
+("free" ["ۥ"])
+("freedom" ["ۥ"])
+("freely" ["HKa"])
+("freeze" ["ᵲ"])
+("freight" ["fB"])
+("frequent" ["g`"])
+("fresh" ["sA"])
+("freshness" ["sA"])
+("friction" [""])
+("friday" ["P"])
+("friend" ["B"])
+("friendliness" ["ˤ"])
+("friendly" ["ͦn"])
+("friendship" ["ͽ"])
+("fright" ["b"])
+("frighten" ["b"])
+("frightful" ["iȪ"])
+("fringe" ["t"])
+("frog" ["C"])
+("from" ["q"])
+("front" ["e"])
+("frontier" [""])
+("frost" [""])
+("frosty" ["ժ"])
+("frown" ["TܭWy"])
+("frozen" ["ᵲ"])
+("frugal" ["`"])
+("fruit" ["G"])
+("fruitful" ["qh"])
+("fruitless" ["G"])
+("frustrate" [""])
+("fry" ["Ϊo"])
+("fuel" ["U"])
+("fugitive" ["k`"])
+("fulfil" [""])
+("full" [""])
+("fullness" ["R"])
+("fully" ["a"])
+("fume" [""])
+("fun" ["A"])
+("function" [""])
+("fund" [""])
+("fundamental" ["򥻪"])
+("funeral" ["§"])
+("fungus" [""])
+("funnel" ["|"])
+("funny" ["쪺"])
+("fur" ["n"])
+("furious" ["g㪺"])
+("furnace" ["ql"])
+("furnish" ["ѵ"])
+("furniture" ["a"])
+("furrow" [""])
+("further" [""])
+("furthermore" ["ӥB"])
+("furthest" ["̻"])
+("fury" ["E"])
+("fuse" ["OI"])
+("fusion" [""])
+("fuss" ["jp"])
+("futile" ["{Ҫ"])
+("future" [""])
+("gaiety" ["w"])
+("gain" ["o"])
+("gait" ["B"])
+("gale" ["j"])
+("gall" ["x"])
+("gallant" ["^i"])
+("gallery" ["eY"])
+("gallon" ["[["])
+("gallop" ["e"])
+("gamble" [""])
+("game" ["C"])
+("gang" ["@s"])
+("gangster" ["{"])
+("gap" ["j"])
+("garage" ["w"])
+("garden" [""])
+("gardener" ["B"])
+("gardening" [""])
+("garland" [""])
+("garment" [""])
+("garter" ["a"])
+("gas" ["˴,To"])
+("gaseous" ["骺"])
+("gasoline" ["To"])
+("gasp" ["ݮ"])
+("gate" ["h"])
+("gateway" ["XJf"])
+("gather" ["X"])
+("gathering" ["E"])
+("gauge" ["зǤؤo"])
+("gauze" [""])
+("gay" ["֬"])
+("gaze" [""])
+("gear" [""])
+("gem" ["_"])
+("gender" ["ʧO"])
+("general" ["Nx" "q`"])
+("generate" [""])
+("generation" ["@N"])
+("generosity" ["Bn"])
+("generous" ["lej"])
+("genial" ["Mħ"])
+("genius" ["Ѥ~"])
+("gentle" ["嶮"])
+("gentleman" ["Ԥh"])
+("gentleness" ["ũM~"])
+("gently" ["a"])
+("gentry" ["Wy"])
+("genuine" ["¥"])
+("geographical" ["az"])
+("geography" ["az"])
+("geology" ["a"])
+("geometry" ["X"])
+("germ" ["ӵ"])
+("germany" ["w"])
+("germinate" ["o"])
+("gerund" ["ʦW"])
+("gesture" [""])
+("get" ["o"])
+("ghastly" ["ƪ"])
+("ghost" [""])
+("giant" ["H"])
+("giddy" ["wt"])
+("gift" ["§" "ѽ"])
+("gifted" ["Ѥ~"])
+("gigantic" ["ej"])
+("giggle" ["毺"])
+("gild" [""])
+("gill" ["|" "l"])
+("gilt" [""])
+("gin" ["Qls"])
+("ginger" [""])
+("gingerbread" [""])
+("gingham" ["l֥"])
+("giraffe" ["V"])
+("gird" ["" ""])
+("girdle" ["y"])
+("girl" ["k"])
+("give" ["" ""])
+("giver" ["ػP"])
+("glacier" ["Be"])
+("glad" [""])
+("glade" ["hA"])
+("gladness" ["w"])
+("glamour" ["yO"])
+("glance" ["@h"])
+("gland" [""])
+("glare" ["j"])
+("glass" [""])
+("glaze" ["ˬ"])
+("gleam" ["@uL"])
+("glean" [""])
+("glee" ["w"])
+("glen" ["U"])
+("glide" ["Ƶ"])
+("glider" ["Ƶ"])
+("glimmer" ["L"])
+("glimpse" ["@h"])
+("glint" ["{ģ"])
+("glisten" ["{G"])
+("glitter" [""])
+("globe" ["y"])
+("gloom" ["շt"])
+("gloomy" ["{"])
+("glorify" ["[aģ"])
+("glorious" ["a"])
+("glory" ["a"])
+("glossy" ["ƪ"])
+("glove" ["M"])
+("glow" ["K"])
+("glue" [""])
+("gnat" [""])
+("gnaw" ["jr"])
+("go" ["h"])
+("goal" ["ؼ"])
+("goat" ["s"])
+("gobble" ["jY"])
+("goblet" ["}M"])
+("goblin" ["p"])
+("goddess" ["k"])
+("godfather" ["Ф"])
+("godmother" ["Х"])
+("going" ["}"])
+("gold" [""])
+("golden" ["⪺"])
+("goldfish" [""])
+("goldsmith" ["K"])
+("golf" ["Ҳy"])
+("gone" ["Lh"])
+("good" ["}n"])
+("goodbye" ["A"])
+("goodlooking" [""])
+("goodly" ["n"])
+("goodnatured" ["M"])
+("goodness" ["w"])
+("goods" ["f"])
+("goodwill" ["˵"])
+("goose" ["Z"])
+("gore" [""])
+("gorge" ["U"])
+("gorgeous" ["R"])
+("gospel" ["֭"])
+("gossip" [""])
+("govern" ["vz"])
+("government" ["F"])
+("governor" ["{"])
+("gown" ["T"])
+("grab" [""])
+("grace" ["u"])
+("graceful" ["u"])
+("gracious" ["ˤ"])
+("grade" ["~"])
+("gradual" ["v"])
+("graduate" ["~"])
+("graduation" ["~§"])
+("graft" ["K"])
+("grain" ["\"])
+("gram" ["J" ""])
+("grammar" ["k"])
+("gramophone" ["dn"])
+("grand" [""])
+("grandeur" ["Q"])
+("grandfather" [""])
+("grandma" [""])
+("grandmother" [""])
+("grandpa" ["ݷ"])
+("grandson" ["]l"])
+("granite" ["^"])
+("granny" [""])
+("grant" ["\"])
+("grape" [""])
+("grasp" [""])
+("grass" ["C"])
+("grasshopper" ["Kg"])
+("grassy" ["p"])
+("grate" ["l["])
+("grateful" ["Pª"])
+("gratify" ["ϡȰ"])
+("gratitude" ["P"])
+("grave" ["J"])
+("gravel" ["H"])
+("gravely" ["H۪"])
+("gravitation" ["aߧlO"])
+("gravity" ["UޤO"])
+("gravy" ["ըץ"])
+("gray" ["Ǧ"])
+("graze" [""])
+("grease" ["o"])
+("great" ["j"])
+("greatness" ["j"])
+("greedy" ["gߪ"])
+("green" ["⪺"])
+("greet" ["Pq" "ﱵ"])
+("greeting" ["ݭ"])
+("greyhound" ["y"])
+("grief" ["dh"])
+("grievance" ["W"])
+("grieve" ["ˤ"])
+("grievous" ["d˪"])
+("grim" ["NŪ"])
+("grin" ["Sӯ"])
+("grind" ["iH"])
+("grip" [""])
+("grit" ["ʬ"])
+("grizzly" ["Ǧ⪺"])
+("groan" ["Du"])
+("grocer" ["f"])
+("grocery" ["f"])
+("groom" [""])
+("groove" ["" "D"])
+("grope" ["N"])
+("gross" ["`"])
+("grotesque" ["jǪ"])
+("ground" ["a"])
+("group" [""])
+("grouse" ["Q"])
+("grove" ["pL"])
+("grow" ["ͪ"])
+("growl" ["H"])
+("growth" [""])
+("grub" ["I"])
+("grudge" [""])
+("gruff" ["W"])
+("grumble" ["DW"])
+("grunt" ["BP"])
+("guarantee" ["OH"])
+("guaranty" ["O"])
+("guard" ["ĵ"])
+("guardian" ["@H"])
+("guess" ["q"])
+("guest" ["ȤH"])
+("guidance" [""])
+("guide" ["޾"])
+("guild" ["|"])
+("guilt" ["o"])
+("guilty" ["o"])
+("guitar" ["NL"])
+("gulf" ["W"])
+("gulp" [""])
+("gum" [""])
+("gun" ["j"])
+("gunner" [""])
+("gunpowder" [""])
+("gust" ["}"])
+("gutter" ["Ƥ"])
+("guy" ["å"])
+("gym" ["|]"])
+("gymnasium" ["|]"])
+("gymnastic" ["ު"])
+("gymnastics" [""])
+("gypsy" ["NɤH"])
+("habit" ["ߺD"])
+("habitation" [""])
+("habitual" ["ߺD"])
+("hack" ["A"])
+("hail" ["wI"])
+("hair" ["" "Yv"])
+("hairy" [""])
+("half" ["@b"])
+("halfway" ["b~"])
+("hall" ["jU"])
+("hallow" ["t"])
+("halt" [""])
+("ham" ["L"])
+("hammer" [""])
+("hammock" ["Q"])
+("hamper" ["ê"])
+("hand" [""])
+("handful" [""])
+("handkerchief" ["⩬"])
+("handle" [""])
+("handsome" ["^T"])
+("handy" ["F"])
+("hang" ["a"])
+("happen" ["o"])
+("happening" ["ƥ"])
+("happily" ["ּ֦a"])
+("happiness" [""])
+("happy" ["ּ"])
+("harass" ["ϧxZ"])
+("harbor" ["s"])
+("hard" ["T" "w"])
+("harden" ["ϵw"])
+("hardly" ["XG"])
+("hardness" ["w"])
+("hardship" ["x"])
+("hardware" ["K"])
+("hare" [""])
+("hark" ["ť"])
+("harm" ["ˮ`"])
+("harmful" ["`"])
+("harmless" ["L`"])
+("harmonious" ["թM"])
+("harmony" ["թM"])
+("harness" [""])
+("harp" ["ݵ^"])
+("harrow" [""])
+("harry" [""])
+("harsh" ["V"])
+("hart" ["d"])
+("harvest" [""])
+("has" [""])
+("hasn't" ["S"])
+("haste" ["^"])
+("hasten" ["Pi"])
+("hastily" ["^a"])
+("hasty" ["榣"])
+("hat" ["Ul"])
+("hatch" [""])
+("hatchet" ["Y"])
+("hate" [""])
+("hateful" ["i몺"])
+("hatred" [""])
+("haughty" ["źƪ"])
+("haul" [""])
+("haunt" ["XS"])
+("have" [""])
+("havoc" ["}a"])
+("hawk" ["N"])
+("hay" [""])
+("hazard" ["_I"])
+("haze" [""])
+("hazel" ["d"])
+("he" ["L"])
+("head" ["Y"])
+("headache" ["Yh"])
+("headlight" ["eO"])
+("headline" ["D"])
+("headlong" ["YVe"])
+("headquarters" ["`"])
+("heal" ["_"])
+("health" ["d"])
+("healthful" ["åͪ"])
+("healthy" ["d"])
+("heap" ["" "jq"])
+("hear" ["ť"])
+("hearer" ["ť"])
+("hearing" ["ťO"])
+("heart" [""])
+("hearth" ["l"])
+("hearty" [""])
+("heat" ["O"])
+("heater" ["x"])
+("heath" ["۫n"])
+("heathen" ["Ю{"])
+("heather" ["۫n"])
+("heave" ["|_"])
+("heaven" ["Ѱ"])
+("heavenly" ["Ѱ"])
+("heavy" ["H"])
+("hebrew" ["SӤH"])
+("hectogram" [""])
+("hectoliter" [""])
+("hectometer" [""])
+("hedge" ["X"])
+("heed" ["`N"])
+("heedless" ["pߪ"])
+("heel" ["}"])
+("heifer" ["pɤ"])
+("height" [""])
+("heighten" ["W"])
+("heir" ["~H"])
+("hell" ["a"])
+("hello" ["o"])
+("helm" [""])
+("helmet" [""])
+("help" [""])
+("helper" ["U"])
+("helpful" ["U"])
+("helpless" ["LU"])
+("hem" ["A_"])
+("hemisphere" ["by"])
+("hemlock" ["rW"])
+("hemp" ["j"])
+("hen" [""])
+("hence" ["]"])
+("henceforth" ["qH"])
+("her" ["o"])
+("herald" ["W"])
+("herb" [""])
+("herd" ["s"])
+("here" ["o"])
+("hereafter" [""])
+("hereby" ["S"])
+("hereditary" ["Ǫ"])
+("herein" ["bB"])
+("heresy" [""])
+("heretic" ["Ю{"])
+("heretofore" ["ɥHe"])
+("heritage" [""])
+("hermit" ["h"])
+("hero" ["^"])
+("heroic" ["^"])
+("heroine" ["k^"])
+("heroism" ["^i欰"])
+("heron" ["aO"])
+("herring" ["C"])
+("hers" ["o"])
+("herself" ["oۤv"])
+("hesitate" [""])
+("hesitation" ["ü{"])
+("hew" [""])
+("hey" [""])
+("hickory" ["sJ"])
+("hide" [""])
+("hideous" ["iȪ"])
+("high" [""])
+("highland" ["a"])
+("highly" ["צa"])
+("highness" ["צa"])
+("highway" ["t"])
+("hike" [""])
+("hiking" ["{BȦ"])
+("hill" ["pC"])
+("hillside" ["sY"])
+("hilltop" ["s"])
+("him" ["L"])
+("himself" ["Lۤv"])
+("hind" ["䪺"])
+("hinder" [""])
+("hinge" [""])
+("hint" ["t"])
+("hip" ["v"])
+("hire" [""])
+("his" ["L"])
+("hiss" ["RRn"])
+("historian" ["vǮa"])
+("historic" ["vʪ"])
+("historical" ["vW"])
+("history" ["v"])
+("hit" [""])
+("hitch" ["C"])
+("hither" ["즹B"])
+("hitherto" ["ܤ"])
+("hive" [""])
+("ho" ["~n"])
+("hoard" ["yn"])
+("hoarse" ["Rn"])
+("hobby" ["ݦn"])
+("hockey" ["Ҳy"])
+("hoe" ["SY"])
+("hog" [""])
+("hoist" ["ɰ_"])
+("hold" [""])
+("holder" ["H"])
+("hole" ["}"])
+("holiday" [""])
+("hollow" ["Ū"])
+("holly" ["VC"])
+("holy" ["t"])
+("homage" ["ĩ"])
+("home" ["a"])
+("homely" ["a`"])
+("homemade" ["ۻs"])
+("homesick" ["Qa"])
+("homestead" ["a"])
+("homeward" ["^a"])
+("homework" ["ax@~"])
+("honest" ["۹ꪺ"])
+("honestly" ["Zժ"])
+("honesty" ["۹"])
+("honey" ["e" "RH"])
+("honeycomb" [""])
+("honeymoon" ["e밲"])
+("honeysuckle" ["Ȫ"])
+("honor" ["aA"])
+("honourable" ["۹ꪺ"])
+("hood" ["´U"])
+("hoof" [""])
+("hook" ["_l"])
+("hoop" ["骬"])
+("hoot" ["s" "s"])
+("hop" ["D"])
+("hope" ["Ʊ"])
+("hopeful" ["Ʊ檺"])
+("hopeless" ["檺"])
+("hopely" ["Ʊa"])
+("horde" ["s"])
+("horizon" ["au"])
+("horizontal" [""])
+("horn" ["Q"])
+("horrible" ["iȪ"])
+("horribly" ["iȦa"])
+("horrid" ["Qa"])
+("horrify" ["~"])
+("horror" [""])
+("horse" [""])
+("horseback" ["I"])
+("horseman" ["Mv"])
+("horsepower" ["O"])
+("horseshoe" ["K"])
+("hose" [""])
+("hospital" ["|"])
+("hospitality" ["ˤ"])
+("hostess" ["kDH"])
+("hostile" ["hķN"])
+("hostility" ["ķN"])
+("hot" [""])
+("hotel" ["]"])
+("hound" ["y"])
+("hour" ["@p"])
+("house" ["Τl"])
+("household" ["a"])
+("housekeeper" ["kޮa"])
+("housekeeping" ["aF"])
+("housewife" ["D"])
+("housework" ["a"])
+("hover" ["r"])
+("how" [""])
+("however" ["M"])
+("howl" ["gp"])
+("hue" [""])
+("hug" [""])
+("huge" ["j"])
+("hum" ["n"])
+("human" ["H" "H"])
+("humane" ["H"])
+("humanism" ["HDDq"])
+("humanity" ["HD"])
+("humble" [""])
+("humiliate" ["۰d"])
+("humiliation" ["y"])
+("humility" [""])
+("humor" ["q"])
+("humorous" ["q"])
+("hundred" ["@"])
+("hunger" ["j"])
+("hungry" ["j"])
+("hunt" ["y"])
+("hunter" ["yH"])
+("hurricane" ["䭷"])
+("hurried" ["ܫP"])
+("hurry" ["榣"])
+("hurt" ["Ϩ"])
+("husband" ["V"])
+("hut" ["T"])
+("hybrid" ["V"])
+("hydrogen" ["B"])
+("hygiene" ["å"])
+("hymn" ["tq"])
+("hyphen" ["srŸ"])
+("hypocrisy" [""])
+("hypocrite" [""])
+("hysterical" ["gê"])
+("ice" ["B" "cream" "BNO"])
+("iceberg" ["Bs"])
+("icy" ["B"])
+("idea" ["DN"])
+("identical" ["P"])
+("identify" ["T{"])
+("idiom" ["y"])
+("idiot" ["è"])
+("idle" ["ik"])
+("idleness" ["k"])
+("idol" [""])
+("if" ["pG"])
+("ignorance" ["L"])
+("ignorant" ["MN"])
+("ignore" [""])
+("ill" ["ͯf"])
+("illegal" ["Xk"])
+("illness" ["ef"])
+("illuminate" [""])
+("illumination" ["G"])
+("illusion" ["۶H"])
+("illustrate" ["ϸѻ"])
+("illustration" [""])
+("illustrator" ["eϪ"])
+("illustrious" ["ǥX"])
+("image" ["ι"])
+("imaginary" ["c"])
+("imagination" ["Q"])
+("imaginative" ["IQ"])
+("imagine" ["Q"])
+("imitate" ["ҭ"])
+("imitation" [""])
+("immediate" ["ߨ誺"])
+("immediately" ["Ya"])
+("immemorial" ["ӥj"])
+("immense" ["L"])
+("immigrant" [""])
+("immigration" ["E~"])
+("imminent" ["YN{"])
+("immortal" [""])
+("immortality" [""])
+("impair" ["l`"])
+("impart" ["Ǳ"])
+("impartial" [""])
+("impatience" ["@"])
+("impatient" ["@Ъ"])
+("impel" ["i"])
+("imperative" ["n"])
+("imperfect" [""])
+("imperial" ["Ұꪺ"])
+("imperious" ["ƺC"])
+("impetuous" ["b˪"])
+("implement" [""])
+("implore" ["sD"])
+("imply" ["t"])
+("import" ["if"])
+("importance" ["n"])
+("important" ["n"])
+("impose" ["[ȩ"])
+("imposing" ["Ӫ"])
+("impossibility" ["i઺"])
+("impossible" ["i઺"])
+("impress" ["L`"])
+("impression" ["L"])
+("impressive" ["Ѫ"])
+("imprison" ["U"])
+("imprisonment" ["c"])
+("improper" ["XA"])
+("improve" ["}"])
+("improvement" ["ﵽ"])
+("impulse" ["ĤO"])
+("in" ["bȤ"])
+("inability" ["L"])
+("inactive" ["y"])
+("inadequate" ["A"])
+("inasmuch" ["]ȤG"])
+("inaugurate" ["N"])
+("incapable" ["L઺"])
+("incense" [""])
+("incentive" ["ʾ"])
+("incessant" [""])
+("inch" ["T"])
+("incident" ["ƥ"])
+("incidentally" ["Ma"])
+("inclination" ["ɦV"])
+("incline" ["ɱ"])
+("inclose" ["ʤJ"])
+("include" ["]t"])
+("income" ["J"])
+("inconvenience" ["K"])
+("inconvenient" ["K"])
+("incorporate" ["զq"])
+("increase" ["W["])
+("increasingly" ["va"])
+("incredible" ["HmH"])
+("incur" ["ް_"])
+("indebted" ["t"])
+("indeed" ["T"])
+("indefinite" ["T"])
+("independence" ["W"])
+("independent" ["Wߪ"])
+("index" [""])
+("indicate" [""])
+("indication" [""])
+("indicative" ["ܪ"])
+("indictment" ["_D"])
+("indifference" [""])
+("indifferent" ["Ln"])
+("indignant" [""])
+("indignation" [""])
+("indigo" ["QC"])
+("indirect" [""])
+("indispensable" ["iʤ֪"])
+("individual" ["ӧO"])
+("individuality" ["ө"])
+("indoor" ["Ǥ"])
+("indoors" ["bǤ"])
+("induce" ["ް_"])
+("indulge" [""])
+("indulgence" ["ݦn"])
+("industrial" ["u~"])
+("industrious" ["ԫj"])
+("industry" ["u~"])
+("inert" ["LͩR"])
+("inevitable" ["M"])
+("inexpensive" ["G"])
+("inexperience" ["Sg"])
+("infancy" [""])
+("infant" [""])
+("infantry" ["BL"])
+("infect" ["ǬV"])
+("infection" ["ǬV"])
+("infer" [""])
+("inference" ["_"])
+("inferior" ["C"])
+("infernal" ["a"])
+("infest" ["Z"])
+("infinite" ["L"])
+("infinitive" ["w"])
+("inflame" ["E_"])
+("inflation" ["qf"])
+("inflict" ["[H"])
+("influence" ["vT"])
+("influential" ["vT"])
+("influenza" ["yʷP_"])
+("inform" ["q"])
+("informal" ["D"])
+("information" ["" ""])
+("ingenious" ["гyO"])
+("ingenuity" ["гyO"])
+("ingredient" [""])
+("inhabit" ["~"])
+("inhabitant" ["~"])
+("inherit" ["~"])
+("inheritance" ["~v"])
+("inheritress" ["k~ӤH"])
+("initial" ["̪쪺"])
+("initiative" ["B"])
+("injunction" ["RO"])
+("injure" ["ˮ`"])
+("injurious" ["`"])
+("injury" [""])
+("injustice" [""])
+("ink" [""])
+("inkstand" ["~["])
+("inland" ["a"])
+("inlet" ["Jf"])
+("inmate" ["Ǥ"])
+("inn" ["]"])
+("inner" ["b"])
+("inning" ["@"])
+("innocence" ["Ld"])
+("innocent" ["Ld"])
+("innumerable" ["Lƪ"])
+("inquire" ["߰" "լd"])
+("inquiry" ["߰" "d"])
+("inquisitive" ["n_"])
+("insane" ["믫f"])
+("insanity" ["믫"])
+("inscribe" ["g"])
+("inscription" ["Dr"])
+("insect" [""])
+("insensible" ["Sı"])
+("inseparable" ["i"])
+("insert" ["J"])
+("inside" [""])
+("insight" [""])
+("insignificant" ["Ln"])
+("insist" [""])
+("insolent" ["ʳ"])
+("inspect" ["ˬd"])
+("inspection" ["լd"])
+("inspector" ["ˬd"])
+("inspiration" ["FP"])
+("inspire" ["Eo"])
+("install" ["w"])
+("installation" ["˸m"])
+("installment" ["I"])
+("instance" [""])
+("instant" ["Y"])
+("instantly" ["Ya"])
+("instead" ["N"])
+("instinct" [""])
+("instinctive" ["ı"])
+("institute" ["s"])
+("institution" [""])
+("instruct" ["о"])
+("instruction" [""])
+("instructive" ["Ш|"])
+("instructor" ["v"])
+("instrument" [""])
+("insufficient" [""])
+("insult" ["Vd"])
+("insurance" ["OI"])
+("insure" ["OI"])
+("intellect" ["ѥl"])
+("intellectual" ["O"])
+("intelligence" [""])
+("intelligent" ["ప"])
+("intend" [""])
+("intense" ["i"])
+("intensity" ["j"])
+("intent" ["N"])
+("intention" ["N"])
+("intently" ["@ߤ@N"])
+("intercept" ["I"])
+("interchange" [""])
+("intercourse" ["汵"])
+("interest" ["P"])
+("interested" ["쪺"])
+("interesting" ["쪺"])
+("interfere" ["ê"])
+("interference" ["zZ"])
+("interior" ["b"])
+("interjection" ["Pĵ"])
+("intermediate" [""])
+("internal" ["b"])
+("international" ["ڪ"])
+("interpret" ["½Ķ"])
+("interpretation" [""])
+("interpreter" ["½Ķ"])
+("interrogation" ["ð"])
+("interrogative" ["ðݪ"])
+("interrupt" ["_"])
+("interruption" ["zZ"])
+("interval" ["j"])
+("intervene" ["zA"])
+("intervention" ["J"])
+("interview" ["ୱ"])
+("intimacy" ["˪"])
+("intimate" ["ˤ"])
+("into" [""])
+("intolerable" ["LkԨ"])
+("intonation" ["onk"])
+("intoxicate" ["ϾK"])
+("intricate" [""])
+("intrigue" [""])
+("introduce" [""])
+("introduction" ["޾"])
+("intrude" ["J"])
+("intruder" ["IJ"])
+("intrusion" ["IJ"])
+("invade" ["IZ"])
+("invader" ["IJ"])
+("invalid" ["fH"])
+("invaluable" ["L"])
+("invariably" ["ܤƦa"])
+("invasion" ["IJ"])
+("invent" ["o"])
+("invention" ["o"])
+("inventor" ["oa"])
+("invert" ["A˹L"])
+("invest" [""])
+("investigate" ["լd"])
+("investigation" ["լd"])
+("investigator" ["s"])
+("investment" [""])
+("investor" [""])
+("invisible" ["ݤ"])
+("invitation" ["ܽ"])
+("invite" ["ܽ"])
+("involuntary" ["۵MӵM"])
+("involve" ["J"])
+("inward" ["ߪ"])
+("iris" [""])
+("iron" ["K"])
+("irony" ["ب"])
+("irregular" ["Wh"])
+("irresistible" ["ܪ"])
+("irrigation" ["@"])
+("irritate" ["E"])
+("irritation" ["E"])
+("is" ["O"])
+("island" ["q"])
+("isle" ["pq"])
+("isolate" ["ϩt"])
+("it" [""])
+("itch" ["o"])
+("item" [""])
+("its" [""])
+("itself" [""])
+("ivory" ["H"])
+("ivy" ["`K"])
+("jack" ["p_"])
+("jacket" ["J"])
+("jail" ["ʺ"])
+("jam" ["G" ""])
+("january" ["@"])
+("japan" ["饻"])
+("jar" [""])
+("jaw" ["E"])
+("jazz" ["hR"])
+("jealous" ["Ҫ"])
+("jealousy" [""])
+("jeer" ["J"])
+("jelly" ["Gl"])
+("jerk" ["M¤H"])
+("jersey" ["´Bʭm"])
+("jest" [""])
+("jet" ["Qg"])
+("jewel" ["_"])
+("jewelry" [""])
+("jingle" ["ma"])
+("job" ["¾~"])
+("join" ["X"])
+("joint" ["`"])
+("joke" [""])
+("jolly" ["h֪"])
+("journal" ["x"])
+("journalism" ["sD"])
+("journalist" ["sDO"])
+("journey" ["ȵ{"])
+("joy" ["߮"])
+("joyful" ["wߪ"])
+("joyous" ["ּ֪"])
+("judge" ["kx" "P"])
+("judgment" ["P_"])
+("judicial" ["qk"])
+("jug" ["V~"])
+("juice" ["ĲG"])
+("juicy" ["h"])
+("july" ["C"])
+("jump" ["D"])
+("jumpy" ["gLӪ"])
+("junction" ["|X"])
+("june" [""])
+("jungle" ["OL"])
+("junior" ["Ū"])
+("jurisdiction" ["qkv"])
+("jury" ["f"])
+("just" ["n"])
+("justice" ["q"])
+("justification" ["G@"])
+("justify" ["G@"])
+("justly" ["a"])
+("jut" ["X"])
+("juvenile" ["֦~"])
+("kangaroo" ["U"])
+("keel" ["s"])
+("keen" ["ӾU"])
+("keep" ["O" ""])
+("keeper" ["޲zH"])
+("keeping" ["O"])
+("ken" [""])
+("kennel" [""])
+("kernel" [""])
+("kerosene" ["Ѫo"])
+("kettle" [""])
+("key" ["_"])
+("kick" [""])
+("kid" ["p"])
+("kidnap" ["j["])
+("kidney" [""])
+("kill" [""])
+("kiloliter" [""])
+("kilometer" [""])
+("kin" [""])
+("kind" ["O" ""])
+("kindle" ["UN"])
+("kindly" ["Oa"])
+("kindness" ["O"])
+("kindred" [""])
+("king" [""])
+("kingdom" [""])
+("kingly" [""])
+("kinsman" ["kʿ"])
+("kiss" ["k"])
+("kitchen" ["p"])
+("kite" [""])
+("kitten" ["p"])
+("kitty" ["߫}"])
+("knave" ["Fl"])
+("knead" ["b|"])
+("knee" ["\"])
+("kneel" ["U"])
+("knell" [""])
+("knife" ["Ml"])
+("knight" ["Mh"])
+("knighthood" ["Mh"])
+("knightly" ["Mh"])
+("knit" ["s´"])
+("knob" [""])
+("knock" ["V" ""])
+("knoll" ["pC"])
+("knot" [""])
+("know" [""])
+("knowing" ["վǪ"])
+("knowledge" [""])
+("known" ["W"])
+("knuckle" ["`"])
+("label" [""])
+("labor" ["Ҥu" "Y"])
+("laboratory" [""])
+("laborer" ["Ұʪ"])
+("laborious" ["Ҫ"])
+("lace" [""])
+("lack" ["ʥF"])
+("lad" ["pl"])
+("ladder" [""])
+("laden" ["R"])
+("lady" ["kh"])
+("lag" [""])
+("lair" ["_"])
+("lake" [""])
+("lamb" ["p"])
+("lame" ["_"])
+("lament" ["s"])
+("lamentable" ["id"])
+("lamentation" ["s"])
+("lamp" ["O"])
+("lance" [""])
+("land" ["ga"])
+("landing" ["۳"])
+("landlady" ["kЪF"])
+("landlord" ["ЪF"])
+("landmark" ["ɼ"])
+("landscape" [""])
+("lane" ["p"])
+("language" ["y"])
+("languish" ["" "|"])
+("lantern" ["OŢ"])
+("lap" ["jL" "|"])
+("lapse" ["~"])
+("lard" ["ުo"])
+("large" ["j"])
+("lark" [""])
+("larva" [""])
+("lash" ["" "@"])
+("lass" ["k"])
+("last" ["̫᪺"])
+("lasting" ["["])
+("latch" [""])
+("late" ["F"])
+("lately" ["̪"])
+("latent" ["b"])
+("later" [""])
+("lateral" ["䪺"])
+("latest" ["̿"])
+("latitude" ["nu"])
+("latter" [""])
+("laugh" [""])
+("laughter" ["n"])
+("launch" ["o" "п"])
+("laundry" ["~穱"])
+("laurel" ["۾"])
+("lava" [""])
+("lavender" ["Ȧ"])
+("lavish" ["O"])
+("lavishly" ["Lצa"])
+("law" ["k"])
+("lawful" ["Xk"])
+("lawless" ["Dk"])
+("lawn" ["a"])
+("lawyer" ["߮v"])
+("lay" ["wm" "Z"])
+("layer" ["@h"])
+("layman" ["~H"])
+("lazily" ["ivva"])
+("lazy" ["ik"])
+("lead" ["]" "޾"])
+("leader" ["ɪ"])
+("leadership" ["ɯO"])
+("leading" ["ɪ"])
+("leaf" [""])
+("leafy" ["h"])
+("league" ["p"])
+("leak" ["||"])
+("lean" ["ɱ" "G"])
+("leap" ["" "D"])
+("learn" ["ǲ"])
+("learned" ["ǰݪ"])
+("learning" ["ǰ"])
+("lease" [""])
+("least" ["̤֪"])
+("leather" ["֭"])
+("leave" ["dU" "}"])
+("leaven" ["å"])
+("lecture" ["t"])
+("lecturer" ["v"])
+("ledge" ["[" "tG"])
+("lee" ["׭B"])
+("leech" [""])
+("left" [""])
+("leg" ["L"])
+("legal" ["kߪ"])
+("legally" ["Xka"])
+("legend" ["ǻ"])
+("legion" ["x"])
+("legislation" ["kW"])
+("legislative" ["ߪk"])
+("legislature" ["ߪk"])
+("legitimate" ["Xk"])
+("leisure" ["v"])
+("leisurely" ["y"])
+("lemon" ["fc"])
+("lemonade" ["fc"])
+("lend" ["ɥX"])
+("length" [""])
+("lengthen" ["["])
+("lens" ["Y"])
+("leopard" ["\l"])
+("less" ["֪"])
+("lessen" [""])
+("lesser" [""])
+("lesson" ["ҵ{"])
+("lest" ["HK"])
+("let" ["" "w"])
+("letter" ["r"])
+("lettuce" ["͵"])
+("level" [""])
+("lever" ["b"])
+("levy" ["x"])
+("liability" ["d"])
+("liable" ["d"])
+("liar" [""])
+("liberal" ["ۥѬ"])
+("liberate" [""])
+("liberty" ["ۥ"])
+("librarian" ["ϮѺ޲z"])
+("library" ["Ϯ]"])
+("license" [""])
+("lichen" ["Ca"])
+("lick" ["Q"])
+("lid" ["\l"])
+("lie" [""])
+("lieutenant" ["xL"])
+("life" ["ͩR"])
+("lifeless" ["LͩR"])
+("lifetime" ["@"])
+("lift" ["|_"])
+("light" [""])
+("lighten" ["ӫG"])
+("lighthouse" ["O"])
+("lightly" [""])
+("lightning" ["{q"])
+("like" ["w"])
+("likelihood" ["hb"])
+("likely" ["γ\" "i"])
+("likeness" [""])
+("likewise" ["P˦a"])
+("liking" ["Rn"])
+("lilac" ["B"])
+("lily" ["ʦX"])
+("limb" ["⨬"])
+("lime" ["ۦ"])
+("limestone" ["ۦǥ"])
+("limit" ["d"])
+("limitation" [""])
+("limited" [""])
+("limp" ["}"])
+("line" ["u"])
+("linen" ["ȳ¥"])
+("linger" ["r"])
+("lining" ["Ũ"])
+("link" [""])
+("linoleum" ["o"])
+("lion" ["l"])
+("lip" ["B"])
+("liquid" ["G"])
+("liquor" ["s붼"])
+("list" ["W"])
+("listen" ["ť"])
+("listener" ["ť"])
+("liter" [""])
+("literal" ["r"])
+("literally" ["Ӧr"])
+("literary" ["Ǫ"])
+("literature" ["" "m"])
+("litter" ["ݾl"])
+("little" ["p"])
+("live" ["~"])
+("livelihood" ["ͭp"])
+("lively" ["ͮkk"])
+("liver" ["xŦ"])
+("livery" ["X"])
+("living" ["ͪ"])
+("lizard" ["hi"])
+("load" ["t"])
+("loaf" ["@"])
+("loan" ["ɴ"])
+("loath" ["c"])
+("loathe" ["c"])
+("lobby" ["𮧫"])
+("lobster" ["s"])
+("local" ["aʪ"])
+("locality" ["m"])
+("locate" ["]m"])
+("location" [""])
+("lock" [""])
+("locomotive" [""])
+("locust" [""])
+("lodge" ["p"])
+("lodging" ["J"])
+("loft" ["Ӵ["])
+("lofty" [""])
+("log" ["Τ"])
+("logic" ["޿"])
+("logical" ["޿誺"])
+("loin" ["y"])
+("loiter" ["V"])
+("lone" ["t檺"])
+("loneliness" ["t"])
+("lonely" ["I檺"])
+("lonesome" ["I檺"])
+("long" [""])
+("longing" [""])
+("longitude" ["g"])
+("look" [""])
+("lookout" [""])
+("loom" ["´"])
+("loop" [""])
+("loose" ["P}"])
+("loosen" ["P"])
+("lord" ["Q"])
+("lordly" ["𬣪"])
+("lordship" ["Qڨ"])
+("lorry" ["fT"])
+("lose" [""])
+("loss" ["l"])
+("lost" ["h"])
+("lot" ["jq,a"])
+("loud" ["n"])
+("loudly" ["na"])
+("loudspeaker" ["z"])
+("lounge" ["𮧫"])
+("love" ["R"])
+("lovely" ["iR"])
+("lover" ["RH"])
+("loving" ["R"])
+("low" ["C"])
+("lower" ["U"])
+("lowland" ["Ca"])
+("loyal" ["۪"])
+("loyalty" [""])
+("luck" ["B"])
+("luckily" ["Ʀa"])
+("lucky" ["nB"])
+("luggage" [""])
+("lullaby" ["ʯv"])
+("lumber" [""])
+("luminous" ["o"])
+("lump" [""])
+("lunatic" ["߯fg"])
+("lunch" ["\"])
+("luncheon" ["\"])
+("lung" [""])
+("lure" ["l"])
+("lust" [""])
+("luster" ["A"])
+("lute" ["\]"])
+("luxurious" ["ت"])
+("luxury" [""])
+("lyric" ["q"])
+("machine" [""])
+("machinery" ["˸m"])
+("mad" ["og" "o"])
+("madam" ["Ӥ"])
+("madame" ["ҤH"])
+("made" ["sy"])
+("madly" ["oga"])
+("madman" ["gH"])
+("madness" ["ƨg"])
+("magazine" ["x"])
+("magic" ["]N"])
+("magician" ["]Nv"])
+("magistrate" ["Fx"])
+("magnet" ["K"])
+("magnetic" ["ϩʪ"])
+("magnificence" ["R"])
+("magnificent" ["R"])
+("magnify" ["Xj"])
+("magnitude" ["jp"])
+("mahogany" ["ߤ"])
+("maid" ["ͤk"])
+("maiden" ["֤k"])
+("mail" ["l"])
+("maim" ["ˮ`"])
+("main" ["̥Dn"])
+("mainland" ["j"])
+("mainly" ["Dna"])
+("maintain" ["@"])
+("maintenance" ["O"])
+("majestic" ["R"])
+("majesty" ["LY"])
+("major" ["Dn" "D"])
+("majority" ["h"])
+("make" ["y" "o" ""])
+("maker" ["sy"])
+("makeup" ["Ƨ~"])
+("malady" ["ef"])
+("malaria" ["įe"])
+("male" ["ʪ"])
+("malice" ["cN"])
+("malicious" ["cr"])
+("mama" [""])
+("mamma" [""])
+("mammal" ["Űʪ"])
+("man" ["kH"])
+("manage" ["޲z"])
+("management" ["޲z"])
+("manager" ["gz"])
+("mandate" ["RO"])
+("mandolin" ["v\]"])
+("mane" ["O"])
+("maneuver" ["t" "p"])
+("manger" [""])
+("mangle" [""])
+("manhood" ["H"])
+("manifest" [""])
+("manifestation" ["ҩ"])
+("manifold" ["h˪"])
+("mankind" ["H"])
+("manly" ["kl"])
+("manner" ["A" "k"])
+("manor" ["ʦa"])
+("mansion" ["jH"])
+("mantle" ["O"])
+("manual" ["U"])
+("manufacture" ["sy"])
+("manufacturer" ["sy~"])
+("manure" ["ή"])
+("manuscript" ["Z"])
+("many" ["\h"])
+("map" ["a"])
+("maple" [""])
+("mar" ["la"])
+("marble" ["jz"])
+("march" ["T"])
+("mare" [""])
+("margin" ["t"])
+("marginal" ["ɭ"])
+("marine" ["̪"])
+("mariner" [""])
+("maritime" ["W"])
+("mark" ["Ÿ"])
+("market" [""])
+("marquis" ["J"])
+("marriage" ["B"])
+("married" ["wB"])
+("marrow" [""])
+("marry" ["B"])
+("marsh" ["hA"])
+("marshal" ["xx"])
+("mart" ["ӷ~"])
+("martial" ["xƪ"])
+("martyr" ["Ph"])
+("marvel" ["_" "_"])
+("marvellous" ["Z"])
+("marvellously" ["Za"])
+("masculine" ["kl"])
+("mash" ["k"])
+("mask" [""])
+("mason" ["dK"])
+("masquerade" ["ƧR|"])
+("mass" ["jq"])
+("massacre" ["jO"])
+("massive" ["jq"])
+("mast" ["ѽu"])
+("masterpiece" ["W"])
+("mat" ["Ԥl"])
+("match" ["" "۰t"])
+("matchless" ["L"])
+("mate" ["t"])
+("material" ["" ""])
+("materially" ["W"])
+("maternal" ["Y"])
+("mathematic" ["ƾǪ"])
+("mathematics" ["ƾ"])
+("matron" ["kٺ"])
+("matter" ["Ʊ"])
+("mattress" ["ɹ"])
+("mature" [""])
+("maturity" ["" ""])
+("maxim" ["樥"])
+("maximum" ["̦h"])
+("may" ["" "i"])
+("maybe" ["j"])
+("mayonnaise" ["D"])
+("mayor" [""])
+("maze" ["g}"])
+("me" [""])
+("mead" ["es"])
+("meadow" ["a"])
+("meager" ["MG"])
+("meal" [""])
+("mean" ["N" "["])
+("meaning" ["tN"])
+("means" ["k"])
+("meantime" ["P"])
+("meanwhile" ["P"])
+("measles" ["l"])
+("measure" ["׶q"])
+("measurement" ["׶q"])
+("meat" [""])
+("mechanic" ["ޤu"])
+("mechanical" [""])
+("mechanically" ["a"])
+("mechanism" ["c"])
+("medal" [""])
+("meddle" ["J"])
+("medicine" ["ľ"])
+("medieval" ["@"])
+("meditate" ["Ҽ{"])
+("meditation" ["H"])
+("medium" [""])
+("meek" ["M"])
+("meekly" ["Ma"])
+("meet" ["J" "|X"])
+("meeting" ["|ĳ"])
+("megaphone" ["X"])
+("melancholy" ["T"])
+("mellow" [""])
+("melody" ["۫"])
+("melon" [""])
+("melt" [""])
+("member" ["|"])
+("membership" ["|"])
+("membrane" [""])
+("memoir" ["լdi"])
+("memorable" ["Ѫ"])
+("memorandum" ["Ƨѿ"])
+("memorial" [""])
+("memorize" ["O"])
+("memory" ["O"])
+("menace" ["¯"])
+("mend" ["׸"])
+("mental" ["߲z"])
+("mention" [""])
+("menu" [""])
+("mercenary" [""])
+("merchandise" ["ӫ~"])
+("merchant" ["ӤH"])
+("merciful" ["O"])
+("merciless" ["ݧԪ"])
+("mercury" [""])
+("mercy" ["Od"])
+("mere" ["ȶȪ"])
+("merely" ["ȶ"])
+("merge" ["X"])
+("meridian" ["lȽu"])
+("merit" ["uI"])
+("merrily" ["ּ֦a"])
+("merriment" ["w"])
+("merry" ["ּ֪"])
+("mesh" [""])
+("mess" [""])
+("message" ["H"])
+("messenger" ["Ht"])
+("metal" [""])
+("metallic" ["ݪ"])
+("meteor" ["yP"])
+("meter" [""])
+("methinks" ["ڻ{"])
+("method" ["k"])
+("metropolis" [""])
+("metropolitan" ["j|"])
+("mew" ["ߥsn"])
+("mexican" ["H"])
+("mexico" [""])
+("microphone" ["X"])
+("microscope" ["L"])
+("mid" [""])
+("midday" [""])
+("middle" [""])
+("middleaged" ["~"])
+("midnight" ["ȩ]"])
+("midst" [""])
+("midsummer" ["L"])
+("midway" ["~"])
+("might" ["jv"])
+("mighty" ["jժ"])
+("migrate" ["E"])
+("migration" ["E~"])
+("mild" ["ũM"])
+("mildly" ["ũMa"])
+("mile" ["^"])
+("military" ["xƪ"])
+("milk" [""])
+("milky" ["ťզ⪺"])
+("mill" ["il"])
+("miller" ["i{D"])
+("milligram" ["@J"])
+("milliliter" [""])
+("millimeter" [""])
+("million" ["ʸU"])
+("millionaire" ["ʸUI"])
+("millstone" ["i"])
+("mince" ["H"])
+("mind" [""])
+("mine" ["ڪ"])
+("miner" ["qu"])
+("mineral" ["q"])
+("mingle" ["VX"])
+("miniature" ["Ypҫ"])
+("minimum" ["̧C"])
+("mining" ["q"])
+("minister" [""])
+("ministry" ["v¾"])
+("mink" ["I"])
+("minor" ["~H"])
+("minority" ["ּƥ"])
+("mint" [""])
+("minus" ["h"])
+("minute" [""])
+("miracle" ["_"])
+("miraculous" ["_ݪ"])
+("mirror" ["l"])
+("miscellaneous" [""])
+("mischief" ["c@@"])
+("mischievous" ["c@@"])
+("miser" ["["])
+("miserable" ["YG"])
+("miserably" ["isa"])
+("misery" [""])
+("misfortune" [""])
+("mishap" [""])
+("miss" ["pj" "~"])
+("missile" ["u"])
+("mission" [""])
+("missionary" ["ǹD̪"])
+("mist" [""])
+("mistake" [""])
+("mister" [""])
+("mistress" ["kDH"])
+("mistrust" ["H"])
+("misty" ["g۪"])
+("misunderstanding" ["~|"])
+("misuse" ["~"])
+("mitten" ["M"])
+("mix" ["V"])
+("mixture" ["VX"])
+("moan" ["d"])
+("moat" ["@e"])
+("mob" ["QX"])
+("mock" ["M"])
+("mockery" ["J"])
+("mode" ["˦"])
+("model" ["Ҧ"])
+("moderate" ["A"])
+("moderately" ["Aצa"])
+("moderation" ["wM"])
+("modern" ["{N"])
+("modest" ["ꪺ"])
+("modestly" ["ԷVa"])
+("modesty" [""])
+("modification" ["ץ"])
+("modify" ["ץ"])
+("moist" ["㪺"])
+("moisten" [""])
+("moisture" [""])
+("mold" ["Ҥl"])
+("mole" ["µi"])
+("molest" ["i"])
+("molten" ["ĸ"])
+("moment" [""])
+("momentary" [""])
+("monarch" ["gD"])
+("monarchy" ["gDFv"])
+("monastery" ["׹D|"])
+("monday" ["P@"])
+("money" [""])
+("monk" ["Q"])
+("monkey" ["Ul"])
+("monopoly" ["b_c"])
+("monotonous" ["ժ"])
+("monster" ["Ǫ"])
+("monstrous" ["Ǫ"])
+("month" [""])
+("monument" ["O"])
+("monumental" ["ej"])
+("mood" ["߱"])
+("moon" ["G"])
+("moonlight" [""])
+("moose" ["j"])
+("mop" [""])
+("moral" ["Dw"])
+("morality" ["Dw"])
+("more" ["h"])
+("moreover" ["~"])
+("morning" [""])
+("morrow" [""])
+("mortal" ["|"])
+("mortality" ["`v"])
+("mortgage" [""])
+("mosquito" ["Al"])
+("moss" ["a"])
+("mossy" ["ͭa"])
+("most" ["̦h"])
+("mostly" ["j"])
+("moth" [""])
+("mother" [""])
+("motion" ["B"])
+("motionless" ["ʪ"])
+("motive" ["ʾ"])
+("motor" ["F"])
+("motorcar" ["T"])
+("motorist" ["`T"])
+("motto" ["yk"])
+("mound" ["g"])
+("mount" ["M"])
+("mountain" ["s"])
+("mountaineer" ["nsa"])
+("mountainous" ["hs"])
+("mourn" ["s"])
+("mournful" ["dE"])
+("mouse" ["ѹ"])
+("mouth" ["L,f"])
+("mouthful" ["@f"])
+("movable" ["iʪ"])
+("move" [""])
+("movement" ["i"])
+("movie" ["qv"])
+("mow" ["ί"])
+("much" ["D`h"])
+("mud" ["d"])
+("muddy" ["ż"])
+("muffin" ["P"])
+("mug" ["M"])
+("mulberry" [""])
+("mule" ["["])
+("multiplication" ["k"])
+("multiply" [""])
+("multitude" ["h"])
+("mummy" ["D"])
+("municipal" ["F"])
+("murder" ["ѱ"])
+("murderer" [""])
+("murmur" ["py"])
+("muscle" ["٦"])
+("muscular" ["٦׵oF"])
+("muse" ["PQ"])
+("museum" ["ժ]"])
+("mushroom" ["Ĩ"])
+("music" [""])
+("musical" ["֪"])
+("musician" ["֮a"])
+("must" ["@wn"])
+("mustache" ["Ž"])
+("mustard" ["㥽"])
+("mute" ["ת"])
+("mutiny" ["q"])
+("mutter" ["Cy"])
+("mutton" ["Ϧ"])
+("mutual" ["ۤ"])
+("muzzle" ["f"])
+("my" ["ڪ"])
+("myself" ["ڦۤv"])
+("mysterious" [""])
+("mystery" [""])
+("myth" [""])
+("mythology" [""])
+("nail" [""])
+("naked" ["r"])
+("name" ["Wr" "m"])
+("nameless" ["LW"])
+("namely" ["Y"])
+("napkin" ["\y"])
+("narcotic" ["¾K"])
+("narration" ["ԭz"])
+("narrative" ["G"])
+("narrow" [""])
+("nasty" ["©"])
+("nation" [""])
+("national" [""])
+("nationality" ["y"])
+("native" ["g۪"])
+("natural" ["۵M"])
+("naturally" ["Ma"])
+("nature" ["۵M"])
+("naught" ["L" "s"])
+("naughty" ["x֪"])
+("naval" ["x"])
+("navigation" [""])
+("navigator" [""])
+("navy" ["x"])
+("nay" [""])
+("near" [""])
+("nearby" ["b"])
+("nearly" ["XG"])
+("neat" ["b"])
+("neatly" ["a"])
+("nebula" ["P"])
+("necessarily" ["M"])
+("necessary" ["n"])
+("necessitate" ["ݭn"])
+("necessity" [""])
+("neck" ["V"])
+("necklace" [""])
+("need" ["ݭn"])
+("needle" ["_w"])
+("needless" ["n"])
+("needy" ["ha"])
+("negative" ["_w"])
+("neglect" [""])
+("negligence" [""])
+("negligent" ["jN"])
+("negotiate" ["ͧP"])
+("negotiation" ["ͧP"])
+("neighbor" ["F~"])
+("neighborhood" ["{"])
+("neighboring" [""])
+("neither" ["]"])
+("nephew" ["~c"])
+("nerve" ["g" "xq"])
+("nervous" ["i"])
+("nervously" ["ia"])
+("nest" ["۱_"])
+("nestle" ["̰"])
+("net" ["" "b"])
+("nettle" ["C"])
+("network" ["s"])
+("neutral" ["ʪ"])
+("never" ["qӤ"])
+("nevertheless" ["M"])
+("new" ["s"])
+("newcomer" ["sӪH"])
+("newly" ["s"])
+("news" ["sD"])
+("newspaper" [""])
+("next" ["U@"])
+("nibble" ["r"])
+("nice" ["n"])
+("nicely" ["nna"])
+("nick" ["ʤf"])
+("nickel" [""])
+("nickname" ["~"])
+("niece" ["k" "ck"])
+("nigh" [""])
+("night" ["]"])
+("nightfall" [""])
+("nightingale" ["]a"])
+("nightly" ["C]"])
+("nightmare" ["c"])
+("nimble" ["ӱ"])
+("nine" ["E"])
+("nineteen" ["QE"])
+("nineteenth" ["ĤQE"])
+("ninetieth" ["ĤEQ"])
+("ninety" ["EQ"])
+("ninth" ["ĤE"])
+("nip" ["r" ""])
+("nitrogen" [""])
+("no" ["O"])
+("nobility" ["Q"])
+("noble" ["Q"])
+("nobleman" ["Q"])
+("nobly" ["|a"])
+("nobody" ["SH"])
+("nod" ["IY"])
+("noise" ["nxn"])
+("noiseless" ["Ln"])
+("noiselessly" ["Lna"])
+("noisy" ["nx"])
+("nominate" ["W"])
+("nomination" ["W"])
+("nominative" ["D"])
+("none" ["S"])
+("nonsense" ["L"])
+("nook" [""])
+("noon" [""])
+("noonday" ["Ȫ"])
+("nor" ["]"])
+("normal" ["`"])
+("north" ["_"])
+("northeast" ["F_"])
+("northeastern" ["F_誺"])
+("northern" ["_誺"])
+("northward" ["V_a"])
+("northwest" ["_"])
+("northwestern" ["_誺"])
+("nose" ["l"])
+("nostril" [""])
+("not" ["" "O"])
+("notable" ["ۦW"])
+("notably" ["ۦWa"])
+("notch" ["貪"])
+("note" ["O"])
+("notebook" ["O"])
+("noted" ["ۦW"])
+("nothing" ["Sƻ"])
+("notice" ["q" "`N"])
+("noticeable" ["ȱo`N"])
+("notify" ["q"])
+("notion" ["["])
+("notorious" ["cWL"])
+("notwithstanding" ["M"])
+("nought" ["L"])
+("noun" ["W"])
+("nourish" ["i"])
+("nourishment" ["i~"])
+("novel" ["p"])
+("novelist" ["pa"])
+("novelty" ["s_ƪ"])
+("november" ["Q@"])
+("now" ["{b"])
+("nowadays" ["p"])
+("nowhere" ["LB"])
+("nuclear" ["֤l"])
+("nucleus" ["֤l"])
+("nuisance" ["QF"])
+("numb" ["¤쪺"])
+("number" ["Ʀr"])
+("numeral" ["Ʀr"])
+("numerous" ["Lƪ"])
+("nun" ["פk" "h"])
+("nuptial" ["B§"])
+("nurse" ["@h"])
+("nursery" [""])
+("nut" ["G"])
+("nutrition" ["i"])
+("nylon" ["s"])
+("nymph" ["k"])
+("oak" [""])
+("oaken" ["쪺"])
+("oar" [""])
+("oasis" ["w"])
+("oat" ["P"])
+("oath" ["}"])
+("oatmeal" ["P"])
+("obedience" ["Aq"])
+("obedient" ["q"])
+("obey" ["Aq"])
+("object" [""])
+("objection" ["Ϲ"])
+("objective" ["ؼ" ""])
+("obligation" ["q"])
+("oblige" ["d"])
+("oblivion" ["IS"])
+("obscure" ["LW"])
+("obscurity" ["" "tk"])
+("observance" ["^"])
+("observation" ["["])
+("observatory" ["Ѥx"])
+("observe" ["["])
+("observer" ["["])
+("obstacle" ["ê"])
+("obstinacy" ["xT"])
+("obstinate" ["xT"])
+("obstruct" ["j"])
+("obstruction" ["ê"])
+("obtain" ["o"])
+("obvious" ["M"])
+("obviously" ["Ma"])
+("occasion" ["X" "ɾ"])
+("occasional" ["M"])
+("occasionally" ["Ma"])
+("occupant" [""])
+("occupation" ["¾~"])
+("occupy" [""])
+("occur" ["o"])
+("occurrence" ["o"])
+("ocean" ["v"])
+("october" ["Q"])
+("odd" ["_" "sY"])
+("oddly" ["jǦa"])
+("odds" ["i"])
+("ode" ["|"])
+("odor" [""])
+("of" ["ݩ"])
+("off" ["" "}"])
+("offend" ["Ĳ"])
+("offender" ["_Ǫ"])
+("offense" ["I"])
+("offensive" ["ʪ"])
+("offer" [""])
+("offering" ["^{"])
+("office" ["줽"])
+("officer" ["x"])
+("official" ["Ȫ"])
+("officially" ["x誺"])
+("offset" ["zLL"])
+("offspring" ["l]"])
+("often" ["``"])
+("oh" ["ڧr"])
+("oil" ["o"])
+("oily" ["oo"])
+("ointment" ["ĻI"])
+("old" ["Ѫ"])
+("oldfashioned" ["Lɪ"])
+("oldtime" ["jӪ"])
+("olive" ["V"])
+("omen" ["w"])
+("ominous" ["NQ"])
+("omission" ["ٲ"])
+("omit" ["h"])
+("omnibus" ["@T"])
+("on" ["b..W"])
+("once" ["@"])
+("one" ["@"])
+("oneself" ["ۤv"])
+("onion" ["v"])
+("only" ["u"])
+("onto" ["ȤW"])
+("onward" ["ei"])
+("ooze" ["d"])
+("opal" ["Jե"])
+("open" ["}"])
+("opening" [""])
+("openly" ["}a"])
+("opera" ["q@"])
+("operate" ["ާ@"])
+("operation" ["ʧ@" "N"])
+("operator" ["ާ@"])
+("opinion" ["N"])
+("opium" ["~"])
+("opponent" ["ܪ"])
+("opportunity" ["|"])
+("oppose" ["Ϲ"])
+("opposite" ["ۤϪ"])
+("opposition" ["Ϲ"])
+("oppress" [""])
+("oppression" [""])
+("optimism" ["["])
+("or" ["Ϊ"])
+("oracle" [""])
+("oral" ["fY"])
+("orange" ["l"])
+("oration" ["t"])
+("orator" ["t"])
+("orbit" ["yD"])
+("orchestra" ["ީֹ"])
+("ordain" ["RBw"])
+("ordeal" [""])
+("order" [""])
+("orderly" [""])
+("ordinal" ["Ǽ"])
+("ordinance" ["kO"])
+("ordinarily" ["q`"])
+("ordinary" ["q"])
+("ore" ["q"])
+("organ" ["^"])
+("organic" ["x"])
+("organism" [""])
+("organization" ["´"])
+("organize" ["´"])
+("orient" ["F"])
+("oriental" ["F誺"])
+("origin" ["_"])
+("original" ["̪쪺"])
+("originality" ["Ч@O"])
+("originally" [""])
+("originate" ["_l"])
+("ornament" ["˹"])
+("ornamental" ["˹"])
+("orphan" ["t"])
+("orthodox" ["Ϊ"])
+("ostrich" ["k"])
+("other" ["O"])
+("otherwise" ["M"])
+("ought" ["O"])
+("ounce" ["sq"])
+("our" ["ڭ̪"])
+("ourself" ["ڪH"])
+("ourselves" ["ڭ̦ۤv"])
+("out" ["~"])
+("outbreak" ["zo"])
+("outburst" ["o"])
+("outcome" ["G"])
+("outcry" ["s"])
+("outdoor" ["~"])
+("outdoors" ["b~"])
+("outer" ["b~"])
+("outfit" ["Ȧ˳"])
+("outlaw" ["LkLѪ"])
+("outlet" ["Xf"])
+("outline" ["" "Z"])
+("outlook" ["i"])
+("output" ["X"])
+("outrage" ["ϼn"])
+("outrageous" ["㪺"])
+("outside" ["~"])
+("outskirt" ["~"])
+("outstanding" ["ت"])
+("outward" ["~"])
+("oval" [""])
+("ovary" ["l"])
+("oven" ["`"])
+("over" ["bW"])
+("overcoat" ["j"])
+("overcome" ["JA"])
+("overflow" ["X"])
+("overhang" ["a"])
+("overhead" ["["])
+("overhear" ["LNť"])
+("overland" ["g"])
+("overlook" [""])
+("overnight" ["qd"])
+("overpower" [""])
+("overseas" ["~"])
+("oversleep" ["ιLY"])
+("overtake" ["lW"])
+("overthrow" ["½"])
+("overturn" ["½"])
+("overwhelm" [""])
+("overwhelming" ["˩ʪ"])
+("overwork" ["u@L"])
+("owe" ["ɶ"])
+("owing" [""])
+("owl" ["YN"])
+("own" ["֦"])
+("owner" ["D"])
+("ownership" ["Ҧv"])
+("ox" [""])
+("oxygen" [""])
+("oyster" ["d" "H"])
+("pace" ["B"])
+("pacific" ["M"])
+("pack" ["]"])
+("package" ["]"])
+("packet" ["p]"])
+("pad" ["Ũ"])
+("paddle" [""])
+("page" [""])
+("pageant" ["|"])
+("pail" [""])
+("pain" ["h"])
+("painful" ["h"])
+("painfully" ["hWa"])
+("paint" ["C"])
+("painter" ["ea"])
+("painting" ["oe"])
+("pair" ["@"])
+("pajamas" ["Φ"])
+("pal" ["٦"])
+("palace" ["c"])
+("pale" ["a"])
+("palm" ["x" "ľ["])
+("pamphlet" ["pUl"])
+("pan" [""])
+("pancake" ["N"])
+("pane" [""])
+("panel" ["KO"])
+("panic" ["W"])
+("pansy" ["T⵵ù"])
+("pant" ["ݮ"])
+("panther" ["w\"])
+("pants" [""])
+("papa" [""])
+("paper" [""])
+("par" ["P"])
+("parachute" [""])
+("parade" ["C"])
+("paradise" ["ֶ"])
+("paragraph" ["q"])
+("parallel" ["檺"])
+("paralyze" ["ϳ·"])
+("paramount" ["ܰ"])
+("paraphrase" [""])
+("parasite" ["Hͪ"])
+("parasol" [""])
+("parcel" ["]q"])
+("parch" ["M"])
+("parchment" ["ϥ֯"])
+("pardon" [""])
+("pare" ["鱼"])
+("parent" [""])
+("parenthesis" ["A"])
+("parish" ["а"])
+("park" [""])
+("parliament" ["|"])
+("parliamentary" ["|"])
+("parrot" ["xM"])
+("parsley" [""])
+("parson" ["v"])
+("part" [""])
+("partake" [""])
+("partial" [""])
+("partially" ["a"])
+("participate" ["ѥ["])
+("participation" ["ѻP"])
+("participle" [""])
+("particular" ["W"])
+("particularly" ["Wa"])
+("parting" [""])
+("partisan" [""])
+("partition" ["ʤ"])
+("partly" ["a"])
+("partner" ["X٤H"])
+("partridge" ["l"])
+("party" ["|" "F" "R|"])
+("pass" ["qL"])
+("passage" ["qD"])
+("passenger" [""])
+("passion" [""])
+("passionate" [""])
+("passionately" ["a"])
+("passive" [""])
+("passport" ["@"])
+("past" ["Lh"])
+("paste" ["k" "I"])
+("pastime" [""])
+("pastor" ["v" "H"])
+("pastoral" ["H"])
+("patron" [""])
+("patronage" [""])
+("patter" ["Pn"])
+("pattern" ["Ϯ" "ҧ"])
+("pause" ["y"])
+("pave" ["Q]"])
+("pavement" [""])
+("paw" ["l"])
+("pay" ["I"])
+("payment" ["I"])
+("pea" ["l"])
+("peace" ["M"])
+("peaceable" ["M"])
+("peaceful" ["w窺"])
+("peach" ["l"])
+("peacock" ["ճ"])
+("peak" ["sp"])
+("peal" ["Tn"])
+("peanut" [""])
+("pear" ["l"])
+("pearl" ["ï]"])
+("peasant" ["A"])
+("pebble" ["ZZ"])
+("peculiar" ["_S"])
+("peculiarity" ["ǻ"])
+("peculiarly" ["_Sa"])
+("peddler" ["pc"])
+("pedestal" ["xy"])
+("pedestrian" ["H"])
+("peel" ["G"])
+("peep" [""])
+("peer" ["P" "Ӭ"])
+("peg" ["v" "秨"])
+("pelt" [""])
+("pen" ["" ""])
+("penalty" ["g@"])
+("pencil" ["]"])
+("pending" ["Mw"])
+("pendulum" ["\"])
+("penetrate" ["z"])
+("peninsula" ["bq"])
+("penny" ["@"])
+("pension" ["iѪ"])
+("pensive" ["s䪺"])
+("people" ["H" ""])
+("pepper" ["J"])
+("perceive" ["Pı"])
+("percent" ["ʤ"])
+("percentage" ["ʤ"])
+("perceptible" ["㪺"])
+("perception" ["ı"])
+("perch" ["Ϯ"])
+("perchance" ["γ\"])
+("perfect" [""])
+("perfection" [""])
+("perfectly" ["a"])
+("perform" ["t" ""])
+("performance" ["tX" "Z"])
+("perfume" [""])
+("perhaps" ["i"])
+("peril" ["MI"])
+("perilous" ["MI"])
+("period" ["ɴ" "y"])
+("periodical" ["Z"])
+("perish" [""])
+("permanent" ["ä["])
+("permanently" ["ä[a"])
+("permission" ["\i"])
+("permit" ["\"])
+("perpendicular" [""])
+("perpetual" ["ä["])
+("perplex" ["gb"])
+("perplexity" ["xb"])
+("persecute" ["`"])
+("persecution" ["`"])
+("perseverance" ["ݤO"])
+("persevere" [""])
+("persimmon" ["Ul"])
+("persist" [""])
+("persistent" ["T"])
+("person" ["H"])
+("personage" ["WH" "e"])
+("personal" ["pH"])
+("personality" ["ө"])
+("personally" ["˦ۦa"])
+("personnel" ["HƳ"])
+("perspective" ["z"])
+("persuade" ["U"])
+("persuasion" ["U"])
+("pertain" ["ݩ"])
+("pervade" ["M"])
+("pessimism" ["d["])
+("pest" ["r"])
+("pestilence" ["ǬVf"])
+("pet" ["d"])
+("petal" ["ä"])
+("petition" ["@"])
+("petroleum" ["۪o"])
+("petticoat" ["Ũ"])
+("petty" ["Ӥp"])
+("pew" ["y"])
+("phantom" ["ۼv"])
+("phase" ["ɴ"])
+("pheasant" ["n"])
+("phenomenon" ["{H"])
+("philosopher" ["Ǯa"])
+("philosophic" ["ǤW"])
+("philosophy" [""])
+("phone" ["q"])
+("phonograph" ["q۾"])
+("phosphoric" ["tM"])
+("photo" ["Ӥ"])
+("photograph" ["Ӥ"])
+("phrase" ["y"])
+("physical" ["z"])
+("physically" ["za"])
+("physician" [""])
+("physics" ["z"])
+("pianist" ["^a"])
+("piano" ["^"])
+("piazza" ["Y"])
+("pick" ["D"])
+("pickle" ["M"])
+("picnic" ["\"])
+("picture" ["ϵe"])
+("picturesque" ["pe"])
+("pie" ["`"])
+("piece" ["@" "@"])
+("pier" ["XY"])
+("pierce" ["}"])
+("piety" [""])
+("pig" [""])
+("pigeon" ["Fl"])
+("pike" ["j" "|"])
+("pile" ["@"])
+("pilgrim" ["¸t"])
+("pilgrimage" ["¸t"])
+("pill" ["ĤY"])
+("pillar" ["Wl"])
+("pillow" ["EY"])
+("pilot" ["rp"])
+("pin" ["Ow"])
+("pinch" [""])
+("pine" ["Q"])
+("pineapple" [""])
+("pingpong" ["y"])
+("pinion" [""])
+("pink" [""])
+("pint" ["~"])
+("pioneer" ["}ݪ"])
+("pious" ["@۪"])
+("pipe" [""])
+("piper" ["jê"])
+("pirate" ["s"])
+("pistil" ["ۿ"])
+("pistol" ["j"])
+("piston" [""])
+("pit" ["W}"])
+("pitch" [""])
+("pitcher" [""])
+("pitiful" ["i"])
+("pitiless" ["L"])
+("pity" [""])
+("placard" ["лyP"])
+("place" [",a"])
+("placid" ["R"])
+("plague" ["̯f"])
+("plaid" ["lO"])
+("plain" ["q"])
+("plan" ["pe"])
+("plane" [""])
+("planet" ["P"])
+("plank" ["O"])
+("plant" ["Ӫ"])
+("plantation" ["A"])
+("planter" ["شӪH"])
+("plaster" ["ۻI"])
+("plastic" ["콦"])
+("plate" ["ݪO"])
+("plateau" [""])
+("platform" ["O"])
+("platinum" ["ժ,`"])
+("platter" ["jLl"])
+("play" ["C"])
+("player" ["vɪ"])
+("playful" ["RC"])
+("playground" ["Bʳ"])
+("playmate" ["C"])
+("plaything" [""])
+("plea" ["@"])
+("plead" ["G@"])
+("pleasant" ["r֪"])
+("pleasantly" ["r֦a"])
+("please" ["ϰ"])
+("pleased" [""])
+("pleasing" ["r֪"])
+("pleasure" ["w"])
+("pledge" ["}"])
+("plentiful" ["\h"])
+("plenty" ["ܦh"])
+("plot" [""])
+("plow" ["p"])
+("pluck" ["K"])
+("plug" [""])
+("plum" ["l"])
+("plumage" ["Ф"])
+("plume" ["Ф"])
+("plunder" [""])
+("plunge" ["i"])
+("plural" ["Ƽ"])
+("plus" ["["])
+("ply" ["["])
+("pneumonia" ["ͪ"])
+("pocket" ["fU"])
+("poem" [""])
+("poet" ["֤H"])
+("poetic" ["ַN"])
+("poetry" [""])
+("point" ["I"])
+("pointed" ["y"])
+("poison" ["r"])
+("poisonous" ["r"])
+("poke" ["}"])
+("pole" ["" ""])
+("police" ["ĵ"])
+("policeman" ["ĵ"])
+("policy" ["F"])
+("polish" ["i"])
+("polite" ["§"])
+("politely" ["Ԧa"])
+("politeness" ["§"])
+("political" ["Fv"])
+("politician" ["Fva"])
+("politics" ["Fv"])
+("poll" ["N"])
+("pollen" ["᯻"])
+("pond" [""])
+("ponder" ["I"])
+("ponderous" ["­"])
+("pony" ["p"])
+("pool" [""])
+("poor" ["ha" "tl"])
+("pop" ["zn"])
+("pope" ["Ь"])
+("poplar" ["շ"])
+("poppy" ["Ģ"])
+("populace" [""])
+("popular" ["w諸"])
+("popularity" ["y"])
+("population" ["Hf"])
+("populous" ["HfYK"])
+("porcelain" [""])
+("porch" ["x"])
+("porcupine" [""])
+("pore" [""])
+("pork" ["ަ"])
+("port" ["f"])
+("portable" ["ⴣ"])
+("portal" [""])
+("porter" ["u"])
+("portion" ["@"])
+("portrait" ["b"])
+("pose" [""])
+("position" ["m"])
+("positive" ["Tw"])
+("positively" ["Twa"])
+("possess" ["֦"])
+("possession" ["Ҧv"])
+("possessive" ["Ҧ"])
+("possibility" ["i"])
+("possible" ["i઺"])
+("possibly" ["ia"])
+("post" ["i" "l"])
+("postage" ["lO"])
+("postal" ["lF"])
+("postcard" ["H"])
+("poster" [""])
+("posterity" ["N"])
+("postman" ["lt"])
+("postoffice" ["l"])
+("postpone" [""])
+("postscript" [""])
+("posture" [""])
+("pot" ["" ""])
+("potato" ["a"])
+("potent" ["jO"])
+("potential" ["i"])
+("potter" ["suH"])
+("pottery" [""])
+("pouch" ["pU"])
+("poultry" ["aV"])
+("pound" ["S" "V"])
+("pour" ["ɭ"])
+("poverty" ["hx"])
+("powder" ["ӯ"])
+("power" ["Oq" "vO"])
+("powerful" ["jO"])
+("powerless" ["LO"])
+("practicable" ["i檺"])
+("practical" ["ڪ"])
+("practicality" ["ک"])
+("practically" ["ڦa"])
+("practice" ["m"])
+("prairie" ["j"])
+("praise" ["g"])
+("pray" ["ë"])
+("prayer" ["ëi"])
+("preach" ["Ǳ"])
+("preacher" ["ǹD"])
+("precarious" ["MI"])
+("precaution" ["w"])
+("precede" ["e"])
+("precedent" [""])
+("preceding" ["e"])
+("precept" ["e"])
+("precinct" ["ϰ"])
+("precious" ["Q"])
+("precipice" ["aV"])
+("precipitate" ["H" "P"])
+("precise" ["T"])
+("precisely" ["Ta"])
+("precision" ["T"])
+("predecessor" ["e" "e"])
+("predicate" ["zy"])
+("predict" ["w"])
+("prediction" ["w"])
+("preface" ["" ""])
+("prefecture" ["ax¾"])
+("prefer" ["w"])
+("preference" ["R" "uf"])
+("prefix" ["r"])
+("prejudice" [""])
+("preliminary" ["B"])
+("premier" ["`z" ""])
+("premise" ["e"])
+("premium" [""])
+("preparation" ["w"])
+("preparatory" ["wƪ"])
+("prepare" ["ǳ"])
+("preposition" ["t"])
+("prerogative" ["Sv"])
+("prescribe" ["Ww"])
+("prescription" ["Ĥ" "Ww"])
+("presence" ["Xu"])
+("present" ["ee" "{b"])
+("presentation" ["§" "tX"])
+("presently" ["[a"])
+("preservation" ["O@"])
+("preserve" ["O@"])
+("preside" ["D"])
+("presidency" ["`Υ"])
+("president" ["`" "ժ"])
+("presidential" ["`Ϊ"])
+("press" ["" "sD"])
+("pressure" ["O"])
+("prestige" ["±"])
+("presumably" ["wa"])
+("presume" ["w"])
+("pretend" [""])
+("pretense" ["갰"])
+("pretty" ["}G"])
+("prevail" ["y" "Գ"])
+("prevailing" ["y檺"])
+("prevalent" ["y檺"])
+("prevent" [""])
+("prevention" [""])
+("previous" ["e"])
+("previously" ["ea"])
+("prey" ["y"])
+("price" [""])
+("priceless" ["L"])
+("pride" ["۴L"])
+("priest" ["v"])
+("primarily" ["Dna"])
+("primary" ["Ū"])
+("prime" ["Dn"])
+("primitive" ["򥻪"])
+("primrose" [""])
+("prince" ["Ӥl"])
+("princely" ["a"])
+("princess" ["D"])
+("principal" ["Dn"])
+("principle" ["h"])
+("print" ["L"])
+("printer" ["L"])
+("prior" ["w"])
+("prism" ["TW"])
+("prison" ["ʺ"])
+("prisoner" ["ǤH"])
+("privacy" ["p"])
+("private" ["pH"])
+("privately" ["pHa"])
+("privilege" ["Sv"])
+("privileged" ["Sv"])
+("prize" ["~"])
+("probability" ["i"])
+("probable" ["i" "j"])
+("probably" ["ja"])
+("problem" ["D"])
+("procedure" ["{"])
+("proceed" ["i"])
+("proceeding" [""])
+("process" ["L{"])
+("procession" ["C"])
+("proclaim" ["n"])
+("proclamation" ["Ũ"])
+("procure" ["P"])
+("prodigal" ["O"])
+("prodigious" ["jq"])
+("produce" ["Ͳ"])
+("producer" ["s@"])
+("product" ["~"])
+("production" ["Ͳ"])
+("productive" ["Ͳ"])
+("profane" ["@U"])
+("profess" ["n"])
+("profession" ["¾~"])
+("professional" ["M~"])
+("professor" ["б"])
+("proffer" [""])
+("proficient" ["Ma" "q"])
+("profile" ["~"])
+("profit" ["Qq"])
+("profitable" ["QiϪ"])
+("profiteer" ["ɧQ"])
+("profound" ["`"])
+("profoundly" ["`a"])
+("program" ["`"])
+("programme" ["`"])
+("progress" ["iB"])
+("progressive" ["iB"])
+("prohibit" ["T"])
+("prohibition" ["T"])
+("project" [""])
+("projection" ["g"])
+("prologue" ["ǹ"])
+("prolong" [""])
+("promenade" ["C"])
+("prominent" ["ۦW"])
+("promise" ["w"])
+("promising" ["Ʊ檺"])
+("promote" ["ɾE"])
+("promotion" ["ɾE"])
+("prompt" ["ߨ誺"])
+("promptly" ["ߨa"])
+("prone" ["ɦV"])
+("pronoun" ["NW"])
+("pronounce" ["o" "n"])
+("pronounced" [""])
+("pronunciation" ["o"])
+("proof" [""])
+("propaganda" ["Ŷ"])
+("propagate" ["s"])
+("propeller" ["ۼ"])
+("proper" ["A"])
+("properly" ["Aa"])
+("property" ["]"])
+("prophecy" ["w"])
+("prophesy" ["w"])
+("prophet" ["wa"])
+("prophetic" ["w"])
+("proportion" ["v"])
+("proposal" ["" "DB"])
+("propose" ["ĳ"])
+("proposition" ["Di"])
+("proprietor" ["Ҧ"])
+("prose" [""])
+("prosecute" ["_D"])
+("prospect" [""])
+("prospective" ["Ʊ檺"])
+("prosper" ["ca"])
+("prosperity" ["ca"])
+("prosperous" ["ca"])
+("protect" ["O@"])
+("protection" ["O@"])
+("protective" ["O@"])
+("protector" ["O@"])
+("protein" ["Jս"])
+("protest" ["ĳ"])
+("protestant" ["s"])
+("protoplasm" ["ν"])
+("proud" ["ź"])
+("proudly" ["ģa"])
+("prove" [""])
+("proverb" ["λy"])
+("provide" ["ѵ"])
+("provided" ["խY"])
+("province" [""])
+("provincial" ["٪"])
+("provision" [""])
+("provocation" ["Ĳ"])
+("provoke" ["ϼ"])
+("prudence" ["ԷV"])
+("prudent" ["ԷV"])
+("prune" ["װ"])
+("pry" ["뱴"])
+("psalm" ["ֽg"])
+("psychology" ["߲z"])
+("public" ["Ϊ"])
+("publication" ["X"])
+("publicity" ["}"])
+("publicly" ["Ma"])
+("publish" ["o"])
+("publisher" ["X"])
+("pudding" ["B"])
+("puff" ["@j"])
+("pull" [""])
+("pulp" ["G"])
+("pulse" ["߷i"])
+("pump" ["A"])
+("pumpkin" ["n"])
+("punch" ["վ"])
+("punctual" ["u"])
+("punctuation" ["I"])
+("punish" ["B@"])
+("punishment" ["B@"])
+("pup" ["p"])
+("pupil" ["ǥ"])
+("puppet" ["참"])
+("puppy" ["p"])
+("purchase" ["ʶR"])
+("purchaser" ["ʶR"])
+("pure" ["ª"])
+("purely" ["ºa"])
+("purge" ["²M"])
+("purify" ["b"])
+("purity" ["M"])
+("purple" ["⪺"])
+("purpose" ["ت"])
+("purse" ["U"])
+("pursue" ["lD"])
+("pursuit" ["q"])
+("push" [""])
+("pussy" [""])
+("put" ["m"])
+("puzzle" ["D"])
+("pyramid" ["r"])
+("quack" ["ǹ"])
+("quail" ["OL"])
+("quaint" ["_쪺"])
+("qualification" [""])
+("qualify" ["P"])
+("quality" ["~"])
+("quantity" ["q"])
+("quarrel" ["n["])
+("quarrelsome" ["wn["])
+("quarry" ["w۳"])
+("quarter" ["|@"])
+("quartz" ["ۭ^"])
+("queen" ["k" "Z"])
+("queer" ["jǪ"])
+("quench" ["Ѵ"])
+("query" ["ð"])
+("quest" [""])
+("question" ["D"])
+("quick" [""])
+("quicken" ["["])
+("quickly" ["ܧ֦a"])
+("quicksilver" [""])
+("quiet" ["IR"])
+("quietly" ["wRa"])
+("quill" ["в"])
+("quilt" ["ֳQ"])
+("quit" [""])
+("quite" ["۷"])
+("quiver" ["Ÿ"])
+("quotation" ["ޥΥy"])
+("quote" ["޵"])
+("rabbit" ["ߤl"])
+("race" ["v"])
+("racial" ["رڪ"])
+("rack" ["["])
+("racket" ["y"])
+("radar" ["pF"])
+("radiance" [""])
+("radiant" ["g"])
+("radiate" ["g"])
+("radiator" ["x"])
+("radical" ["ڥ"])
+("radio" [""])
+("radium" ["J"])
+("radius" ["b|"])
+("raft" [""])
+("rag" ["}"])
+("rage" [""])
+("ragged" ["}ꪺ"])
+("raid" ["ŧ"])
+("rail" [""])
+("railing" ["ߤ"])
+("railroad" ["K"])
+("railway" ["yD"])
+("rain" ["B"])
+("rainbow" ["i"])
+("raindrop" ["Bw"])
+("rainfall" ["Bq"])
+("rainy" ["UB"])
+("raise" ["ɰ_"])
+("rally" ["ܫ¹B"])
+("ram" [""])
+("ramble" ["B"])
+("ranch" ["jA"])
+("random" ["N"])
+("range" ["d"])
+("rank" [""])
+("ransom" ["ū"])
+("rap" ["V"])
+("rapid" ["t"])
+("rapidity" ["t"])
+("rapidly" ["ta"])
+("rapt" ["gߪ"])
+("rapture" ["`"])
+("rare" ["}֪"])
+("rarely" ["}֦a"])
+("rascal" ["p^"])
+("rash" ["ll"])
+("rat" ["ѹ"])
+("rate" ["v" ""])
+("rather" ["@"])
+("ratify" [""])
+("ratio" ["v"])
+("rational" ["Xz"])
+("rattle" ["oǹn"])
+("ravage" ["}a"])
+("rave" ["q"])
+("raven" ["Q~" ""])
+("ravine" ["l"])
+("raw" ["ͪ"])
+("ray" ["u"])
+("razor" ["cM"])
+("reach" ["F"])
+("react" [""])
+("reaction" [""])
+("reactionary" ["ϰʤl"])
+("read" ["\Ū"])
+("reader" ["Ū"])
+("readily" ["ea"])
+("readiness" ["K"])
+("ready" ["ǳƦn"])
+("real" ["uꪺ"])
+("reality" ["{"])
+("realization" ["{"])
+("realize" ["{"])
+("really" ["ua"])
+("realm" [""])
+("reap" [""])
+("reaper" ["Ϊ"])
+("reappear" ["AX{"])
+("rear" ["᭱" "i|"])
+("reason" ["z"])
+("reasonable" ["Xz"])
+("reasonably" ["Xza"])
+("reasoning" ["z"])
+("reassure" ["AO"])
+("rebel" ["ϧܪ"])
+("rebellion" ["y"])
+("rebellious" ["ϫq"])
+("rebuff" ["^"])
+("rebuild" [""])
+("rebuke" ["d"])
+("recall" ["l^" "O_"])
+("recede" ["C"])
+("receipt" [""])
+("receive" [""])
+("receiver" [""])
+("recent" ["̪"])
+("recently" ["̪a"])
+("receptacle" ["e" "ᦫ"])
+("reception" ["۫"])
+("recess" [""])
+("reciever" [""])
+("recipe" [""])
+("reciprocal" ["f"])
+("recite" ["Iw"])
+("reckless" ["U@"])
+("reckon" ["p"])
+("reclaim" ["y"])
+("recline" [""])
+("recognition" ["{X"])
+("recognize" ["{X"])
+("recoil" ["h"])
+("recollect" ["^"])
+("recollection" ["^"])
+("recommend" [""])
+("recompense" ["S"])
+("reconcile" ["հ"])
+("reconstruct" [""])
+("reconstruction" [""])
+("record" ["O" "ۤ"])
+("recount" ["ԭz"])
+("recovery" ["" "_"])
+("recreation" ["T֤"])
+("recruit" ["۶"])
+("rectangle" [""])
+("rector" ["v"])
+("recur" ["{"])
+("red" [""])
+("redbreast" [""])
+("redden" ["ܬ"])
+("reddish" ["a⪺"])
+("redeem" ["ū^"])
+("reduction" [""])
+("reed" ["Ī"])
+("reef" ["tG"])
+("reel" ["b"])
+("refer" [""])
+("reference" ["ѦҮ"])
+("refine" [""])
+("refined" ["s"])
+("refinement" [""])
+("reflect" ["Ϯg"])
+("reflection" ["Ϯg"])
+("reform" ["ﭲ"])
+("reformer" ["ﭲ"])
+("refrain" ["T"])
+("refresh" ["_"])
+("refreshment" ["߲n"])
+("refrigerator" ["Bc"])
+("refuge" [""])
+("refugee" [""])
+("refusal" ["ڵ"])
+("refuse" ["ڵ"])
+("regain" ["_" "^"])
+("regal" ["Ҥ"])
+("regard" ["{"])
+("regardful" ["pߪ"])
+("regarding" [""])
+("regardless" ["U"])
+("regent" ["F"])
+("regime" ["Fv"])
+("regiment" ["@" "@s"])
+("region" ["a"])
+("register" ["U"])
+("registration" ["U"])
+("regret" ["ᮬ"])
+("regular" ["q`"])
+("regularity" ["Wh"])
+("regularly" ["`a"])
+("regulate" ["ե"])
+("regulation" ["Wh"])
+("rein" ["ŷ÷"])
+("reindeer" [""])
+("reinforce" ["W"])
+("reiterate" ["ϴ_"])
+("reject" ["ڵ"])
+("rejoice" ["ϡȰ"])
+("rejoicing" [""])
+("relate" ["s"])
+("relation" ["Y"])
+("relationship" ["Y"])
+("relative" ["˱" ""])
+("relatively" ["۹a"])
+("relax" ["P"])
+("release" [""])
+("relent" ["P"])
+("reliable" ["ia"])
+("relic" [""])
+("relief" ["Ѳ"])
+("relieve" ["Ѱ"])
+("religion" ["v"])
+("religious" ["vЪ"])
+("relinquish" [""])
+("relish" [""])
+("reluctance" ["jj"])
+("reluctant" ["jj"])
+("reluctantly" ["jja"])
+("rely" ["H"])
+("remain" ["O" "dU"])
+("remainder" ["l"])
+("remark" ["`N" ""])
+("remarkable" ["`"])
+("remarkably" ["`"])
+("remedy" ["v" "ɱ"])
+("remember" ["Oo"])
+("remembrance" [""])
+("remind" [""])
+("remit" ["ױH" "jK"])
+("remnant" [""])
+("remodel" [""])
+("remorse" [""])
+("remote" [""])
+("removal" ["M"])
+("remove" [""])
+("removed" [""])
+("renaissance" ["_"])
+("rend" [""])
+("render" ["ee" "y"])
+("renew" ["s" "q"])
+("renounce" ["" "_{"])
+("renown" ["W"])
+("rent" ["" "X"])
+("repair" ["ײz"])
+("reparation" ["v"])
+("repast" ["\"])
+("repeal" ["MP"])
+("repeat" [""])
+("repeated" ["ƪ"])
+("repeatedly" ["Ʀa"])
+("repel" ["X" "ڵ"])
+("repent" ["ᮬ"])
+("repentance" [""])
+("repetition" [""])
+("replace" [""])
+("replenish" ["ɥR"])
+("reply" [""])
+("report" ["i"])
+("reporter" ["ĳXO"])
+("represent" [""])
+("representation" ["N"])
+("reproach" ["wd"])
+("reproduce" ["ƻs"])
+("reproduction" ["ƻs"])
+("reproof" ["D"])
+("reprove" ["d"])
+("reptile" ["ΰʪ"])
+("republic" ["@M"])
+("republican" ["@MF"])
+("repulse" ["vh"])
+("reputation" ["n"])
+("repute" ["W"])
+("request" ["ШD"])
+("require" ["ݭn"])
+("requirement" ["n"])
+("requisite" ["n"])
+("rescue" [""])
+("research" ["s"])
+("resemblance" ["I"])
+("resemble" [""])
+("resent" ["n"])
+("resentment" ["n"])
+("reservation" ["w" "Od"])
+("reserve" ["w"])
+("reservoir" ["JB"])
+("reside" [""])
+("residence" ["v"])
+("resident" ["~"])
+("resign" ["¾"])
+("resignation" ["¾"])
+("resist" [""])
+("resistance" [""])
+("resolute" ["w"])
+("resolutely" ["Ma"])
+("resolution" ["M"])
+("resolve" ["UM"])
+("resolved" ["Mĳ"])
+("resort" ["Tֳ"])
+("resource" ["귽"])
+("respect" ["Lq"])
+("respectable" ["iLq"])
+("respectful" ["ܷqN"])
+("respectfully" ["Lqa"])
+("respecting" [""])
+("respective" ["ӧO"])
+("respectively" ["ӧOa"])
+("respond" ["^"])
+("response" [""])
+("responsibility" ["d"])
+("responsible" ["td"])
+("rest" [""])
+("restaurant" ["\]"])
+("restless" ["w"])
+("restoration" ["״_"])
+("restore" ["_쪬"])
+("restrain" [""])
+("restraint" [""])
+("restrict" [""])
+("restriction" [""])
+("result" ["G"])
+("resume" ["s}l"])
+("resurrection" ["_"])
+("retail" ["s"])
+("retain" ["O"])
+("retard" ["Ct"])
+("retire" ["h"])
+("retirement" ["h"])
+("retort" ["ϻ"])
+("retreat" ["Mh"])
+("return" ["k"])
+("reveal" [""])
+("revelation" ["o"])
+("revenge" [""])
+("revenue" ["J,q"])
+("revere" ["Lq"])
+("reverence" ["Lq"])
+("reverend" ["Lq"])
+("reverse" ["ۤ"])
+("revert" ["_"])
+("review" [""])
+("revise" ["׭q"])
+("revision" ["խq"])
+("revival" ["_d"])
+("revive" ["_d"])
+("revolt" ["ɰ"])
+("revolution" ["R"])
+("revolutionary" ["R"])
+("revolve" ["j"])
+("revolver" ["j"])
+("reward" ["S"])
+("rhetoric" [""])
+("rheumatism" [""])
+("rhyme" [""])
+("rhythm" ["۫"])
+("rib" ["ذ"])
+("ribbon" ["va"])
+("rice" [","])
+("rich" ["I"])
+("rid" ["ϧK"])
+("riddle" [""])
+("ride" ["M" ""])
+("rider" ["Mh"])
+("ridge" ["I"])
+("ridicule" ["M"])
+("ridiculous" ["ժ"])
+("rifle" ["Ӻֺj"])
+("rig" ["˸m"])
+("right" ["T"])
+("righteous" ["q"])
+("righteousness" ["q"])
+("rightful" [""])
+("righthand" ["k⪺"])
+("rigid" ["Tw"])
+("rim" [""])
+("ring" ["٤l"])
+("rinse" ["~"])
+("riot" ["ɰ"])
+("rip" [""])
+("ripe" [""])
+("ripen" [""])
+("ripple" [""])
+("rise" ["_" "@_"])
+("rising" ["k@"])
+("risk" ["_I"])
+("rival" ["Ī"])
+("rivalry" ["v"])
+("river" ["e"])
+("rivet" ["ϩTw"])
+("road" ["D"])
+("roadside" [""])
+("roadway" ["D"])
+("roam" ["r"])
+("roar" ["H"])
+("roast" ["MN"])
+("rob" ["mT"])
+("robber" ["js"])
+("robbery" [""])
+("robe" ["~T"])
+("robin" [""])
+("rock" [""])
+("rocket" ["b"])
+("rocky" ["۪"])
+("rod" ["" ""])
+("role" [""])
+("roll" ["u"])
+("rollcall" ["IW"])
+("roller" ["u"])
+("romance" ["ʷR"])
+("roof" ["γ"])
+("room" ["ж"])
+("rooster" [""])
+("root" [""])
+("rope" ["÷"])
+("rose" [""])
+("rosebud" [""])
+("rosy" ["z"])
+("rot" ["Ga"])
+("rotate" ["j"])
+("rotation" ["j"])
+("rotten" ["GѪ"])
+("rouge" ["گ"])
+("rough" ["ʪ"])
+("round" ["ꪺ"])
+("rouse" [""])
+("route" ["u"])
+("routine" ["`u@"])
+("rove" ["h"])
+("rover" ["y"])
+("row" ["@"])
+("royal" [""])
+("royalty" ["v"])
+("rub" ["|"])
+("rubber" [""])
+("rubbish" ["o"])
+("ruby" ["_"])
+("rude" ["L§"])
+("rudely" ["L§a"])
+("rug" ["l"])
+("rugged" ["T"])
+("ruin" [""])
+("rule" ["Wh"])
+("ruler" ["Ϊv"])
+("ruling" ["w"])
+("rum" ["s"])
+("rumble" [""])
+("rumor" [""])
+("run" ["]"])
+("runaway" ["k`"])
+("runner" ["]B"])
+("running" ["]"])
+("rural" ["mU"])
+("rush" ["t"])
+("rust" ["Kq"])
+("rustic" ["m"])
+("rusty" ["Gk"])
+("ruthless" ["L"])
+("sable" ["¶I"])
+("sack" ["jUl"])
+("sacred" ["t"])
+("sacrifice" ["묹"])
+("sad" ["ds"])
+("saddle" ["b"])
+("sadly" ["dha"])
+("sadness" ["ds"])
+("safe" ["w"])
+("safeguard" ["O@"])
+("safely" ["wa"])
+("safety" ["w"])
+("sag" ["P"])
+("sage" ["઺"])
+("sail" ["|"])
+("sailor" [""])
+("saint" ["tH"])
+("sake" ["tG"])
+("salad" ["F"])
+("salary" ["~"])
+("sale" ["P"])
+("salesman" ["f"])
+("salmon" ["D"])
+("salon" ["Fs"])
+("salt" ["Q"])
+("salute" ["q§"])
+("salvation" ["ϥ@"])
+("same" ["ۦP"])
+("sample" ["˫~"])
+("sanction" ["֭"])
+("sand" ["F"])
+("sandal" ["Dc"])
+("sandstone" ["F"])
+("sandwich" ["Tv"])
+("sandy" ["F"])
+("sane" ["YM"])
+("sanitary" ["åͪ"])
+("sanitation" ["åͳ]"])
+("sardine" ["FB"])
+("sash" ["a"])
+("satellite" ["ìP"])
+("satin" ["v"])
+("satire" ["ب"])
+("satisfactory" ["N"])
+("satisfy" ["N"])
+("saturday" ["P"])
+("satyr" ["T"])
+("sauce" ["ը"])
+("saucepan" [""])
+("saucer" ["pФl"])
+("saucy" ["N֪"])
+("sausage" ["z"])
+("savage" ["ѵM"])
+("save" ["@"])
+("saving" ["`"])
+("savior" ["@Ϫ"])
+("savor" [""])
+("saw" ["}"])
+("say" [""])
+("saying" ["W"])
+("scald" ["S"])
+("scale" ["S"])
+("scalp" ["Y"])
+("scamper" ["e"])
+("scan" ["Ӭ"])
+("scandal" [""])
+("scant" ["ʥF"])
+("scanty" ["ʥF"])
+("scar" ["Ͳ"])
+("scarce" ["ʥF"])
+("scarcely" ["XGS"])
+("scarcity" ["ʥF"])
+("scare" ["`"])
+("scarecrow" ["_H"])
+("scarf" ["y"])
+("scarlet" ["`"])
+("scatter" ["B"])
+("scene" ["p"])
+("scenery" [""])
+("scenic" [""])
+("scent" [""])
+("scepter" ["v"])
+("schedule" ["ɶ"])
+("scheme" ["p"])
+("scholar" ["Ǫ"])
+("scholarship" ["Ǫ"])
+("school" ["Ǯ"])
+("schoolboy" ["ǵ"])
+("schoolgirl" ["kǥ"])
+("schoolhouse" ["ժ"])
+("schoolmaster" ["ժ"])
+("schoolroom" ["Ы"])
+("schooner" ["jO"])
+("science" [""])
+("scientific" ["Ǫ"])
+("scientist" ["Ǯa"])
+("scissors" ["ŤM"])
+("scoff" ["J"])
+("scold" ["d|"])
+("scoop" ["@l"])
+("scope" [""])
+("scorch" ["NJ"])
+("score" ["o"])
+("scorn" [""])
+("scornful" [""])
+("scoundrel" ["Lţ"])
+("scour" ["~"])
+("scourge" ["a`"])
+("scout" ["lx"])
+("scowl" ["KY"])
+("scramble" ["Ͷ"])
+("scrap" ["sY" "ų"])
+("scrapbook" ["ŶKï"])
+("scrape" [""])
+("scratch" [""])
+("screech" ["ys"])
+("screen" ["" "ȹ"])
+("screw" ["v"])
+("script" ["Z"])
+("scripture" ["g"])
+("scroll" ["b"])
+("scrub" ["~" "O"])
+("scruple" ["U"])
+("sculptor" ["na"])
+("sculpture" ["n~"])
+("scurry" ["e"])
+("scuttle" ["ѽc"])
+("scythe" ["jIM"])
+("sea" ["v"])
+("seacoast" [""])
+("seal" ["L" "O" "\"])
+("seam" ["_"])
+("seaman" [""])
+("seaport" ["f"])
+("search" ["jd"])
+("searchlight" ["ӿO"])
+("seashore" [""])
+("seasick" ["w"])
+("seaside" [""])
+("season" ["u`"])
+("seat" ["y"])
+("seaweed" [""])
+("seclude" ["j"])
+("second" ["ĤG" "٦"])
+("secondary" ["n"])
+("secondhand" ["Gf"])
+("secrecy" ["K"])
+("secret" ["K"])
+("secretary" [""])
+("sect" ["v"])
+("section" [""])
+("secular" ["@U"])
+("secure" ["O@"])
+("security" ["w"])
+("see" ["ݨ"])
+("seed" ["ؤl"])
+("seedling" ["]"])
+("seeing" ["ѩ"])
+("seek" ["MD"])
+("seem" ["G"])
+("seeming" ["G"])
+("seesaw" ["ߪO"])
+("seethe" ["_wj"])
+("segment" [""])
+("seize" [""])
+("seldom" ["ܤ"])
+("select" ["D"])
+("selection" [""])
+("self" ["ۤv"])
+("selfish" ["ۨp"])
+("selfishness" ["ۨp"])
+("selfsame" ["P˪"])
+("sell" ["X"])
+("seller" ["D"])
+("semblance" ["ۦ"])
+("semicolon" [""])
+("senate" ["ĳ|"])
+("senator" ["ĳ"])
+("send" ["e" ""])
+("senior" ["~"])
+("sensation" ["P"])
+("sensational" ["H"])
+("sense" ["Px"])
+("senseless" ["Lı"])
+("sensibility" ["P"])
+("sensible" ["㪺"])
+("sensitive" ["ӷP"])
+("sentence" ["PM" "yl"])
+("sentiment" [""])
+("sentimental" ["ƪ"])
+("sentinel" ["L"])
+("separate" ["}"])
+("separation" [""])
+("september" ["E"])
+("sepulcher" ["X"])
+("sequence" [""])
+("serenade" ["p]"])
+("serene" ["wԪ"])
+("serge" ["ͼT"])
+("sergeant" ["xh" "ĵx"])
+("series" ["tC"])
+("serious" ["Y"])
+("sermon" ["D"])
+("serpent" ["D"])
+("servant" ["H"])
+("serve" ["ͭ"])
+("service" ["A"])
+("session" ["|"])
+("set" ["wm"])
+("settle" ["wy"])
+("settled" ["Tw"])
+("settlement" ["M" "ޥa"])
+("settler" ["w~"])
+("seven" ["C"])
+("seventeen" ["QC"])
+("seventeenth" ["ĤQC"])
+("seventh" ["ĤC" ""])
+("seventieth" ["ĤCQ"])
+("seventy" ["CQ"])
+("sever" ["_"])
+("several" ["X"])
+("severe" ["YF"])
+("severity" ["YF"])
+("sew" ["_"])
+("sewer" ["UD"])
+("sex" ["ʧO"])
+("shabby" ["}ª"])
+("shade" ["DB"])
+("shadow" ["v"])
+("shadowy" ["v"])
+("shady" ["D"])
+("shaft" ["b" "٬`"])
+("shaggy" [""])
+("shake" ["n"])
+("shale" [""])
+("shall" ["N"])
+("shallow" ["L"])
+("shalt" ["N"])
+("shame" ["ۮ"])
+("shameful" ["魱"])
+("shape" [""])
+("shapeless" ["SΪ"])
+("share" [""])
+("shark" ["T"])
+("sharp" ["UQ"])
+("sharpen" ["d"])
+("sharply" ["UQa"])
+("shatter" ["H"])
+("shave" [""])
+("shawl" ["y"])
+("she" ["o"])
+("sheaf" [""])
+("shear" ["_"])
+("sheath" ["T"])
+("shed" ["X"])
+("sheep" [""])
+("sheer" ["M"])
+("sheet" ["ɳ" "@i"])
+("shelf" ["O"])
+("shell" [""])
+("shellfish" [""])
+("shelter" ["óB"])
+("shepherd" ["Ϫ"])
+("sheriff" ["pvwx"])
+("shield" [""])
+("shift" [""])
+("shilling" ["O"])
+("shimmer" ["H"])
+("shin" ["~pL"])
+("shine" ["oG"])
+("shingle" [""])
+("shiny" ["oG"])
+("ship" [""])
+("shipment" ["˲"])
+("shipping" ["˳f"])
+("shipwreck" ["J"])
+("shirt" ["Ũ"])
+("shiver" ["o"])
+("shock" ["_"])
+("shoe" ["c"])
+("shoemaker" ["־cK"])
+("shoot" ["g"])
+("shop" [""])
+("shopkeeper" ["D"])
+("shopping" ["ʪ"])
+("shore" [""])
+("short" ["u"])
+("shortage" ["ʥF"])
+("shorten" ["˵u"])
+("shortening" ["˵u"])
+("shorthand" ["tO"])
+("shortly" ["["])
+("shortsighted" [""])
+("shot" ["og"])
+("should" ["N|"])
+("shoulder" ["ӻH"])
+("shout" ["s"])
+("shove" [""])
+("shovel" ["l"])
+("show" ["t" ""])
+("shower" ["JB"])
+("shred" ["H"])
+("shrewd" ["ӱ"])
+("shriek" ["ys"])
+("shrill" ["yU"])
+("shrine" [""])
+("shrink" ["Yp"])
+("shrivel" ["_K"])
+("shrub" [""])
+("shrug" ["q"])
+("shudder" ["o"])
+("shuffle" ["~ȵP"])
+("shun" [""])
+("shut" [""])
+("shutter" ["ʸ"])
+("shuttle" [""])
+("shy" ["`"])
+("sick" ["f"])
+("sicken" ["ϧ@"])
+("sickness" ["f"])
+("side" [""])
+("sidewalk" ["HD"])
+("siege" [""])
+("sieve" ["zl"])
+("sift" ["z"])
+("sigh" ["Į"])
+("sight" ["ı"])
+("sign" ["x,ñW"])
+("signal" ["H"])
+("signature" ["ñW"])
+("significance" ["n"])
+("significant" ["n"])
+("signify" [""])
+("silence" ["Hq"])
+("silent" ["Ln"])
+("silk" [""])
+("silkworm" [""])
+("silly" ["M"])
+("silver" [""])
+("silvery" ["Ȫ"])
+("similar" [""])
+("simple" ["²檺"])
+("simplicity" ["²"])
+("simplify" ["²"])
+("simply" ["²a"])
+("simultaneous" ["Pɪ"])
+("sin" ["oc"])
+("since" ["۱q"])
+("sincere" ["u"])
+("sincerely" ["ۼa"])
+("sincerity" ["u"])
+("sinew" ["xl" "Oq"])
+("sing" ["q"])
+("singer" ["q"])
+("single" ["W"])
+("singular" ["S"])
+("sinister" ["c"])
+("sink" ["H" ""])
+("sinner" ["oH"])
+("sip" ["㶼"])
+("sir" [""])
+("sire" ["դU"])
+("siren" ["ĵ"])
+("sister" ["nf"])
+("sit" [""])
+("site" ["m"])
+("situated" [""])
+("situation" ["p"])
+("six" [""])
+("sixteen" ["Q"])
+("sixteenth" ["ĤQ"])
+("sixth" ["Ĥ"])
+("sixtieth" ["ĤQ"])
+("sixty" ["Q"])
+("size" ["ؤo" "jp"])
+("skate" ["ȦBc"])
+("skeleton" ["["])
+("skeptical" ["hê"])
+("sketch" ["Z" "y"])
+("ski" ["Ƴ"])
+("skill" ["ޯ"])
+("skilled" ["m"])
+("skillful" ["m"])
+("skim" ["Jh"])
+("skin" ["ֽ"])
+("skip" ["D"])
+("skirmish" ["pĬ"])
+("skirt" ["Ȥl"])
+("skull" ["Y\"])
+("skunk" ["^"])
+("sky" ["Ѫ"])
+("skylark" [""])
+("skyscraper" ["ѺO"])
+("slab" ["ۤ" "O"])
+("slack" ["Ѵ" "wC"])
+("slacken" ["wC"])
+("slam" ["r"])
+("slander" [""])
+("slang" ["Zy"])
+("slant" ["ɱ"])
+("slap" ["x"])
+("slash" ["ζ"])
+("slate" ["۪O"])
+("slaughter" ["O"])
+("slave" [""])
+("slavery" [""])
+("slay" [""])
+("sled" [""])
+("sledge" ["" "j"])
+("sleek" ["ƪ"])
+("sleep" ["ı"])
+("sleeper" ["ίv"])
+("sleeping" ["ίv"])
+("sleepy" ["QΪ"])
+("sleet" ["Br"])
+("sleeve" ["Sl"])
+("sleigh" [""])
+("slender" ["Ӫ"])
+("slice" ["" ""])
+("slide" ["Ƹ"])
+("slight" ["L"])
+("slim" ["G"])
+("sling" ["u}" "Q÷"])
+("slip" ["ƭ" "Ȩ"])
+("slipper" ["c"])
+("slippery" ["ƷȪ"])
+("slogan" ["f" "лy"])
+("slope" ["ɱ"])
+("slow" ["wC"])
+("slug" ["p"])
+("slumber" ["ίv"])
+("slump" [""])
+("sly" ["K"])
+("smack" ["" ""])
+("small" ["p"])
+("smallpox" ["Ѫ"])
+("smart" [""])
+("smash" ["oH"])
+("smear" ["ż"])
+("smell" ["D"])
+("smile" ["L"])
+("smite" ["" "d"])
+("smith" ["uK"])
+("smock" ["nm"])
+("smoke" ["" ""])
+("smoking" ["_Ϫ"])
+("smooth" ["ƪ"])
+("smother" ["e" "\"])
+("smuggle" ["p"])
+("snail" [""])
+("snake" ["D"])
+("snap" ["_" "m"])
+("snare" ["" ""])
+("snarl" ["q" ""])
+("snatch" ["ܨ"])
+("sneak" [""])
+("sneer" ["J"])
+("sneeze" ["Q"])
+("sniff" ["l"])
+("snore" ["I"])
+("snort" ["@n"])
+("snow" [""])
+("snowy" [""])
+("snuff" ["lJ"])
+("snug" ["ξA"])
+("so" ["p"])
+("so-called" ["ҿ"])
+("soak" ["z"])
+("soap" ["Ψm"])
+("soar" [""])
+("sob" ["|"])
+("sober" ["M"])
+("soccer" ["y"])
+("social" ["|"])
+("socialism" ["|Dq"])
+("socialist" ["|Dq"])
+("society" ["|"])
+("sock" ["u"])
+("socket" ["y" "W"])
+("sod" ["a"])
+("soda" ["T"])
+("sofa" ["Fo"])
+("soft" ["Xn"])
+("soften" ["ܳn"])
+("soil" ["dg"])
+("sojourn" ["d"])
+("solace" ["w"])
+("solar" ["Ӷ"])
+("soldier" ["hL"])
+("sole" ["@"])
+("solemn" ["Yª"])
+("solemnity" ["Y"])
+("solicit" ["߮v"])
+("solid" ["T骺"])
+("solitary" ["W"])
+("solitude" ["W"])
+("solo" ["W" "W"])
+("solution" ["ѵ" ""])
+("solve" ["ѨM"])
+("somber" ["t"])
+("some" ["@"])
+("somebody" ["YH"])
+("somehow" ["G"])
+("someone" ["YH"])
+("something" ["Y"])
+("sometime" ["Y" ""])
+("sometimes" ["" ""])
+("somewhat" ["I"])
+("somewhere" ["YB"])
+("son" ["l"])
+("song" ["q"])
+("sonnet" ["Q|"])
+("soon" ["["])
+("soot" ["Ѧ"])
+("soothe" ["w"])
+("sordid" ["©"])
+("sore" ["kh"])
+("sorrow" ["d"])
+("sorrowful" ["d˪"])
+("sorry" ["p"])
+("sort" [""])
+("soul" ["F"])
+("sound" ["" "ձ" "n"])
+("soup" ["ü"])
+("sour" ["Ī"])
+("source" ["ӷ"])
+("south" ["n"])
+("southeast" ["Fn"])
+("southern" ["n誺"])
+("southward" ["Vn"])
+("southwest" ["n"])
+("southwestward" ["Vn"])
+("sovereign" ["㦳Dv"])
+("sovereignty" ["Dv"])
+("sow" [""])
+("space" ["Ŷ"])
+("spacious" ["s"])
+("spade" ["l"])
+("span" ["uɶ"])
+("spangle" ["{{"])
+("spank" ["@ڴx"])
+("spare" ["Ǯ"])
+("spark" [""])
+("sparkle" [""])
+("sparrow" ["³"])
+("speak" [""])
+("speaker" ["t"])
+("spear" [""])
+("special" ["SO"])
+("specialist" ["Ma"])
+("specialize" ["M"])
+("species" [""])
+("specific" ["S"])
+("specify" ["w"])
+("specimen" ["˫~"])
+("speck" ["I"])
+("speckle" ["pI"])
+("spectacle" ["_[" ""])
+("spectacular" ["["])
+("spectator" ["["])
+("specter" ["F"])
+("spectrum" [""])
+("speculate" [""])
+("speculation" [""])
+("speculative" ["z"])
+("speech" ["t"])
+("speechless" ["Xܨ"])
+("speed" ["tv"])
+("speedy" ["t"])
+("spell" [""])
+("spelling" ["r"])
+("spend" ["O"])
+("sphere" ["y"])
+("sphinx" ["HYਭ"])
+("spice" [""])
+("spider" ["j"])
+("spike" ["v"])
+("spill" ["ⱼ"])
+("spin" [""])
+("spinach" ["Ե"])
+("spindle" [""])
+("spine" ["I"])
+("spinning" ["´"])
+("spiral" ["ۧ"])
+("spire" ["y"])
+("spirit" ["믫"])
+("spiritual" ["FW"])
+("spit" ["R"])
+("splash" ["q}"])
+("splendid" ["V"])
+("splendor" ["m"])
+("splinter" ["H"])
+("split" [""])
+("spoil" ["V" "da"])
+("spoke" [""])
+("spokesman" ["oH"])
+("sponge" [""])
+("sponsor" ["٧U"])
+("spontaneous" ["۵M"])
+("spool" ["ub"])
+("spoon" [""])
+("spoonful" ["@"])
+("sport" ["B"])
+("sportsman" ["Bʮa"])
+("spot" ["I"])
+("spouse" ["t"])
+("spout" ["QX"])
+("spray" ["QX"])
+("spread" ["Ͻ"])
+("spring" ["K," "u®"])
+("sprinkle" ["x"])
+("sprout" [""])
+("spy" [""])
+("square" [""])
+("squash" [""])
+("squat" [""])
+("squeak" ["ssn"])
+("squeal" ["ynڭ"])
+("squeeze" [""])
+("squire" ["m"])
+("squirrel" ["Q"])
+("stab" [""])
+("stability" ["ww"])
+("stable" ["T"])
+("stack" [""])
+("stadium" ["|]"])
+("staff" ["¾"])
+("stag" [""])
+("stage" ["O,q"])
+("stagger" ["ڶ\"])
+("stain" ["I"])
+("stainless" ["ÿ"])
+("stair" ["ӱ"])
+("staircase" ["ӱ"])
+("stake" ["`"])
+("stale" ["sA"])
+("stalk" [""])
+("stall" ["CO"])
+("stammer" ["fY"])
+("stamp" ["l" "L" "y" ""])
+("stanch" ["" "j"])
+("stand" [""])
+("standard" ["з"])
+("standing" ["" "a"])
+("standpoint" ["߳"])
+("stanza" ["@`()"])
+("staple" ["W" "DD" "vѰw"])
+("star" ["P" "P"])
+("starch" [""])
+("stare" ["`"])
+("stark" ["w"])
+("starry" ["hP"])
+("start" ["Xo" "}l"])
+("startle" ["Y"])
+("startling" ["H"])
+("starvation" ["j"])
+("starve" ["j"])
+("state" ["{" "p" "n"])
+("stately" ["Y"])
+("statement" ["n"])
+("statesman" ["Fva"])
+("station" [""])
+("stationary" ["Tw"])
+("stationer" [""])
+("stationery" [""])
+("statistics" ["έp"])
+("statue" ["J"])
+("stature" [""])
+("status" ["p" "a"])
+("statute" ["kW"])
+("stay" ["d" "w"])
+("steadfast" ["Tw"])
+("steady" ["íw"])
+("steak" ["" ""])
+("steal" [""])
+("steam" ["]T"])
+("steamboat" ["T"])
+("steamer" ["]T"])
+("steamship" ["T"])
+("steed" ["@"])
+("steel" [""])
+("steep" ["Im"])
+("steeple" ["y"])
+("steer" ["rp"])
+("stem" ["" "`" "F"])
+("stenographer" ["tO"])
+("step" ["}B"])
+("stepmother" [""])
+("sterling" ["«~"])
+("stern" ["Y檺"])
+("stew" ["L"])
+("steward" ["Aȭ"])
+("stewardess" ["kA"])
+("stick" ["Ҥl" "J"])
+("sticky" ["ߪ"])
+("stiff" ["w"])
+("stiffen" ["ܵw"])
+("stifle" [""])
+("stigma" ["岫"])
+("still" ["R"])
+("stillness" ["R"])
+("stimulate" ["E"])
+("stimulus" ["E"])
+("sting" ["" "m"])
+("stir" ["ͩ"])
+("stirrup" [""])
+("stitch" ["wk"])
+("stock" ["sf" "Ѳ"])
+("stockholder" ["ѪF"])
+("stocking" [""])
+("stomach" ["G"])
+("stone" ["Y"])
+("stony" ["۪"])
+("stool" ["l" "jK"])
+("stoop" ["sy" "Y"])
+("stop" [""])
+("storage" ["xë"])
+("store" ["ө"])
+("storehouse" ["ܮw"])
+("storm" ["ɭB"])
+("stormy" ["ɭB"])
+("story" ["G"])
+("stout" ["κӪ"])
+("stove" ["l_"])
+("straight" [""])
+("straighten" ["˪"])
+("straightway" ["ߨ"])
+("strain" ["" "Ժ"])
+("strait" ["l"])
+("strand" ["@"])
+("strange" ["_Ǫ"])
+("stranger" ["ͤH"])
+("strap" ["ֱa" "⥴"])
+("stratagem" ["p"])
+("straw" ["_" "l"])
+("strawberry" [""])
+("stray" ["C"])
+("streak" ["u"])
+("stream" ["ˬy"])
+("streamer" ["a"])
+("street" ["D"])
+("streetcar" ["q"])
+("strength" ["O"])
+("strengthen" ["[j"])
+("strenuous" ["OO"])
+("stress" ["O" ""])
+("stretch" ["i}"])
+("stretcher" ["["])
+("strew" [""])
+("stricken" ["QI`"])
+("strict" ["Y檺"])
+("stride" ["jB"])
+("strife" ["n"])
+("strike" ["" "}u"])
+("striking" ["ޤH`ت" ""])
+("string" ["ӽu" "÷l"])
+("strip" ["" "汼"])
+("stripe" [""])
+("striped" [""])
+("strive" ["İ"])
+("stroke" ["" ""])
+("stroll" ["߷i" "e"])
+("strong" ["j"])
+("stronghold" ["n"])
+("structure" ["cy"])
+("struggle" ["İ" "ä"])
+("strut" ["B"])
+("stub" ["s"])
+("stubble" ["ݮ"])
+("stubborn" ["xT"])
+("stud" ["v"])
+("student" ["ǥ"])
+("studio" ["u@"])
+("study" ["Ū"])
+("stuff" ["F" ""])
+("stumble" ["̭" "ڶ\"])
+("stump" [""])
+("stun" ["fb"])
+("stunt" [""])
+("stupendous" ["H"])
+("stupid" ["Mª"])
+("sturdy" ["j"])
+("style" ["" ""])
+("subdue" ["A"])
+("subject" ["" "D" "X"])
+("subjunctive" ["]y"])
+("sublime" ["R"])
+("submarine" [""])
+("submerge" ["TS"])
+("submission" ["k"])
+("submit" ["ĳ"])
+("subordinate" ["ݪ"])
+("subscribe" ["q"])
+("subscriber" ["qʪ"])
+("subscription" ["pW" "q\"])
+("subsequent" ["Ӫ"])
+("subside" ["h"])
+("subsist" ["sb"])
+("substance" ["" ""])
+("substantial" ["jq"])
+("substitute" ["N"])
+("subtle" ["L"])
+("subtract" [""])
+("suburb" [""])
+("suburban" ["Ϫ"])
+("subway" ["aUK"])
+("succeed" ["~"])
+("success" ["\"])
+("successful" ["\"])
+("succession" ["s"])
+("successive" ["s"])
+("successor" ["~Ӫ"])
+("succor" [""])
+("such" ["o˪"])
+("suck" ["lm"])
+("sucker" ["bl"])
+("sudden" ["M"])
+("sue" ["i"])
+("suffer" ["W"])
+("sufferer" [""])
+("suffering" ["hW"])
+("sufficient" [""])
+("suffix" ["r"])
+("suffocate" [""])
+("sugar" ["}"])
+("suggest" ["ĳ" "t"])
+("suggestion" ["ĳ"])
+("suicide" ["۱"])
+("suit" ["@M" "D^"])
+("suitable" ["AX"])
+("suitcase" ["ⴣc"])
+("suite" ["M"])
+("suitor" ["_D"])
+("sulfur" ["D"])
+("sullen" ["~{"])
+("sum" ["`M"])
+("summary" ["Kn"])
+("summer" ["L"])
+("summit" [""])
+("summon" ["l"])
+("sumptuous" ["ת"])
+("sun" ["Ӷ"])
+("sunbeam" [""])
+("sunday" ["P"])
+("sundown" ["鸨"])
+("sunlight" [""])
+("sunny" [""])
+("sunrise" ["X"])
+("sunset" ["鸨"])
+("sunshine" [""])
+("superb" ["n"])
+("superficial" [""])
+("superfluous" ["hl"])
+("superintendent" ["ʷH"])
+("superior" ["uV"])
+("superiority" ["uV"])
+("superlative" ["̰"])
+("superstition" ["gH"])
+("superstitious" ["gH"])
+("supervise" ["ʷ"])
+("supervision" ["ʷ"])
+("supervisor" ["ʷ"])
+("supper" ["\"])
+("supplement" ["ɥR"])
+("supply" ["ѵ"])
+("support" [""])
+("supporter" ["Ta"])
+("suppose" [""])
+("supposedly" ["w"])
+("suppress" [""])
+("supremacy" ["ܰ"])
+("supreme" ["ܤW"])
+("sure" ["T"])
+("surface" [""])
+("surge" ["j"])
+("surgeon" ["~"])
+("surgery" ["~N"])
+("surmise" [""])
+("surmount" ["Գ"])
+("surname" ["m"])
+("surpass" ["u"])
+("surplus" ["Ѿl"])
+("surprise" ["ϦY"])
+("surprisingly" ["OH岧"])
+("surrender" ["" "뭰"])
+("surround" [""])
+("surrounding" [""])
+("survey" ["[" "q"])
+("survive" ["ͦs"])
+("survivor" ["٪"])
+("susceptible" ["eʷn"])
+("suspect" ["h"])
+("suspend" ["Ȯɰ"])
+("suspense" ["a"])
+("suspension" ["a"])
+("suspicion" ["ä"])
+("suspicious" ["iê"])
+("sustain" [""])
+("swallow" ["]"])
+("swamp" ["hA"])
+("swan" ["Z"])
+("swarm" ["s"])
+("sway" ["n"])
+("swear" ["o}"])
+("sweat" ["o"])
+("sweater" [""])
+("sweep" [""])
+("sweeping" ["զp}˪"])
+("sweet" [""])
+("sweeten" ["["])
+("sweetheart" ["RH"])
+("sweetness" [""])
+("swell" [""])
+("swift" ["֪"])
+("swim" ["a"])
+("swine" [""])
+("swing" ["\"])
+("swirl" ["x"])
+("switch" ["}" ""])
+("swollen" ["Ȥj"])
+("sword" ["C"])
+("syllable" ["`"])
+("symbol" ["Hx"])
+("symmetrical" ["٩ʪ"])
+("sympathetic" ["Pߪ"])
+("sympathize" ["P"])
+("sympathy" ["P"])
+("symphony" ["T"])
+("symptom" ["x" "g"])
+("syndicate" ["pX´"])
+("synonym" ["Pqr"])
+("syntax" ["yk"])
+("syrup" ["}"])
+("system" ["t"])
+("systematic" ["tΪ"])
+("table" ["l"])
+("tablet" ["O"])
+("tack" ["jYv"])
+("tackle" ["Ψ"])
+("tact" [""])
+("tactics" [""])
+("tag" [""])
+("tail" [""])
+("tailor" ["_v"])
+("taint" ["I"])
+("take" [""])
+("tale" ["G"])
+("talent" ["~"])
+("talk" ["ͽ"])
+("tall" [""])
+("tame" ["A"])
+("tan" ["Ŧ"])
+("tangle" [""])
+("tank" [""])
+("tap" ["" "sY"])
+("tape" ["a" "a"])
+("taper" ["y"])
+("tapestry" ["¸c"])
+("tar" ["Jo"])
+("tardy" ["wC"])
+("target" ["ؼ"])
+("tariff" ["|"])
+("tarry" [""])
+("tart" ["G`"])
+("task" ["u@"])
+("tassel" ["J"])
+("taste" ["" "~"])
+("tatter" ["H"])
+("tavern" ["ȴ"])
+("tawny" ["Ŧ"])
+("tax" ["|"])
+("taxation" ["|"])
+("taxi" ["p{"])
+("taxpayer" ["ǵ|H"])
+("tea" [""])
+("teach" ["о"])
+("teacher" ["Ѯv"])
+("team" ["ζ"])
+("tear" ["\" "}"])
+("tease" [""])
+("teaspoon" [""])
+("technical" ["޳N"])
+("technique" ["޳N"])
+("tedious" ["F"])
+("teem" ["R"])
+("telegram" ["q"])
+("telegraph" ["q"])
+("telephone" ["q"])
+("telescope" ["沴"])
+("tell" ["iD"])
+("teller" ["Xǭ"])
+("temper" ["ʮ"])
+("temperament" [""])
+("temperance" ["`"])
+("temperate" ["`"])
+("temperature" ["ū"])
+("tempest" ["ɭB"])
+("temple" ["xq"])
+("temporary" ["Ȯɪ"])
+("tempt" ["Ĥ"])
+("temptation" ["b"])
+("tempting" ["gH"])
+("ten" ["Q"])
+("tenant" ["Ы"])
+("tend" ["V" "Ӯ"])
+("tendency" ["Ͷ"])
+("tender" ["ӹ઺"])
+("tenderness" ["ũM"])
+("tenement" ["v"])
+("tennis" ["y"])
+("tenor" ["k"])
+("tense" ["Ժ" "ɺA"])
+("tension" ["O"])
+("tent" ["bO"])
+("tenth" ["ĤQ"])
+("term" ["Ny"])
+("terminal" ["I"])
+("terminate" [""])
+("terrace" ["x"])
+("terrible" ["iȪ"])
+("terribly" ["iȦa"])
+("terrific" ["D`"])
+("terrify" ["~"])
+("territory" ["g"])
+("terror" [""])
+("test" ["Ҹ"])
+("testament" [""])
+("testify" ["ҹ"])
+("text" [""])
+("textbook" ["Ь"])
+("textile" ["´~"])
+("texture" ["a"])
+("than" [""])
+("thank" ["P"])
+("thankful" ["Pª"])
+("thanksgiving" ["P"])
+("that" [""])
+("thatch" ["Tγ"])
+("thaw" ["ѭ"])
+("the" ["o"])
+("theater" ["|"])
+("theatrical" ["@ƪ"])
+("thee" ["A"])
+("theft" [""])
+("their" ["L̪"])
+("theirs" ["L̪F"])
+("them" ["L"])
+("theme" ["DD"])
+("themselves" ["L̦ۤv"])
+("then" [""])
+("thence" ["q"])
+("theological" ["Ǫ"])
+("theology" [""])
+("theory" ["z"])
+("there" [""])
+("thereabout" ["b"])
+("thereafter" ["b"])
+("thereby" ["]"])
+("therefore" ["ҥH"])
+("therein" ["b䤤"])
+("thereof" [""])
+("thereon" ["bW"])
+("thereupon" ["ߨ"])
+("therewith" ["H"])
+("thermometer" ["ū׭p"])
+("these" ["o"])
+("they" ["L"])
+("thick" ["p"])
+("thicken" ["ܫp"])
+("thicket" ["OL"])
+("thickness" ["p"])
+("thief" ["Ѹ"])
+("thigh" ["jL"])
+("thimble" ["w"])
+("thin" [""])
+("thine" ["A"])
+("thing" ["F"])
+("think" [""])
+("third" ["ĤT"])
+("thirst" ["f"])
+("thirsty" [""])
+("thirteen" ["QT"])
+("thirteenth" ["ĤQT"])
+("thirtieth" ["ĤTQ"])
+("thirty" ["TQ"])
+("this" ["o"])
+("thistle" [""])
+("thither" ["쨺"])
+("thorn" [""])
+("thorough" [""])
+("those" [""])
+("thou" ["A"])
+("though" ["M"])
+("thought" ["["])
+("thoughtful" ["ߪ"])
+("thoughtless" ["`N"])
+("thousand" ["d"])
+("thrash" ["@"])
+("thread" ["ӽu"])
+("threat" ["¯"])
+("threaten" ["¯"])
+("three" ["T"])
+("threshold" ["J"])
+("thrice" ["Ta"])
+("thrift" ["`"])
+("thrifty" ["`"])
+("thrill" ["Ÿ"])
+("thrive" [""])
+("throat" ["V"])
+("throb" [""])
+("throne" ["y"])
+("throng" ["s"])
+("through" ["gL"])
+("throughout" ["M"])
+("throw" ["ᱼ"])
+("thrush" ["eܳ"])
+("thrust" ["J"])
+("thumb" [""])
+("thump" [""])
+("thunder" ["pn"])
+("thursday" ["P|"])
+("thus" ["p"])
+("thwart" [""])
+("thyself" ["Aۤv"])
+("tick" ["wn"])
+("ticket" [""])
+("tickle" ["ko"])
+("tide" [""])
+("tidings" [""])
+("tidy" ["䪺"])
+("tie" [""])
+("tiger" ["Ѫ"])
+("tight" [""])
+("tighten" [""])
+("tile" ["j"])
+("till" [""])
+("tilt" ["ɱ"])
+("timber" [""])
+("time" ["ɶ"])
+("timely" ["ήɪ"])
+("timid" ["xp"])
+("tin" [""])
+("tinge" ["V"])
+("tingle" ["h"])
+("tinker" ["׸ɦK"])
+("tinkle" ["mn"])
+("tint" ["m"])
+("tiny" ["Yp"])
+("tip" ["pO"])
+("tiptoe" ["ky"])
+("tire" ["h"])
+("tired" ["hª"])
+("tiresome" ["Q"])
+("tissue" ["´" ""])
+("title" ["D"])
+("to" ["V" ""])
+("toad" [""])
+("toast" ["Nѥ]"])
+("tobacco" ["ϯ"])
+("today" [""])
+("toe" ["}k"])
+("together" ["@_"])
+("toil" ["Ҳ"])
+("toilet" ["Z"])
+("token" ["Hx"])
+("tolerable" ["ieԪ"])
+("tolerate" ["ee"])
+("toll" ["q|"])
+("tomato" ["X"])
+("tomb" ["X"])
+("tomorrow" [""])
+("ton" [""])
+("tone" [""])
+("tongs" ["X"])
+("tongue" ["Y"])
+("tonight" [""])
+("tonnage" [""])
+("too" [""])
+("tool" ["u"])
+("tooth" [""])
+("top" [""])
+("topic" ["D"])
+("torch" [""])
+("torment" ["i"])
+("torrent" ["y"])
+("tortoise" ["t"])
+("torture" ["i"])
+("toss" ["Y"])
+("total" ["`p"])
+("totally" ["β"])
+("totter" ["ڶ\"])
+("touch" ["ĲN"])
+("touching" ["ʤH"])
+("tough" ["jw"])
+("tour" ["PC"])
+("tourist" ["["])
+("tournament" ["v"])
+("tow" ["쨮" ""])
+("toward" ["¦V"])
+("towel" ["y"])
+("tower" [""])
+("towering" ["q"])
+("town" [""])
+("township" [""])
+("toy" [""])
+("trace" ["H"])
+("track" ["]D"])
+("tractor" ["즲"])
+("trade" ["ͷN"])
+("trader" ["ӤH"])
+("tradesman" ["s"])
+("tradition" ["ǲ"])
+("traditional" ["ǲΪ"])
+("traffic" ["q"])
+("tragic" ["d@"])
+("trail" [",u"])
+("trailer" ["ʩЫ"])
+("train" ["C"])
+("trainer" ["Vm"])
+("training" ["Vm"])
+("trait" ["Sx"])
+("traitor" ["qf"])
+("tram" ["q"])
+("tramp" [""])
+("trample" [""])
+("tranquil" ["R"])
+("tranquility" ["R"])
+("transact" [""])
+("transaction" [""])
+("transfer" ["E"])
+("transform" ["ܴ"])
+("transformation" ["ܴ"])
+("transient" ["ȮɱH"])
+("transit" ["B"])
+("transition" ["Lɴ"])
+("transitive" ["Ϊ"])
+("translate" ["½Ķ"])
+("translation" ["½Ķ"])
+("transmission" ["ǰe"])
+("transmit" ["ǰe"])
+("transparent" ["z"])
+("transport" ["e"])
+("transportation" ["B"])
+("transverse" ["_"])
+("trap" ["M"])
+("travel" ["C"])
+("traveler" ["ȫ"])
+("traverse" ["L"])
+("tray" ["Ll"])
+("treachery" ["Iq"])
+("tread" [""])
+("treason" ["qf"])
+("treasure" ["]_"])
+("treasurer" ["Xǭ"])
+("treasury" ["_w"])
+("treat" [""])
+("treatise" ["׭z"])
+("treatment" ["ݹJ"])
+("treaty" [""])
+("treble" ["T"])
+("tree" [""])
+("tremble" ["o"])
+("tremendous" ["ܤj"])
+("tremulous" ["oݪ"])
+("trench" ["뷾"])
+("trend" ["Ͷ"])
+("trespass" ["I`"])
+("trial" [",fP"])
+("triangle" ["T"])
+("tribe" [""])
+("tribute" ["^"])
+("trick" ["Z"])
+("trickle" ["wy"])
+("trifle" [""])
+("trifling" ["ǳ\"])
+("trim" ["װ"])
+("trinity" ["T@"])
+("trip" ["Ȧ" "ȵ{"])
+("triple" ["T"])
+("triumph" ["ͱ"])
+("triumphant" ["Ӫ"])
+("trivial" ["Ӫ"])
+("trolley" [""])
+("troop" ["x"])
+("trophy" [""])
+("tropic" ["a"])
+("tropical" ["a"])
+("trot" ["֨B]"])
+("trouble" ["x"])
+("troublesome" ["·Ъ"])
+("trough" [""])
+("trouser" ["Ǥl"])
+("trout" ["L"])
+("truck" ["d"])
+("true" ["u"])
+("truly" ["ua"])
+("trumpet" ["z"])
+("trunk" ["߷F"])
+("trust" ["H"])
+("trustee" ["UH"])
+("trusting" ["۫H"])
+("trusty" ["iH"])
+("truth" ["uz"])
+("truthful" ["۹ꪺ"])
+("try" [""])
+("trying" [""])
+("tub" ["D"])
+("tube" [""])
+("tuck" ["i"])
+("tuesday" ["PG"])
+("tug" ["j"])
+("tulip" ["{"])
+("tumble" ["u"])
+("tune" ["դl"])
+("tunnel" ["GD"])
+("turbulent" ["íwy"])
+("turf" ["a"])
+("turn" [""])
+("turnip" [""])
+("turtle" ["t"])
+("tutor" ["axЮv"])
+("tweed" ["ׯnO"])
+("twelfth" ["ĤQG"])
+("twelve" ["QG"])
+("twentieth" ["ĤGQ"])
+("twenty" ["GQ"])
+("twice" ["⦸"])
+("twilight" ["L"])
+("twin" ["ML"])
+("twine" ["Xѽu"])
+("twinkle" ["{G"])
+("twinkling" ["{{"])
+("twist" [""])
+("two" ["G"])
+("type" ["˦,r"])
+("typewriter" ["r"])
+("typhoid" ["˴Hg"])
+("typhoon" ["䭷"])
+("typical" ["嫬"])
+("typist" ["r"])
+("tyranny" ["ɬF"])
+("tyrant" ["ɧg"])
+("ugly" ["઺"])
+("ultimate" ["̫᪺"])
+("ultimately" ["̫"])
+("umpire" ["P"])
+("unable" [""])
+("unanimous" ["@P"])
+("unarmed" ["Z˪"])
+("unaware" ["ı"])
+("unbearable" ["Ԩ"])
+("unbroken" ["㪺"])
+("uncertainty" ["Tw"])
+("unchanged" ["ܪ"])
+("uncle" ["B" ""])
+("uncomfortable" ["ξA"])
+("uncommon" ["}"])
+("unconscious" ["hNѪ"])
+("unconsciously" ["LNѦa"])
+("uncover" ["S"])
+("under" ["bU"])
+("underbrush" ["O"])
+("undergo" ["g"])
+("underground" ["baU"])
+("underline" ["u"])
+("underneath" ["bU"])
+("understand" ["F" ""])
+("understanding" ["z"])
+("undertake" ["Ӿ"])
+("underwear" [""])
+("underworld" ["a"])
+("undesirable" ["QH"])
+("undisturbed" ["wR"])
+("undo" ["Ѷ}"])
+("undone" [""])
+("undress" ["A"])
+("uneasily" ["ۦba"])
+("uneasiness" ["ۦb"])
+("uneasy" ["w"])
+("unemployment" ["~"])
+("unequal" ["Ū"])
+("uneven" [""])
+("unexpected" ["N~"])
+("unfair" [""])
+("unfavorable" ["Q"])
+("unfinished" [""])
+("unfit" ["A"])
+("unfold" ["i}"])
+("unfortunate" [""])
+("unfortunately" ["a"])
+("ungrateful" ["Ѯtq"])
+("uniform" ["A"])
+("uniformly" ["ۦPa"])
+("unimportant" ["n"])
+("union" ["p" "u|"])
+("unique" ["ߤ@"])
+("unit" [""])
+("unite" ["pX"])
+("united" ["pX"])
+("unity" ["@" ""])
+("universal" ["tz"])
+("universally" ["Ma"])
+("universe" ["tz"])
+("university" ["j"])
+("unjust" [""])
+("unkind" [""])
+("unknown" [""])
+("unless" ["D"])
+("unlike" ["P"])
+("unlimited" ["L"])
+("unload" ["U"])
+("unlock" ["}"])
+("unlucky" [""])
+("unmarried" ["B"])
+("unmoved" ["ʷn"])
+("unnatural" ["۵M"])
+("unnecessary" ["n"])
+("unoccupied" ["SH"])
+("unpleasant" ["r֪"])
+("unprecedent" ["ūe"])
+("unreasonable" ["Xz"])
+("unrest" ["w"])
+("unseen" ["ݤ"])
+("unspeakable" ["Lkήe"])
+("unsuccessful" ["\"])
+("untie" ["Ѷ}"])
+("until" [""])
+("unto" ["" ""])
+("untouched" ["Ϊ"])
+("untrue" ["Tꪺ"])
+("unusual" ["`"])
+("unwelcome" ["w諸"])
+("unwilling" ["@"])
+("unwise" [""])
+("unworthy" ["ȱo"])
+("up" ["VWa"])
+("uphold" ["" "|_"])
+("upland" ["a"])
+("uplift" ["_"])
+("upon" ["bȤW"])
+("upper" ["W"])
+("upright" ["ߪ"])
+("uprising" ["q"])
+("uproar" ["̰"])
+("uproot" ["ޮ"])
+("upset" ["дo"])
+("upside" ["W"])
+("upward" ["VWa"])
+("upwards" ["VWa"])
+("urchin" ["x"])
+("urge" ["ʫP"])
+("urgent" ["檺"])
+("urn" ["»"])
+("us" ["ڭ"])
+("usage" ["Ϊk"])
+("use" ["Q"])
+("useful" ["Ϊ"])
+("useless" ["LΪ"])
+("usher" ["۫ݭ"])
+("usual" ["`"])
+("usurp" ["Q"])
+("utensil" ["Ψ"])
+("utility" ["qƷ~"])
+("utilize" ["Q"])
+("utmost" ["ݪ"])
+("utter" ["" "X"])
+("utterance" ["o"])
+("vacancy" ["ů"])
+("vacant" ["Ū"])
+("vacation" [""])
+("vacuum" ["u"])
+("vagabond" ["y"])
+("vagrant" ["y"])
+("vague" ["tk"])
+("vain" ["LĪ"])
+("vale" ["" "A|"])
+("valiant" ["^i"])
+("valley" ["s"])
+("valor" ["i"])
+("valuable" ["Ȫ"])
+("valuation" [""])
+("value" [""])
+("valve" [""])
+("van" ["f"])
+("vanish" [""])
+("vanity" ["B"])
+("vanquish" ["A"])
+("vapor" ["]"])
+("variable" ["|ܪ"])
+("variation" ["ܤ"])
+("varied" ["P"])
+("variety" ["ܤ"])
+("various" ["P"])
+("varnish" ["o"])
+("vary" [""])
+("vase" ["~"])
+("vassal" ["e"])
+("vast" ["jq"])
+("vat" ["j"])
+("vault" [""])
+("vegetable" [""])
+("vegetation" ["Ӫ"])
+("vehemence" ["rP"])
+("vehement" ["rP"])
+("vehicle" [""])
+("veil" ["n"])
+("vein" [""])
+("velocity" ["t"])
+("velvet" [""])
+("venerable" ["iq"])
+("vengeance" ["_"])
+("venom" ["r"])
+("vent" ["Xf"])
+("ventilate" ["q"])
+("ventilation" ["q"])
+("venture" ["_I"])
+("veranda" ["Y"])
+("verb" ["ʵ"])
+("verdict" ["PM"])
+("verge" ["t"])
+("verify" [""])
+("verily" ["ua"])
+("verse" [""])
+("version" [""])
+("vertical" [""])
+("very" [""])
+("vessel" ["e" ""])
+("vest" ["I"])
+("vestige" [""])
+("veteran" ["hxH"])
+("veto" ["_M"])
+("vex" ["E"])
+("vexation" ["Wo"])
+("vibrate" ["_"])
+("vibration" ["_"])
+("vice" ["oc"])
+("vicepresident" ["`"])
+("vicinity" [""])
+("vicious" ["c"])
+("victim" ["`"])
+("victor" ["ӧQ"])
+("victory" ["ӧQ"])
+("view" [""])
+("viewpoint" ["[I"])
+("vigilance" ["ĵ"])
+("vigor" ["O"])
+("vigorous" ["ORK"])
+("vile" ["cH"])
+("villa" ["O"])
+("village" ["m"])
+("villager" [""])
+("villain" ["c"])
+("vine" ["ý"])
+("vinegar" ["L"])
+("vineyard" [""])
+("violate" ["H"])
+("violation" ["Ǫk"])
+("violence" ["ɶ"])
+("violent" ["jɪ"])
+("violet" ["ù"])
+("violin" ["p^"])
+("viper" ["rD"])
+("virgin" ["Bk"])
+("virtually" ["W"])
+("virtue" ["Dw"])
+("virtuous" ["w檺"])
+("visible" ["ݱo"])
+("vision" ["O"])
+("visit" ["X"])
+("visitor" ["Xݪ"])
+("visual" ["ı"])
+("vital" ["O"])
+("vitality" ["ͩRO"])
+("vitamin" ["LR"])
+("vivid" ["Ͱʪ"])
+("vocabulary" ["yJ"])
+("vocal" ["on"])
+("vogue" ["ɻ"])
+("voice" ["n"])
+("void" ["Ū"])
+("volcanic" ["s"])
+("volcano" ["s"])
+("volleyball" ["Ʋy"])
+("volume" ["U"])
+("voluntary" ["@"])
+("volunteer" ["@"])
+("vote" ["벼"])
+("vow" ["}"])
+("vowel" [""])
+("voyage" [""])
+("vulgar" ["ʫU"])
+("wade" ["bB"])
+("wafer" ["Pƻ氮"])
+("wag" ["n\"])
+("wage" ["u" "~"])
+("wager" ["`"])
+("wagon" ["Bf"])
+("wail" ["s_"])
+("waist" ["y"])
+("waistcoat" ["I"])
+("wait" [""])
+("waiter" ["ͪ"])
+("waiting" [""])
+("wake" [""])
+("waken" [""])
+("walk" [""])
+("wall" [""])
+("wallet" ["U"])
+("walnut" ["J"])
+("wand" [""])
+("wander" ["r"])
+("wanderer" ["y"])
+("wane" [""])
+("war" ["Ԫ"])
+("ward" ["f"])
+("warden" ["庻"])
+("wardrobe" ["p"])
+("ware" [""])
+("warehouse" ["ܮw"])
+("warfare" ["Ԫ"])
+("warlike" ["nԪ"])
+("warm" ["ŷx"])
+("warmth" ["ŷx"])
+("warning" ["ĵi"])
+("warp" ["s"])
+("warrant" ["O"])
+("warrior" ["Ԥh"])
+("warship" ["xĥ"])
+("wary" ["ĵı"])
+("was" ["O"])
+("wash" ["~"])
+("washing" ["~"])
+("wasp" [""])
+("waste" ["O"])
+("wasteful" ["O"])
+("watch" ["`N"])
+("watchful" ["`N"])
+("watchman" ["ݤ"])
+("water" [""])
+("waterfall" ["r"])
+("waterproof" [""])
+("waterway" [""])
+("watery" ["t"])
+("wave" ["i"])
+("waver" ["n\"])
+("wax" ["" ""])
+("way" ["D"])
+("wayside" [""])
+("wayward" ["ʪ"])
+("we" ["ڭ"])
+("weak" ["z"])
+("weaken" ["dz"])
+("weakness" ["z"])
+("wealth" ["]I"])
+("wealthy" ["I"])
+("weapon" ["Z"])
+("wear" ["a"])
+("wearily" ["hҦa"])
+("weariness" ["h"])
+("weary" ["hҪ"])
+("weasel" ["T"])
+("weather" ["Ѯ"])
+("weave" ["s´"])
+("weaver" ["´"])
+("web" ["´~" ""])
+("wed" ["B"])
+("wedding" ["B§"])
+("wedge" ["Ϊ"])
+("wednesday" ["PT"])
+("wee" ["Ӥp"])
+("week" ["P"])
+("weekday" ["`"])
+("weekend" ["P"])
+("weep" ["_"])
+("weigh" ["٭"])
+("weight" ["q"])
+("weird" ["ǲ"])
+("welcome" ["w"])
+("welfare" ["֧Q"])
+("well" ["ܦn"])
+("wellknown" ["ۦW"])
+("were" ["O"])
+("west" [""])
+("western" ["誺"])
+("westward" ["V誺"])
+("wet" ["ê"])
+("whale" ["H"])
+("wharf" ["XY"])
+("whatever" ["Lצp"])
+("wheat" ["p"])
+("wheel" ["l"])
+("when" [""])
+("whence" ["B" "H"])
+("whenever" ["Lצ"])
+("where" ["B"])
+("whereas" ["M"])
+("whereby" ["p"])
+("wherefore" ["G"])
+("wherein" ["b䤤"])
+("whereupon" ["O"])
+("wherever" ["LצB"])
+("whether" ["O_"])
+("which" ["@"])
+("whichever" ["Lצ"])
+("while" ["Ȯ"])
+("whim" ["MY"])
+("whimper" ["|"])
+("whine" ["oc"])
+("whip" ["@"])
+("whir" ["IIn"])
+("whirl" [""])
+("whirlwind" ["ۭ"])
+("whisk" ["ر"])
+("whisker" ["ĲŽ"])
+("whisky" ["¤hҰs"])
+("whisper" ["ջy"])
+("whistle" ["jf"])
+("whit" ["@I"])
+("white" ["զ"])
+("whiten" ["}"])
+("whiteness" ["զ"])
+("whither" ["VB"])
+("who" ["H"])
+("whoever" ["LצH"])
+("whole" [""])
+("wholesale" ["o"])
+("wholesome" ["q"])
+("wholly" ["a"])
+("whom" [""])
+("whoop" ["Isn"])
+("whose" ["֪"])
+("why" [""])
+("wicked" ["c"])
+("wide" ["e"])
+("widely" ["sxa"])
+("widen" ["[e"])
+("widespread" ["Ϊ"])
+("widow" [""])
+("width" ["e"])
+("wife" ["dl"])
+("wig" ["v"])
+("wigwam" ["bO"])
+("wild" ["ͪ"])
+("wildcat" [""])
+("wilderness" [""])
+("will" ["N" "" "|"])
+("willful" ["@"])
+("willing" ["@"])
+("willingness" ["N@"])
+("willow" ["h"])
+("wilt" ["\"])
+("win" [""])
+("wince" ["h"])
+("wind" ["" "s" "W"])
+("winding" ["j"])
+("windmill" [""])
+("window" ["l"])
+("windy" [""])
+("wine" ["Gs"])
+("wink" ["w"])
+("winner" ["ӧQ"])
+("winning" ["ӧQ"])
+("winter" ["V"])
+("wintry" ["HV"])
+("wipe" [""])
+("wire" ["qu"])
+("wireless" ["Luq"])
+("wiry" ["ݽu"])
+("wise" ["o"])
+("wish" ["@"])
+("wishful" ["檺"])
+("wit" [""])
+("witch" ["űC"])
+("witchcraft" ["ųN"])
+("with" ["M"])
+("withal" ["S" "åB"])
+("withdraw" ["M^"])
+("wither" ["\"])
+("withhold" ["d"])
+("within" ["bȤ"])
+("without" ["S"])
+("withstand" [""])
+("witness" ["ҤH"])
+("witty" [""])
+("wizard" ["k"])
+("woe" ["dh"])
+("woeful" ["dh"])
+("wolf" ["T"])
+("woman" ["kH"])
+("wonder" ["_"])
+("wonderful" ["_"])
+("wondrous" ["H"])
+("wont" ["ߺD"])
+("woo" ["DR"])
+("wood" [""])
+("wooded" ["h쪺"])
+("wooden" ["s"])
+("woodland" ["La"])
+("woodman" [""])
+("woodpecker" ["֤쳾"])
+("wool" ["Ϥ"])
+("woolen" ["Ϥ"])
+("word" ["r"])
+("work" ["u@"])
+("worker" ["uH"])
+("working" ["u@"])
+("workmanship" [""])
+("workshop" ["u@"])
+("world" ["@"])
+("worldly" ["@U"])
+("worm" [""])
+("worry" ["Ϸдo"])
+("worse" ["a"])
+("worship" ["R"])
+("worshipper" ["R"])
+("worst" ["a"])
+("worth" ["ȱo"])
+("worthless" ["LΪ"])
+("worthy" ["ȱo"])
+("wound" [""])
+("wrap" ["]"])
+("wrath" [""])
+("wreath" [""])
+("wreathe" [""])
+("wreck" ["J"])
+("wrench" ["۹X"])
+("wrest" [""])
+("wrestle" ["L"])
+("wrestling" ["L"])
+("wriggle" ["įʫei"])
+("wrinkle" ["K"])
+("wrist" [""])
+("writ" ["O"])
+("write" ["g"])
+("writer" ["@a"])
+("writing" ["ۭz"])
+("wrong" [""])
+("yacht" ["C"])
+("yard" ["x|" "X"])
+("yarn" ["u"])
+("yawn" [""])
+("yea" ["O"])
+("year" ["~"])
+("yearly" ["C~"])
+("yeast" ["å"])
+("yell" ["s"])
+("yellow" [""])
+("yes" ["O"])
+("yesterday" ["Q"])
+("yet" [""])
+("yield" [""])
+("yoke" ["m"])
+("yonder" [""])
+("you" ["A" "A"])
+("young" ["~"])
+("youngster" ["֦~"])
+("your" ["A"])
+("yourself" ["Aۤv"])
+("youth" ["C~"])
+("youthful" ["~C"])
+("zeal" [""])
+("zealous" ["ߪ"])
+("zero" ["s"])
+("zest" [""])
+("zinc" ["N"])
+("zone" ["aa"])
+("zoo" ["ʪ"])
+("zoological" ["ʪǪ"])
+("zoology" ["ʪ"])
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
@@ -0,0 +1,1486 @@
+;; Quail package `chinese-py-b5
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: PY-b5.tit
+
+;; # Header added for Emacs -*- coding: cn-big5 -*-
+;; #
+;; # This file is included in the directory contrib/clients/cxterm of the
+;; # distribution of X11R6.  As the file itself doesn't contain copyright
+;; # and license notices, the following statements in the section 6 of
+;; # the file .../cxterm/README covers it.
+;; #
+;; # X11R6 CXTERM (C) 1994 BY YONGGUANG ZHANG.
+;; # X11R5 CXTERM (C) 1991 BY YONGGUANG ZHANG AND MAN-CHI PONG.
+;; #
+;; # Permission to use, copy, modify, and distribute this software and
+;; # its documentation for any purpose is hereby granted without fee,
+;; # provided that this entire copyright and permission notice appear
+;; # in all such copies, and that the name of the authors may not be
+;; # used to endorse or promote products derived from this material
+;; # without specific prior written permission.  The authors make no
+;; # representations about the suitability of this software for any
+;; # purpose.  It is provided "as is" without express or implied warranty.
+;; #
+;; # End of header added for Emacs
+;; # HANZI input table for cxterm
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 2
+;; ENCODE:	BIG5
+;; AUTOSELECT:	NO
+;; PROMPT:	~rJ::::\040
+;; #
+;; COMMENT	~yJפ   (`Ÿ)
+;; COMMENT	
+;; COMMENT				n (CONSONANT)
+;; COMMENT	
+;; COMMENT	t u v w  x y z {  | } ~             
+;; COMMENT	b  p  m  f   d  t  n  l   g  k  h   j  q  x   zh ch sh r   z  c  s
+;; COMMENT	 Y N   o S [            E      
+;; COMMENT	
+;; COMMENT				 (VOWEL)
+;; COMMENT	
+;; COMMENT		                        
+;; COMMENT		a   o   e   e   ai  ei  ao  ou  an  en  ang eng er
+;; COMMENT		    Z (C) s        w     () 
+;; COMMENT	
+;; COMMENT	                 
+;; COMMENT	C+   i   ia   io   --   ie   --   --   iao  iu   ian  in  iang  ing
+;; COMMENT	 +  yi   ya   yo   --   ye   ai   --   yao  you  yan  yin yang ying
+;; COMMENT	       r           C   V        y   ~      ]      ^
+;; COMMENT	
+;; COMMENT	                 
+;; COMMENT	C+  u    ua   uo   --   --   uai  ui   --   --   uan  un  uang  ong
+;; COMMENT	 +  wu   wa   wo   --   --   wai  wei  --   --   wan  wen wang weng
+;; COMMENT	                       n                s      L   
+;; COMMENT	
+;; COMMENT	                 
+;; COMMENT	j+   u   --   --   --   ue   --   --   --   --   uan  un   --  iong
+;; COMMENT	l+  u:   --   --   --  u:e   --   --   --   --  u:an  u:n  --   --
+;; COMMENT	 +  yu   --   --   --  yue   --   --   --   --  yuan  yun  --  yong
+;; COMMENT	                                                w        l
+;; COMMENT	
+;; COMMENT	C+ -> eanɭ,       + -> eSnɭ,
+;; COMMENT	j+ -> n j,q,x ɭ,   l+ -> n l,n ɭ
+;; COMMENT
+;; # define keys
+;; VALIDINPUTKEY:	12345:abcdefghijklmnopqrstuvwxyz
+;; WILDCARDKEY:	*
+;; WILDCHARKEY:	?
+;; SELECTKEY:	1\040
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	.>
+;; MOVELEFT:	,<
+;; REPEATKEY:	\020\022
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-py-b5" "Chinese-BIG5" "B"
+ t
+"~rJ::::
+
+	~yJפ   (`Ÿ)
+	
+				n (CONSONANT)
+	
+	t u v w  x y z {  | } ~             
+	b  p  m  f   d  t  n  l   g  k  h   j  q  x   zh ch sh r   z  c  s
+	 Y N   o S [            E      
+	
+				 (VOWEL)
+	
+		                        
+		a   o   e   e   ai  ei  ao  ou  an  en  ang eng er
+		    Z (C) s        w     () 
+	
+	                 
+	C+   i   ia   io   --   ie   --   --   iao  iu   ian  in  iang  ing
+	 +  yi   ya   yo   --   ye   ai   --   yao  you  yan  yin yang ying
+	       r           C   V        y   ~      ]      ^
+	
+	                 
+	C+  u    ua   uo   --   --   uai  ui   --   --   uan  un  uang  ong
+	 +  wu   wa   wo   --   --   wai  wei  --   --   wan  wen wang weng
+	                       n                s      L   
+	
+	                 
+	j+   u   --   --   --   ue   --   --   --   --   uan  un   --  iong
+	l+  u:   --   --   --  u:e   --   --   --   --  u:an  u:n  --   --
+	 +  yu   --   --   --  yue   --   --   --   --  yuan  yun  --  yong
+	                                                w        l
+	
+	C+ -> eanɭ,       + -> eSnɭ,
+	j+ -> n j,q,x ɭ,   l+ -> n l,n ɭ
+
+
+Pinyin base input method for Chinese Big5 characters
+(`chinese-big5-1', `chinese-big5-2').
+
+This input method works almost the same way as `chinese-py' (which
+see).
+
+This input method supports only Han characters.  The more convenient
+method is `chinese-py-punct-b5', which is the combination of this
+method and `chinese-punct-b5' and which supports both Han characters
+and punctuation/symbols.
+
+For double-width Big5 characters corresponding to ASCII, use the input
+method `chinese-qj-b5'.
+
+The input method `chinese-py' and `chinese-tonepy' are also Pinyin
+based, but for the character set GB2312 (`chinese-gb2312').
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   ("." . quail-next-translation)
+   (">" . quail-next-translation)
+   ("," . quail-prev-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+("a1" "")
+("a2" "ڪ")
+("a4" "")
+("ai1" "sJuM")
+("ai2" "JcVԩ")
+("ai3" "GħGHd")
+("ai4" "Rêi@WإTiT|MI")
+("an1" "wbgڮϣOuΦrLP")
+("an2" "u")
+("an3" "{٣~")
+("an4" "tשfC}Ӱ")
+("ang1" "ˣ")
+("ang2" "W")
+("ang3" "B")
+("ang4" "s")
+("ao1" "Wb")
+("ao2" "ξCgR}vmlWjj")
+("ao3" "ͶͽD")
+("ao4" "ƿDMشj")
+("b" "t")
+("ba1" "KäڬͪݯJzЧaT")
+("ba2" "޶[YnɥnZ")
+("ba3" "vj")
+("ba4" "}QBf")
+("ba5" "a}]I")
+("bai1" "T")
+("bai2" "")
+("bai3" "\yx")
+("bai4" "ѫax")
+("ban1" "Zh{IWݽx")
+("ban3" "OƶzI")
+("ban4" "bղ̩räb̭")
+("bang1" "ı}W")
+("bang3" "]jƻH")
+("bang4" "νSFr")
+("bao1" "]McRUU")
+("bao2" "rn")
+("bao3" "O_ȸ̯ؿ")
+("bao4" "z\jS^XۭsoI")
+("bei1" "IMdOڴS׻t|յɸs")
+("bei3" "_")
+("bei4" "QƭIuVήH_ȪڪOXtXϺ")
+("ben1" "bNI")
+("ben3" "cf")
+("ben4" "^ʬ")
+("beng1" "Y^[My]")
+("beng2" "")
+("beng3" "ff}ԾO")
+("beng4" "{nng")
+("bi1" "GYMD")
+("bi2" "")
+("bi3" "񵧩P]YӼp_D")
+("bi4" "ͲzuAźѪcڽȹʹp@]t{qXDNShnzKAҥul}GղǷ]ڷتctʯ}gLrGZXWtvz~ͶKs~qJ")
+("bian1" "s@Hx_t")
+("bian3" "SнG")
+("bian4" "KܹMGX|٥KqZ")
+("biao1" "гCtdI@nlܭIdH[l")
+("biao3" "DtF")
+("biao4" "")
+("bie1" "xž")
+("bie2" "ODvo")
+("bie3" "çס")
+("bie4" "")
+("bin1" "رlby}xˬ@gRɢ~y")
+("bin4" "lK")
+("bing1" "LB|")
+("bing3" "[`ì}@׮~ε")
+("bing4" "ïf֦}xR")
+("bo1" "iԲg׷[qYQi")
+("bo2" "Bլfyki䩭򽳻KY`JJcWaf`cѴުߴwcR{")
+("bo3" "_ðװ")
+("bo4" "ðB")
+("bu1" "ժl")
+("bu2" "")
+("bu3" "ɮHR{")
+("bu4" "BƧGïZO")
+("c" "")
+("ca1" "g")
+("ca3" "}")
+("ca4" "")
+("cai1" "q")
+("cai2" "~]")
+("cai3" "ımBsٽ")
+("cai4" "ʪ")
+("can1" "\|")
+("can2" "F[")
+("can3" "G٩v")
+("can4" "GTD")
+("cang1" "aܷɿaV")
+("cang2" "t")
+("cao1" "W")
+("cao2" "ѹ˺]")
+("cao3" "{ZJ")
+("cao4" "Wͫ")
+("ce4" "UZlI|")
+("cen1" "շ")
+("cen2" "¯KպHX")
+("ceng1" "")
+("ceng2" "heU")
+("ceng4" "O")
+("ch" "")
+("cha1" "teCXj`")
+("cha2" "dgAhQͤ")
+("cha3" "")
+("cha4" "ҧëbtЮ˲L")
+("chai1" "t[")
+("chai2" "[")
+("chai4" "")
+("chan1" "e˦~V")
+("chan2" "Ia``GsGd^URx@")
+("chan3" "ĶAC˱L|ossA")
+("chan4" "b_")
+("chang1" "Ҳs@KuI@ڨ")
+("chang2" "`nvzZu|^")
+("chang3" "t")
+("chang4" "ۭҺZJC")
+("chao1" "۶rWp̢˶")
+("chao2" "¼_JHq")
+("chao3" "n")
+("chao4" "f")
+("che1" "s")
+("che3" "")
+("che4" "Mw\Kж")
+("chen1" "ҵ`QݧԮ")
+("chen2" "IڹШWծfpӲ}YBqjɯ")
+("chen3" "w^")
+("chen4" "XŨh@")
+("cheng1" "ټeWڥaԿgY")
+("cheng2" "{ӲۧegJٳshкLգmu]oIWή")
+("cheng3" "xѭG")
+("cheng4" "ٯWg")
+("chi1" "YEè^]ګZֲwju")
+("chi2" "𹣰ͦUWӳרzYӢAbNw")
+("chi3" "ؾ`׿ݶӿj^Nɭ{")
+("chi4" "ͥwK̸ܿUSLk`Kr")
+("chong1" "RĨRݼrE")
+("chong2" "Reܣӵ֡")
+("chong3" "d")
+("chong4" "o")
+("chou1" "oݱl")
+("chou2" "TwSYCåvAW۬EP")
+("chou3" "|p")
+("chou4" "ŷh{")
+("chu1" "X")
+("chu2" "xpSoQ]q`")
+("chu3" "Bx¦SuG")
+("chu4" "BĲbJԩzHMڢbG")
+("chua1" "")
+("chuai2" "D")
+("chuai3" "")
+("chuai4" "D")
+("chuan1" "tJ޸")
+("chuan2" "ǲ")
+("chuan3" "ݦӶ")
+("chuan4" "곩k@U")
+("chuang1" "нHwy")
+("chuang2" "ɼl")
+("chuang3" "m")
+("chuang4" "[ޯ")
+("chui1" "j")
+("chui2" "lݴն质޽i|P[Ƚxߡ")
+("chui4" "j")
+("chun1" "KYs")
+("chun2" "®BJE]Lz޲")
+("chun3" "eb")
+("chuo1" "W")
+("chuo4" "ؽ[Y]N\wuM")
+("ci1" "θۣtl")
+("ci2" "OϲۯZY[M")
+("ci3" "˽uүl֦")
+("ci4" "Z˵۴l")
+("cong1" "^oqw槼{vkpĽze")
+("cong2" "qOFzUO")
+("cong4" "")
+("cou4" "s")
+("cu1" "")
+("cu2" "eu")
+("cu4" "PLLT`kB")
+("cuan1" "O}")
+("cuan2" "")
+("cuan4" "«yy")
+("cui1" "RʱZQgiI")
+("cui2" "")
+("cui3" "A")
+("cui4" "Aܺ|ufXcQZ")
+("cun1" "r")
+("cun2" "s")
+("cun3" "k")
+("cun4" "oTG")
+("cuo1" "bROe")
+("cuo2" "ڵ˷Dh")
+("cuo3" "L")
+("cuo4" "Vk")
+("d" "x")
+("da1" "fʵU")
+("da2" "FŶ޽DHӯT|bb{ϯX")
+("da3" "")
+("da4" "j")
+("dai1" "b")
+("dai3" "e")
+("dai4" "NaݳUpLUjũeԴgLo@cs")
+("dan1" "ᤦ°XCHE")
+("dan3" "xnܳPɿldd")
+("dan4" "HJϾuܿF~vDlHy\ICcxEPL")
+("dang1" "Lh@N")
+("dang3" "Ҿm")
+("dang4" "Xۥ~fE]am")
+("dao1" "Mo{ͱ[")
+("dao3" "ˮqëor")
+("dao4" "D˽_sбACq")
+("de2" "ow")
+("de5" "o")
+("dei3" "o")
+("deng1" "nOhSf]")
+("deng3" "u")
+("deng4" "H޹jELI")
+("di1" "Cwzw׾}ai")
+("di2" "ĭ}fúC޹޺@S{ܫ`t_")
+("di3" "CkscE")
+("di4" "aħ̫һlͮXڻAj`aMЩIZki")
+("dia1" "")
+("dian1" "AqiY\he")
+("dian3" "IKکG")
+("dian4" "qlԾ}QିfeJN")
+("diao1" "JNIMpnڤKע")
+("diao3" "x")
+("diao4" "ձQsKɹ")
+("die1" "R")
+("die2" "^Һ|޳ҼSآk{]yETxGD")
+("ding1" "BvmonExM")
+("ding3" "C")
+("ding4" "wqvHa~E_r")
+("diu1" "")
+("dong1" "FVN]Фlϵ۪")
+("dong3" "\Q")
+("dong4" "ʬ}ɫѯi")
+("dou1" "")
+("dou3" "ݰ~BUw")
+("dou4" "rku^eMŪ")
+("du1" "G")
+("du2" "ŪWr|Ap}upZ\r")
+("du3" "@w{EE")
+("du4" "״{h")
+("duan1" "ݭBek")
+("duan3" "u")
+("duan4" "q_v|b")
+("dui1" "")
+("dui4" "ﶤIPUXdv")
+("dun1" "ۼ[")
+("dun3" "Ļ")
+("dun4" "y޶wPڿLPyQWʭɶT{")
+("duo1" "hGө")
+("duo2" "Ms@tiէjM")
+("duo3" "ئW֣c")
+("duo4" "kZF⹤WOmOƫײ")
+("e1" "ˣΣ裮")
+("e2" "B_ZZ@omXʧx˳Hrxiڸ")
+("e3" "M")
+("e4" "cjXk̹KsEcjmˮ맸K~FإiخYGݦh_")
+("ei1" "")
+("en1" "⣴")
+("en4" "ݮ")
+("eng1" "񢣶")
+("er1" "")
+("er2" "ϥSkwlFӴԢ{")
+("er3" "լ|ҭbzΩt")
+("er4" "GL˹F֬")
+("f" "w")
+("fa1" "o")
+("fa2" "F@ֵ|ӫ")
+("fa3" "kv")
+("fa4" "kW")
+("fan1" "f½ºn|`Z]")
+("fan2" "Zc|sÿdͨ\OESڳcDysG_h")
+("fan3" "Ϫ")
+("fan4" "dSǥƦƶcxoJU")
+("fang1" "ڧ{D˨BbCK")
+("fang2" "Шէ{")
+("fang3" "Xϥ鯼")
+("fang4" "")
+("fei1" "DvئmnPW")
+("fei2" "x")
+("fei3" "B^IK")
+("fei4" "oOͪmpȪQauWM")
+("fen1" "ɪ^hjܨwdV")
+("fen2" "XIWFnVʷZbtc")
+("fen3" "")
+("fen4" "ļT\ʮx")
+("feng1" "׺ƮpWlZ߱ީʲJgGv")
+("feng2" "{_ʰIذߧ")
+("feng3" "w")
+("feng4" "^Ŀ_c")
+("fiao4" "")
+("fo2" "")
+("fong4" "")
+("fou2" "MR")
+("fou3" "_o")
+("fu1" "ҽŹlSiy[@˪i`fTu")
+("fu2" "A֧߯Bť񩻿TR{ܿ罻MegӺվӬ{ZXpߦlm߶׷tQNRfYGy{]z")
+("fu3" "GjyƳ@XF̹dfrkD")
+("fu4" "tII_ƳнƸJutrL{^nF`bקTΥ۽P")
+("g" "|")
+("ga1" "")
+("ga2" "")
+("ga4" "")
+("gai1" "ӫ¸u˴yjU[")
+("gai3" "")
+("gai4" "\t@vbG")
+("gan1" "̤zxaXݯihzЦQ")
+("gan3" "PzAux")
+("gan4" "FBhmG")
+("gang1" "^z\tiٻԶk")
+("gang3" "^")
+("gang4" "b")
+("gao1" "|It̯oSAR\")
+("gao3" "Zͷd`XR")
+("gao4" "ip{")
+("ge1" "qFޤvϷ]O")
+("ge2" "歲jոf𫣻J@uӨC\}")
+("ge3" "S}")
+("ge4" "ӦUШ")
+("ge5" "")
+("gei3" "")
+("gen1" "")
+("gen2" "")
+("gen3" "")
+("gen4" "ӣ")
+("geng1" "ѩeüN۩X")
+("geng3" "ծCXǮGd")
+("geng4" "}")
+("gong1" "u\ѧc`}GǪtpc@Z")
+("gong3" "dE@Ҭq{ѱۻ")
+("gong4" "@Ѱ^Pݢ")
+("gou1" "yĹ_e")
+("gou3" "AceeQӭ׭")
+("gou4" "ʫcbpỸzloU")
+("gu1" "htdBfۣݩKGTl^@`VW~ZTIaU")
+("gu2" "")
+("gu3" "ѥj\YSƯL[¢SaתWF`FLBXk")
+("gu4" "GTUDiL_D")
+("gua1" "ʬAh~gߢ߲Aa")
+("gua3" "l")
+("gua4" "ohGEo")
+("guai1" "")
+("guai3" "^b")
+("guai4" "J[sM")
+("guan1" "x[aì``")
+("guan3" "]_FE")
+("guan4" "Ded|a[cuVq")
+("guang1" "֬ҮYӤ[|")
+("guang3" "sx")
+("guang4" "}Rt")
+("gui1" "kWtӦc^ԳصDиt")
+("gui3" "yެosVɣiwֿ۹F")
+("gui4" "Qd`P@k")
+("gun3" "uOXl@եR")
+("gun4" "k")
+("guo1" "Oԭb")
+("guo2" "~UQA")
+("guo3" "GqK_t]e")
+("guo4" "L")
+("h" "~")
+("ha1" "")
+("ha2" "")
+("ha3" "")
+("hai1" "y")
+("hai2" "٫e")
+("hai3" "W")
+("hai4" "`bٮ")
+("han1" "oMFwܬP{")
+("han2" "Ht[զRmrU")
+("han3" "ۨuDUD")
+("han4" "M~kѿٮXvFcթCھrZ_ATg_FpFu")
+("hang1" "q")
+("hang2" "C\ޮͳͬӹ")
+("hang3" "")
+("hang4" "Y")
+("hao1" "UQ")
+("hao2" "@ĮzbHM")
+("hao3" "nq")
+("hao4" "ӯEqUnPVREDѮ")
+("he1" "ܨFΫ")
+("he2" "XMeֲݽŨ׬TϲUr\ҬN粶ꭨP}{]Q[Z]]")
+("he4" "PMbܲ~q{tw")
+("he5" "M")
+("hei1" "¼KH")
+("hei3" "")
+("hen2" "")
+("hen3" "ܬ")
+("hen4" "")
+("heng1" "P")
+("heng2" "ҲdmKh˼")
+("heng4" "ԦZ")
+("hong1" "FMбʡnHF`")
+("hong2" "xEilRbdATcG^gfRrlCXDRto}")
+("hong3" "")
+("hong4" "iE")
+("hou1" "")
+("hou2" "UJjSo")
+("hou3" "q")
+("hou4" "ԫpZmM^пZϬ")
+("hu1" "IGp|vOpR}zA")
+("hu2" "JkGM[z}pݬ|tVm`R")
+("hu3" "[q\\")
+("hu4" "@᤬}|Cɼ̲[^jQqlhcz")
+("hua1" "ؼMr")
+("hua2" "طƦEϼM~Ź@b")
+("hua4" "ܤƵeT_pE")
+("huai2" "ha޺i˿wvTf")
+("huai4" "aeE")
+("huan1" "wNa[")
+("huan2" "U`lXJ{{wѳl|Sܥ")
+("huan3" "wpںd")
+("huan4" "Ʊw۷ثAȸMR޽I|")
+("huang1" "WwЪ")
+("huang2" "aq®XD׬ӰĵGNChtJIAvر]oR}L")
+("huang3" "̷E̤agS")
+("huang4" "A")
+("hui1" "ǴٷuZZokϤskA")
+("hui2" "^jw֤")
+("hui3" "|kt")
+("hui4" "|føzJ©kмc}PFJrnn^YU[_PIV[Qhwj_")
+("hun1" "BN_ݼ")
+("hun2" "_VLI")
+("hun3" "V")
+("hun4" "VTIľ@ܱ")
+("huo1" "")
+("huo2" "dߪ")
+("huo3" "d")
+("huo4" "ìMbNfi|tֺF]nC~E_RO")
+("huo5" "M")
+("i" "")
+("ie" "")
+("j" "")
+("ji1" "nZݿEVȦٽ]_FLjEYXTBRQҨ~A~D۵F\jpl~@")
+("ji2" "ίŷYeyNI᧣AVEYǽCDaͿDk˸KcOOyiϡSϿBdHnoX@nѹո\")
+("ji3" "Xvu٤LqP")
+("ji4" "pOJ~uHާپôҺ[MV^EkŴgɫ[ا߽xr\^ɾSELx@DA`p")
+("jia1" "a[Ũγí{EPmX@JjSrXަ뱧")
+("jia2" "UH|IhճqU@ֳ")
+("jia3" "Ҹ[aKzHٮL")
+("jia4" "[r[ɲ")
+("jian1" "ʰyݪ}lνpq̱yf쿡J^ޥieTlFYݸۢܩT~bZh")
+("jian3" "²߰Ŵ˴zõPZcVج_uQ¥I޹")
+("jian4" "ذ󶡺ŲbCĥųϷ^xqetϽҶh}]r^D^V")
+("jiang1" "Næ߫LŷlEsXo~")
+("jiang3" "C")
+("jiang4" "KjNz᰾L")
+("jiao1" "Х潦źJb뿼GtBMkN`wjSdh")
+("jiao2" "Z")
+("jiao3" "}úͶB˳岮ϸǬQѿ@ޢ")
+("jiao4" "ХsոıⵢuCiҫ]PN")
+("jie1" "󱵬ҶnnNx٬a~")
+("jie2" "`ǱܧTINe׮P~ͮܤmKU^ںjQDfCP_ѹgr")
+("jie3" "jѩn")
+("jie4" "ɭɤǩΪ|znkzʥɲѣXP")
+("jin1" "Tzy̬o~ҴVWjd")
+("jin3" "AԾѽ@DXԻjί")
+("jin4" "iɸTʾluᶾڿʵRHݨͯh]cnSEɻa")
+("jing1" "g׹HܸeRըɰa")
+("jing3" "ĵV[mdLX")
+("jing4" "qRҲbvw|tlHjE߼y")
+("jiong1" "")
+("jiong3" "~~ޣRujbʨ滬q")
+("jiu1" "ȴGGyVBЯjۮ")
+("jiu3" "E[shvb")
+("jiu4" "Ns¸ݬ^Sl\ѵ")
+("ju1" "~sqjIѨu_^ٹLڡc|")
+("ju2" "Żѷ|]BvپKDϾնVާ{\J^")
+("ju3" "|xCqLټ@")
+("ju4" "ڥy㥨@EѩڶZ߹dح£U~_\uN̥먬]~H^Kl")
+("juan1" "SYOկO")
+("juan3" "ԯd")
+("juan4" "¨hmѦX]ڿRβJr")
+("jue1" "")
+("jue2" "MıﱸZZּݿṶϧྻwƨnũi}TDRn͸Ti|ZnԳ")
+("jue3" "")
+("jue4" "")
+("jun1" "xgvdYt")
+("jun3" "~")
+("jun4" "T߰pmm@CsڭMѸY]լʣj")
+("k" "}")
+("ka1" "@ث")
+("ka3" "dya")
+("ka4" "")
+("kai1" "}{|˴")
+("kai3" "ʹn_ϰZZmt")
+("kai4" "nZtyqn")
+("kan1" "Zɷ`")
+("kan3" "ԧreԹB")
+("kan4" "EЫe")
+("kang1" "dBRnty")
+("kang2" "")
+("kang3" "B")
+("kang4" "ܪʩfz˧p")
+("kao1" "u")
+("kao3" "үNϢ")
+("kao4" "aR")
+("ke1" "_VOWHa\^HΤި")
+("ke2" "y")
+("ke3" "iVeu_")
+("ke4" "ȽҨJgط«EyNݤ")
+("ken3" "ְپiV")
+("ken4" "vֶ")
+("keng1" "|^\[")
+("keng3" "")
+("kong1" "űSOTQ")
+("kong3" "խ")
+("kong4" "ű")
+("kou1" "׼c")
+("kou3" "f")
+("kou4" "FnMF̪n")
+("ku1" "\]u\")
+("ku3" "W")
+("ku4" "wǻA}")
+("kua1" "ئjfӡ˺")
+("kua3" "˺")
+("kua4" "m")
+("kuai1" "J{")
+("kuai3" "")
+("kuai4" "ֶ|_̼DzDaV")
+("kuan1" "eb")
+("kuan3" "")
+("kuang1" "JصFo")
+("kuang2" "g")
+("kuang3" "")
+("kuang4" "pqmزKRiv")
+("kui1" "swѧJxkJ")
+("kui2" "̫}ftUZP")
+("kui3" "iyΡ")
+("kui4" "\칼XJ±|D~B`ַl")
+("kun1" "X[bCOխt񱹦cc")
+("kun3" "iѨ@")
+("kun4" "xte")
+("kuo3" "")
+("kuo4" "AXJrbz")
+("l" "{")
+("la1" "԰ճXi")
+("la2" "f")
+("la3" "")
+("la4" "þNfKݷ")
+("la5" "")
+("lai2" "ӵܱt]ٷJԨ")
+("lai4" "uţ_")
+("lan2" "xdiİP")
+("lan3" "iVlI_X_")
+("lan4" "lS")
+("lang1" "j")
+("lang2" "TYw}[հGcq")
+("lang3" "άѢNH")
+("lang4" "J")
+("lao1" "")
+("lao2" "ҨcGRHbc")
+("lao3" "ѫWL{y")
+("lao4" "ҵOToU")
+("le4" "֩UǦM{Rѻ}ɪɤBͧ")
+("le5" "F")
+("lei1" "")
+("lei2" "pݹJý]DOvAd")
+("lei3" "SwԽULOWsOT|W|{KE")
+("lei4" "\־t")
+("leng2" "WٱUͷ")
+("leng3" "N")
+("leng4" "hD")
+("li1" "")
+("li2" "XzpvWԸuqռIƳNx}RzMuN")
+("li3" "̲z§@U[ZCĿ׾YUT~")
+("li4" "OߧQRcҾFyrɻYEwtO߷XWg~ѰŰ|UBRetgҪskEv`zqHlв`שdStVHrFUxYݹKCyd")
+("lia3" "")
+("lian2" "spGîIſ棩rUTiIC¾Z")
+("lian3" "yLܶ")
+("lian4" "mʷkFKVߵة")
+("liang2" "}q³DdxGY")
+("liang3" "Ry")
+("liang4" "qG̽gDyWNѢ")
+("liao1" "")
+("liao2" "d鼺I·Vyc{lgvSsQ")
+("liao3" "FAdBm")
+("liao4" "ARSb")
+("lie1" "")
+("lie4" "CPHyʨca{~duJ۶qq")
+("lin2" "L{FOMCYbMZ`szYixSovzPB")
+("lin3" "oܱ۫j")
+("lin4" "[nĩMe")
+("ling1" "")
+("ling2" "sFaֳٲܭdDoMҾ~WFaIdSABRevA̰S")
+("ling3" "v")
+("ling4" "Ot϶")
+("liu1" "")
+("liu2" "Byd[hsF~aeuܬ^FUW")
+("liu3" "hqg")
+("liu4" "Hya")
+("long2" "sŢVŤngK]tSPFDuPRM")
+("long3" "lb")
+("long4" "@ձ")
+("lou1" "O")
+("lou2" "ӹư\ܼo~nKy")
+("lou3" "MO\")
+("lou4" "|Sb")
+("lu1" "P")
+("lu2" "cĪfĤl`ytGjCFDVGOB")
+("lu3" "|ۺrfsi[")
+("lu4" "SSLSOFOuxiFr^ڣtwSZpֵjF\c")
+("lu:2" "j[qB")
+("lu:3" "fȼiQT\M~e")
+("lu:4" "ߺv{oJw")
+("lu:an2" "p")
+("lu:an3" "")
+("lu:e4" "n")
+("luan2" "rq}eCk")
+("luan3" "Z")
+("luan4" "J")
+("lun1" "")
+("lun2" "۽׽_[ںԬCeKۡF")
+("lun3" "A")
+("lun4" "j")
+("luo1" "o")
+("luo2" "ùrY[ozm")
+("luo3" "rs")
+("luo4" "dܯOT_BָpΪ")
+("m" "v")
+("ma1" "")
+("ma2" "·s")
+("ma3" "½XbVM")
+("ma4" "|XY")
+("ma5" "")
+("mai2" "Iŵ")
+("mai3" "RGh")
+("mai4" "گ")
+("man2" "ZCfںOѫ")
+("man3" "^")
+("man4" "Cҽpg[rBܻ")
+("mang2" "~]ʾQʱAvl`]ڳ\xB")
+("mang3" "x\i")
+("mao1" "")
+("mao2" "Tٻiͻب]\U")
+("mao3" "f}g")
+("mao4" "U_TZѬعͻAHZ")
+("mei2" "SѬܪTC`𷰵DУSث޻Qqzu_K")
+("mei3" "CZT")
+("mei4" "fAKNξyzLڶq")
+("men1" "e")
+("men2" "̱ۯ")
+("men3" "")
+("men4" "eTV")
+("meng2" "Xéacjܿ_{jpfEw`")
+("meng3" "rgSj")
+("meng4" "کsqx")
+("mi1" "}N")
+("mi2" "gjSGn^")
+("mi3" "ڮ֩w߾kQ")
+("mi4" "KeVcQWmYⷦ΢XmLCG")
+("mian2" "ֺvضQzv")
+("mian3" "KjqîYSB\_MMy")
+("mian4" "")
+("miao1" "p")
+("miao2" "]y^")
+("miao3" "zHW")
+("miao4" "q[")
+("mie1" "A")
+("mie4" "GNBݩGzw")
+("min2" "ТxB^J~")
+("min3" "Ӽ{ԩת{׵C]Injݼ^")
+("ming2" "Wʿ߽P\UHy@yQ")
+("ming3" "֮qo")
+("ming4" "R\")
+("miu1" "")
+("miu4" "")
+("mo1" "N")
+("mo2" "ҿiU]Ĩr")
+("mo3" "")
+("mo4" "qzS歯\ߪj[Zipnw֯~mEEh۾KfrM")
+("mo5" "")
+("mou2" "Ѳ[ۿϨN")
+("mou3" "YN^")
+("mu2" "")
+("mu3" "adiϼྫΨ")
+("mu4" "ع}ӶҿpǨN`VAӾ~q")
+("n" "z")
+("na2" "Ѳ")
+("na3" "")
+("na4" "ǧo[u̮RͰʴ")
+("nai2" "")
+("nai3" "DiΩ`CN")
+("nai4" "@`qUn")
+("nan1" "_")
+("nan2" "nk䷣Ix")
+("nan3" "ivk")
+("nan4" "")
+("nang1" "")
+("nang2" "n")
+("nang3" "")
+("nang4" "")
+("nao1" "o")
+("nao2" "¾Lq̬`")
+("nao3" "o")
+("nao4" "x")
+("ne1" "O")
+("ne5" "O")
+("nei3" "kN")
+("nei4" "")
+("nen4" "")
+("neng2" "")
+("neng4" "")
+("ng1" "")
+("ni2" "dgOeND]FObk")
+("ni3" "ApF̻oP")
+("ni4" "fİοdE|д")
+("nian2" "~Hp")
+("nian3" "ɼ[VGU")
+("nian4" "")
+("niang2" "Q]")
+("niang4" "C")
+("niao3" "оrs")
+("niao4" "")
+("nie1" "En")
+("nie2" "|")
+("nie4" "^\¿hIAnܡjvAsQXXQ")
+("nin2" "z")
+("nin3" "")
+("ning2" "羮{fڬ]k")
+("ning3" "")
+("ning4" "צ")
+("niu1" "")
+("niu2" "")
+("niu3" "çscUp")
+("niu4" "")
+("nong2" "A@wªT")
+("nong4" "")
+("nou2" "c")
+("nou4" "U")
+("nu2" "qV")
+("nu3" "V")
+("nu4" "")
+("nu:3" "kF")
+("nu:4" "~")
+("nu:e4" "h")
+("nuan3" "xN")
+("nuo2" "R{")
+("nuo3" "")
+("nuo4" "zݫѽ")
+("o1" "ᣬ")
+("o2" "@")
+("ou1" "ڿ^޹ãӰe_P")
+("ou2" "ʡ")
+("ou3" "¹ý~Bx")
+("ou4" "x")
+("p" "u")
+("pa1" "wr")
+("pa2" "]ҪI")
+("pa4" "ȩ׽")
+("pai1" "")
+("pai2" "ƵPrl")
+("pai3" "x")
+("pai4" "")
+("pan1" "k")
+("pan2" "LYϯDn\")
+("pan3" "")
+("pan4" "Pq߯`׵KNdXϸ")
+("pang1" "S")
+("pang2" "eHKʾܧxY")
+("pang3" "")
+("pang4" "D")
+("pao1" "K")
+("pao2" "THS̩ϲƬҽ")
+("pao3" "]")
+("pao4" "wpC")
+("pei1" "FA[B_N")
+("pei2" "߳pIy")
+("pei3" "ڦ")
+("pei4" "tبK\nSůrɵ")
+("pen1" "Q")
+("pen2" "K")
+("pen3" "{")
+("peng1" "yi{⧼q")
+("peng2" "B^꽴NPOˢ@LܽXh~L")
+("peng3" "֥")
+("peng4" "IԸkٮ")
+("pi1" "ܤǼARQA`_e̮m|")
+("pi2" "֯hʵ\Jts]@}ﳲgei˭ׯhAfwfpf")
+("pi3" "_ǥԵlСy")
+("pi4" "ĴPB@}IW\vY")
+("pian1" "gؾ")
+("pian2" "Kck")
+("pian4" "FM")
+("piao1" "ƺ}_ܸ")
+("piao2" "]A")
+("piao3" "}gegpOn")
+("piao4" "}YN[")
+("pie1" "hJ~")
+("pie3" "J")
+("pin1" "c")
+("pin2" "hxWIy")
+("pin3" "~")
+("pin4" "u")
+("ping1" "\{")
+("ping2" "~̵īөWiΰnunmзM[۲ӱߩϰ")
+("ping3" "")
+("po1" "iY@")
+("po2" "CIx")
+("po3" "r")
+("po4" "}zĪyjs")
+("pou1" "}")
+("pou2" "hѼ")
+("pou3" "٫")
+("pu1" "QPڱ_̷")
+("pu2" "븲ZЦڲ\m@rzYN")
+("pu3" "HЮEPV")
+("pu4" "ɾQrnE")
+("q" "")
+("qi1" "Cd۱ϱ~YmּPNPQNHԧNhQr")
+("qi2" "_XMѸR±Ta[XQ_ϲNתKuNBmY]gӽդDCQkcY")
+("qi3" "_ҰZ^]vs}Uͼʦ")
+("qi4" "𾹨T󫴬_WͽrE¿ltddyӽay")
+("qia1" "t")
+("qia3" "da")
+("qia4" "ꬢαK")
+("qian1" "d]EñoҴOaHʷ^ǺSrILdˡRjmCNtIV")
+("qian2" "erX@xzaH̵y߰ɰFK")
+("qian3" "LV")
+("qian4" "pg}SdfH")
+("qiang1" "jʶmf٪B{ᬱN")
+("qiang2" "jRb|p")
+("qiang3" "jmuhf")
+("qiang4" "v")
+("qiao1" "VTKktdtpJjuW")
+("qiao2" "@¼LkNVBHXK")
+("qiao3" "sNN")
+("qiao4" "¼¬NkTs")
+("qie1" "P")
+("qie2" "XG")
+("qie3" "B")
+("qie4" "ѩcĴg櫴۷h^")
+("qin1" "˫I]k\\j")
+("qin2" "Ե^V߾^tAhͭܤ")
+("qin3" "`ʫH")
+("qin4" "Gk")
+("qing1" "MCɭBfJԫg")
+("qing2" "")
+("qing3" "г")
+("qing4" "yjvkSMjբ")
+("qiong1" "|")
+("qiong2" "aã|rۼFTcrv߳")
+("qiu1" "CLZ_tD")
+("qiu2" "Dy}}AsX[MGSڹgNаɦDuvZG\y")
+("qiu3" "")
+("qu1" "ϩ}X߹򦱳I£׶徵]X`B̶v\q")
+("qu2" "WT£CWykEQaۧ")
+("qu3" "TϦ")
+("qu4" "h@m")
+("quan1" "ѪٯμW")
+("quan2" "vuறͲlҡyޤhAht޾p")
+("quan3" "enFQ")
+("quan4" "UҢy")
+("que1" "")
+("que2" "a")
+("que4" "oTNe|O[i")
+("qun1" "_n")
+("qun2" "sg")
+("r" "")
+("ran2" "MUwףפ׹")
+("ran3" "VTw\I{")
+("rang2" "cš[{m")
+("rang3" "W[c")
+("rang4" "J")
+("rao2" "c")
+("rao3" "Z")
+("rao4" "¶")
+("re3" "SoY")
+("re4" "")
+("ren2" "HQI")
+("ren3" "ԸZPe")
+("ren4" "{bbMѡQݶ`t")
+("reng1" "")
+("reng2" "r}")
+("reng3" "")
+("ri4" "s")
+("rong2" "eaķT_AxCgvSD`ycn")
+("rong3" "_D")
+("rou2" "X|ɨq")
+("rou3" "Mn")
+("rou4" "")
+("ru2" "pį}}]ѲwδQ")
+("ru3" "Ŧdk")
+("ru4" "JdvP@")
+("ruan2" "أ")
+("ruan3" "nįRA}")
+("rui2" "Bo")
+("rui3" "uս")
+("rui4" "UͺU")
+("run1" "i")
+("run4" "|")
+("ruo4" "YzٰkYxd")
+("s" "")
+("sa1" "e")
+("sa3" "xs")
+("sa4" "Ĥٻ")
+("sai1" "θ|Bl")
+("sai4" "ɶ")
+("san1" "TM")
+("san3" "oX")
+("san4" "{")
+("sang1" "")
+("sang3" "ݺb{")
+("sang4" "")
+("sao1" "bkiR")
+("sao3" "AԵ")
+("sao4" "M")
+("se4" "槣¨OlpZu")
+("sen1" "xix")
+("seng1" "")
+("sh" "")
+("sha1" "FTƧگjңFq")
+("sha2" "ԣ")
+("sha3" "")
+("sha4" "KHQ|gl")
+("shai1" "z")
+("shai3" "")
+("shai4" "ή")
+("shan1" "smRûQ\ksݵUh}[")
+("shan3" "{E٥")
+("shan4" "¾տµTSĺbMQlR")
+("shang1" "Ӷ˼ҴNY")
+("shang3" "ΤW")
+("shang4" "W|sg")
+("shang5" "n")
+("shao1" "NyߥzvKݾefK")
+("shao2" "@ਢcϹ")
+("shao3" "")
+("shao4" "ֲЭlso׸ڼL")
+("she1" "aB")
+("she2" "Dެe`")
+("she3" "˪")
+("she4" "]gAjeiQB")
+("shei2" "")
+("shen1" "`ӲԩDHѮWEMgP~]k[XPp")
+("shen2" "")
+("shen3" "HfTnZ{{˩T")
+("shen4" "VǺƸ¨G߸Ҳ̽z")
+("sheng1" "nӤɬ@cưNʢdTd")
+("sheng2" "÷Izh")
+("sheng3" "f")
+("sheng4" "ӲtOo")
+("shi1" "Iv÷ͣNr߭йOiwHk")
+("shi2" "QۮɹꭹBkӮgAMc")
+("shi3" "ϩlvpګ˨")
+("shi4" "Oƥ@hѫǥܸյAͻ}uݫKUIaغb]Kiflmrr")
+("shi5" "")
+("shou1" "ӧ")
+("shou2" "")
+("shou3" "⭺uSF")
+("shou4" "~½G")
+("shu1" "ѿή޲Vg_Y")
+("shu2" "QūEZa")
+("shu3" "ƹݴpLaIr")
+("shu4" "Nƾzpݲfƹֺ@oo}")
+("shua1" "|m")
+("shua3" "A")
+("shuai1" "LI")
+("shuai3" "")
+("shuai4" "vO")
+("shuan1" "꭬C")
+("shuan4" "R")
+("shuang1" "\")
+("shuang3" "n")
+("shuang4" "f")
+("shui2" "O")
+("shui3" "")
+("shui4" "ε|tX")
+("shun3" "mp")
+("shun4" "Hv")
+("shuo1" "")
+("shuo4" "Һ{޲v}qT㷤cx|a")
+("si1" "q䴵prRBTzӸ@GWS@|")
+("si3" "")
+("si4" "|}xvSrx쾩qξo]NYAI")
+("song1" "QPSCpe]C")
+("song3" "qn[")
+("song4" "e|^w")
+("sou1" "jB઻``YIޮ\^")
+("sou3" "]")
+("sou4" "")
+("su1" "ĬdpqZ")
+("su2" "U")
+("su4" "Dt±Jg½HhAPFP\S{YeBɧZϩWMy")
+("suan1" "ĵmҩ")
+("suan3" "")
+("suan4" "[H")
+("sui1" "kAFhB֪gCcoD")
+("sui2" "Hs")
+("sui3" "gar")
+("sui4" "EHJG`gaԽH^ID")
+("sun1" "]^ެݻ_N")
+("sun3" "lgih")
+("sun4" "")
+("suo1" "YPuTfbaV")
+("suo3" "ү꺾c@")
+("suo4" "")
+("t" "y")
+("ta1" "Loe|͢")
+("ta3" "GX")
+("ta4" "fáݭľ־ػkYlOZkoN")
+("tai1" "La")
+("tai2" "xOa׶`iϱ|")
+("tai4" "ӺAOg`^yV")
+("tan1" "gyu~̾Rd")
+("tan2" "ͼuȾ¾»\z^Gg")
+("tan3" "ZReJT")
+("tan4" "ļۺҬԼE")
+("tang1" "A")
+("tang2" "}޷eF]_x")
+("tang3" "սlI\f")
+("tang4" "S")
+("tao1" "ܷŹqlݰmO[{E")
+("tao2" "k糳^ܰެvhBp`fA")
+("tao3" "Q")
+("tao4" "M")
+("te4" "S|i")
+("teng2" "küf")
+("ti1" "I")
+("ti2" "Dڳ׽{w󻶬NVxJg")
+("ti3" "^W")
+("ti4" "PcOKVR³|")
+("tian1" "ѲKZ_")
+("tian2" "в۰")
+("tian3" "QfSb٧")
+("tian4" "ml")
+("tiao1" "Dֽιo")
+("tiao2" "Ѩ٭|mgqULkf")
+("tiao3" "DKw")
+("tiao4" "ظоfm")
+("tie1" "Ḳ")
+("tie3" "KR")
+("tie4" "Kצ")
+("ting1" "ťUչKͪ")
+("ting2" "xʫF^@lM߬W^")
+("ting3" "m[pMoXn")
+("ting4" "ť")
+("tong1" "qf֢ϵk")
+("tong2" "Pɮc˾ֻwӦuhiYn@J")
+("tong3" "εѶTJo")
+("tong4" "hºEI")
+("tou1" "")
+("tou2" "Yޤ")
+("tou3" "DYo")
+("tou4" "z")
+("tou5" "Y")
+("tu1" "r`ա")
+("tu2" "ϳ~{OY\E~r̨߫YLPbwS")
+("tu3" "gRAzG")
+("tu4" "ߦR")
+("tuan1" "~")
+("tuan2" "{wqa")
+("tuan4" "ν")
+("tui1" "a")
+("tui2" "ZR")
+("tui3" "L")
+("tui4" "haa")
+("tun1" "]tK")
+("tun2" "٧ybv͵ʤ")
+("tun3" "ʤ")
+("tun4" "a")
+("tuo1" "즫UحѾ~K")
+("tuo2" "mbkY@]Ws[eײO")
+("tuo3" "IW")
+("tuo4" "ݳl")
+("u" "")
+("u:" "")
+("w" "")
+("wa1" "zکKEqHCp")
+("wa2" "")
+("wa3" "_")
+("wa4" "")
+("wai1" "n")
+("wai3" "")
+("wai4" "~")
+("wan1" "WsܭdɽU")
+("wan2" "xYKˣJ")
+("wan3" "߸J{YpFd`{V١wNd")
+("wan4" "Uñ{ɺdEcg")
+("wang1" "Lʿq")
+("wang2" "`")
+("wang3" "PɱSI٤vR")
+("wang4" "ѦkZ")
+("wei1" "´Q߻~jkDOm|ZPa")
+("wei2" "LMߺHޮcRWIWQt\ϪaobN")
+("wei3" "enӸTmԮUЬ޳qC߯~Lߤͷ|zypBַC")
+("wei4" "쥼Qè׭G޼LȽL}Bؼbst^Ycqu")
+("wen1" "ŽEg")
+("wen2" "DALTͲڧJ")
+("wen3" "íkF")
+("wen4" "ݻDZKݯoʹ")
+("weng1" "ζoS")
+("weng3" "c[f")
+("weng4" "|")
+("wo1" "ۭشsA")
+("wo3" "զ")
+("wo4" "רUWSQR_")
+("wu1" "ίQædzrdcjwzh")
+("wu2" "Ld^ſz`\kfmOlbid")
+("wu3" "ȪZRVMaKuɮqݳԤTmV")
+("wu4" "Ūȴc~aEcBظWt|QܪVO|;ڲg")
+("x" "")
+("xi1" "ƧlH}x˪RH^RfhQOLֱEXծDm]cQQ{DWR^\GrѩִrPkweξο]jioܾj\оIGM")
+("xi2" "ߩu@ŧVDgKbiٶ_O{Ry")
+("xi3" "߬~pâuVCqCҧ")
+("xi4" "Ytôiؾ񾵿ͥbͮQg\Wrm̧[]Myb")
+("xia1" "M")
+("xia2" "vlLUXEIƪ\jߣݡzһxE")
+("xia4" "UL~Hvyg")
+("xian1" "PA־kC_yD[IWjwGlܹHsGҹ")
+("xian2" "嶢wЩβͼ_C~w}pߺV۸Gyqԡ")
+("xian3" "IA~ndhK`dP@vݣzBB")
+("xian4" "{umr`óA乷sիڽW|beVbv")
+("xiang1" "mۭc^[R߹H")
+("xiang2" "Բ")
+("xiang3" "QTɻWY")
+("xiang4" "ѦV۹HQAmM_")
+("xiao1" "Ptdp­v]ŻNJi`cFnӷڰ}AmQڴ߿]WdGuԪr")
+("xiao2" "mB")
+("xiao3" "pNQ")
+("xiao4" "կĻüSvSZ")
+("xie1" "Ƿt")
+("xie2" "cׯٿӨe^EHFq\DZjݲ޺_")
+("xie3" "g")
+("xie4" "±񬪮hmӨnɸѱPkbr跤طcc^_ZLgʶJWa[[")
+("xin1" "߷s~YNʲQ`c`tʻF")
+("xin2" "MV")
+("xin3" "ɳ")
+("xin4" "H]\ʻvX")
+("xing1" "PV{ɴiXz޼`S|")
+("xing2" "ΫDxO˶xϭn{P")
+("xing3" "ٿ")
+("xing4" "濳ʩmƱӮc")
+("xiong1" "SݤIF")
+("xiong2" "\")
+("xiong4" "")
+("xiu1" "ץ۲竦κZpVӪt")
+("xiu3" "J")
+("xiu4" "q¸óSJqͩҵɧhi")
+("xu1" "ݵŽNVEXSwYhdFSc")
+("xu2" "}")
+("xu3" "\ݷ֫HJYҷr")
+("xu4" "WԵBbf̹z͹m[w̡TC|E")
+("xuan1" "ŰaޱySU~J̷Pimu")
+("xuan2" "ȱax{fKozٿ")
+("xuan3" "j")
+("xuan4" "xt֭bױ|`Ta״XE")
+("xue1" "uf{")
+("xue2" "ǥ`bOP")
+("xue3" "")
+("xue4" "峷ޫde~\׳")
+("xun1" "tH}Oee{")
+("xun2" "Mߴ`ұì}K{JнXbOgC@")
+("xun4" "TVSĿA")
+("ya1" "r~nXٲ")
+("ya2" "޲PŰHbɷ")
+("ya3" "Ȱ׶oVܦ")
+("ya4" "ȳY]GYPgoK")
+("yan1" "ϲjTM|کaҹPYIkmҸ`\")
+("yan2" "㨥CYuQòFԺwwr^ngZJz")
+("yan3" "tln^kLλjVQfJ}kٰj|LbXV")
+("yan4" "P˶bTvV۳x|`@Ϊu]oŬijEvIK[mmQܵE[Avzx")
+("yang1" "omߪtfKbG")
+("yang2" "vϨ˯LGzR۱޴ҳֱػ")
+("yang3" "ioWbϴ̿}")
+("yang4" "˾i~y·")
+("yao1" "nyԧܤ\[m߷")
+("yao2" "n󻻫ca\fdޭ]\ҰWbl`lor")
+("yao3" "rHʼ̳ХPJUE")
+("yao4" "nģ`_cF@xM")
+("ye1" "CO")
+("ye2" "ݭCx^")
+("ye3" "]MԱ")
+("ye4" "~]|֫MgogEeOe")
+("yi1" "@촥avTUIWϫHۺvbw^")
+("yi2" "òyɫi˯ضM~xߨ^[U˲elfpưYDQAΧ֫B˷ЭMۦҿ׻C۳ݿheolGL")
+("yi3" "HwAʴȨoíwѰYcAܯ࿨^\xH٨")
+("yi4" "NqĳqĶGl̼ݶhwö~cڦzHݬ汳triŦkѺm٨@|}HѥhCԷa@AJfJTܲ\EYmp^ɩh~{U̴a]٦Q԰Lnm[ZLm^γ|g")
+("yin1" "]îfءeXMϧhL")
+("yin2" "ȧuG]iҤCUlH{hyPdm")
+("yin3" "޶}CvUiXhAVL")
+("yin4" "LNJxWPyu")
+("ying1" "^NatxXĢLw}VtcRQ")
+("ying2" "ǿĹռslƶ^m]DDF")
+("ying3" "vor_ջV")
+("ying4" "wMjT")
+("yo1" "")
+("yong1" "ıel־sV`Hvou׻R")
+("yong2" "qQMx")
+("yong3" "êaiֿ鸺iñvsM\UίFѤ")
+("yong4" "Φ")
+("you1" "u~ձyNM̫׫")
+("you2" "ѴCתolS߹\ɬץO;{ɬO[a_")
+("you3" "ͨKNO}kvD")
+("you4" "SkcVɨݫ^rn\έϻ")
+("yu1" "J@P֧ͦ")
+("yu2" "rTl_ME򷮹O\ַصͪpfjڮLgYܢٿi½ߨҨSBB\}maЬԥؤزOm")
+("yu3" "PyBthžFܺ@޷OYּ{[J")
+("yu4" "|JwɱUADηԴJmP౿ݱs{~¡RL\nֹ{ܮfڮKyٵHìg@HO٭RzqM}SsRgѬPkw")
+("yuan1" "޲Wp{uBi")
+("yuan2" "줸tDK᫮JլGXʹEF˫ʺ`ӻ[_CuޫDd")
+("yuan3" "S")
+("yuan4" "|@bD޶@dpC")
+("yue1" "A_")
+("yue4" "V֮\fDģ_`ൻGeͣTcb^|v")
+("yun1" "wrIjd")
+("yun2" "éЪ⾸aeXNʳɴ]")
+("yun3" "kfevpeu˰")
+("yun4" "BĭY@wPy")
+("z" "")
+("za1" "ϥ`sN")
+("za2" "{")
+("zai1" "av")
+("zai3" "J_")
+("zai4" "bA")
+("zan1" "¯")
+("zan2" "")
+("zan3" "se")
+("zan4" "ټgfo")
+("zang1" "żB}N")
+("zang3" "")
+("zang4" "ŦN")
+("zao1" "DVܷ")
+("zao2" "w")
+("zao3" "ǾĦDj")
+("zao4" "ym꾸ķ_ļqT")
+("ze2" "hdܿAɯVQᲲе")
+("ze3" "")
+("ze4" "z")
+("zei2" "")
+("zen3" "")
+("zen4" "")
+("zeng1" "W¹ye")
+("zeng4" "p")
+("zh" "")
+("zha1" "ӬdfHt̼")
+("zha2" "㥾ϹhZ׬C")
+("zha3" "wzux")
+("zha4" "^]BEcKQܦ\Kz")
+("zhai1" "KN")
+("zhai2" "vC")
+("zhai3" "h")
+("zhai4" "Ź벽dqֹ")
+("zhan1" "g¤LĸSevL")
+("zhan3" "iٷݪ~\RZ^")
+("zhan4" "ԯȥeŸEYXJN")
+("zhang1" "is̼khܴ`R")
+("zhang3" "xSA")
+("zhang4" "VMbٽȧ`}H")
+("zhao1" "©۬LlۼJxฮO")
+("zhao2" "")
+("zhao3" "hۨ")
+("zhao4" "ӻlnF@EgŴUU}")
+("zhe1" "Bծw")
+("zhe2" "PֻK͸GBծsQЧMs")
+("zhe3" "̽")
+("zhe4" "oCvp[")
+("zhe5" "۾Bծw")
+("zhen1" "uwísշrez¿dEްLezW޲س")
+("zhen3" "EElH׿h[̺Ga")
+("zhen4" "}_ӪE}_֨WմJ")
+("zheng1" "]Cxú奿òuWpmMϳBB")
+("zheng3" "@ɡͩ")
+("zheng4" "GҬFgôV")
+("zhi1" "´KĥusۯתϻjLO쮥gݥ|[CY")
+("zhi2" "¾ȴӰY˻hŭԲTPjz޿[H")
+("zhi3" "uȤ}xk竤LT˯ܰ@tʪCV")
+("zhi4" "ܨvӻsPmxXϽomnicoFIŮKˤζdzл~_jPxW׺~Ҧ~lpϣEηгUdB")
+("zhong1" "שJجnɱʸy`ޡqX")
+("zhong3" "ظ~")
+("zhong4" "حصFd\د")
+("zhou1" "Pg{w൰yNzv|EҺPM")
+("zhou2" "bo")
+("zhou3" "y")
+("zhou4" "޽Kz`GóC@̦HB")
+("zhu1" "]Ѯ޵ݻ˨xмUL־}@s")
+("zhu2" "˿vv⵮ǥĽTbbCz")
+("zhu3" "DݵNJZf쯩G_[F")
+("zhu4" "ۧU`nWEűϮRV}rMwKg")
+("zhua1" "f")
+("zhua3" "")
+("zhuai1" "")
+("zhuai3" "m")
+("zhuai4" "")
+("zhuan1" "MjBFWlm@")
+("zhuan3" "")
+("zhuan4" "ȽfW޵{")
+("zhuang1" "˲Χ")
+("zhuang3" "N")
+("zhuang4" "Y")
+("zhui1" "l@իAߡ")
+("zhui3" "D")
+("zhui4" "Yشm]p")
+("zhun1" "Τ٪ʽ")
+("zhun3" "ǭGԭb")
+("zhun4" "")
+("zhuo1" "g")
+("zhuo2" "_Bްu`۰NµZ|տٸZ@HUٺ~ka")
+("zi1" "stԸYdhFhۤrE^S@")
+("zi2" "l")
+("zi3" "lJTdӥE~I͡BI")
+("zi4" "ۦr{ְFIH~")
+("zong1" "vaOqHwGI")
+("zong3" "`pz")
+("zong4" "aqr")
+("zou1" "Q԰ph_iٴi")
+("zou3" "")
+("zou4" "J~")
+("zu1" "")
+("zu2" "ڨjA")
+("zu3" "կ[A")
+("zuan1" "pp")
+("zuan3" "ġp@")
+("zuan4" "p")
+("zui1" "pn")
+("zui3" "LFCZ")
+("zui4" "̸oK٢IPb")
+("zun1" "LJdmbS")
+("zun3" "J")
+("zun4" "T`WQ")
+("zuo2" "Q@O")
+("zuo3" "w")
+("zuo4" "@y`wg̩_Y")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
@@ -0,0 +1,174 @@
+;; Quail package `chinese-punct-b5
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: Punct-b5.tit
+
+;; # -*- coding: cn-big5 -*-
+;; # HANZI input table for cxterm
+;; # Generated from Punct-b5.cit by cit2tit
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 1
+;; ENCODE:	BIG5
+;; MULTICHOICE:	YES
+;; PROMPT:	JiIŸj
+;; #
+;; COMMENT Copyright 1991 by Yongguang Zhang.	(ygz@cs.purdue.edu)
+;; COMMENT Permission to use/modify/copy for any purpose is hereby granted.
+;; COMMENT Absolutely no fee and no warranties.
+;; COMMENT
+;; COMMENT use <CTRL-f> to move to the right
+;; COMMENT use <CTRL-b> to move to the left
+;; COMMENT Modify by Wei-Chung Hwang, OCT 15, 1992.
+;; # define keys
+;; VALIDINPUTKEY:	!"\043$%&'()*+,-./0123456789:;<=>?@[\134]^_`abcdefghijkl
+;; VALIDINPUTKEY:	mnopqrstuvwxyz{|}~
+;; SELECTKEY:	1\040
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	\006
+;; MOVELEFT:	\002
+;; REPEATKEY:	\020\022
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-punct-b5" "Chinese-BIG5" "B"
+ t
+"JiIŸj
+
+ Copyright 1991 by Yongguang Zhang.	(ygz@cs.purdue.edu)
+ Permission to use/modify/copy for any purpose is hereby granted.
+ Absolutely no fee and no warranties.
+
+ use <CTRL-f> to move to the right
+ use <CTRL-b> to move to the left
+ Modify by Wei-Chung Hwang, OCT 15, 1992.
+
+Input method for Chinese punctuation and symbols of Big5
+(`chinese-big5-1' and `chinese-big5-2').
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   
+   )
+ nil nil nil nil)
+
+(quail-define-rules
+("!" "IT")
+("\"" "")
+("#" "")
+("$" "DLFG")
+("%" "H")
+("&" "͡")
+("'" "")
+("(" "]e}_guyx|")
+(")" "^f~`hvzw{")
+("*" "ΡѣSN")
+("+" "ϡޡӣUt")
+("," "AMBN")
+("-" "СߡߡV¢w")
+("." "CDEOPKLX")
+("/" "AҡԢ@B")
+("0" "̣֣¢")
+("1" "ãͣעâ")
+("2" "ģΣآĢ")
+("3" "ţϣ٢")
+("4" "ƣУڢ")
+("5" "ǣѣۢ")
+("6" "ȣңܢ")
+("7" "ɣӣݢ")
+("8" "ʣԣޢ")
+("9" "ˣգߢ")
+(":" "GJR")
+(";" "FQ")
+("<" "qmos")
+("=" "סڡܡ")
+(">" "rnpt")
+("?" "HS")
+("@" "I")
+("[" "ik")
+("\\" "@BA")
+("]" "jl")
+("^" "s")
+("_" "Z\")
+("`" "")
+("a" "")
+("b" "")
+("c" "")
+("d" "")
+("e" "")
+("f" "")
+("g" "")
+("h" "")
+("i" "")
+("j" "")
+("k" "")
+("l" "")
+("m" "")
+("n" "")
+("o" "")
+("p" "")
+("q" "")
+("r" "")
+("s" "")
+("t" "")
+("u" "")
+("v" "")
+("w" "@")
+("x" "A")
+("y" "B")
+("z" "C")
+("A" "")
+("B" "")
+("C" "")
+("D" "")
+("E" "")
+("F" "")
+("G" "")
+("H" "")
+("I" "")
+("J" "")
+("K" "")
+("L" "")
+("M" "")
+("N" "")
+("O" "")
+("P" "")
+("Q" "")
+("R" "")
+("S" "")
+("T" "")
+("U" "")
+("V" "")
+("W" "")
+("X" "")
+("Y" "")
+("Z" "")
+("graph" "bcdefghijklmnopqrstuvwxyz{|}~")
+("logo" "¡áġšơǡȡɡʡ")
+("math" "ϡСѡҡӡԡա֡סء١ڡۡܡݡޡߡ")
+("symbol" "@AB")
+("unit" "CDEFGHHIPQRSTUVWXYZ[\]^_`a")
+("{" "ac")
+("|" "UYx")
+("}" "bd")
+("~" "\")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
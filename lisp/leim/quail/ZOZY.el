@@ -0,0 +1,1548 @@
+;; Quail package `chinese-zozy
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: ZOZY.tit
+
+;; # -*- coding: cn-big5 -*-
+;; # HANZI input table for cxterm
+;; # Generated from ZOZY.cit by cit2tit
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 1
+;; ENCODE:	BIG5
+;; MULTICHOICE:	YES
+;; PROMPT:	Jis`j
+;; #
+;; COMMENT Copyright (c) 1997 Wei-Chung Hwang <wchwang@csie.nctu.edu.tw>
+;; COMMENT 
+;; COMMENT Permission to copy and distribute both modified and unmodified
+;; COMMENT versions is granted without royalty provided this notice is preserved.
+;; COMMENT
+;; COMMENT Constructed by Wei-Chung Hwang( wchwang@csie.nctu.edu.tw)
+;; COMMENT Made available in TANET at Oct 15, 1992.
+;; COMMENT
+;; COMMENT In Taipei(ETen) Big5 coding (eg. used with taipei15,taipei20)
+;; COMMENT
+;; COMMENT LĥιsejdMfL`ŸƦC覡C
+;; COMMENT
+;; COMMENT `: t u v w x y z { | } ~          
+;; COMMENT L:  1  q  a  z  2  w  s  x  e  d  c  r  f  v  5  t  g  b  y  h  n
+;; COMMENT
+;; COMMENT `:                
+;; COMMENT L:  8  i  k  ,  9  o  l  .  0  p  ;  /  -  u  j  m
+;; COMMENT
+;; COMMENT n: (@)  ()  Wn()  hn()  n()
+;; COMMENT L:   SPACE      6         3         4         7
+;; COMMENT
+;; COMMENT                 L`ŸƦC
+;; COMMENT +----+----+----+----+----+----+----+----+----+----+----+
+;; COMMENT |1   |2   |3   |4   |5   |6   |7   |8   |9   |0   |-   |
+;; COMMENT |  t|  x|Wn|hn|  ||n|  |  |  |  |
+;; COMMENT ++---++---++---++---++---++---++---++---++---++---++---+
+;; COMMENT  |Q   |W   |E   |R   |T   |Y   |U   |I   |O   |P   |
+;; COMMENT  |  u|  y|  ||  |  |  |  |  |  |  |
+;; COMMENT  ++---++---++---++---++---++---++---++---++---++---++
+;; COMMENT   |A   |S   |D   |F   |G   |H   |J   |K   |L   |;   |
+;; COMMENT   |  v|  z|  }|  |  |  |  |  |  |  |
+;; COMMENT   ++---++---++---++---++---++---++---++---++---++---++
+;; COMMENT    |Z   |X   |C   |V   |B   |N   |M   |,   |.   |/   |
+;; COMMENT    |  w|  {|  ~|  |  |  |  |  |  |  |
+;; COMMENT    +----+----+----+----+----+----+----+----+----+--+-+
+;; COMMENT         |         (SPACE BAR)                      |
+;; COMMENT         |                                      |
+;; COMMENT         +------------------------------------------+
+;; # define keys
+;; VALIDINPUTKEY:	\040,-./0123456789;abcdefghijklmnopqrstuvwxyz
+;; SELECTKEY:	1
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	>
+;; MOVELEFT:	<
+;; REPEATKEY:	\020\022
+;; KEYPROMPT(\040):	@
+;; KEYPROMPT(,):	
+;; KEYPROMPT(-):	
+;; KEYPROMPT(.):	
+;; KEYPROMPT(/):	
+;; KEYPROMPT(0):	
+;; KEYPROMPT(1):	t
+;; KEYPROMPT(2):	x
+;; KEYPROMPT(3):	
+;; KEYPROMPT(4):	
+;; KEYPROMPT(5):	
+;; KEYPROMPT(6):	
+;; KEYPROMPT(7):	
+;; KEYPROMPT(8):	
+;; KEYPROMPT(9):	
+;; KEYPROMPT(;):	
+;; KEYPROMPT(a):	v
+;; KEYPROMPT(b):	
+;; KEYPROMPT(c):	~
+;; KEYPROMPT(d):	}
+;; KEYPROMPT(e):	|
+;; KEYPROMPT(f):	
+;; KEYPROMPT(g):	
+;; KEYPROMPT(h):	
+;; KEYPROMPT(i):	
+;; KEYPROMPT(j):	
+;; KEYPROMPT(k):	
+;; KEYPROMPT(l):	
+;; KEYPROMPT(m):	
+;; KEYPROMPT(n):	
+;; KEYPROMPT(o):	
+;; KEYPROMPT(p):	
+;; KEYPROMPT(q):	u
+;; KEYPROMPT(r):	
+;; KEYPROMPT(s):	z
+;; KEYPROMPT(t):	
+;; KEYPROMPT(u):	
+;; KEYPROMPT(v):	
+;; KEYPROMPT(w):	y
+;; KEYPROMPT(x):	{
+;; KEYPROMPT(y):	
+;; KEYPROMPT(z):	w
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-zozy" "Chinese-BIG5" "s`"
+ '(   (122 . "w")
+   (121 . "")
+   (120 . "{")
+   (119 . "y")
+   (118 . "")
+   (117 . "")
+   (116 . "")
+   (115 . "z")
+   (114 . "")
+   (113 . "u")
+   (112 . "")
+   (111 . "")
+   (110 . "")
+   (109 . "")
+   (108 . "")
+   (107 . "")
+   (106 . "")
+   (105 . "")
+   (104 . "")
+   (103 . "")
+   (102 . "")
+   (101 . "|")
+   (100 . "}")
+   (99 . "~")
+   (98 . "")
+   (97 . "v")
+   (59 . "")
+   (57 . "")
+   (56 . "")
+   (55 . "")
+   (54 . "")
+   (53 . "")
+   (52 . "")
+   (51 . "")
+   (50 . "x")
+   (49 . "t")
+   (48 . "")
+   (47 . "")
+   (46 . "")
+   (45 . "")
+   (44 . "")
+   (32 . "@")
+)"Jis`j
+
+ Copyright (c) 1997 Wei-Chung Hwang <wchwang@csie.nctu.edu.tw>
+ 
+ Permission to copy and distribute both modified and unmodified
+ versions is granted without royalty provided this notice is preserved.
+
+ Constructed by Wei-Chung Hwang( wchwang@csie.nctu.edu.tw)
+ Made available in TANET at Oct 15, 1992.
+
+ In Taipei(ETen) Big5 coding (eg. used with taipei15,taipei20)
+
+ LĥιsejdMfL`ŸƦC覡C
+
+ `: t u v w x y z { | } ~          
+ L:  1  q  a  z  2  w  s  x  e  d  c  r  f  v  5  t  g  b  y  h  n
+
+ `:                
+ L:  8  i  k  ,  9  o  l  .  0  p  ;  /  -  u  j  m
+
+ n: (@)  ()  Wn()  hn()  n()
+ L:   SPACE      6         3         4         7
+
+                 L`ŸƦC
+ +----+----+----+----+----+----+----+----+----+----+----+
+ |1   |2   |3   |4   |5   |6   |7   |8   |9   |0   |-   |
+ |  t|  x|Wn|hn|  ||n|  |  |  |  |
+ ++---++---++---++---++---++---++---++---++---++---++---+
+  |Q   |W   |E   |R   |T   |Y   |U   |I   |O   |P   |
+  |  u|  y|  ||  |  |  |  |  |  |  |
+  ++---++---++---++---++---++---++---++---++---++---++
+   |A   |S   |D   |F   |G   |H   |J   |K   |L   |;   |
+   |  v|  z|  }|  |  |  |  |  |  |  |
+   ++---++---++---++---++---++---++---++---++---++---++
+    |Z   |X   |C   |V   |B   |N   |M   |,   |.   |/   |
+    |  w|  {|  ~|  |  |  |  |  |  |  |
+    +----+----+----+----+----+----+----+----+----+--+-+
+         |         (SPACE BAR)                      |
+         |                                      |
+         +------------------------------------------+
+
+Zhuyin base input method for Chinese Big5 characters (`chinese-big5-1',
+`chinese-big5-2').
+
+Zhuyin is a kind of a phonetic symbol.  One to three Zhuyin symbols
+compose a Chinese character.
+
+In this input method, you enter a Chinese character by first typing
+keys corresponding to Zhuyin symbols (see the above table) followed by
+SPC, 6, 3, 4, or 7 specifying a tone (SPC:, 6:, 3:Wn, 4:hn,
+7:n).
+
+\\<quail-translation-docstring>
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   (">" . quail-next-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+(", " "")
+(",4" "M")
+("- " "")
+("-3" "լ|ҭbzΩt")
+("-4" "GL˹F֬")
+("-6" "ϥSkwlFӴԢ{")
+(". " "ڿ^޹ãӰe_P")
+(".3" "¹ý~Bx")
+(".4" "x")
+(".6" "ʡ")
+("/ " "񢣶")
+("0 " "wbgڮiOuΦrLP")
+("03" "{٣~")
+("04" "tשfC}Ӱ")
+("06" "u")
+("1 " "t")
+("1/ " "Y^[My]")
+("1/3" "ff}ԾO")
+("1/4" "{nng")
+("1/6" "")
+("10 " "Zh{IWݽx")
+("103" "OƶzI")
+("104" "bղ̩räb̭")
+("18 " "KäڬͪݯJzЧaT")
+("183" "vj")
+("184" "}QBf")
+("186" "޶[YnɥnZ")
+("187" "a}]I")
+("19 " "T")
+("193" "\yx")
+("194" "ѫax")
+("196" "")
+("1; " "ı}W")
+("1;3" "]jƻH")
+("1;4" "νSFr")
+("1i " "Բgܼ׷[qYQi")
+("1i3" "_ðװ")
+("1i4" "ðB")
+("1i6" "Bլfyki䩭򽳻KY`JJcWaf`cѴުߴwcR{")
+("1j " "ժl")
+("1j3" "ɮHR{")
+("1j4" "BƧGïZO")
+("1j6" "")
+("1l " "]McRUU")
+("1l3" "O_ȸ̯ؿ")
+("1l4" "z\jS^XۭsoI")
+("1l6" "rn")
+("1o " "IMdOڴS׻t|յɸs")
+("1o3" "_")
+("1o4" "QƭIuVήH_ȪڪOXtXϺ")
+("1p " "bNI")
+("1p3" "cf")
+("1p4" "^ʬ")
+("1u " "GYMD")
+("1u, " "xž")
+("1u,3" "çס")
+("1u,4" "")
+("1u,6" "ODvo")
+("1u/ " "LB|")
+("1u/3" "[`ì}@׮~ε")
+("1u/4" "ïf֦}xR")
+("1u0 " "s@Hx_t")
+("1u03" "SнG")
+("1u04" "KܹMGX|٥KqZ")
+("1u3" "񵧩P]YӼp_D")
+("1u4" "ͲzuAźѪcڽȹʹp@]t{qXDNShnzKAҥul}GղǷ]ڷتctʯ}gLrGZXWtvz~ͶKs~qJ")
+("1u6" "")
+("1ul " "гCtdI@nlܭIdH[l")
+("1ul3" "DtF")
+("1ul4" "")
+("1up " "رlby}xˬ@gRɢ~y")
+("1up4" "lK")
+("2 " "x")
+("2. " "")
+("2.3" "ݰ~BUw")
+("2.4" "rku^eMŪ")
+("2/ " "nOhSf]")
+("2/3" "u")
+("2/4" "H޹jELI")
+("20 " "ᤦ°XCHE")
+("203" "xnܳPɿldd")
+("204" "HJϾuܿF~vDlHy\ICcxEPL")
+("28 " "fʵ弽DľU")
+("283" "")
+("284" "j")
+("286" "FŶ޽DHӯT|bb{ϯX")
+("29 " "b")
+("293" "e")
+("294" "NaݳUpLUjũeԴgLo@cs")
+("2; " "Lh@N")
+("2;3" "Ҿm")
+("2;4" "Xۥ~fE]am")
+("2j " "G")
+("2j/ " "FVN]Фlϵ۪")
+("2j/3" "\Q")
+("2j/4" "ʬ}ɫѯi")
+("2j0 " "ݭBek")
+("2j03" "u")
+("2j04" "q_v|b")
+("2j3" "@w{EE")
+("2j4" "״{h")
+("2j6" "ŪWr|Ap}upZ\r")
+("2ji " "hGө")
+("2ji3" "ئW֣c")
+("2ji4" "kZF⹤WOmOƫײ")
+("2ji6" "Mhs@tiէjM")
+("2jo " "")
+("2jo4" "ﶤIPUXdv")
+("2jp " "ۼ[")
+("2jp3" "Ļ")
+("2jp4" "y޶wPڿLPyQWʭɶT{")
+("2k6" "ow")
+("2k7" "o")
+("2l " "Mo{ͱ[")
+("2l3" "ˮqëor")
+("2l4" "D˽_sбACq")
+("2o3" "o")
+("2u " "Cwzw׾}ai")
+("2u, " "R")
+("2u,6" "^Һ|޳ҼSآk{]yETxGD")
+("2u. " "")
+("2u/ " "BvmonExM")
+("2u/3" "C")
+("2u/4" "wqvHa~E_r")
+("2u0 " "AqiY\he")
+("2u03" "IKکG")
+("2u04" "qlԾ}QିfeJN")
+("2u3" "CkscE")
+("2u4" "aħ̫һlͮXڻAj`aMЩIZki")
+("2u6" "ĭ}fúC޹޺@S{ܫ`t_")
+("2u8 " "")
+("2ul " "JNIMpnڤKע")
+("2ul3" "x")
+("2ul4" "ձQsKɹ")
+("5 " "´KĥusۯתϻjLO쮥gݥ|[CY")
+("5. " "Pg{w൰yNzv|EҺPM")
+("5.3" "y")
+("5.4" "޽Kz`GóC@̦HB")
+("5.6" "bo")
+("5/ " "]Cxú奿òuWpmMϳBB")
+("5/3" "@ɡͩ")
+("5/4" "GҬFgôV")
+("50 " "g¤LĸSevL")
+("503" "iٷݪ~\RZ^")
+("504" "ԯȥeŸEYXJN")
+("53" "uȤ}xk竤LT˯ܰ@tʪCV")
+("54" "ܨvӻsPmxXϽomnicoFIŮKˤζdzл~_jPxW׺~Ҧ~lpϣEηгUdB")
+("56" "¾ȴӰY˻hŭԲTPjz޿[H")
+("58 " "ӬdfHt̼")
+("583" "wzux")
+("584" "^]BEcKQܦ\Kz")
+("586" "㥾ϹhZ׬C")
+("59 " "KN")
+("593" "h")
+("594" "Ź벽dqֹ")
+("596" "vC")
+("5; " "is̼khܴ`R")
+("5;3" "xSA")
+("5;4" "VMbٽȧ`}H")
+("5j " "]Ѯ޵ݻ˨xмUL־}@s")
+("5j/ " "שJجnɱʸy`ޡqX")
+("5j/3" "ظ~")
+("5j/4" "حصFd\د")
+("5j0 " "MjBFWlm@")
+("5j03" "")
+("5j04" "ȽfW๶޵{")
+("5j3" "DݵNJZf쯩G_[F")
+("5j4" "ۧU`nWEűϮRV}rMwKg")
+("5j6" "˿vv⵮ǥĽTbbCz")
+("5j8 " "f")
+("5j83" "")
+("5j9 " "")
+("5j93" "m")
+("5j94" "")
+("5j; " "˲Χ")
+("5j;3" "N")
+("5j;4" "Y")
+("5ji " "g")
+("5ji6" "_Bްu`۰NµZ|տٸZ@HUٺ~ka")
+("5jo " "l@իAߡ")
+("5jo3" "D")
+("5jo4" "Yشm]p")
+("5jp " "Τ٪ʽ")
+("5jp3" "ǭGԭb")
+("5jp4" "")
+("5k " "Bծw")
+("5k3" "̽")
+("5k4" "oCvp[")
+("5k6" "PֻK͸GBծsQЧMs")
+("5k7" "۾Bծw")
+("5l " "©۬LlۼJxฮO")
+("5l3" "hۨ")
+("5l4" "ӻlnF@EgŴUU}")
+("5l6" "")
+("5p " "uwísշrez¿dEްLezW޲س")
+("5p3" "EElH׿h[̺Ga")
+("5p4" "}_ӪE}_֨WմJ")
+("8 " "ڣ")
+("84" "")
+("87" "ڪ")
+("9 " "sJuM")
+("93" "GħGHd")
+("94" "Rêi@WإTiT|MI")
+("96" "Jc")
+("; " "ˣ")
+(";3" "B")
+(";4" "s")
+(";6" "W")
+("a " "v")
+("a.3" "YN^")
+("a.6" "Ѳ[ۿϨN")
+("a/3" "rgSj")
+("a/4" "کsqx")
+("a/6" "Xéacjܿ_{jpfEw`")
+("a03" "^")
+("a04" "Cҽpg[rBܻ")
+("a06" "ZCfںOѫ")
+("a8 " "")
+("a83" "½XbVM")
+("a84" "|XY")
+("a86" "·s")
+("a87" "")
+("a93" "RGh")
+("a94" "گ")
+("a96" "Iŵ")
+("a;3" "x\i")
+("a;6" "~]ʾQʱAvl`]ڳ\xB")
+("ai " "N")
+("ai3" "")
+("ai4" "qzS歯\ߪj[Zipnw֯~mEEh۾KfrM")
+("ai6" "ҿiU]Ĩr")
+("ai7" "")
+("aj3" "adiϼྫΨ")
+("aj4" "ع}ӶҿpǨN`VAӾ~q")
+("aj6" "")
+("ak7" "")
+("al " "")
+("al3" "f}g")
+("al4" "U_TZѬعͻAHZ")
+("al6" "Tٻiͻب]\U")
+("ao3" "CZT")
+("ao4" "fAKNξyzLڶq")
+("ao6" "SѬܪTC`𷰵DУSث޻Qqzu_K")
+("ap " "e")
+("ap3" "")
+("ap4" "eTV")
+("ap6" "̱ۯ")
+("ap7" "")
+("au " "}N")
+("au, " "A")
+("au,4" "GNBݩGzw")
+("au. " "")
+("au.4" "")
+("au/3" "֮qo")
+("au/4" "R\")
+("au/6" "Wʿ߽P\UHy@yQ")
+("au03" "KjqîYSB\_MMy")
+("au04" "")
+("au06" "ֺvضQzv")
+("au3" "ڮ֩w߾kQ")
+("au4" "KeVcQWmYⷦ΢XmLCG")
+("au6" "gjSGn^")
+("aul " "p")
+("aul3" "zHW")
+("aul4" "q[")
+("aul6" "]y^")
+("aup3" "Ӽ{ԩת{׵C]Injݼ^")
+("aup6" "ТxB^J~")
+("b " "")
+("b.3" "Mn")
+("b.4" "")
+("b.6" "X|ɨq")
+("b/ " "")
+("b/3" "")
+("b/6" "r}")
+("b03" "VTw\I{")
+("b06" "MUwףפ׹")
+("b4" "s")
+("b;3" "W[c")
+("b;4" "J")
+("b;6" "cš[{m")
+("bj/3" "_D")
+("bj/6" "eaķT_AxCgvSD`ycn")
+("bj03" "nįRA}")
+("bj06" "أ")
+("bj3" "Ŧdk")
+("bj4" "JdvP@")
+("bj6" "pį}}]ѲwδQ")
+("bji4" "YzٰkYxd")
+("bjo3" "uս")
+("bjo4" "UͺU")
+("bjo6" "Bo")
+("bjp " "i")
+("bjp4" "|")
+("bk3" "SoY")
+("bk4" "")
+("bl3" "Z")
+("bl4" "¶")
+("bl6" "c")
+("bp3" "ԸZPe")
+("bp4" "{bbMѡQݶ`t")
+("bp6" "HQI")
+("c " "~")
+("c. " "")
+("c.3" "q")
+("c.4" "ԫpZmM^пZϬ")
+("c.6" "UJjSo")
+("c/ " "P")
+("c/4" "ԦZ")
+("c/6" "ҲdmKh˼")
+("c0 " "oMFwܬP{")
+("c03" "ۨuDUD")
+("c04" "M~kѿٮXvFcթCھrZ_ATg_FpFu")
+("c06" "Ht[զRmrU")
+("c8 " "")
+("c83" "")
+("c86" "")
+("c9 " "y")
+("c93" "W")
+("c94" "`bٮ")
+("c96" "٫e")
+("c; " "q")
+("c;3" "")
+("c;4" "Y")
+("c;6" "C\ޮͳͬӹ")
+("cj " "IGp|vOpR}zA")
+("cj/ " "FMбʡnHF`")
+("cj/3" "")
+("cj/4" "iE")
+("cj/6" "xEilRbdATcG^gfRrlCXDRto}")
+("cj0 " "wNa[")
+("cj03" "wpںd")
+("cj04" "Ʊw۷ثAȸMR޽I|")
+("cj06" "GU`lXJ{{wѳl|Sܥ")
+("cj3" "[q\\")
+("cj4" "@᤬}|Cɼ̲[^jQqlhcz")
+("cj6" "JkGM[z}pݬ|tVm`R")
+("cj8 " "ؼMr")
+("cj84" "ܤƵeT_pE")
+("cj86" "طƦEϼM~Ź@b")
+("cj94" "aeE")
+("cj96" "ha޺i˿wvTf")
+("cj; " "WwЪ")
+("cj;3" "̷E̤agS")
+("cj;4" "A")
+("cj;6" "aq®XD׬ӰĵGNChtJIAvر]oR}L")
+("cji " "")
+("cji3" "d")
+("cji4" "ìMbNfi|tֺF]nC~E_RO")
+("cji6" "dߪ")
+("cji7" "M")
+("cjo " "ǴٷuZZokϤskA")
+("cjo3" "|kt")
+("cjo4" "|føzJ©kмc}PFJrnn^YU[_PIV[Qhwj_")
+("cjo6" "^jw֤")
+("cjp " "BN_ݼ")
+("cjp3" "V")
+("cjp4" "VTIľ@ܱ")
+("cjp6" "_VLI")
+("ck " "ܨFΫ")
+("ck4" "PMbܲ~q{tw")
+("ck6" "XMeֲݽŨ׬TϲUr\ҬN粶ꭨP}{]Q[Z]]")
+("cl " "UQ")
+("cl3" "nq")
+("cl4" "ӯEqUnPVREDѮ")
+("cl6" "@ĮzbHM")
+("co " "¼KH")
+("co3" "")
+("cp3" "ܬ")
+("cp4" "")
+("cp6" "")
+("d " "}")
+("d. " "׼c")
+("d.3" "f")
+("d.4" "FnMF̪n")
+("d/ " "|^\[")
+("d/3" "")
+("d0 " "Zɷ`")
+("d03" "ԧrteԹB")
+("d04" "EЫe")
+("d8 " "@ث")
+("d83" "dya")
+("d84" "")
+("d9 " "}{|˴")
+("d93" "ʹn_ϰZZmt")
+("d94" "nZtyqn")
+("d; " "dBRnty")
+("d;3" "B")
+("d;4" "ܪʩfz˧p")
+("d;6" "")
+("dj " "\]u\")
+("dj/ " "űSOTQ")
+("dj/3" "խ")
+("dj/4" "ű")
+("dj0 " "eb")
+("dj03" "")
+("dj3" "W")
+("dj4" "wǻA}")
+("dj8 " "ئjfӡ˺Z")
+("dj83" "˺")
+("dj84" "m")
+("dj9 " "J{")
+("dj93" "")
+("dj94" "ֶ|_̼DzDaV")
+("dj; " "JصFo")
+("dj;3" "")
+("dj;4" "pqmزKRiv")
+("dj;6" "g")
+("dji3" "")
+("dji4" "AXJrbz")
+("djo " "swѧJxkJ")
+("djo3" "iyΡ")
+("djo4" "\칼XJ±|D~B`ַl")
+("djo6" "̫}ftUZP")
+("djp " "X[bCOխt񱹦cc")
+("djp3" "iѨ@")
+("djp4" "xte")
+("dk " "_VOWHa\^HΤި")
+("dk3" "iVeu_")
+("dk4" "ȽҨJgط«ߥiEyNݤ")
+("dk6" "y")
+("dl " "u")
+("dl3" "үNϢ")
+("dl4" "aR")
+("dp3" "ְپiV")
+("dp4" "vֶ")
+("e " "|")
+("e. " "yĹ_e")
+("e.3" "AceeQӭ׭")
+("e.4" "ʫcbpỸzloU")
+("e/ " "ѩeüN۩X")
+("e/3" "ծCXǮGd")
+("e/4" "}")
+("e0 " "̤zxaXݯihzЦQ")
+("e03" "PzAux")
+("e04" "FBhmG")
+("e8 " "")
+("e84" "")
+("e86" "")
+("e87" "")
+("e9 " "ӫ¸u˴yjU[")
+("e93" "")
+("e94" "\t@vbG")
+("e; " "^z\tiٻԶk")
+("e;3" "^")
+("e;4" "b")
+("ej " "htdBfۣݩKGTl^@`VW~ZTIaU")
+("ej/ " "u\ѧc`}GǪtpc@Z")
+("ej/3" "dE@Ҭq{ѱۻ")
+("ej/4" "@Ѱ^Pݢ")
+("ej0 " "x[aì``")
+("ej03" "]_FE")
+("ej04" "Ded|a[cuVq")
+("ej3" "ѥj\YSƯL[¢SaתWF`FLBXk")
+("ej4" "GTUDiL_D")
+("ej6" "")
+("ej8 " "ʬAhK~gߢ߲Aa")
+("ej83" "l")
+("ej84" "ohGEo")
+("ej9 " "")
+("ej93" "^b")
+("ej94" "J[sM")
+("ej; " "֬ҮYӤ[|")
+("ej;3" "sx")
+("ej;4" "}Rt")
+("eji " "Oԭb")
+("eji3" "GqK_t]e")
+("eji4" "L")
+("eji6" "~UQA")
+("ejo " "kWtӦc^ԳصDиt")
+("ejo3" "yެosVɣiwֿ۹F")
+("ejo4" "Qd`P@k")
+("ejp3" "uOXl@եR")
+("ejp4" "k")
+("ek " "qFޤvϷ]O")
+("ek3" "S}")
+("ek4" "ӦUШ")
+("ek6" "歲jոf𫣻J@uӨC\}")
+("ek7" "")
+("el " "|It̯oSAR\")
+("el3" "Zͷd`XR")
+("el4" "ip{")
+("eo3" "")
+("ep " "")
+("ep3" "")
+("ep4" "ӣ")
+("ep6" "")
+("f " "")
+("fm " "ϩ}X߹򦱳I£׶徵]X`B̶v\q")
+("fm, " "")
+("fm,4" "oTNe|O[i")
+("fm,6" "a")
+("fm/ " "|")
+("fm/6" "aã|rۼFTcrv߳")
+("fm0 " "ѪٯμW")
+("fm03" "enFQ")
+("fm04" "UҢy")
+("fm06" "vuறͲlҡyޤhAht޾p")
+("fm3" "TϦ")
+("fm4" "h@m")
+("fm6" "WT£CWykEQaۧ")
+("fmp " "_n")
+("fmp6" "sg")
+("fu " "Cd۱ϱ~YmּPNPQNHԧNhQr")
+("fu, " "P")
+("fu,3" "B")
+("fu,4" "ѩcĴg櫴۷h^")
+("fu,6" "XG")
+("fu. " "CLZ_tD")
+("fu.3" "")
+("fu.6" "Dy}}AsX[MGSڹgNаɦDuvZG\y")
+("fu/ " "MCɭBfJԫg")
+("fu/3" "г")
+("fu/4" "yjvkSMjբ")
+("fu/6" "")
+("fu0 " "d]EñoҴOaHʷ^ǺSrILdˡRjmCNtIV")
+("fu03" "LV")
+("fu04" "pg}SdfH")
+("fu06" "erX@xzaH̵y߰ɰFK")
+("fu3" "_ҰZ^]vs}Uͼʦ")
+("fu4" "𾹨T󫴬_WͽrE¿ltddyӽay")
+("fu6" "_XMѸR֪±Ta[XQ_ϲNתKuNBmY]gӽդDCQkcY")
+("fu8 " "t")
+("fu83" "da")
+("fu84" "ꬢαK")
+("fu; " "jʶmf٪B{ᬱN")
+("fu;3" "jmuhf")
+("fu;4" "v")
+("fu;6" "jRb|p")
+("ful " "VTKktdtpJjuW")
+("ful3" "sNN")
+("ful4" "¼¬NkTߴs")
+("ful6" "@¼LkNVBHXK")
+("fup " "˫I]k\\j")
+("fup3" "`ʫH")
+("fup4" "Gk")
+("fup6" "Ե^V߾^tAhͭܤ")
+("g " "Iv÷ͣNr˥߭йOiwHk")
+("g. " "ӧ")
+("g.3" "⭺uSF")
+("g.4" "~½G")
+("g.6" "")
+("g/ " "nӤɬ@cưNʢdTd")
+("g/3" "f")
+("g/4" "ӲtOo")
+("g/6" "÷Izh")
+("g0 " "smRûQ\ksݵh}[")
+("g03" "{٥")
+("g04" "¾տµTSĺbIMQlR")
+("g3" "ϩlvpګ˨")
+("g4" "Oƥ@hѫǥܸյAͻ}uݫKUIaغb]Kiflmrr")
+("g6" "QۮɹꭹBkӮgAMc")
+("g7" "")
+("g8 " "FTƧگjңFq")
+("g83" "")
+("g84" "KHQ|gl")
+("g86" "ԣ")
+("g9 " "z")
+("g93" "")
+("g94" "ή")
+("g; " "Ӷ˼ҴNY")
+("g;3" "ΤW")
+("g;4" "W|sg")
+("g;7" "n")
+("gj " "ѿή޲Vg_Y")
+("gj0 " "꭬C")
+("gj04" "R")
+("gj3" "ƹݴpLaIr")
+("gj4" "Nƾzpݲfƹֺ@oo}")
+("gj6" "QūEZa")
+("gj8 " "|m")
+("gj83" "A")
+("gj9 " "LI")
+("gj93" "")
+("gj94" "vO")
+("gj; " "\")
+("gj;3" "n")
+("gj;4" "f")
+("gji " "")
+("gji4" "Һ{޲v}qT㷤cx|a")
+("gjo3" "")
+("gjo4" "ε|tX")
+("gjo6" "O")
+("gjp3" "mp")
+("gjp4" "Hv")
+("gk " "aB")
+("gk3" "˪")
+("gk4" "]gAjeiQB")
+("gk6" "Dެe`")
+("gl " "NyߥzvKݾefK")
+("gl3" "")
+("gl4" "ֲЭlso׸ڼL")
+("gl6" "@ਢcϹ")
+("go6" "")
+("gp " "`ӲԩDHxWEMgP~]k[XPp")
+("gp3" "HfTnZ{{˩T")
+("gp4" "VǺƸ¨G߸Ҳ̽z")
+("gp6" "")
+("h " "θۣtl")
+("h.4" "s")
+("h/ " "")
+("h/4" "O")
+("h/6" "heU")
+("h0 " "\|")
+("h03" "G٩v")
+("h04" "GTD")
+("h06" "F[")
+("h3" "˽uүl֦")
+("h4" "Z˵۴l")
+("h6" "OϲۯZY[M")
+("h8 " "g")
+("h83" "}")
+("h84" "")
+("h9 " "q")
+("h93" "ımBsٽ")
+("h94" "ʪ")
+("h96" "~]")
+("h; " "aܷɿaV")
+("h;6" "t")
+("hj " "")
+("hj/ " "^oqw槼{vkpĽze")
+("hj/4" "")
+("hj/6" "qOFzUO")
+("hj0 " "O}")
+("hj04" "«yy")
+("hj06" "")
+("hj4" "PLLT`k")
+("hj6" "eu")
+("hji " "bROe")
+("hji3" "L")
+("hji4" "Vk")
+("hji6" "ڵ˷Dh")
+("hjo " "RʱZQgiI")
+("hjo3" "A")
+("hjo4" "Aܺ|ufXcQZ")
+("hjo6" "")
+("hjp " "r")
+("hjp3" "k")
+("hjp4" "oTG")
+("hjp6" "s")
+("hk4" "UZlI|")
+("hl " "W")
+("hl3" "{ZJ")
+("hl4" "Wͫ")
+("hl6" "ѹ˺]")
+("hp " "շ")
+("hp6" "¯KպHX")
+("i " "ᣬ")
+("i6" "@")
+("j " "ίQædzrdcjwzh")
+("j/ " "ζoS")
+("j/3" "c[f")
+("j/4" "|")
+("j0 " "WsܭdɽU")
+("j03" "߸J{YpFd`{V١wNd")
+("j04" "Uñ{ɺdEcg")
+("j06" "xYKˣJ")
+("j3" "ȪZRVMaKuɮqݳԤTmV")
+("j4" "Ūȴc~aJEcBظWt|QܪVO|;ڲg")
+("j6" "Ld^ſz`\kfmOlbid")
+("j8 " "zکKEqHCp")
+("j83" "_")
+("j84" "")
+("j86" "")
+("j9 " "n")
+("j93" "")
+("j94" "~")
+("j; " "Lʿq")
+("j;3" "PɱSI٤vR")
+("j;4" "ѦkZ")
+("j;6" "`")
+("ji " "ۭشsA")
+("ji3" "զ")
+("ji4" "רUWSQR_")
+("jo " "´Q߻~ejkDOm|ZPa")
+("jo3" "enӸTmԮUЬ޳qC߯~Lߤͷ|zypBַC")
+("jo4" "쥼Qè׭G޼LȽL}Bؼbst^Ycqu")
+("jo6" "LMߺHޮcRWIWQt\ϪaobN")
+("jp " "ŽEg")
+("jp3" "íkF")
+("jp4" "ݻDZKݯoʹ")
+("jp6" "DALTͲڧJ")
+("k " "ˣΣ")
+("k3" "")
+("k4" "cjXk̹KsEcjmˮ맸K~FإخYGݦh_")
+("k6" "B_ZZ@omXʧx˳Hrxiڸ")
+("l " "Wb")
+("l3" "ͶͽD")
+("l4" "ƿDMش鮩j")
+("l6" "ξCgR}vmlWjj")
+("m " "J@P֧ͦ")
+("m, " "A_")
+("m,4" "V֮\fDģ_`ൻGeͣTcb^|v")
+("m/ " "ıel־sV`Hvou׻R")
+("m/3" "êaiֿ鸺iñvsM\UίFѤ")
+("m/4" "Φ")
+("m/6" "qQMx")
+("m0 " "޲Wp{uBi")
+("m03" "S")
+("m04" "|@bD޶@dpC")
+("m06" "줸tDK᫮JլGXʹEF˫ʺ`ӻ[_CuޫDd")
+("m3" "PyBthžFܺ@޷OYּ{[J")
+("m4" "|JwɱUADηԴJmP౿ݱs{~¡RL\nֹ{ܮfڮKyٵHìg@HO٭RzqM}SsRgѬPkw")
+("m6" "rTl_ME򷮹O\ַصͪpfjڮLgYܢٿi½ߨҨSBB\}maЬԥؤزOm")
+("mp " "wrIjd")
+("mp3" "kfevpeu˰")
+("mp4" "BĭY@wPy")
+("mp6" "éЪ⾸aeXNʳɴ]")
+("n " "q䴵prRBTzӸ@GWS@|")
+("n. " "jB઻``YIޮ\^")
+("n.3" "]")
+("n.4" "")
+("n/ " "")
+("n0 " "TM")
+("n03" "oX")
+("n04" "{")
+("n3" "")
+("n4" "|}xvSrx쾩qξo]NYAI")
+("n7" "")
+("n8 " "e")
+("n83" "xs")
+("n84" "Ĥٻ")
+("n9 " "θ|Bl")
+("n94" "ɶ")
+("n; " "")
+("n;3" "ݺb{")
+("n;4" "")
+("nj " "ĬdpqZ")
+("nj/ " "QPSCpe]C")
+("nj/3" "qn[")
+("nj/4" "e|^w")
+("nj0 " "ĵmҩ")
+("nj03" "")
+("nj04" "[H")
+("nj4" "Dt±Jg½YHhAPFP\S{YeBɧZϩWMyB")
+("nj6" "U")
+("nji " "YPuTfbaV")
+("nji3" "ү꺾c@")
+("nji4" "")
+("njo " "kAFhB֪gCcoD")
+("njo3" "gar")
+("njo4" "EHJG`gaԽH^ID")
+("njo6" "Hs")
+("njp " "]^ެݻ_N")
+("njp3" "lgih")
+("njp4" "")
+("nk4" "槣¨OlpZu")
+("nl " "bkiR")
+("nl3" "AԵ")
+("nl4" "M")
+("np " "ix")
+("o " "")
+("p " "⣴")
+("p4" "ݮ")
+("q " "u")
+("q. " "}")
+("q.3" "٫")
+("q.6" "hѼ")
+("q/ " "yi{⧼q")
+("q/3" "֥")
+("q/4" "IԸkٮ")
+("q/6" "B^꽴NPOˢ@LܽXh~L")
+("q0 " "k")
+("q03" "")
+("q04" "Pq߯`׵KNdXϸ")
+("q06" "LYϯDn\")
+("q8 " "wr")
+("q84" "ȩ׽")
+("q86" "]ҪI")
+("q9 " "")
+("q93" "x")
+("q94" "")
+("q96" "ƵPrl")
+("q; " "S")
+("q;3" "")
+("q;4" "D")
+("q;6" "eHKʾܧxY")
+("qi " "iY@")
+("qi3" "r")
+("qi4" "}zĪyjs")
+("qi6" "CIx")
+("qj " "QPڱ_̷")
+("qj3" "HЮEPV")
+("qj4" "ɾQrnE")
+("qj6" "븲ZЦڲ\m@rzYN")
+("ql " "K")
+("ql3" "]")
+("ql4" "wpC")
+("ql6" "THS̩ϲƬҽ")
+("qo " "FA[B_N")
+("qo3" "ڦ")
+("qo4" "tبK\nSůrɵ")
+("qo6" "߳pIy")
+("qp " "Q")
+("qp3" "{")
+("qp6" "K")
+("qu " "ܤǼARQA`_e̮m|")
+("qu, " "hJ~")
+("qu,3" "J")
+("qu/ " "\{")
+("qu/3" "")
+("qu/6" "~̵īөWiΰnunmзM[۲ӱߩϰ")
+("qu0 " "gؾ")
+("qu04" "FM")
+("qu06" "Kck")
+("qu3" "_ǥԵlСy")
+("qu4" "ĴPB@}IW\vY")
+("qu6" "֯hʵ\Jts]@}ﳲgei˭ׯhAfwfpf")
+("qul " "ƺ}_ܸ")
+("qul3" "}gegpOn")
+("qul4" "}YN[")
+("qul6" "]A")
+("qup " "c")
+("qup3" "~")
+("qup4" "u")
+("qup6" "hxWIy")
+("r " "")
+("rm " "~sqjIѨuu_^ٹLڡc|")
+("rm, " "")
+("rm,3" "")
+("rm,4" "")
+("rm,6" "MıﱸZZּݿṶPྻwƨnũi}TDRn͸Ti|ZnԳ")
+("rm/ " "")
+("rm/3" "~~ޣRujbʨ滬q")
+("rm0 " "SYOկO")
+("rm03" "ԯd")
+("rm04" "¨hmѦX]ڿRβJr")
+("rm3" "|xCqLټ@")
+("rm4" "ڥy㥨@EѩڶZ߹dح£U~_\uN̥먬]~H^Kl")
+("rm6" "Żѷ|]BvپKDϾնVާ{\J^")
+("rmp " "xgvdYt")
+("rmp3" "~")
+("rmp4" "T߰pmm@CsڭMѸY]լʣj")
+("ru " "nZݿEVȦٽ]_ֺFLjEYXTBRQҨ~A~D۵F\jpl~@")
+("ru, " "󱵬ҶnnNx٬a~")
+("ru,3" "jѩn")
+("ru,4" "ɭɤǩΪ|znkzʥɲѣXP")
+("ru,6" "`ǱܧTINe׮P~ͮܤmKU^ںjQDfCP_ѹgr")
+("ru. " "ȴGGyVBЯjۮ")
+("ru.3" "E[shvb")
+("ru.4" "Ns¸ݬ^Sl\ѵ")
+("ru/ " "gק󹸮HܸeRըɰa")
+("ru/3" "ĵV[mdLX")
+("ru/4" "qRҲbvw|tlHjE߼y")
+("ru0 " "ʰyݪ}lνpq̱yf쿡J^ޥieTlFYݸۢܩT~bZh")
+("ru03" "²߰Ŵ˴zõPZcVج_uQ¥I޹")
+("ru04" "ذ󶡺ŲbCĥųϷ^xqetϽҶh}]r^D^V")
+("ru3" "Xvu٤LqP")
+("ru4" "pOJ~uHާپôҺ[MV^EkŴgɫ[ا߽xr\^ɾSELx@DA`p")
+("ru6" "ίŷYeyNI᧣AVEYǽCDaͿDk˸KcOOyiϡSϿBdHnoX@nѹո\")
+("ru8 " "a[Ũγí{EPmX@JjSrXަ뱧")
+("ru83" "Ҹ[aKzHٮL")
+("ru84" "[r[ɲ")
+("ru86" "UH|IhճqU@ֳ")
+("ru; " "Næ߫LŷlEsXo~")
+("ru;3" "C")
+("ru;4" "KjNz᰾L")
+("rul " "Х潦źJb뿼GtBMkN`wjSdh")
+("rul3" "}úͶB˳岮ϸǬQѿ@ޢ")
+("rul4" "ХsոıⵢuCiҫ]PN")
+("rul6" "Z")
+("rup " "Tzy̬o~ҴVWjd")
+("rup3" "AԾѽ@DXԻjί")
+("rup4" "iɸTʾluᶾڿʵRHݨͯh]cnSEɻa")
+("s " "z")
+("s.4" "U")
+("s.6" "c")
+("s/4" "")
+("s/6" "")
+("s0 " "_")
+("s03" "ivk")
+("s04" "")
+("s06" "nk䷣Ix")
+("s83" "")
+("s84" "ǧo[u̮RͰʴ")
+("s86" "Ѳ")
+("s93" "DiΩ`CN")
+("s94" "@`qUn")
+("s96" "")
+("s; " "")
+("s;3" "")
+("s;4" "")
+("s;6" "n")
+("s;7" "")
+("sj/4" "")
+("sj/6" "A@wªT")
+("sj03" "xN")
+("sj3" "V")
+("sj4" "")
+("sj6" "qV")
+("sji3" "")
+("sji4" "zݫѽ")
+("sji6" "R{")
+("sk " "O")
+("sl " "o")
+("sl3" "o")
+("sl4" "x")
+("sl6" "¾Lq̬`")
+("sm,4" "h")
+("sm3" "kF")
+("sm4" "~")
+("so3" "kN")
+("so4" "")
+("sp4" "")
+("su, " "En")
+("su,4" "^\¿hIAnܡjvAsQXXQ")
+("su,6" "|")
+("su. " "")
+("su.3" "çscUp")
+("su.4" "")
+("su.6" "")
+("su/3" "")
+("su/4" "צ")
+("su/6" "羮{fڬ]k")
+("su03" "ɼ[VӯGU")
+("su04" "")
+("su06" "~HpD")
+("su3" "ApF̻oP")
+("su4" "fİοdE|д")
+("su6" "dgOeND]FObk")
+("su;4" "C")
+("su;6" "Q]")
+("sul3" "оrs")
+("sul4" "")
+("sup3" "")
+("sup6" "z")
+("t " "YEè^]ګZֲwju")
+("t. " "oݱl")
+("t.3" "|p")
+("t.4" "ŷh{")
+("t.6" "TwSYCåvAW۬EP")
+("t/ " "ټeWڥaԿgY")
+("t/3" "xѭG")
+("t/4" "ٯWg")
+("t/6" "{ӲۧegJٳshкLգmu]oIWή")
+("t0 " "Ue˦~V")
+("t03" "ĶAC˱L|ossA")
+("t04" "b_")
+("t06" "Ia``GsGd^URx@")
+("t3" "ؾ`׿ݶӿj^Nɭ{")
+("t4" "ͥwK̸ܿUSLk`Kr")
+("t6" "𹣰ͦUWӳרzYӢAbNw")
+("t8 " "teCXj`")
+("t83" "")
+("t84" "ҧëbtЮ˲L")
+("t86" "dgAhQͤ")
+("t9 " "t[")
+("t94" "")
+("t96" "[")
+("t; " "Ҳs@KuI@ڨ")
+("t;3" "t")
+("t;4" "ۭҺZJC")
+("t;6" "`nvzZu|^")
+("tj " "X")
+("tj/ " "RĨRݼrE")
+("tj/3" "d")
+("tj/4" "o")
+("tj/6" "Reܣӵ֡")
+("tj0 " "tJ޸")
+("tj03" "ݦӶ")
+("tj04" "곩k@U")
+("tj06" "ǲ")
+("tj3" "Bx¦SuG")
+("tj4" "BĲbJԩzHMڢbG")
+("tj6" "xpSoQ]q`")
+("tj8 " "")
+("tj93" "")
+("tj94" "D")
+("tj96" "D")
+("tj; " "нHwy")
+("tj;3" "m")
+("tj;4" "[ޯ")
+("tj;6" "ɼl")
+("tji " "W")
+("tji4" "ؽ[Y]N\wuM")
+("tjo " "j")
+("tjo4" "j")
+("tjo6" "lݴն质޽i|P[Ƚxߡ")
+("tjp " "KYs")
+("tjp3" "eb")
+("tjp6" "®BJE]LzB")
+("tk " "s")
+("tk3" "")
+("tk4" "Mw\Kж")
+("tl " "۶rWp̢˶")
+("tl3" "n")
+("tl4" "f")
+("tl6" "¼_JHq")
+("tp " "ҵ`QݧԮ")
+("tp3" "w^")
+("tp4" "XŨh@")
+("tp6" "IڹШWըHfpӲ}YBqjɯ")
+("u " "@촥avTUIWϫHۺvbw^")
+("u, " "CO")
+("u,3" "]MԱ")
+("u,4" "~]|֫MgogEeOe")
+("u,6" "ݭCx^")
+("u. " "u~ձyNM̫׫")
+("u.3" "ͨKNO}kv߮D")
+("u.4" "SkcVɨݫ^rn\έϻ")
+("u.6" "ѴCתolS߹\ɬץO;{ɬO[a_")
+("u/ " "^NatxXĢLw}VtcRQ")
+("u/3" "vor_ջV")
+("u/4" "wMjT")
+("u/6" "ǿĹռslƶ^m]DDF")
+("u0 " "ϲjTM|کaҹPYIkmҸ`\")
+("u03" "tln^kLλjVQfJ}kٰj|LbXV")
+("u04" "P˶bTvV۳x|`@Ϊu]oŬijEvIK[mmQܵE[Avzx")
+("u06" "㨥CYuQòFԺwwr^ngZJz")
+("u3" "HwAʴȨoƧíwѰYcAܯ࿨^\xH٨")
+("u4" "NqĳqĶGl̼ݶhw@ö~cڦzHݬ汳triŦkѺm٨@|}HѥhCԷa@AJfJTܲ\EYmp^ɩh~{U̴a]٦Q԰Lnm[ZLm^γ|g")
+("u6" "òyɫi@˯ضM~xߨ^[U˲DelfpưYDQAΧ֫B˷ЭMۦҿ׻C۳ݿheolGL")
+("u8 " "r~nXٲ")
+("u83" "Ȱ׶oVܦ")
+("u84" "ȳY]GYPgoK")
+("u86" "޲PŰHbɷ")
+("u96" "Vԩ")
+("u; " "omߪtfKbG")
+("u;3" "ioWbϴ̿}")
+("u;4" "˾i~y·")
+("u;6" "vϨ˯LGzR۱޴ҳֱػ")
+("ui " "")
+("ul " "nyԧܤ\[m߷")
+("ul3" "rHʼ̳ХPJUE")
+("ul4" "nģ`_cF@xM")
+("ul6" "n󻻫ca\fdޭ]\ҰWbl`lor")
+("up " "]îfءeXMϧhL")
+("up3" "޶}CvUiXhAVL")
+("up4" "LNJxWPyu")
+("up6" "ȧuG]iҤCUlH{hyPdm")
+("v " "")
+("vm " "ݵŽNVEXSwYhdFSc")
+("vm, " "uf{")
+("vm,3" "")
+("vm,4" "峷ޫde~\׳")
+("vm,6" "ǥ`bOP")
+("vm/ " "SݤIF")
+("vm/4" "")
+("vm/6" "\")
+("vm0 " "ŰaޱySU~J̷Pimu")
+("vm03" "j")
+("vm04" "xt֭bױ|`Ta״XE")
+("vm06" "ȱax{fKozٿ")
+("vm3" "\ݷ֫HJYҷr")
+("vm4" "WԵBbf̹z͹m[w̡TC|E")
+("vm6" "}")
+("vmp " "tH}Oee{")
+("vmp4" "TVSĿA")
+("vmp6" "Mߴ`ұì}K{JнXbOgC@")
+("vu " "ƧlH}x˪RH^RfhQOLֱEXծDm]cQQ{DWR^\GrѩִrPkweξο]jioܾj\оIGM")
+("vu, " "Ƿt")
+("vu,3" "g")
+("vu,4" "±񬪮hmӨnɸѱPkbr跤طcc^_ZLgʶJWa[[")
+("vu,6" "cׯٿӨe^EHFq\DZjݲ޺_")
+("vu. " "ץ۲竦κZpVӪt")
+("vu.3" "J")
+("vu.4" "q¸óSJqͩҵɧhi")
+("vu/ " "PV{ɴiXz޼`S|")
+("vu/3" "ٿ")
+("vu/4" "濳ʩmƱӮc")
+("vu/6" "ΫDxO˶xϭn{P")
+("vu0 " "PA־kC_yD[IWjwGlܹHsGҹ")
+("vu03" "IA~ndhK`dP@vݣzBB")
+("vu04" "{umr`óA乷sիڽW|beVbv")
+("vu06" "嶢wЩβͼ_ܲC~w}pߺV۸Gyqԡ")
+("vu3" "߬~pâuVCqCҧ")
+("vu4" "Ytôiؾ񾵿ͥbͮQg\Wrm̧[]Myb")
+("vu6" "ߩu@ŧVDgKbiٶ_O{Ry")
+("vu8 " "M")
+("vu84" "UL~Hvyg")
+("vu86" "vlLUXEIƪ\jߣݡzһExE")
+("vu; " "mۭc^[R߹H")
+("vu;3" "QTɻWY")
+("vu;4" "ѦV۹HQAmM_")
+("vu;6" "Բ")
+("vul " "Ptdp­dv]ŻNJi`cFnӷڰ}AmQڴ߿]WdGuԪr")
+("vul3" "pNQ")
+("vul4" "կĻüSvSZ")
+("vul6" "mB")
+("vup " "߷s~YNʲQ`c`tʻF")
+("vup3" "ɳ")
+("vup4" "H]\ʻvX")
+("vup6" "MV")
+("w " "y")
+("w. " "")
+("w.3" "DYo")
+("w.4" "z")
+("w.6" "Yޤ")
+("w.7" "Y")
+("w/6" "küf")
+("w0 " "gyu~̾Rd")
+("w03" "ZReJT")
+("w04" "ļۺҬԼE")
+("w06" "ͼuȾ¾»\z^Gg")
+("w8 " "Loe|͢")
+("w83" "GX")
+("w84" "f϶áݭľ־ػkYlOZkoN")
+("w9 " "La")
+("w94" "ӺAOg`^yV")
+("w96" "xOa׶`iϱ|")
+("w; " "A")
+("w;3" "սlI\f")
+("w;4" "S")
+("w;6" "}޷eF]_x")
+("wj " "r`ա")
+("wj/ " "qf֢ϵk")
+("wj/3" "εѶTJo")
+("wj/4" "hºEI")
+("wj/6" "Pɮc˾ֻwӦuhiYn@J")
+("wj0 " "~")
+("wj04" "ν")
+("wj06" "{wqa")
+("wj3" "gRAzG")
+("wj4" "ߦR")
+("wj6" "ϳ~{OY\E~r̨߫YLPbwS")
+("wji " "즫UحѾ~K")
+("wji3" "IW")
+("wji4" "ݳl")
+("wji6" "mbkY@]Ws[eײO")
+("wjo " "a")
+("wjo3" "L")
+("wjo4" "haa")
+("wjo6" "ZR")
+("wjp " "]tK")
+("wjp3" "ʤ")
+("wjp4" "a")
+("wjp6" "٧ybv͵ʤ")
+("wk4" "S|i")
+("wl " "ܷŹqlݰmO[{E")
+("wl3" "Q")
+("wl4" "M")
+("wl6" "k糳^ܰެvhBp`fA")
+("wu " "I")
+("wu, " "Ḳ")
+("wu,3" "KR")
+("wu,4" "Kצ")
+("wu/ " "ťUչKͪ")
+("wu/3" "m[pMoXn")
+("wu/4" "ť")
+("wu/6" "xʫF^@lM߬W^")
+("wu0 " "ѲKZ_")
+("wu03" "QfSb٧")
+("wu04" "ml")
+("wu06" "в۰")
+("wu3" "^W")
+("wu4" "PcOKVR³|")
+("wu6" "Dڳ׽{w󻶬NVxJgl")
+("wul " "Dֽιo")
+("wul3" "DKw")
+("wul4" "ظоfm")
+("wul6" "Ѩ٭|mgqULkf")
+("x " "{")
+("x. " "O")
+("x.3" "MO\")
+("x.4" "|Sb")
+("x.6" "ӹư\ܼo~nKy")
+("x/3" "N")
+("x/4" "hD")
+("x/6" "WٱUͷ")
+("x03" "iVlI_X_")
+("x04" "lS")
+("x06" "xdiİP")
+("x8 " "԰ճXi")
+("x83" "")
+("x84" "þNfKݷ")
+("x86" "f")
+("x87" "")
+("x94" "uţ_")
+("x96" "ӵܱt]ٷJԨ")
+("x; " "j")
+("x;3" "άѢNH")
+("x;4" "J")
+("x;6" "TYw}[հGcq")
+("xj " "P")
+("xj/3" "lb")
+("xj/4" "@ձ")
+("xj/6" "sŢVŤngK]tSPFDuPRM")
+("xj03" "Z")
+("xj04" "J")
+("xj06" "rq}eCk")
+("xj3" "|ۺrfsi[")
+("xj4" "SSLSOFdOuxiFr^ڣtwSZpֵjF\c")
+("xj6" "cĪfĤl`ytGjCFDVGOB")
+("xji " "o")
+("xji3" "rs")
+("xji4" "dܯOT_BָpΪ")
+("xji6" "ùrY[ozm")
+("xjp " "")
+("xjp3" "A")
+("xjp4" "j")
+("xjp6" "۽׽_[ںԬCeKۡF")
+("xk4" "֩UǦM{Rѻ}ɪɤBͧ")
+("xk7" "F")
+("xl " "")
+("xl3" "ѫWL{y")
+("xl4" "ҵOToU")
+("xl6" "ҨcGRHbc")
+("xm,4" "n")
+("xm03" "")
+("xm06" "p")
+("xm3" "fȼiQT\M~e")
+("xm4" "ߺv{oJw")
+("xm6" "j[qB")
+("xo " "")
+("xo3" "SwԽULOWsOT|W|{KE")
+("xo4" "\־t")
+("xo6" "pݹJý]DOvAd")
+("xu " "")
+("xu, " "")
+("xu,3" "")
+("xu,4" "CPHyʨca{~duJ۶qq")
+("xu. " "")
+("xu.3" "hqg")
+("xu.4" "Hya")
+("xu.6" "Byd[hsF~aeuܬ^FUW")
+("xu/ " "")
+("xu/3" "v")
+("xu/4" "Ot϶")
+("xu/6" "sFaֳٲܭdDoMҾ~WFaIdSABRevA̰S")
+("xu03" "yLܶ")
+("xu04" "mʷkFKVߵة")
+("xu06" "spGîIſ棩rUTiIC¾Z")
+("xu3" "̲z§ح@U[ZCĿ׾YUT~")
+("xu4" "OߧQRcҾFyrɻYEwtO߷XWg~ѰŰ|UBRetgҪskEv`zqHlв`שdStVHrFUxYݹKCyd")
+("xu6" "XzpvWԸuqռIƳNx}RzMuN")
+("xu83" "")
+("xu;3" "Ry")
+("xu;4" "qG̽gDyWNѢ")
+("xu;6" "}q³DdxGWY")
+("xul " "")
+("xul3" "FAdBm")
+("xul4" "ARSb")
+("xul6" "d鼺RI·Vyc{lgvSsQ")
+("xup3" "oܱ۫j")
+("xup4" "[nĩMe")
+("xup6" "L{FOMCYbMZ`szYixSovzPB")
+("y " "stԸYdhFhۤrE^S@")
+("y. " "Q԰ph_iٴi")
+("y.3" "")
+("y.4" "J~")
+("y/ " "W¹ye")
+("y/4" "p")
+("y0 " "¯")
+("y03" "se")
+("y04" "ټgfo")
+("y06" "")
+("y3" "lJTdӥE~I͡BI")
+("y4" "ۦr{ְFIH~")
+("y7" "l")
+("y8 " "ϥ`sN")
+("y86" "{")
+("y9 " "av")
+("y93" "J_")
+("y94" "bA")
+("y; " "żB}N")
+("y;3" "")
+("y;4" "ŦN")
+("yj " "")
+("yj/ " "vaOqHwGI")
+("yj/3" "`pz")
+("yj/4" "aqr")
+("yj0 " "pp")
+("yj03" "ġp@")
+("yj04" "p")
+("yj3" "կ[A")
+("yj6" "ڨjA")
+("yji3" "w")
+("yji4" "@y`wg̩_Y")
+("yji6" "Q@O")
+("yjo " "pn")
+("yjo3" "LFCZ")
+("yjo4" "̸oK٢IPb")
+("yjp " "LJdmbS")
+("yjp3" "J")
+("yjp4" "T`WQ")
+("yk3" "")
+("yk4" "z")
+("yk6" "hdܿAɯVQᲲе")
+("yl " "DVܷ")
+("yl3" "ǾĦDj")
+("yl4" "ym꾸ķ_ļqT")
+("yl6" "w")
+("yo6" "")
+("yp3" "")
+("yp4" "")
+("z " "w")
+("z.3" "_o")
+("z.6" "MR")
+("z/ " "׺ƮpWlZ߱ީʲJgGv")
+("z/3" "w")
+("z/4" "^Ŀ_c")
+("z/6" "{_ʰIذߧ")
+("z0 " "f½ºn|`Z]")
+("z03" "Ϫ")
+("z04" "dSǥƦƶcxoJU")
+("z06" "Zc|sÿdͨ\OESڳcDysG_h")
+("z8 " "o")
+("z83" "kv")
+("z84" "kW")
+("z86" "F@ֵ|ӫk")
+("z; " "ڧ{D˨BbCK")
+("z;3" "Xϥ鯼")
+("z;4" "")
+("z;6" "Шէ{")
+("zi6" "")
+("zj " "ҽŹlSiy[@˪i`fTu")
+("zj/4" "")
+("zj3" "GjyƳ@XF̹dfrkD")
+("zj4" "tII_ƳнƸJutrL{^nF`bקTΥ۽P")
+("zj6" "A֧߯Bť񩻿TR{ܿ罻MegӺվӬ{ZXpߦlm߶׷tQNRfYGy{]z")
+("zo " "DvئmnPW")
+("zo3" "B^IK")
+("zo4" "oOͪmpȪQauWM")
+("zo6" "x")
+("zp " "ɪ^hjܨwdV")
+("zp3" "")
+("zp4" "ļT\ʮx")
+("zp6" "XIWFnVʷZbtc")
+("zul4" "")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
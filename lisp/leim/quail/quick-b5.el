@@ -0,0 +1,691 @@
+;; Quail package `chinese-b5-quick'
+;;   Generated by the command `miscdic-convert'
+;;   Source dictionary file: cangjie-table.b5
+;;   Copyright notice of the source file
+;;------------------------------------------------------
+;; # Copyright 2001 Christian Wittern <wittern@iis.sinica.edu.tw>
+;; #
+;; # Permission to copy and distribute both modified and
+;; # unmodified versions is granted without royalty provided
+;; # this notice is preserved.
+;;------------------------------------------------------
+
+;;; Code:
+
+(require 'quail)
+(quail-define-package "chinese-b5-quick" "Chinese-BIG5" "²B" t
+"Ji²jBIG5
+
+	~y²JL
+
+   [Q ] [W ] [E ] [R f] [T ] [Y R] [U s] [I ] [O H] [P ]
+
+    [A ] [S r] [D ] [F ] [G g] [H ] [J Q] [L ]
+
+      [Z  ] [X ] [C ] [V k] [B ] [N }] [M @]
+
+\\<quail-translation-docstring>"
+  '(("." . quail-next-translation-block)
+   ("," . quail-prev-translation-block))
+  nil nil)
+
+(quail-define-rules
+("a"	"")
+("aa"	"tGKN")
+("ab"	"㴸ժK")
+("ac"	"\DmV٧F")
+("ad"	"XN~ݿn")
+("ae"	"ҳ̷vxnլL")
+("af"	"ӷ־RY٥eqQppq")
+("ag"	"q|`Kا٤MxR")
+("ah"	"zvխ٦K")
+("ai"	"SɶԻ־u")
+("aj"	"uwDPF٢")
+("ak"	"M{mJE")
+("al"	"YhSo")
+("am"	"PϷy[EHlG")
+("an"	"z")
+("ao"	"OTа{")
+("ap"	"ʹeP")
+("aq"	"k")
+("ar"	"Lΰݱാջ׼ʾ[")
+("as"	"Qfmy")
+("at"	"@R}m")
+("au"	"ګ_Jܮ̰ñ߾\թի١٣٨{AkIw")
+("av"	"˱{l")
+("aw"	"m")
+("ax"	"F")
+("ay"	"F")
+("b"	"")
+("ba"	"׸@zc֭Kr}U")
+("bb"	"BͰJfͰڼڿxw|}zd")
+("bc"	"ߵɽPQūYTvZ~ytS")
+("bd"	"tBCNNw^֩KuZT")
+("be"	"AϪѬcRկGOMz|S~tuw")
+("bf"	"Mg@APcx{y")
+("bg"	"{F~eJs£l֪ILMOwDE")
+("bh"	"ͬ߬[]mnz翱xˤdeڻ")
+("bi"	"yЫaޯt\ƻKbftwVXbѯJ@CffF")
+("bj"	"uxxʸDxͮ֬ھQv}{GJ")
+("bk"	"Oӯگݱѵź̽IϾZf֨s~jdH")
+("bl"	"K}ͯ[kPVWU")
+("bm"	"BzFOĸ{νI`HߡX{Ae")
+("bn"	"G٧RnhضJɩɿmvyͬͭWnlֲ֫P}w")
+("bo"	"wbͶSeya¥é]gjmF{z")
+("bp"	"v|ragP|l")
+("bq"	"έDϸxֱYz")
+("br"	"PPLۯ޶IKMM߾ufx¤ĺjJa֮LߢQ")
+("bs"	"YاUկӻHBŦ_mv")
+("bt"	"UׯOĤżSR")
+("bu"	"ϥبũΪҬڭM֯ܲVõ˶øEĢ\KENںڽJ~F~xyx")
+("bv"	"ɯ߲ȸyLwþ\vi֯NyBy")
+("bw"	"˿t")
+("bx"	"")
+("by"	"Q")
+("c"	"")
+("ca"	"`sB")
+("cb"	"uZPQA_v}m@Ca`@ehnr")
+("cc"	"yh{|XIpRHTmcgK")
+("cd"	"˿Bww[bgBdgm")
+("ce"	"zektdgj}\jniiM")
+("cf"	"ZdVcdo")
+("cg"	"s;VY@KrʬA~oisu")
+("ch"	"̶rcOCweth")
+("ci"	"abNűgnrbnrmUWfqspRU")
+("cj"	"wNWZMhoz|hrL")
+("ck"	"YէikDh")
+("cl"	"oݹ[gˬhlUy")
+("cm"	"γvX{Y`bT")
+("cn"	"cRvxxBDpx~pk")
+("co"	"ܶymhSakA_ajV")
+("cp"	"cf{ix]ip^DJ")
+("cq"	"b")
+("cr"	"W]_ɻʻ̾TBDPyfpsvX_cC")
+("cs"	"tdRSOC@bft")
+("ct"	"ֻпŲDeeZeo")
+("cu"	"Iêw^ѾUjquu|Afg")
+("cv"	"ȻϿ^vclzd`N")
+("cw"	"\fEJL^S")
+("cx"	"l")
+("cy"	"zq")
+("d"	"")
+("da"	"HfطrٶC]bL")
+("db"	"U`ƴǴִ׺`cIJL")
+("dc"	"ѷbbdpLNWٮټ@V\W")
+("dd"	"Lʴ˺dDEQվٽپQBRZ")
+("de"	"֪KOдԼDշٱٴٺHMN")
+("df"	"MNZϴĵITмؾUٰUYZ[_{")
+("dg"	"PWخۮպegivԱղչռW")
+("dh"	"~Wbl跨{H")
+("di"	"o@Q̶ikhoCGSa׬FMJEr")
+("dj"	"SUiͷg̾uR`q")
+("dk"	"Tձձ𷤼ҼԾ[AKYyKP")
+("dl"	"Rhj}]ոT")
+("dm"	"adkٮݴӷfBH\٪ٲٵAEU")
+("dn"	"CVf췮fkFGպF")
+("do"	"Ӭ^֮緡׾cPT_ճٷٸٿBGX")
+("dp"	"JҷQS@FIxS")
+("dq"	"kݷߣ")
+("dr"	"\_eܮôȷ_jlqsCEZ[յն٫ٹGPY")
+("ds"	"Dg]^@J^bջQ")
+("dt"	"]񷭾eAXձENXV")
+("du"	"EIۮޮpohVBMORտٯٻSaCV")
+("dv"	"ڰϼհմս٬ٳD^CT")
+("dw"	"Fcɺh޽DO")
+("dx"	"OW")
+("dy"	"l`٭II")
+("e"	"")
+("ea"	"QyZCS@PXVW`")
+("eb"	"KFM_cƺvw|jURWBMEN`azDLBQae")
+("ec"	"rxNht{HpuxɢSaHI\C[tbd\^gl")
+("ed"	"NzVmBEO`b̸detxJQ\_eDOLQ]^GODE")
+("ee"	"SVaiCQ[EyrZ[DtUnotQaPX`i")
+("ef"	"DFH}SEmTϤEGJMYHKNUZY^ch")
+("eg"	"L`@IP]aFGüyooqϣPVسRWA_")
+("eh"	"FWcAPWBh{")
+("ei"	"eŦƨOkl~DLSBqNRGiIPRZw|@XUfgad")
+("ej"	"ĦĪj|fǺsA\TSq}I]RZ")
+("ek"	"MUZtG\A˷ͺzDEkQm{~ϧϫN[]`d@LVvAJT^")
+("el"	"R^}wWXB@XϥEIPrBW")
+("em"	"[q|CĿGvwTILNCCTKsERcb")
+("en"	"ŨTYm{KRssWɣEFpϩϭYy`")
+("eo"	"sxHgx~@UACTMFY")
+("ep"	"G]bd{GKVVoxY]u_uYCV[]e")
+("eq"	"vzzϨHfQ[\_")
+("er"	"efghuv}DEIUeɺFʦGJKvwyϡϬKOfEGFHFOxP]")
+("es"	"è\ɤKHOrϢcB")
+("et"	"_ns·żCyLMnM֧JKST")
+("eu"	"Ʀ¨HIJPpwy~JT^@DIOVMϪFLXZbAFNWSm\f")
+("ev"	"PCYƺu@J}gDDV~f[_")
+("ew"	"osdȼnisϦUG@")
+("ex"	"tF")
+("ey"	"XJA|")
+("f"	"")
+("fa"	"˹KVbfJ")
+("fb"	"v`mkwzβtPTcksuikRV`")
+("fc"	"MнT|IU_JjiX")
+("fd"	"̬ŷѺa{_VNYef_P")
+("fe"	"qڷRzIMxlra")
+("ff"	"ҺRU|taž]wdNWj")
+("fg"	"_󳶶Ϸ׼³ģUϮkyMXpvUAlm")
+("fh"	"֨骣XAOISg")
+("fi"	"`{X϶GKQ^o")
+("fj"	"ƲklSͨEIXZbinagHLM\")
+("fk"	"yűʹظeLUPTϴHatuT")
+("fl"	"FQL")
+("fm"	"ʺ^ϯϳjrL[`z")
+("fn"	"PdμDx޹oo")
+("fo"	"\lqR\cD")
+("fp"	"OTpxjp]")
+("fq"	"bLxMҢxdm")
+("fr"	"|OH}WuzKQUVcore")
+("fs"	"HNk")
+("ft"	"ɷԹOulwdm")
+("fu"	"ٲNhWϰvJNJ_ܱhVh{J")
+("fv"	"ۻnFHgs^`nt")
+("fw"	"lO")
+("fx"	"KSj")
+("fy"	"ϵsW")
+("g"	"g")
+("ga"	"W~M")
+("gb"	"THKUԵԸԿؤحVZ]aN")
+("gc"	"񻮼XeRLluro")
+("gd"	"afWNԭԮآ`cI")
+("ge"	"Yi߹\BVԴb[BS}r")
+("gf"	"QvԼةdGyM}~")
+("gg"	"cIԻOS]LOءدرgVQT")
+("gh"	"^XʮԷ^")
+("gi"	"hxʰAM԰ذ\WJSmghy")
+("gj"	"WmngHSԽ`ML}")
+("gk"	"GJγj׼[YأfvJM")
+("gl"	"`[vqийWb")
+("gm"	"}XZV¼cԲԺ}ئeX")
+("gn"	"|nʫTXزbdYr")
+("go"	"ڶU޶^fNK")
+("gp"	"tʪ@Q}cz")
+("gq"	"URZԾ~")
+("gr"	"NV߳W޶ŽkT\ج_aR")
+("gs"	"dT{вخei")
+("gt"	"Ur_LyB")
+("gu"	"e_j¢RYʭV[RԯԳԶثܲ]EKKS")
+("gv"	"KVa[PJإ\")
+("gw"	"\ت")
+("gx"	"Թ")
+("gy"	"~\u]")
+("h"	"")
+("ha"	"թ୻]¯²yN[")
+("hb"	"ӫӮvy}ٽZgtzkR^γR\AJKߥFHRTKZikru")
+("hc"	"T߻PnZ®±}îUţd~lXGIi\z")
+("hd"	"Gݦeu}\nyǿvQ~i@PߦߨSYG`q")
+("he"	"ϧЩquԭA_W^LìðB_D{G[IOoI{")
+("hf"	"tQmwZ[ġMyOQWvqb}~glnpsjsa")
+("hg"	"ШdӭĴa{XػܽhXY^QҡMJPY")
+("hh"	"Ŀpr©G]ͱϺC]ܭaSu")
+("hi"	"Z\gZڨpݬꭷgSoŲ쵥zyNQïw`vnϼWڸ۽ncoG")
+("hj"	"dozOqM°ʰq̲C{}Qߧ\elY")
+("hk"	"ԧwѪҲL_xjLBc|NuQja{")
+("hl"	"fLҪêsl`IWмопqU[XpZf")
+("hm"	"¥ͩǫ|²ƸaixC½uwCiгG^jxOrf")
+("hn"	"LQ嗢l`NѵŻμBbýľЫHױܯ޸SUZm")
+("ho"	"KFʪYخ{pqtb[fPjñLҼESIdeQV]`c")
+("hp"	"ɨmĩ筼xT^ZQwͿ{kJgíŢGͤA֦B@p")
+("hq"	"߫pwF|F[YyzIw")
+("hr"	"UVZާ]iMSެuǲQqY޺YehHòANP\_SLRN[fAY")
+("hs"	"EϨqЯʲȵcKfBpͧVZODbU")
+("ht"	"ɦSJLdxĥ@p֥HdhF")
+("hu"	"gۨrદĬݬޭQq±R`p|ccdıGΥ@ҽFrӸ`hkdFߤEWFHfjV|")
+("hv"	"eܸ͹suMªSBѰGYxqH}")
+("hw"	"dõfV¨^óξϻBTDxu")
+("hx"	"ݽ_­h")
+("hy"	"VrvaPW")
+("i"	"")
+("ia"	"Hs_")
+("ib"	"juԱeqtɨ")
+("ic"	"¶LGRռsQPt")
+("id"	"ɻSG͢κVu־o")
+("ie"	"æBD׭d\rHSoywG`C")
+("if"	"fNϱ^ru")
+("ig"	"xyηhL_s}")
+("ih"	"ѹʾx")
+("ii"	"Npë]e̱ͣζi_nft")
+("ij"	"wIKJAq")
+("ik"	"oϼtɥkn")
+("il"	"{¬警YNrкQ@iK")
+("im"	"ά篪ɼ{ּ")
+("in"	"EǨ没Zҿi")
+("io"	"hGzιIJֽBt^")
+("ip"	"|ȫ鮡bPAeUyθο@")
+("iq"	"ȫֲsrG")
+("ir"	"xMtw䦕׿iHa")
+("is"	"r")
+("it"	"ٲ§fεڹ]")
+("iu"	"שg[ֿ")
+("iv"	"}¸š|F")
+("iw"	"cvap")
+("ix"	"c")
+("iy"	"")
+("j"	"Q")
+("ja"	"̯ϱJJ")
+("jb"	"ɭJdJ»]fHL")
+("jc"	"ޯuGN껫BA_u@IvEVj")
+("jd"	"rt׮K^mTͦ}K@HSXe")
+("je"	"FIHLjI")
+("jf"	"vNdg`lôGvWw|]")
+("jg"	"ǲպITKypOp")
+("jh"	"WHG")
+("ji"	"ubMմueeͥ۴DFJ_X")
+("jj"	"{n_adFWFBI")
+("jk"	"VOGе¬ʼ@BK")
+("jl"	"Ʊٳfwl")
+("jm"	"hyūů͸KEC}{H")
+("jn"	"sƪƫgy氮ιarsHGL")
+("jo"	"wancswHIJtEHY")
+("jp"	"vѴf@dF")
+("jq"	"cSڬ")
+("jr"	"jxvȮ`ceH~aXQgCLxegM")
+("js"	"Ҩkh]")
+("jt"	"cuWG")
+("ju"	"CJ{cKm]sʽAdNT")
+("jv"	"wdbf«nu~r")
+("jw"	"zIbfsZd")
+("jx"	"D")
+("jy"	"Hz")
+("k"	"j@")
+("ka"	"s]޿aM")
+("kb"	"ƪԯXfٱaqhCab~çNҧh~pxڱڴLzcdwn")
+("kc"	"VPUxá\N}")
+("kd"	"s[tuҨqڰާ")
+("ke"	"̯ͬhmGIҩrsrwޥuJ")
+("kf"	"Ǩf`Ϸ𹧾rO]ޢޣcy|lqsezcb")
+("kg"	"bgWzʿcgҥڵw")
+("kh"	"lbңگڳ[o")
+("ki"	"YӬMܺƿWXe֡vޡ")
+("kj"	"`}CU`fv")
+("kk"	"enUpo~_kpN")
+("kl"	"έdCҦjK")
+("km"	"gijnVjI_cdtcgnt")
+("kn"	"E¦ibgɦDfoaaҪd֣ګ")
+("ko"	"U}è|u{`r")
+("kp"	"iE¡}pbRcm")
+("kq"	"~O}^")
+("kr"	"[k_mlݽDH`ϿаҤai֢֤sڲަ޾P")
+("ks"	"Ojq")
+("kt"	"brkE")
+("ku"	"qǩaͬаejoӷbePޤx")
+("kv"	"TPTyo^vt\]Lm")
+("kw"	"SFO")
+("kx"	"x")
+("ky"	"kaڶ")
+("l"	"")
+("la"	"ѻumE׽۾]@K")
+("lb"	"y`HIɻfʾxįsפ׮׹bkzYZaq")
+("lc"	"VOQfi|׳YZnXHI")
+("ld"	"޻rЭӾ׻k^{d")
+("le"	"QnCӽװ@AcJn")
+("lf"	"}mpq`h[_te")
+("lg"	"McE̼lp")
+("lh"	"mHZi׿bx")
+("li"	"|GMЩЮF}ק״׶fjuBIJ")
+("lj"	"BFPtЦor")
+("lk"	"vALmס׷ۺ\eiv")
+("ll"	"tӦCh˩XBWn^")
+("lm"	"i޳FILReBרׯ׾o|`")
+("ln"	"Ĺ½xlШӹ۳۶y")
+("lo"	"ĮoӺӿצת׺Xw")
+("lp"	"_NwDdЧӼײgq\eMRH")
+("lq"	"֪˴Wϸ׵۱ۿK")
+("lr"	"GHȸλjmvαϹעף׭׸׼۵l[]y")
+("ls"	"Kn~׫")
+("lt"	"دsɻgİΰ۲cdpO")
+("lu"	"INTUEøлdlŨUtӻX۹ls")
+("lv"	"jbpſ۸aK")
+("lw"	"ѳSTn˱ץA")
+("lx"	"[N")
+("ly"	"Doש")
+("m"	"@")
+("ma"	"ʬĭʮ޾Lұ٩ڨڷޱen{")
+("mb"	"A\{vNF]rQPҵnwޮQrucANs}]")
+("mc"	"^XIKxzӿXlVYDl@qŬҬteکܬf@BvZF|y~N")
+("md"	"_p߮]Y`pлûƾJMti͡eҶAydڥ_jUt")
+("me"	"E\L}yaLļ~ãڢڣޭ޵]^CW")
+("mf"	"ܭPjҽX~[GMH{z|q{O}zIdn^}")
+("mg"	"ܪZ^zPAT^NŵXmpֺUܦsah")
+("mh"	"άìDgjfSkܨޫޯlR~")
+("mi"	"ɥ˪­@k|duݵW¹sϻYjFâLɧj@x~ۼt\gS\}zCn")
+("mj"	"zyHOKdRhfmzҭkFY^")
+("mk"	"ѧ󪳪FoPֳw빽oʱiRҫҸڧ޴hmZuo")
+("ml"	"ӨH~xSŰFQRSTk˫kлشRjkMz")
+("mm"	"GTuA娻ȪZEn޵doQ@REFtl{eҷpި޳LX")
+("mn"	"BZCD쭪Ʋ|^ѷ칻HɽEo}ҲvްR")
+("mo"	"Ũh寢ֵZq\]¦êҰouެUrRgx_")
+("mp"	"Ůc\b@Rnh~~ү]wq")
+("mq"	"ǿZCҳҴֵ}wު")
+("mr"	"iۧ^_pB_z_aMTUѻŽULSһlrsֳָֻڡڤڦ^_aީF[iVP")
+("ms"	"\lSyEMuqV`ܧ")
+("mt"	"˨׬WEĿgfEGQ~EI")
+("mu"	"a̪[t{[]xJqrܾMOS{J^|Үҹַ{W޲CD`Xq")
+("mv"	"AnwԽV_KKCGCuֶVQwH")
+("mw"	"pִdhW]v{")
+("mx"	"ŴD")
+("my"	"UB`PlҺڪ")
+("n"	"}")
+("na"	"|I_GksZ")
+("nb"	"EjHCJzoMKmtZ`Ly")
+("nc"	"ptkwv[FD[")
+("nd"	"lX尣qWJuAskqUx")
+("ne"	"Ψ@o`ũZɡqGIn[")
+("nf"	"b]ٻػڿVpXEHdmLmcf")
+("ng"	"ʨYZDUبܡܣPv")
+("nh"	"ٶFt")
+("ni"	"ihߩjJĲrtvDv{ijWXw")
+("nj"	"ڰ}سټuſX~")
+("nk"	"SB}Oo")
+("nl"	"ݤ޾HVЯUHxl")
+("nm"	"mੵzæ˯syDw\")
+("nn"	"F¬]YܢAH")
+("no"	"[nԩtӫĭ~HGIEyol_")
+("np"	"v˭so")
+("nq"	"ߨiحAP|r")
+("nr"	"WKspH@|}~jnpuuz")
+("ns"	"Dijoɪz")
+("nt"	"sյnit")
+("nu"	"AզMK|{jtpVˮ˰Uίmt^")
+("nv"	"iSظ|~tj")
+("nw"	"]")
+("nx"	"Y\")
+("ny"	"~I")
+("o"	"H")
+("oa"	"BխɭҰ|x`bܷL")
+("ob"	"GبۨݫMNŭǭ۰ƶĸVaBɵɺSWYeUܽEM")
+("oc"	"LѭѰfgUŶɸgXvTh^SYkVWXt")
+("od"	"JLEܫORǶlcO[Y")
+("oe"	"ITⶺuICɫ`YVܻ]h|")
+("of"	"AYJLlocFLWbltɸenoZZWXܸܵܿj\ik")
+("og"	"KΨޫAZʹn˻Q\]RܤPR@A")
+("oh"	"J^׶˶ɷZOw")
+("oi"	"IOQDCͫXųȶǻkj^J_aɱɴ]f_g")
+("oj"	"ȥaƭڱ׳ʻ»ɮ[˹Gd_ܴܶUL")
+("ok"	"MڥϫJKSԮʰӱԳ˶ƻkb˳Lc]vܮNS")
+("ol"	"R~ɲɹɻJkZ\Y")
+("om"	"CC[íȲBڲ޴㵿ȻDefgi^`[TZoDv")
+("on"	"^Ҩ׫W\t˭̰еμCDSahɰɾ_˶˷ҾHBqT")
+("oo"	"צH٫LPöɭ˴˵ͫVa_KQw")
+("op"	"ƥNЩyzͷU_ɳ˲˽ykѡTSOܾx")
+("oq"	"~˭Į񰶰RϽl")
+("or"	"XFt٫HQU]ʭЭӭխܰɹ}~]d˸˾˿ԤQܺU")
+("os"	"馻@xĶmR\˺")
+("ot"	"֨ڲur澨gλRuTC")
+("ou"	"PΨԩ­ͭϭٶjwɬɯɶiIrf\^ܹS@")
+("ov"	"̭έخ򰳰UGk˼TNPUܼ^PY")
+("ow"	"wHDMa{ڮ")
+("ox"	"`X")
+("oy"	"Vacl")
+("p"	"")
+("pa"	"Ȭұ_")
+("pb"	"ƫmkmH}ѤѦѩeGjk|")
+("pc"	"ųVyDoi̧dgopbA")
+("pd"	"]XZѨѬKY]DF{")
+("pe"	"pBCK̬Ѫ[HPn")
+("pf"	"sϲUXahu~")
+("pg"	"שǱqoʯѧѭOL")
+("ph"	"ťG{zhE~")
+("pi"	"XcĦةī\̰Zi")
+("pj"	"|q{@C}")
+("pk"	"^I֩¼`q")
+("pl"	"QFнM")
+("pm"	"ééʩͫib̥̮TJ")
+("pn"	"FS̴lrAVc")
+("po"	"g̨dNy")
+("pp"	"񩿩˱о~bc")
+("pq"	"w̭")
+("pr"	"yɫ񮩱}[|̢̣̪бѮV\bK~")
+("ps"	"WhjE̩̫nC")
+("pt"	"@Y_ѣ")
+("pu"	"٥]ի鮮{nWj̤̯ѥѫWl{}z")
+("pv"	"~th̡ѢBLO|J")
+("pw"	"l˴o̦Af")
+("px"	"m")
+("py"	"^")
+("q"	"")
+("qa"	"K{Pծeݥݨ")
+("qb"	"CdpK̷̾Ѷvz|բVcq}ݦݬݲ")
+("qc"	"dlX^kwդݢݧݸ")
+("qd"	"ԩ쮹ñıŴ|gRTѴѼզ`iݹݺK")
+("qe"	"ާܮ´hjZѵ^psա")
+("qf"	"̴zTl[ZݩݳݻA")
+("qg"	"֬CERuho|BE")
+("qh"	"ۧ䴭U̺f")
+("qi"	"rзike̶̹ѻ۷")
+("qj"	"ݩ٩±L½[jykݣ")
+("qk"	"ޫʴ}~JMN]̿[")
+("ql"	"㮿Y˪̽ѹ^L")
+("qm"	"@kbQ̵̼no}UXݫݭݵM")
+("qn"	"ܧثñrWYgD")
+("qo"	"ҧߧDȴþھQ̸~d`N")
+("qp"	"׫ɼz\l̻|QmեleݮyB")
+("qq"	"^ծSTa")
+("qr"	"۩ݩAB˲efm}ѷѸѿhiqu@Anݡݴ")
+("qs"	"کߩַc}{q")
+("qt"	"ԩѴ̴f~ݤݯG")
+("qu"	"ꮾүӱǳWnoj̳ѳѺѾgxbpݱݶ")
+("qv"	"Ocѽ{գ]_mݪtCFL")
+("qw"	"y׾d\jz")
+("qx"	"괡tݰ")
+("qy"	"")
+("r"	"f")
+("ra"	"԰۶ݹ˽|POzfnsDOP")
+("rb"	"QoDٳڳݳ繿JL}uyq\]HF@TU")
+("rc"	"uzwSɼQ~EŮԧTABGRp")
+("rd"	"SbI}ڸ򾸿ļCGtԪSZB`")
+("re"	"lsL_qhݼ_DDQ")
+("rf"	"ܳ۶ܶIKY`O{}krHINFg")
+("rg"	"Rez߳Don|FԩtikpQCA^Q")
+("rh"	"ohknr̽icA")
+("ri"	"T[J@aǼTZĽCmvyBj@BB@]")
+("rj"	"ͼM\~HAu~ԦzRUCE@")
+("rk"	"dpru|C[Ⱦ~YwzFK@C")
+("rl"	"nsvDEArkʻRŭʥjvyX")
+("rm"	"pAC׳kٳضNʣԡJOb")
+("rn"	"mYO\uGx{nGE|hoM")
+("ro"	"`jKyֳl^¹ļPzB@rxԨYbEFC")
+("rp"	"w\OY]VxLMlm[EF")
+("rq"	"ľʡDNwzPV")
+("rr"	"f@B~ڰس۶`ûH@EDԣo{qP")
+("rs"	"t{QԶZGK")
+("rt"	"ն\߼Oʢug")
+("ru"	"xSacmqFHް]ʤv{}ԢgwnGXM_e")
+("rv"	"ܳ޸ƾWXŹCsmxWA[aO")
+("rw"	"{psS")
+("rx"	"SEl")
+("ry"	"Nضԥ^")
+("s"	"r")
+("sa"	"O߼h¾gyyV")
+("sb"	"`hеǾwuvFGźxCm`e}")
+("sc"	"ǫo[lųŽKkYDY|Qhi")
+("sd"	"ˮ^Glapb|")
+("se"	"ji@]^")
+("sf"	"հOY[O^~Xvw_v")
+("sg"	"Jΰ׸tCnNdhfyR")
+("sh"	"MAdI\|")
+("si"	"bLMtWzPgbkR`")
+("sj"	"չ@A¿jEEbcnX_hZzz~")
+("sk"	"﹤pvDaec\")
+("sl"	"KڧXCpnUseFRmV[")
+("sm"	"NkPBbxS")
+("sn"	"^uͪhjogI")
+("so"	"ت׻EbJxpf")
+("sp"	"ҧԫͮ|mhoťz]{")
+("sq"	"RsvRtx")
+("sr"	"lqrg~ΰϵsdg{MĴXGio^")
+("ss"	"uoD")
+("st"	"̬PݺʽcpQjZS")
+("su"	"vwW}ԹŻsAga_~")
+("sv"	"icGv|XuY[TU")
+("sw"	"Zqa")
+("sx"	"{")
+("sy"	"Q")
+("t"	"")
+("ta"	"䴶ۼǽuPH")
+("tb"	"\ҳ@׵޸UUVZTͺ~|fivۡۢܰN`ft@FKLTHJ")
+("tc"	"@èݶīwm~PADS@xO")
+("td"	"YFٵߵ~^ĦĬ~Ӫgqs۫߭TksI")
+("te"	"ߪԵٵ踵OͿa\orhkrwnMQq{PUEIUO")
+("tf"	"̲λ[]^PNZi||e߯ߵuY[emrMQWx|kPbmorE`")
+("tg"	"۲츳ӾcĩzzxӢӳklp{ܥapVKRqIKF")
+("th"	"ުTZŲ￺L;lbazdxJB")
+("ti"	"dܴL`q`õdˢˣ{}Уӫӵmp}ۻܫ߱XZ]iCDGQSDpL")
+("tj"	"ʭ[ѵӵطrˡmvzsA|ܩ߾{UnG@")
+("tk"	"^q߸߽@üͲͷ͸ͽntӧӬn߫TWMO")
+("tl"	"g¾G~зӲӴ|oYnO^wTRC\]J[")
+("tm"	"̪ftcûŷuСs{Ի]z^cjۦmVchlBU")
+("tn"	"eR~ڿ_KM|ͳ͹ͼpw~өӮyMBlqۯ߬߰߿")
+("to"	"۪ܯ۵ܵݵrpXۿĻwNvwyu`btC_g۩\buv|VzD")
+("tp"	"~OSu}{ͶoТyӥZet۰SE")
+("tq"	"ϸŶѱӶfHANTy")
+("tr"	"VWXYaeеոT_aĨĵAqsӦӨӭӯcd]ۣۥۨߪ߲ߺ_FLA|G")
+("ts"	"ڭUǰɲҶԸUNxХӡnuwxۧߴ߼g")
+("tt"	"}qY\Īĭmkӱ^iۮߩTG")
+("tu"	"ʪݫѭS_`bcAڵ帴vH[}ʹ͵ͻrӤYj[`bdxۭܪl߹߽Ljz{TVJzj")
+("tv"	"~Ưֵ縯Ab~bi}ħӣӰ[hav߳߷߸߻RoN{K")
+("tw"	"]Wÿt}_۪ۤ۬߮߶}Oy")
+("tx"	"y")
+("ty"	"ҵyФy")
+("u"	"s")
+("ua"	"j}ej")
+("ub"	"kY[\Cέlirs")
+("uc"	"Fq\C")
+("ud"	"WPQeXA")
+("ue"	"Įmi")
+("uf"	"RThl")
+("ug"	"VZ{΢")
+("uh"	"P")
+("ui"	"ϫծoE]P`dRd^iEQ")
+("uj"	"ppA|ah")
+("uk"	"b")
+("ul"	"BKaΩZ\")
+("um"	"SD_`z")
+("un"	"z³ͳf~Χk")
+("uo"	"lrOkykd")
+("up"	"X[ΨJO")
+("uq"	"bc")
+("ur"	"ЮnT^cegΣΤΪΫmnDMNVD")
+("us"	"v]hkήcg")
+("ut"	"Zjvl")
+("uu"	"XsU^AJ|Ρj\f")
+("uv"	"QΦάqB_`")
+("uw"	"@Ug")
+("uy"	"b")
+("v"	"k")
+("va"	"@BY´¹øT[")
+("vb"	"SǰBh޹ߺbls^ʴInrδؼؾ]`xfyWqt")
+("vc"	"Zi}q\^Zr@")
+("vd"	"nof_CJi_ռbpQVgطؿAZfqbj[")
+("ve"	"ŴDA߽uvwgt[\pyiTw")
+("vf"	"ͨapamq]e·}RYصBwdxVX")
+("vg"	"[õDtaQ^h\uB")
+("vh"	"nXɽz[hʷL`ػWaom")
+("vi"	"qiϬZƱNʹXf~ZʳʸKRKT@mlm")
+("vj"	"lA`ry_öʲEeYDkcsU_s")
+("vk"	"îNTٵoúʹGLZ]SXrtVo")
+("vl"	"ȮRVԶmjq_BʶʻPJ_UXضYq")
+("vm"	"jmոgxbcFHMd[krTQUpC")
+("vn"	"Ѵ@sʵͩjdVW")
+("vo"	"Hqt{aν\غz{gWjC")
+("vp"	"g㮤įȷ@B`nlYn")
+("vq"	"r̵ndpѲ}v")
+("vr"	"phlдE^pQµůJObckloqsϷ^ؽbe|qZ")
+("vs"	"ۥV\Nfl")
+("vt"	"kض~U]sB")
+("vu"	"mUY°oβҴAc¶÷\rlʺhibPZع_depw")
+("vv"	"QWDk˺\]WmcChoS")
+("vw"	"oӺBTºrF`R")
+("vx"	"¸E")
+("vy"	"n")
+("w"	"")
+("wa"	"pf")
+("wb"	"GEʨԫԬ|")
+("wc"	"|eRuI")
+("wd"	"_xG@iTk")
+("we"	"uڭ޼k")
+("wf"	"ֶ½|nMh|")
+("wg"	"־Sù[")
+("wh"	"z]v")
+("wi"	"븾åz")
+("wj"	"벦An`H")
+("wk"	"]ʬq")
+("wl"	"Ҫq")
+("wm"	"m|\_g")
+("wn"	"ٻ@rʩm")
+("wo"	"}I`")
+("wp"	"sM}ʧi^z")
+("wq"	"`s")
+("wr"	"^TF˲I\H|Dd")
+("ws"	"kK")
+("wt"	"")
+("wu"	"yJ޻j")
+("wv"	"ȶpG")
+("ww"	"")
+("wy"	"oh")
+("y"	"R")
+("ya"	"ڸ߽ѾDӿJ")
+("yb"	"w|֫ҫԳ[pqJMtݻIMwн׾AͿTݽݾPPk~@")
+("yc"	"szXWCŪŸB`g[EIOsEh")
+("yd"	"AɬIXYg~[ݹCνҽؿѿķ|ETLO")
+("ye"	"[]GeIVݿ@gOitRXQ")
+("yf"	"ʯi|ٻ̽;BϿNLmrwx}@l")
+("yg"	"Dx}fiNlѻ۽־þAbSCFGON")
+("yh"	"B۳CYE{~W")
+("yi"	"ȯYQE^hֻɿؿĳAըrYNP")
+("yj"	"樯pPTv\s{Bٿä|ĶGŤINRXAM")
+("yk"	"]񫳮İ@eڳZ~ľCmwMS")
+("yl"	"񭥰V`tusRQ˧˨Eh")
+("ym"	"WǭhRܲwACջ˽@Oyܳ޺HK~WOVC~")
+("yn"	"먴FqWBйO@ƿ|ýĹ޷Ni")
+("yo"	"譡ak۳vӹEz۾{P}IKWcQIMP")
+("yp"	"Ѫ]Uݳ_Nһx{{shOxдILv[")
+("yq"	"oԹFHп")
+("yr"	"e[{|~jlmӳoy׵@FgǸ׸ܸLYyտԿĸIжֹMJQCB")
+("ys"	"ǳXzBظۻr˥е")
+("yt"	"ٰ߫nr|cЪЬOMg")
+("yu"	"R䪼G^OSf@N޹DPͻEv˦ְ~MZi")
+("yv"	"`k稵csȰIJhOjϹKܻqǽӿֿ\iŧjJNsvwv")
+("yw"	"}biG}BWZ")
+("yx"	"")
+("yy"	"˥drD")
+("z;" "FQABMN")
+("z:" "GJRDCEOP")
+("z'" "")
+("z\"" "")
+("z\\" "@B")
+("z|" "UWY")
+("z/" "A")
+("z?" "HS")
+("z<" "qաs")
+("z>" "r֡t")
+("z[" "eigkuyw{")
+("z]" "fjhlvzx|")
+("z{" "ac ")
+("z}" "bd")
+("z`" "")
+("z~" "ʡˡ[\")
+("z!" "IT")
+("z@" "IN")
+("z#" "")
+("z$" "CL")
+("z%" "HM")
+("z&" "")
+("z*" "Ρ")
+("z(" "]}_")
+("z)" "^~`")
+("z-" "VX¡áС")
+("z_" "ġ")
+("z=" "ס")
+("z+" "ϡ")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: big5
+;; End:
+
+;;; quick-b5.el ends here
@@ -5971,6 +5971,25 @@ The value is a floating-point number."
 	  (set-window-vscroll nil dlh t)))))))
 
 
+(defun line-move-coalesce-p (command)
+  "Return non-nil if COMMAND may move several lines in one go.
+COMMAND is `next-line' or `previous-line'.  This is their predicate
+in `coalesce-repeated-commands'.  A single `next-line' adds a newline
+at the end of the buffer if `next-line-add-newlines' is non-nil.  With
+`auto-window-vscroll', a single line move may instead scroll the
+window when it is vscrolled or its last line is partially visible;
+see `line-move'.  Moving N lines at once does neither."
+  (not (or (and (eq command 'next-line) next-line-add-newlines)
+	   (and auto-window-vscroll
+		(not noninteractive)
+		(zerop scroll-conservatively)
+		(or (/= (window-vscroll nil t) 0)
+		    (and (eq command 'next-line)
+			 (let ((lh (window-line-height -1)))
+			   (if lh
+			       (> (nth 3 lh) 0)
+			     (cddr (pos-visible-in-window-p t nil t))))))))))
+
 ;; This is like line-move-1 except that it also performs
 ;; vertical scrolling of tall images if appropriate.
 ;; That is not really a clean thing to do, since it mixes
@@ -2485,7 +2485,14 @@ to `accept-change-group' or `cancel-change-group'."
   (dolist (elt handle)
     (with-current-buffer (car elt)
       (if (eq buffer-undo-list t)
-	  (setq buffer-undo-list nil)))))
+	  (setq buffer-undo-list nil))
+      ;; The undo entries of consecutive deletions and replacements
+      ;; are merged in place, which would change the entry that the
+      ;; handle points to and make `cancel-change-group' undo too
+      ;; little.  Push a harmless entry that stops such merging; it
+      ;; must not be an `undo-boundary', which would be visible.
+      (when (consp buffer-undo-list)
+	(push (list 'apply 'ignore nil) buffer-undo-list)))))
 
 (defun accept-change-group (handle)
   "Finish a change group made with `prepare-change-group' (which see).
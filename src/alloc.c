@@ -5748,6 +5748,7 @@ garbage_collect_1 (void *end)
   mark_specpdl ();
   mark_terminals ();
   mark_kboards ();
+  mark_regexp_cache ();
 
 #ifdef USE_GTK
   xg_mark_data ();
@@ -6114,6 +6115,11 @@ mark_buffer (struct buffer *buffer)
   mark_overlay (buffer->overlays_before);
   mark_overlay (buffer->overlays_after);
 
+  if (buffer->parse_state_cache)
+    mark_parse_state_cache (buffer->parse_state_cache);
+  if (buffer->syntax_runs)
+    mark_syntax_runs (buffer->syntax_runs);
+
   /* If this is an indirect buffer, mark its base buffer.  */
   if (buffer->base_buffer && !VECTOR_MARKED_P (buffer->base_buffer))
     mark_buffer (buffer->base_buffer);
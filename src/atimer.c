@@ -53,6 +53,10 @@ static bool alarm_timer_ok;
 # ifdef HAVE_TIMERFD
 /* File descriptor for timer, or -1 if it could not be created.  */
 static int timerfd;
+
+/* The time TIMERFD is set to expire at, or an invalid time if it is
+   not set.  */
+static struct timespec timerfd_wakeup;
 # else
 enum { timerfd = -1 };
 # endif
@@ -75,6 +79,11 @@ unblock_atimers (sigset_t const *oldset)
   pthread_sigmask (SIG_SETMASK, oldset, 0);
 }
 
+/* An atimer may fire this fraction of its delay late, so that
+   timers ripe at nearly the same time fire together.  */
+
+enum { ATIMER_SLACK_DIVISOR = 16 };
+
 /* Function prototypes.  */
 
 static void set_alarm (void);
@@ -82,6 +91,23 @@ static void schedule_atimer (struct atimer *);
 static struct atimer *append_atimer_lists (struct atimer *,
                                            struct atimer *);
 
+
+/* Return how late a timer with delay DELAY may fire.  */
+
+static struct timespec
+atimer_slack (struct timespec delay)
+{
+  if (ATIMER_SLACK_DIVISOR <= delay.tv_sec)
+    return make_timespec (1, 0);
+  else
+    {
+      long long ns = (delay.tv_sec * (long long) TIMESPEC_RESOLUTION
+		      + delay.tv_nsec) / ATIMER_SLACK_DIVISOR;
+      return make_timespec (ns / TIMESPEC_RESOLUTION,
+			    ns % TIMESPEC_RESOLUTION);
+    }
+}
+
 /* Start a new atimer of type TYPE.  TIMESTAMP specifies when the timer is
    ripe.  FN is the function to call when the timer fires.
    CLIENT_DATA is stored in the client_data member of the atimer
@@ -97,6 +123,10 @@ static struct atimer *append_atimer_lists (struct atimer *,
 
    If TYPE is ATIMER_CONTINUOUS, the timer fires every TIMESTAMP seconds.
 
+   Relative and continuous timers may fire up to a sixteenth of
+   TIMESTAMP late, but no more than a second, so that Emacs can wake
+   up once for several timers.
+
    Value is a pointer to the atimer started.  It can be used in calls
    to cancel_atimer; don't free it yourself.  */
 
@@ -140,11 +170,13 @@ start_atimer (enum atimer_type type, struct timespec timestamp,
 
     case ATIMER_RELATIVE:
       t->expiration = timespec_add (current_timespec (), timestamp);
+      t->slack = atimer_slack (timestamp);
       break;
 
     case ATIMER_CONTINUOUS:
       t->expiration = timespec_add (current_timespec (), timestamp);
       t->interval = timestamp;
+      t->slack = atimer_slack (timestamp);
       break;
     }
 
@@ -283,7 +315,49 @@ run_all_atimers (void)
 }
 
 
-/* Arrange for a SIGALRM to arrive when the next timer is ripe.  */
+/* Return the time at which to run the active atimers: the earliest
+   time at which a timer must fire, given its slack, moved earlier
+   onto a coarse grid if that keeps it at or after the time the first
+   timer is ripe.  Timers ripe at nearly the same time then fire
+   together, and wake-ups due to other timers with similar slack, in
+   Emacs or in other programs, tend to fall on the same instants.  */
+
+static struct timespec
+atimer_wakeup_time (void)
+{
+  struct timespec ripe = atimers->expiration;
+  struct timespec deadline = timespec_add (ripe, atimers->slack);
+  struct atimer *t;
+
+  for (t = atimers->next;
+       t && timespec_cmp (t->expiration, deadline) < 0;
+       t = t->next)
+    {
+      struct timespec t_deadline = timespec_add (t->expiration, t->slack);
+      if (timespec_cmp (t_deadline, deadline) < 0)
+	deadline = t_deadline;
+    }
+
+  /* Round DEADLINE down to a multiple of the largest power of two
+     nanoseconds not exceeding its distance from RIPE.  */
+  struct timespec room = timespec_sub (deadline, ripe);
+  long long room_ns = (room.tv_sec < 1
+		       ? room.tv_nsec : TIMESPEC_RESOLUTION);
+  if (0 < room_ns && 0 <= deadline.tv_sec)
+    {
+      long long grain = 1, ns;
+      while (grain <= room_ns / 2)
+	grain *= 2;
+      ns = ((deadline.tv_sec % grain) * (TIMESPEC_RESOLUTION % grain)
+	    + deadline.tv_nsec) % grain;
+      deadline = timespec_sub (deadline, make_timespec (0, ns));
+    }
+
+  return deadline;
+}
+
+/* Arrange for a SIGALRM to arrive, or the timer descriptor to become
+   readable, when the next timers are to run.  */
 
 static void
 set_alarm (void)
@@ -294,16 +368,23 @@ set_alarm (void)
       struct itimerval it;
 #endif
       struct timespec now, interval;
+      struct timespec wakeup = atimer_wakeup_time ();
 
 #ifdef HAVE_ITIMERSPEC
       if (0 <= timerfd || alarm_timer_ok)
 	{
 	  struct itimerspec ispec;
-	  ispec.it_value = atimers->expiration;
+	  ispec.it_value = wakeup;
 	  ispec.it_interval.tv_sec = ispec.it_interval.tv_nsec = 0;
 # ifdef HAVE_TIMERFD
-	  if (timerfd_settime (timerfd, TFD_TIMER_ABSTIME, &ispec, 0) == 0)
+	  /* Starting and canceling a timer often leaves the wake-up
+	     time as it was; do not set the descriptor again then.  */
+	  if (0 <= timerfd
+	      && (timespec_cmp (timerfd_wakeup, wakeup) == 0
+		  || (timerfd_settime (timerfd, TFD_TIMER_ABSTIME, &ispec, 0)
+		      == 0)))
 	    {
+	      timerfd_wakeup = wakeup;
 	      add_timer_wait_descriptor (timerfd);
 	      return;
 	    }
@@ -317,9 +398,9 @@ set_alarm (void)
       /* Determine interval till the next timer is ripe.
 	 Don't set the interval to 0; this disables the timer.  */
       now = current_timespec ();
-      interval = (timespec_cmp (atimers->expiration, now) <= 0
+      interval = (timespec_cmp (wakeup, now) <= 0
 		  ? make_timespec (0, 1000 * 1000)
-		  : timespec_sub (atimers->expiration, now));
+		  : timespec_sub (wakeup, now));
 
 #ifdef HAVE_SETITIMER
 
@@ -409,6 +490,7 @@ timerfd_callback (int fd, void *arg)
     {
       /* Timer should expire just once.  */
       eassert (expirations == 1);
+      timerfd_wakeup = invalid_timespec ();
       do_pending_atimers ();
     }
   else if (nbytes < 0)
@@ -455,6 +537,7 @@ turn_on_atimers (bool on)
 	timer_settime (alarm_timer, TIMER_ABSTIME, &ispec, 0);
 # ifdef HAVE_TIMERFD
       timerfd_settime (timerfd, TFD_TIMER_ABSTIME, &ispec, 0);
+      timerfd_wakeup = invalid_timespec ();
 # endif
 #endif
       alarm (0);
@@ -491,9 +574,11 @@ debug_timer_callback (struct atimer *t)
     {
 #ifdef HAVE_SETITIMER
       struct timespec delta = timespec_sub (now, r->expected);
-      /* Too late if later than expected + 0.02s.  FIXME:
+      /* Too late if later than expected + slack + 0.02s.  FIXME:
 	 this should depend from system clock resolution.  */
-      if (timespec_cmp (delta, make_timespec (0, 20000000)) > 0)
+      if (timespec_cmp (delta, timespec_add (t->slack,
+					      make_timespec (0, 20000000)))
+	  > 0)
 	r->intime = 0;
       else
 #endif /* HAVE_SETITIMER */
@@ -523,8 +608,9 @@ Return t if all self-tests are passed, nil otherwise.  */)
     }
 
 #ifdef HAVE_TIMERFD
-  /* Wait for 1s but process timers.  */
-  wait_reading_process_output (1, 0, 0, false, Qnil, NULL, 0);
+  /* Wait for 1.1s, enough for the last timer's slack, but process
+     timers.  */
+  wait_reading_process_output (1, 100000000, 0, false, Qnil, NULL, 0);
 #else
   /* If timerfd is not supported, wait_reading_process_output won't
      pay attention to timers that expired, and the callbacks won't be
@@ -561,6 +647,7 @@ init_atimer (void)
   /* Until this feature is considered stable, you can ask to not use it.  */
   timerfd = (egetenv ("EMACS_IGNORE_TIMERFD") ? -1 :
 	     timerfd_create (CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC));
+  timerfd_wakeup = invalid_timespec ();
 # endif
   if (timerfd < 0)
     {
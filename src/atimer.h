@@ -56,6 +56,10 @@ struct atimer
   /* Interval of this timer.  */
   struct timespec interval;
 
+  /* How much later than EXPIRATION this timer may fire, so that it
+     can fire together with other timers.  */
+  struct timespec slack;
+
   /* Function to call when timer is ripe.  Interrupt input is
      guaranteed to not be blocked when this function is called.  */
   atimer_callback fn;
@@ -38,6 +38,7 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "character.h"
 #include "buffer.h"
 #include "region-cache.h"
+#include "line-index.h"
 #include "indent.h"
 #include "blockinput.h"
 #include "keymap.h"
@@ -558,10 +559,14 @@ even if it is dead.  The return value is never nil.  */)
   *(BUF_GPT_ADDR (b)) = *(BUF_Z_ADDR (b)) = 0; /* Put an anchor '\0'.  */
   b->text->inhibit_shrinking = false;
   b->text->redisplay = false;
+  b->text->gap_motion_bytes = 0;
 
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
+  b->parse_state_cache = 0;
+  b->syntax_runs = 0;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -786,6 +791,9 @@ CLONE nil means the indirect buffer's state is reset to default values.  */)
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
+  b->parse_state_cache = 0;
+  b->syntax_runs = 0;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -1875,6 +1883,21 @@ cleaning up all windows currently displaying the buffer to be killed. */)
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->line_index)
+    {
+      free_line_index (b->line_index);
+      b->line_index = 0;
+    }
+  if (b->parse_state_cache)
+    {
+      free_parse_state_cache (b->parse_state_cache);
+      b->parse_state_cache = 0;
+    }
+  if (b->syntax_runs)
+    {
+      free_syntax_runs (b->syntax_runs);
+      b->syntax_runs = 0;
+    }
   bset_width_table (b, Qnil);
   unblock_input ();
   bset_undo_list (b, Qnil);
@@ -2297,6 +2320,9 @@ results, see Info node `(elisp)Swapping Text'.  */)
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (line_index, struct line_index *);
+  swapfield (parse_state_cache, struct parse_state_cache *);
+  swapfield (syntax_runs, struct syntax_runs *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield (overlays_before, struct Lisp_Overlay *);
@@ -6145,6 +6171,12 @@ at all, these scans may be slow.  If `cache-long-scans' is non-nil,
 results of these scans are cached.  This doesn't help too much if
 paragraphs are of the reasonable (few thousands of characters) size.
 
+`parse-partial-sexp' also records the state of parses that start at
+the beginning of the buffer every few thousand characters, so that
+later parses from there can resume from the last recorded state.
+When `parse-sexp-lookup-properties' is non-nil, the syntax scanning
+functions likewise cache where the `syntax-table' property changes.
+
 The caches require no explicit maintenance; their accuracy is
 maintained internally by the Emacs primitives.  Enabling or disabling
 the cache should not affect the behavior of any of the motion
@@ -451,6 +451,10 @@ struct buffer_text
     EMACS_INT compact;		/* Set to modiff each time when compact_buffer
 				   is called for this buffer.  */
 
+    /* Number of bytes copied so far to move or enlarge the gap.
+       Only used for statistics; see `gap-motion-bytes'.  */
+    EMACS_INT gap_motion_bytes;
+
     /* Minimum value of GPT - BEG since last redisplay that finished.  */
     ptrdiff_t beg_unchanged;
 
@@ -855,6 +859,19 @@ struct buffer
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* Sampled line starts, to move over many lines at once; see
+     line-index.h.  Like the newline cache, it is only kept in base
+     buffers, and only while `cache-long-scans' is non-nil.  */
+  struct line_index *line_index;
+
+  /* Checkpoints of parses from the beginning of the buffer; see
+     syntax.c.  Kept in base buffers like the caches above.  */
+  struct parse_state_cache *parse_state_cache;
+
+  /* Runs of text with the same `syntax-table' property; see syntax.c.
+     Also kept in base buffers only.  */
+  struct syntax_runs *syntax_runs;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
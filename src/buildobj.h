@@ -0,0 +1,69 @@
+"vm-limit.o",
+"dispnew.o",
+"frame.o",
+"scroll.o",
+"xdisp.o",
+"menu.o",
+"window.o",
+"charset.o",
+"coding.o",
+"category.o",
+"ccl.o",
+"character.o",
+"chartab.o",
+"bidi.o",
+"cm.o",
+"term.o",
+"terminal.o",
+"xfaces.o",
+"emacs.o",
+"keyboard.o",
+"macros.o",
+"keymap.o",
+"sysdep.o",
+"buffer.o",
+"filelock.o",
+"insdel.o",
+"marker.o",
+"minibuf.o",
+"fileio.o",
+"dired.o",
+"cmds.o",
+"casetab.o",
+"casefiddle.o",
+"indent.o",
+"search.o",
+"regex.o",
+"undo.o",
+"alloc.o",
+"data.o",
+"doc.o",
+"editfns.o",
+"callint.o",
+"eval.o",
+"floatfns.o",
+"fns.o",
+"font.o",
+"print.o",
+"lread.o",
+"syntax.o",
+"unexelf.o",
+"bytecode.o",
+"process.o",
+"gnutls.o",
+"callproc.o",
+"region-cache.o",
+"line-index.o",
+"sound.o",
+"atimer.o",
+"doprnt.o",
+"intervals.o",
+"textprop.o",
+"composite.o",
+"xml.o",
+"inotify.o",
+"profiler.o",
+"decompress.o",
+"terminfo.o",
+"lastfile.o",
+"gmalloc.o",
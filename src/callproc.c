@@ -247,6 +247,24 @@ usage: (call-process PROGRAM &optional INFILE DESTINATION DISPLAY &rest ARGS)  *
   return unbind_to (count, call_process (nargs, args, filefd, -1));
 }
 
+/* Return a string describing signal SIG, as call-process returns for
+   a process that SIG killed.  */
+
+Lisp_Object
+signal_description (int sig)
+{
+  const char *signame;
+
+  synchronize_system_messages_locale ();
+  signame = strsignal (sig);
+
+  if (signame == 0)
+    signame = "unknown";
+
+  return code_convert_string_norecord (build_string (signame),
+				       Vlocale_coding_system, 0);
+}
+
 /* Like Fcall_process (NARGS, ARGS), except use FILEFD as the input file.
 
    If TEMPFILE_INDEX is nonnegative, it is the specpdl index of an
@@ -781,18 +799,7 @@ call_process (ptrdiff_t nargs, Lisp_Object *args, int filefd,
   unbind_to (count, Qnil);
 
   if (WIFSIGNALED (status))
-    {
-      const char *signame;
-
-      synchronize_system_messages_locale ();
-      signame = strsignal (WTERMSIG (status));
-
-      if (signame == 0)
-	signame = "unknown";
-
-      return code_convert_string_norecord (build_string (signame),
-					   Vlocale_coding_system, 0);
-    }
+    return signal_description (WTERMSIG (status));
 
   eassert (WIFEXITED (status));
   return make_number (WEXITSTATUS (status));
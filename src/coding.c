@@ -1144,6 +1144,104 @@ alloc_destination (struct coding_system *coding, ptrdiff_t nbytes,
 #define UTF_8_BOM_2 0xBB
 #define UTF_8_BOM_3 0xBF
 
+/* Word-at-a-time scanning of ASCII text.  Bytes are loaded into a
+   size_t with memcpy, so the source needs no particular alignment.
+   This lets check_ascii, check_utf_8 and detect_coding_utf_8 skip
+   runs of plain ASCII text several bytes per iteration, which is
+   where most of the time goes when visiting a large file.  */
+
+#define ASCII_WORD_ONES ((size_t) -1 / UCHAR_MAX)
+#define ASCII_WORD_HIGH_BITS (ASCII_WORD_ONES << (CHAR_BIT - 1))
+
+/* Return true if some byte of the word W equals C.  */
+
+static bool
+ascii_word_has_byte (size_t w, unsigned char c)
+{
+  size_t x = w ^ (ASCII_WORD_ONES * c);
+  return ((x - ASCII_WORD_ONES) & ~x & ASCII_WORD_HIGH_BITS) != 0;
+}
+
+/* Skip whole words of ASCII bytes other than CR, starting at SRC and
+   without reading at or past END.  If a skipped word contains an LF,
+   record it in *EOL_SEEN.  Return the first byte not skipped.
+
+   To avoid retrying a failed word for each of its bytes, nothing is
+   skipped while SRC is before *RETRY, and *RETRY is set to the byte
+   after the word that stopped the scan.  */
+
+static const unsigned char *
+skip_ascii_words (const unsigned char *src, const unsigned char *end,
+		  const unsigned char **retry, int *eol_seen)
+{
+  size_t w;
+
+  if (src < *retry)
+    return src;
+  while (end - src >= sizeof w)
+    {
+      memcpy (&w, src, sizeof w);
+      if ((w & ASCII_WORD_HIGH_BITS) || ascii_word_has_byte (w, '\r'))
+	break;
+      if (ascii_word_has_byte (w, '\n'))
+	*eol_seen |= EOL_SEEN_LF;
+      src += sizeof w;
+    }
+  *retry = src + sizeof w;
+  return src;
+}
+
+
+/* Like skip_ascii_words, but skip whole words that contain neither a
+   CR nor an LF, whatever their other bytes are.  */
+
+static const unsigned char *
+skip_non_eol_words (const unsigned char *src, const unsigned char *end,
+		    const unsigned char **retry)
+{
+  size_t w;
+
+  if (src < *retry)
+    return src;
+  while (end - src >= sizeof w)
+    {
+      memcpy (&w, src, sizeof w);
+      if (ascii_word_has_byte (w, '\n') || ascii_word_has_byte (w, '\r'))
+	break;
+      src += sizeof w;
+    }
+  *retry = src + sizeof w;
+  return src;
+}
+
+/* Remove from the NBYTES bytes at BUF every CR that is followed by an
+   LF if CRLF_ONLY, or every CR but a final one otherwise.  The text is
+   compacted in place in a single forward pass, using memchr to find
+   the CRs.  Return the number of bytes removed.  */
+
+static ptrdiff_t
+compact_cr (unsigned char *buf, ptrdiff_t nbytes, bool crlf_only)
+{
+  unsigned char *from = buf, *to = buf, *end = buf + nbytes, *cr;
+
+  while ((cr = memchr (from, '\r', end - from - 1)) != NULL)
+    {
+      ptrdiff_t len = cr - from;
+
+      if (crlf_only && cr[1] != '\n')
+	len++;
+      if (to != from)
+	memmove (to, from, len);
+      to += len;
+      from = cr + 1;
+      if (from >= end - 1)
+	break;
+    }
+  if (to != from)
+    memmove (to, from, end - from);
+  return from - to;
+}
+
 /* Unlike the other detect_coding_XXX, this function counts the number
    of characters and checks the EOL format.  */
 
@@ -1158,6 +1256,7 @@ detect_coding_utf_8 (struct coding_system *coding,
   bool bom_found = 0;
   ptrdiff_t nchars = coding->head_ascii;
   int eol_seen = coding->eol_seen;
+  const unsigned char *retry = src;
 
   detect_info->checked |= CATEGORY_MASK_UTF_8;
   /* A coding system of this category is always ASCII compatible.  */
@@ -1178,6 +1277,13 @@ detect_coding_utf_8 (struct coding_system *coding,
     {
       int c, c1, c2, c3, c4;
 
+      if (! multibytep)
+	{
+	  const unsigned char *p
+	    = skip_ascii_words (src, src_end, &retry, &eol_seen);
+	  nchars += p - src;
+	  src = p;
+	}
       src_base = src;
       ONE_MORE_BYTE (c);
       if (c < 0 || UTF_8_1_OCTET_P (c))
@@ -6194,20 +6300,23 @@ static Lisp_Object adjust_coding_eol_type (struct coding_system *coding,
 static ptrdiff_t
 check_ascii (struct coding_system *coding)
 {
-  const unsigned char *src, *end;
+  const unsigned char *src, *end, *retry;
   Lisp_Object eol_type = CODING_ID_EOL_TYPE (coding->id);
   int eol_seen = coding->eol_seen;
 
   coding_set_source (coding);
-  src = coding->source;
+  src = retry = coding->source;
   end = src + coding->src_bytes;
 
   if (inhibit_eol_conversion
       || SYMBOLP (eol_type))
     {
       /* We don't have to check EOL format.  */
-      while (src < end && !( *src & 0x80))
+      while (src < end)
 	{
+	  src = skip_ascii_words (src, end, &retry, &eol_seen);
+	  if (src == end || (*src & 0x80))
+	    break;
 	  if (*src++ == '\n')
 	    eol_seen |= EOL_SEEN_LF;
 	}
@@ -6217,8 +6326,12 @@ check_ascii (struct coding_system *coding)
       end--;		    /* We look ahead one byte for "CR LF".  */
       while (src < end)
 	{
-	  int c = *src;
+	  int c;
 
+	  src = skip_ascii_words (src, end, &retry, &eol_seen);
+	  if (src == end)
+	    break;
+	  c = *src;
 	  if (c & 0x80)
 	    break;
 	  src++;
@@ -6266,7 +6379,7 @@ check_ascii (struct coding_system *coding)
 static ptrdiff_t
 check_utf_8 (struct coding_system *coding)
 {
-  const unsigned char *src, *end;
+  const unsigned char *src, *end, *retry;
   int eol_seen;
   ptrdiff_t nchars = coding->head_ascii;
 
@@ -6274,14 +6387,20 @@ check_utf_8 (struct coding_system *coding)
     check_ascii (coding);
   else
     coding_set_source (coding);
-  src = coding->source + coding->head_ascii;
+  src = retry = coding->source + coding->head_ascii;
   /* We look ahead one byte for CR LF.  */
   end = coding->source + coding->src_bytes - 1;
   eol_seen = coding->eol_seen;
   while (src < end)
     {
-      int c = *src;
+      const unsigned char *p = skip_ascii_words (src, end, &retry, &eol_seen);
+      int c;
 
+      nchars += p - src;
+      src = p;
+      if (src == end)
+	break;
+      c = *src;
       if (UTF_8_1_OCTET_P (*src))
 	{
 	  src++;
@@ -6424,40 +6543,47 @@ detect_eol (const unsigned char *source, ptrdiff_t src_bytes,
 	}
     }
   else
-    while (src < src_end)
-      {
-	c = *src++;
-	if (c == '\n' || c == '\r')
-	  {
-	    int this_eol;
+    {
+      const unsigned char *retry = src;
 
-	    if (c == '\n')
-	      this_eol = EOL_SEEN_LF;
-	    else if (src >= src_end || *src != '\n')
-	      this_eol = EOL_SEEN_CR;
-	    else
-	      this_eol = EOL_SEEN_CRLF, src++;
+      while (src < src_end)
+	{
+	  src = skip_non_eol_words (src, src_end, &retry);
+	  if (src == src_end)
+	    break;
+	  c = *src++;
+	  if (c == '\n' || c == '\r')
+	    {
+	      int this_eol;
 
-	    if (eol_seen == EOL_SEEN_NONE)
-	      /* This is the first end-of-line.  */
-	      eol_seen = this_eol;
-	    else if (eol_seen != this_eol)
-	      {
-		/* The found type is different from what found before.
-		   Allow for stray ^M characters in DOS EOL files.  */
-		if ((eol_seen == EOL_SEEN_CR && this_eol == EOL_SEEN_CRLF)
-		    || (eol_seen == EOL_SEEN_CRLF && this_eol == EOL_SEEN_CR))
-		  eol_seen = EOL_SEEN_CRLF;
-		else
-		  {
-		    eol_seen = EOL_SEEN_LF;
-		    break;
-		  }
-	      }
-	    if (++total == MAX_EOL_CHECK_COUNT)
-	      break;
-	  }
-      }
+	      if (c == '\n')
+		this_eol = EOL_SEEN_LF;
+	      else if (src >= src_end || *src != '\n')
+		this_eol = EOL_SEEN_CR;
+	      else
+		this_eol = EOL_SEEN_CRLF, src++;
+
+	      if (eol_seen == EOL_SEEN_NONE)
+		/* This is the first end-of-line.  */
+		eol_seen = this_eol;
+	      else if (eol_seen != this_eol)
+		{
+		  /* The found type is different from what found before.
+		     Allow for stray ^M characters in DOS EOL files.  */
+		  if ((eol_seen == EOL_SEEN_CR && this_eol == EOL_SEEN_CRLF)
+		      || (eol_seen == EOL_SEEN_CRLF && this_eol == EOL_SEEN_CR))
+		    eol_seen = EOL_SEEN_CRLF;
+		  else
+		    {
+		      eol_seen = EOL_SEEN_LF;
+		      break;
+		    }
+		}
+	      if (++total == MAX_EOL_CHECK_COUNT)
+		break;
+	    }
+	}
+    }
   return eol_seen;
 }
 
@@ -6756,6 +6882,32 @@ detect_coding (struct coding_system *coding)
 }
 
 
+/* Return true if the CRs of the text that CODING just decoded into the
+   current buffer can be removed by compacting that text in place and
+   deleting its tail, instead of deleting each CR separately.  That
+   requires that nothing can tell the two apart: undo is disabled, no
+   marker points inside the text, and its text properties are
+   uniform.  */
+
+static bool
+decode_eol_in_place_p (struct coding_system *coding)
+{
+  ptrdiff_t from = coding->dst_pos;
+  ptrdiff_t to = from + coding->produced_char;
+  struct Lisp_Marker *m;
+
+  if (coding->produced < 2
+      || ! EQ (BVAR (current_buffer, undo_list), Qt))
+    return false;
+  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+    if (m->charpos > from && m->charpos < to)
+      return false;
+  return (! buffer_intervals (current_buffer)
+	  || EQ (Fnext_property_change (make_number (from), Qnil,
+					make_number (to)),
+		 make_number (to)));
+}
+
 static void
 decode_eol (struct coding_system *coding)
 {
@@ -6775,9 +6927,13 @@ decode_eol (struct coding_system *coding)
   if (VECTORP (eol_type))
     {
       int eol_seen = EOL_SEEN_NONE;
+      const unsigned char *retry = pbeg;
 
       for (p = pbeg; p < pend; p++)
 	{
+	  p = (unsigned char *) skip_non_eol_words (p, pend, &retry);
+	  if (p == pend)
+	    break;
 	  if (*p == '\n')
 	    eol_seen |= EOL_SEEN_LF;
 	  else if (*p == '\r')
@@ -6807,9 +6963,8 @@ decode_eol (struct coding_system *coding)
 
   if (EQ (eol_type, Qmac))
     {
-      for (p = pbeg; p < pend; p++)
-	if (*p == '\r')
-	  *p = '\n';
+      for (p = pbeg; (p = memchr (p, '\r', pend - p)) != NULL; p++)
+	*p = '\n';
     }
   else if (EQ (eol_type, Qdos))
     {
@@ -6817,14 +6972,23 @@ decode_eol (struct coding_system *coding)
 
       if (NILP (coding->dst_object))
 	{
-	  /* Start deleting '\r' from the tail to minimize the memory
-	     movement.  */
-	  for (p = pend - 2; p >= pbeg; p--)
-	    if (*p == '\r')
-	      {
-		memmove (p, p + 1, pend-- - p - 1);
-		n++;
-	      }
+	  if (pend - pbeg > 1)
+	    n = compact_cr (pbeg, pend - pbeg, false);
+	}
+      else if (decode_eol_in_place_p (coding))
+	{
+	  /* Squeeze out the CRs in one pass, then delete the leftover
+	     bytes at the end of the decoded text all at once.  */
+	  ptrdiff_t pos_end = coding->dst_pos + coding->produced_char;
+	  ptrdiff_t pos_end_byte = coding->dst_pos_byte + coding->produced;
+
+	  if (GPT > coding->dst_pos && GPT < pos_end)
+	    move_gap_both (pos_end, pos_end_byte);
+	  n = compact_cr (BYTE_POS_ADDR (coding->dst_pos_byte),
+			  coding->produced, true);
+	  if (n > 0)
+	    del_range_2 (pos_end - n, pos_end_byte - n,
+			 pos_end, pos_end_byte, 0);
 	}
       else
 	{
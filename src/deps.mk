@@ -38,7 +38,7 @@ atimer.o: atimer.c atimer.h syssignal.h systime.h lisp.h blockinput.h \
  globals.h ../lib/unistd.h $(config_h)
 bidi.o: bidi.c buffer.h character.h dispextern.h lisp.h \
    globals.h $(config_h)
-buffer.o: buffer.c buffer.h region-cache.h commands.h window.h \
+buffer.o: buffer.c buffer.h region-cache.h line-index.h commands.h window.h \
    $(INTERVALS_H) blockinput.h atimer.h systime.h character.h ../lib/unistd.h \
    indent.h keyboard.h coding.h keymap.h frame.h lisp.h globals.h $(config_h)
 callint.o: callint.c window.h commands.h buffer.h keymap.h globals.h \
@@ -125,7 +125,7 @@ indent.o: indent.c frame.h window.h indent.h buffer.h lisp.h $(config_h) \
    keyboard.h systime.h coding.h $(INTERVALS_H) globals.h
 inotify.o: inotify.c lisp.h coding.h process.h keyboard.h frame.h termhooks.h
 insdel.o: insdel.c window.h buffer.h $(INTERVALS_H) blockinput.h character.h \
-   atimer.h systime.h region-cache.h lisp.h globals.h $(config_h)
+   atimer.h systime.h region-cache.h line-index.h lisp.h globals.h $(config_h)
 keyboard.o: keyboard.c termchar.h termhooks.h termopts.h buffer.h character.h \
    commands.h frame.h window.h macros.h disptab.h keyboard.h syssignal.h \
    systime.h syntax.h $(INTERVALS_H) blockinput.h atimer.h composite.h \
@@ -166,11 +166,13 @@ regex.o: regex.c syntax.h buffer.h lisp.h globals.h $(config_h) regex.h \
    category.h character.h
 region-cache.o: region-cache.c buffer.h region-cache.h \
    lisp.h globals.h $(config_h)
+line-index.o: line-index.c buffer.h line-index.h \
+   lisp.h globals.h $(config_h)
 scroll.o: scroll.c termchar.h dispextern.h frame.h keyboard.h \
    termhooks.h lisp.h globals.h $(config_h) systime.h coding.h composite.h \
    window.h
-search.o: search.c regex.h commands.h buffer.h region-cache.h syntax.h \
-   blockinput.h atimer.h systime.h category.h character.h charset.h \
+search.o: search.c regex.h commands.h buffer.h region-cache.h line-index.h \
+   syntax.h blockinput.h atimer.h systime.h category.h character.h charset.h \
    $(INTERVALS_H) lisp.h globals.h $(config_h)
 sound.o: sound.c dispextern.h syssignal.h lisp.h globals.h $(config_h) \
    atimer.h systime.h ../lib/unistd.h
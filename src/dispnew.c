@@ -3053,6 +3053,7 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
   /* True means display has been paused because of pending input.  */
   bool paused_p;
   struct window *root_window = XWINDOW (f->root_window);
+  struct timespec start = current_timespec (), flush_start;
 
   if (redisplay_dont_pause)
     force_p = true;
@@ -3106,7 +3107,9 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
 
       /* Update windows.  */
       paused_p = update_window_tree (root_window, force_p);
+      flush_start = current_timespec ();
       update_end (f);
+      record_latency (LATENCY_FLUSH, flush_start);
     }
   else
     {
@@ -3120,6 +3123,7 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
       /* Update the display.  */
       update_begin (f);
       paused_p = update_frame_1 (f, force_p, inhibit_hairy_id_p, 1);
+      flush_start = current_timespec ();
       update_end (f);
 
       if (FRAME_TERMCAP_P (f) || FRAME_MSDOS_P (f))
@@ -3129,6 +3133,7 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
 	  if (FRAME_TERMCAP_P (f))
 	    fflush (FRAME_TTY (f)->output);
         }
+      record_latency (LATENCY_FLUSH, flush_start);
 
       /* Check window matrices for lost pointers.  */
 #ifdef GLYPH_DEBUG
@@ -3142,6 +3147,7 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
   set_window_update_flags (root_window, false);
 
   display_completed = !paused_p;
+  record_latency (LATENCY_UPDATE_FRAME, start);
   return paused_p;
 }
 
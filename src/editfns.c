@@ -1100,6 +1100,16 @@ See also `gap-position'.  */)
   return temp;
 }
 
+DEFUN ("gap-motion-bytes", Fgap_motion_bytes, Sgap_motion_bytes, 0, 0, 0,
+       doc: /* Return the number of bytes copied to move or enlarge the gap.
+The count covers the current buffer's text since it was created.  It
+is meant for measuring how much an editing pattern costs in gap
+motion.  See also `gap-position' and `gap-size'.  */)
+  (void)
+{
+  return make_number (current_buffer->text->gap_motion_bytes);
+}
+
 DEFUN ("position-bytes", Fposition_bytes, Sposition_bytes, 1, 1, 0,
        doc: /* Return the byte position for character position POSITION.
 If POSITION is out of range, the value is nil.  */)
@@ -5149,6 +5159,7 @@ functions if all the text being accessed has this property.  */);
   defsubr (&Spoint_max_marker);
   defsubr (&Sgap_position);
   defsubr (&Sgap_size);
+  defsubr (&Sgap_motion_bytes);
   defsubr (&Sposition_bytes);
   defsubr (&Sbyte_to_position);
 
@@ -3170,6 +3170,16 @@ otherwise, if FILE2 does not exist, the answer is t.  */)
 /* Some buffer offsets are stored in 'int' variables.  */
 verify (READ_BUF_SIZE <= INT_MAX);
 
+/* Regular files are read straight into the gap, whose size is known
+   in advance, so they can be read in much bigger chunks than special
+   files.  This cuts the number of system calls needed to visit a huge
+   file, while still letting the user quit between chunks.  */
+#ifndef REGULAR_READ_BUF_SIZE
+#define REGULAR_READ_BUF_SIZE (4 << 20)
+#endif
+verify (READ_BUF_SIZE <= REGULAR_READ_BUF_SIZE
+	&& REGULAR_READ_BUF_SIZE <= INT_MAX);
+
 /* This function is called after Lisp functions to decide a coding
    system are called, or when they cause an error.  Before they are
    called, the current buffer is set unibyte and it contains only a
@@ -4041,6 +4051,13 @@ by calling `format-decode', which see.  */)
 	report_file_error ("Setting file position", orig_filename);
     }
 
+#ifdef HAVE_POSIX_FADVISE
+  /* Tell the kernel the whole range will be read once, in order, so
+     that it can read ahead aggressively.  */
+  if (! not_regular && total > READ_BUF_SIZE)
+    posix_fadvise (fd, beg_offset, total, POSIX_FADV_SEQUENTIAL);
+#endif
+
   /* In the following loop, HOW_MUCH contains the total bytes read so
      far for a regular file, and not changed for a special file.  But,
      before exiting the loop, it is set to a negative value if I/O
@@ -4058,7 +4075,9 @@ by calling `format-decode', which see.  */)
     while (how_much < total)
       {
 	/* `try' is reserved in some compilers (Microsoft C).  */
-	ptrdiff_t trytry = min (total - how_much, READ_BUF_SIZE);
+	ptrdiff_t trytry = min (total - how_much,
+				(not_regular
+				 ? READ_BUF_SIZE : REGULAR_READ_BUF_SIZE));
 	ptrdiff_t this;
 
 	if (not_regular)
@@ -82,9 +82,25 @@ character_width (int c, struct Lisp_Char_Table *dp)
      in display_text_line.  */
 
   /* Everything can be handled by the display table, if it's
-     present and the element is right.  */
+     present and the element is right.  Each glyph of the vector
+     takes one column if it is a printing character.  Other glyphs,
+     such as the newline in whitespace-mode's `$' marker, move to
+     another column or line, so their width is not fixed.  */
   if (dp && (elt = DISP_CHAR_VECTOR (dp, c), VECTORP (elt)))
-    return ASIZE (elt);
+    {
+      ptrdiff_t i;
+
+      for (i = 0; i < ASIZE (elt); i++)
+	{
+	  Lisp_Object entry = AREF (elt, i);
+
+	  if (GLYPH_CODE_P (entry)
+	      && ! (GLYPH_CODE_CHAR (entry) >= 040
+		    && GLYPH_CODE_CHAR (entry) < 0177))
+	    return 0;
+	}
+      return ASIZE (elt);
+    }
 
   /* Some characters are special.  */
   if (c == '\n' || c == '\t' || c == '\015')
@@ -1176,9 +1192,13 @@ compute_motion (ptrdiff_t from, ptrdiff_t frombyte, EMACS_INT fromvpos,
                    ? XVECTOR (BVAR (current_buffer, width_table))->contents
                    : 0);
   else
-    /* If the window has its own display table, we can't use the width
-       run cache, because that's based on the buffer's display table.  */
-    width_table = 0;
+    {
+      /* If the window has its own display table, we can't use the
+	 width run cache, because that's based on the buffer's display
+	 table.  */
+      width_table = 0;
+      width_cache = NULL;
+    }
 
   /* Negative width means use all available text columns.  */
   if (width < 0)
@@ -1534,11 +1554,14 @@ compute_motion (ptrdiff_t from, ptrdiff_t frombyte, EMACS_INT fromvpos,
 	      else
 		{
 		  /* Have we accumulated a run to put in the cache?
-		     (Currently, we only cache runs of width == 1).  */
+		     The cache records the common width of the run, so
+		     runs of wide display-table glyphs are skipped as
+		     quickly as runs of ordinary characters.  */
 		  if (width_run_start < width_run_end
-		      && width_run_width == 1)
-		    know_region_cache (cache_buffer, width_cache,
-				       width_run_start, width_run_end);
+		      && width_run_width != 0)
+		    set_region_cache (cache_buffer, width_cache,
+				      width_run_start, width_run_end,
+				      width_run_width);
 
 		  /* Start recording a new width run.  */
 		  width_run_width = XFASTINT (width_table[c]);
@@ -1674,10 +1697,10 @@ compute_motion (ptrdiff_t from, ptrdiff_t frombyte, EMACS_INT fromvpos,
 
   /* Remember any final width run in the cache.  */
   if (width_cache
-      && width_run_width == 1
+      && width_run_width != 0
       && width_run_start < width_run_end)
-    know_region_cache (cache_buffer, width_cache,
-                       width_run_start, width_run_end);
+    set_region_cache (cache_buffer, width_cache,
+		      width_run_start, width_run_end, width_run_width);
 
   val_compute_motion.bufpos = pos;
   val_compute_motion.bytepos = pos_byte;
@@ -355,8 +355,8 @@ See inotify_rm_watch(2) for more information.
   /* Cleanup if no more files are watched.  */
   if (NILP (watch_list))
     {
-      emacs_close (inotifyfd);
       delete_read_fd (inotifyfd);
+      emacs_close (inotifyfd);
       inotifyfd = -1;
     }
 
@@ -29,6 +29,7 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "buffer.h"
 #include "window.h"
 #include "region-cache.h"
+#include "line-index.h"
 
 static void insert_from_string_1 (Lisp_Object, ptrdiff_t, ptrdiff_t, ptrdiff_t,
 				  ptrdiff_t, bool, bool);
@@ -142,6 +143,7 @@ gap_left (ptrdiff_t charpos, ptrdiff_t bytepos, bool newgap)
       new_s1 -= i;
       from -= i, to -= i;
       memmove (to, from, i);
+      current_buffer->text->gap_motion_bytes += i;
     }
 
   /* Adjust buffer data structure, to put the gap at BYTEPOS.
@@ -197,6 +199,7 @@ gap_right (ptrdiff_t charpos, ptrdiff_t bytepos)
 	i = 32000;
       new_s1 += i;
       memmove (to, from, i);
+      current_buffer->text->gap_motion_bytes += i;
       from += i, to += i;
     }
 
@@ -495,6 +498,31 @@ make_gap (ptrdiff_t nbytes_added)
 #endif
 }
 
+/* Move the gap to point and make sure it is at least NBYTES long,
+   in preparation for inserting NBYTES bytes there.
+
+   When the gap has to grow, enlarging it copies all the text after
+   the gap.  So if point is before the gap, enlarge the gap first and
+   move it afterwards: the text between point and the old gap is then
+   copied only once instead of twice.  */
+
+static void
+prepare_gap_for_insertion (ptrdiff_t nbytes)
+{
+  if (GAP_SIZE < nbytes && PT < GPT)
+    {
+      make_gap (nbytes - GAP_SIZE);
+      move_gap_both (PT, PT_BYTE);
+    }
+  else
+    {
+      if (PT != GPT)
+	move_gap_both (PT, PT_BYTE);
+      if (GAP_SIZE < nbytes)
+	make_gap (nbytes - GAP_SIZE);
+    }
+}
+
 /* Add NBYTES to B's gap.  It's enough to temporarily
    fake current_buffer and avoid real switch to B.  */
 
@@ -800,10 +828,7 @@ insert_1_both (const char *string,
        or make it smaller.  */
     prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < nbytes)
-    make_gap (nbytes - GAP_SIZE);
+  prepare_gap_for_insertion (nbytes);
 
 #ifdef BYTE_COMBINING_DEBUG
   if (count_combining_before (string, nbytes, PT, PT_BYTE)
@@ -920,10 +945,7 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < outgoing_nbytes)
-    make_gap (outgoing_nbytes - GAP_SIZE);
+  prepare_gap_for_insertion (outgoing_nbytes);
 
   /* Copy the string text into the buffer, perhaps converting
      between single-byte and multibyte.  */
@@ -1033,6 +1055,28 @@ insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
   check_markers ();
 }
 
+/* Advance every marker of the current buffer that still points at
+   FROM / FROM_BYTE to TO / TO_BYTE.  Used after text has been inserted
+   between those positions by a function that leaves markers behind,
+   such as insert_from_gap, to give the effect of inserting it before
+   markers.  */
+
+void
+advance_markers_at_insertion (ptrdiff_t from, ptrdiff_t from_byte,
+			      ptrdiff_t to, ptrdiff_t to_byte)
+{
+  struct Lisp_Marker *m;
+
+  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+    if (m->bytepos == from_byte)
+      {
+	m->bytepos = to_byte;
+	m->charpos = to;
+      }
+
+  check_markers ();
+}
+
 /* Insert text from BUF, NCHARS characters starting at CHARPOS, into the
    current buffer.  If the text in BUF has properties, they are absorbed
    into the current buffer.
@@ -1101,10 +1145,7 @@ insert_from_buffer_1 (struct buffer *buf,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < outgoing_nbytes)
-    make_gap (outgoing_nbytes - GAP_SIZE);
+  prepare_gap_for_insertion (outgoing_nbytes);
 
   if (from < BUF_GPT (buf))
     {
@@ -1928,6 +1969,12 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
     invalidate_region_cache (buf,
                              buf->width_run_cache,
                              start - BUF_BEG (buf), BUF_Z (buf) - end);
+  if (buf->line_index)
+    invalidate_line_index (buf, buf->line_index, start, end);
+  if (buf->parse_state_cache)
+    invalidate_parse_state_cache (buf, start, false);
+  if (buf->syntax_runs)
+    invalidate_syntax_runs (buf, start);
 }
 
 /* These macros work with an argument named `preserve_ptr'
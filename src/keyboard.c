@@ -278,6 +278,32 @@ bool input_pending;
    which results in better feedback to the user.  */
 static bool input_was_pending;
 
+/* The time at which the oldest keystroke whose effects have not been
+   displayed yet arrived, or an invalid time if there is none.  */
+static struct timespec input_arrival_time;
+
+/* The number of durations that latency-samples remembers for each
+   stage.  */
+enum { LATENCY_SAMPLES = 256 };
+
+/* The most recent durations of one stage of handling input, as a ring
+   buffer.  INDEX is where the next one goes, and COUNT is how many of
+   them are valid.  */
+struct latency_ring
+{
+  struct timespec samples[LATENCY_SAMPLES];
+  int index, count;
+};
+
+static struct latency_ring latency_rings[LATENCY_STAGES];
+
+/* The symbols naming the stages, indexed by enum latency_stage.  */
+static Lisp_Object latency_stage_names;
+
+/* The time at which read_char took the event it is returning from the
+   input queue, or an invalid time if it is not returning one.  */
+static struct timespec read_char_start;
+
 /* Circular buffer for pre-read keyboard input.  */
 
 static union buffered_input_event kbd_buffer[KBD_BUFFER_SIZE];
@@ -344,6 +370,8 @@ static void (*keyboard_init_hook) (void);
 
 static bool get_input_pending (int);
 static bool readable_events (int);
+static bool kbd_buffer_repeats_p (Lisp_Object);
+static EMACS_INT kbd_buffer_take_repeats (Lisp_Object);
 static Lisp_Object read_char_x_menu_prompt (Lisp_Object,
                                             Lisp_Object, bool *);
 static Lisp_Object read_char_minibuf_menu_prompt (int, Lisp_Object);
@@ -1257,6 +1285,8 @@ command_loop_1 (void)
   EMACS_INT prev_modiff = 0;
   struct buffer *prev_buffer = NULL;
   bool already_adjusted = 0;
+  struct timespec stage_start;
+  Lisp_Object coalesce;
 
   kset_prefix_arg (current_kboard, Qnil);
   kset_last_prefix_arg (current_kboard, Qnil);
@@ -1434,6 +1464,35 @@ command_loop_1 (void)
       if (!NILP (read_key_sequence_remapped))
 	cmd = read_key_sequence_remapped;
 
+      /* If the key that invoked a command such as next-line is queued
+	 up again, as when it autorepeats faster than the command and
+	 redisplay can keep up, run the command once for all of the
+	 repetitions, with their number as prefix argument, unless
+	 the command's predicate says that would be different.  */
+      if (i == 1 && this_command_key_count == 1
+	  && NILP (KVAR (current_kboard, Vprefix_arg))
+	  && NILP (Vexecuting_kbd_macro)
+	  && NILP (KVAR (current_kboard, defining_kbd_macro))
+	  && NILP (Vunread_command_events)
+	  && NILP (Vunread_post_input_method_events)
+	  && NILP (Vunread_input_method_events)
+	  && !current_kboard->kbd_queue_has_data
+	  && CONSP (coalesce = Fassq (cmd, Vcoalesce_repeated_commands)))
+	{
+	  Lisp_Object key = AREF (this_command_keys, 0);
+	  EMACS_INT repeats = 0;
+
+	  if (kbd_buffer_repeats_p (key)
+	      && (NILP (XCDR (coalesce))
+		  || !NILP (safe_call1 (XCDR (coalesce), cmd))))
+	    repeats = kbd_buffer_take_repeats (key);
+	  if (repeats > 0)
+	    {
+	      num_input_keys += repeats;
+	      kset_prefix_arg (current_kboard, make_number (repeats + 1));
+	    }
+	}
+
       /* Execute the command.  */
 
       {
@@ -1445,7 +1504,9 @@ command_loop_1 (void)
       }
       Vthis_command = cmd;
       Vreal_this_command = cmd;
+      stage_start = current_timespec ();
       safe_run_hooks (Qpre_command_hook);
+      record_latency (LATENCY_PRE_COMMAND_HOOK, stage_start);
 
       already_adjusted = 0;
 
@@ -1476,7 +1537,9 @@ command_loop_1 (void)
             point_before_last_command_or_undo = PT;
             buffer_before_last_command_or_undo = current_buffer;
 
+            stage_start = current_timespec ();
             call1 (Qcommand_execute, Vthis_command);
+            record_latency (LATENCY_COMMAND, stage_start);
 
 #ifdef HAVE_WINDOW_SYSTEM
 	  /* Do not check display_hourglass_p here, because
@@ -1490,7 +1553,9 @@ command_loop_1 (void)
           }
       kset_last_prefix_arg (current_kboard, Vcurrent_prefix_arg);
 
+      stage_start = current_timespec ();
       safe_run_hooks (Qpost_command_hook);
+      record_latency (LATENCY_POST_COMMAND_HOOK, stage_start);
 
       /* If displaying a message, resize the echo area window to fit
 	 that message's size exactly.  */
@@ -2288,6 +2353,29 @@ read_decoded_event_from_main_queue (struct timespec *end_time,
     }
 }
 
+/* Return the character event C, translated by the current keyboard's
+   keyboard-translate-table.  */
+
+static Lisp_Object
+translate_char_event (Lisp_Object c)
+{
+  Lisp_Object table = KVAR (current_kboard, Vkeyboard_translate_table);
+
+  if ((STRINGP (table)
+       && UNSIGNED_CMP (XFASTINT (c), <, SCHARS (table)))
+      || (VECTORP (table)
+	  && UNSIGNED_CMP (XFASTINT (c), <, ASIZE (table)))
+      || (CHAR_TABLE_P (table) && CHARACTERP (c)))
+    {
+      Lisp_Object d = Faref (table, c);
+      /* nil in keyboard-translate-table means no translation.  */
+      if (!NILP (d))
+	c = d;
+    }
+
+  return c;
+}
+
 /* Read a character from the keyboard; call the redisplay if needed.  */
 /* commandflag 0 means do not autosave, but do redisplay.
    -1 means do not redisplay, but do autosave.
@@ -2332,6 +2420,7 @@ read_char (int commandflag, Lisp_Object map,
   struct kboard *orig_kboard = current_kboard;
 
   also_record = Qnil;
+  read_char_start = invalid_timespec ();
 
   c = Qnil;
   previous_echo_area_message = Qnil;
@@ -2806,6 +2895,9 @@ read_char (int commandflag, Lisp_Object map,
 
       if (EQ (c, make_number (-2)))
 	return c;
+
+      if (!NILP (c))
+	read_char_start = current_timespec ();
   }
 
  non_reread:
@@ -2868,23 +2960,7 @@ read_char (int commandflag, Lisp_Object map,
       if (XINT (c) == -1)
 	goto exit;
 
-      if ((STRINGP (KVAR (current_kboard, Vkeyboard_translate_table))
-	   && UNSIGNED_CMP (XFASTINT (c), <,
-			    SCHARS (KVAR (current_kboard,
-					  Vkeyboard_translate_table))))
-	  || (VECTORP (KVAR (current_kboard, Vkeyboard_translate_table))
-	      && UNSIGNED_CMP (XFASTINT (c), <,
-			       ASIZE (KVAR (current_kboard,
-					    Vkeyboard_translate_table))))
-	  || (CHAR_TABLE_P (KVAR (current_kboard, Vkeyboard_translate_table))
-	      && CHARACTERP (c)))
-	{
-	  Lisp_Object d;
-	  d = Faref (KVAR (current_kboard, Vkeyboard_translate_table), c);
-	  /* nil in keyboard-translate-table means no translation.  */
-	  if (!NILP (d))
-	    c = d;
-	}
+      c = translate_char_event (c);
     }
 
   /* If this event is a mouse click in the menu bar,
@@ -3116,6 +3192,11 @@ read_char (int commandflag, Lisp_Object map,
  exit:
   RESUME_POLLING;
   input_was_pending = input_pending;
+  if (timespec_valid_p (read_char_start))
+    {
+      record_latency (LATENCY_READ_CHAR, read_char_start);
+      read_char_start = invalid_timespec ();
+    }
   return c;
 }
 
@@ -3534,6 +3615,11 @@ kbd_buffer_store_buffered_event (union buffered_input_event *event,
     {
       *kbd_store_ptr = *event;
       ++kbd_store_ptr;
+      if ((event->kind == ASCII_KEYSTROKE_EVENT
+	   || event->kind == MULTIBYTE_CHAR_KEYSTROKE_EVENT
+	   || event->kind == NON_ASCII_KEYSTROKE_EVENT)
+	  && !timespec_valid_p (input_arrival_time))
+	input_arrival_time = current_timespec ();
 #ifdef subprocesses
       if (kbd_buffer_nr_stored () > KBD_BUFFER_SIZE / 2
 	  && ! kbd_on_hold_p ())
@@ -4215,6 +4301,104 @@ process_special_events (void)
     }
 }
 
+/* Return the event at the front of kbd_buffer if it is a keystroke,
+   typed on the frame of the last event, that repeats KEY.  Otherwise
+   return NULL.  */
+
+static union buffered_input_event *
+kbd_buffer_next_repeat (Lisp_Object key)
+{
+  union buffered_input_event *event;
+  struct input_event copy;
+  Lisp_Object obj;
+
+  if (kbd_fetch_ptr == kbd_store_ptr)
+    return NULL;
+  event = ((kbd_fetch_ptr < kbd_buffer + KBD_BUFFER_SIZE)
+	   ? kbd_fetch_ptr
+	   : kbd_buffer);
+
+  if (! ((event->kind == ASCII_KEYSTROKE_EVENT
+	  || event->kind == MULTIBYTE_CHAR_KEYSTROKE_EVENT
+	  || event->kind == NON_ASCII_KEYSTROKE_EVENT)
+	 && EQ (event->ie.frame_or_window, internal_last_event_frame)))
+    return NULL;
+
+  /* make_lispy_event modifies the event it converts.  */
+  copy = event->ie;
+  obj = make_lispy_event (&copy);
+  if (INTEGERP (obj))
+    obj = translate_char_event (obj);
+  return EQ (obj, key) ? event : NULL;
+}
+
+/* Return true if the next keystroke waiting in kbd_buffer repeats
+   KEY, as kbd_buffer_take_repeats would take it.  */
+
+static bool
+kbd_buffer_repeats_p (Lisp_Object key)
+{
+  get_input_pending (0);
+  return kbd_buffer_next_repeat (key) != NULL;
+}
+
+/* Remove from the front of kbd_buffer the keystrokes, typed on the
+   frame of the last event, that repeat KEY, and record them as if
+   read_char had read them as part of the current command's keys.
+   Return how many there were.  */
+
+static EMACS_INT
+kbd_buffer_take_repeats (Lisp_Object key)
+{
+  union buffered_input_event *event;
+  EMACS_INT repeats = 0;
+
+  get_input_pending (0);
+
+  while ((event = kbd_buffer_next_repeat (key)) != NULL)
+    {
+      clear_event (event);
+      kbd_fetch_ptr = event + 1;
+
+      record_char (key);
+      add_command_key (key);
+      num_input_events++;
+      repeats++;
+    }
+
+  get_input_pending (0);
+  return repeats;
+}
+
+/* Record how long it took to display the effects of the keystrokes
+   that arrived since the last call, if there were any and none of
+   them is still waiting to be read.  Redisplay calls this when it has
+   updated all frames.  */
+
+void
+record_input_latency (void)
+{
+  if (timespec_valid_p (input_arrival_time)
+      && kbd_fetch_ptr == kbd_store_ptr)
+    {
+      record_latency (LATENCY_INPUT, input_arrival_time);
+      input_arrival_time = invalid_timespec ();
+    }
+}
+
+/* Record that an instance of STAGE that began at START just ended.  */
+
+void
+record_latency (enum latency_stage stage, struct timespec start)
+{
+  struct latency_ring *ring = &latency_rings[stage];
+
+  ring->samples[ring->index] = timespec_sub (current_timespec (), start);
+  ring->index = (ring->index + 1) % LATENCY_SAMPLES;
+  if (ring->count < LATENCY_SAMPLES)
+    ring->count++;
+}
+
 /* Process any events that are not user-visible, run timer events that
    are ripe, and return, without reading any user-visible events.  */
 
@@ -4273,52 +4457,100 @@ timer_resume_idle (void)
    ...).  Each element has the form (FUN . ARGS).  */
 Lisp_Object pending_funcalls;
 
-/* Return true if TIMER is a valid timer, placing its value into *RESULT.  */
+/* Return true if TIMER is a timer vector with a valid time, placing
+   the time into *RESULT.  Unlike decode_timer, accept timers that have
+   been triggered.  */
 static bool
-decode_timer (Lisp_Object timer, struct timespec *result)
+timer_time (Lisp_Object timer, struct lisp_time *result)
 {
   Lisp_Object *vec;
 
   if (! (VECTORP (timer) && ASIZE (timer) == 9))
-    return 0;
+    return false;
   vec = XVECTOR (timer)->contents;
-  if (! NILP (vec[0]))
-    return 0;
   if (! INTEGERP (vec[2]))
     return false;
+  return decode_time_components (vec[1], vec[2], vec[3], vec[8],
+				 result, 0) > 0;
+}
 
+/* Return true if TIMER is a valid timer, placing its value into *RESULT.  */
+static bool
+decode_timer (Lisp_Object timer, struct timespec *result)
+{
   struct lisp_time t;
-  if (decode_time_components (vec[1], vec[2], vec[3], vec[8], &t, 0) <= 0)
+
+  if (! (VECTORP (timer) && ASIZE (timer) == 9 && NILP (AREF (timer, 0))
+	 && timer_time (timer, &t)))
     return false;
   *result = lisp_to_timespec (t);
   return timespec_valid_p (*result);
 }
 
 
-/* Check whether a timer has fired.  To prevent larger problems we simply
-   disregard elements that are not proper timers.  Do not make a circular
-   timer list for the time being.
+/* Return the timers in TIMERS, a list sorted by time, that are ripe
+   at TIME, in order.  Disregard elements that are not proper timers
+   and timers that have been triggered.  */
 
-   Returns the time to wait until the next timer fires.  If a
-   timer is triggering now, return zero.
-   If no timer is active, return -1.
+static Lisp_Object
+ripe_timers (Lisp_Object timers, struct timespec time)
+{
+  Lisp_Object ripe = Qnil;
 
-   If a timer is ripe, we run it, with quitting turned off.
-   In that case we return 0 to indicate that a new timer_check_2 call
-   should be done.  */
+  for (; CONSP (timers); timers = XCDR (timers))
+    {
+      struct timespec timer_time;
+
+      if (decode_timer (XCAR (timers), &timer_time))
+	{
+	  if (timespec_cmp (time, timer_time) < 0)
+	    break;
+	  ripe = Fcons (XCAR (timers), ripe);
+	}
+    }
+
+  return Fnreverse (ripe);
+}
+
+/* Return the time from NOW until the first timer in TIMERS, a list
+   sorted by time, becomes ripe, zero if it is ripe already, or an
+   invalid value if TIMERS has no timer that has not been triggered.  */
 
 static struct timespec
-timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
+timer_delay (Lisp_Object timers, struct timespec now)
+{
+  for (; CONSP (timers); timers = XCDR (timers))
+    {
+      struct timespec timer_time;
+
+      if (decode_timer (XCAR (timers), &timer_time))
+	return (timespec_cmp (now, timer_time) < 0
+		? timespec_sub (timer_time, now)
+		: make_timespec (0, 0));
+    }
+
+  return invalid_timespec ();
+}
+
+
+/* Run the next ripe timer from *TIMERS or *IDLE_TIMERS, lists of the
+   ordinary and idle timers that were ripe when timer_check looked at
+   them, and remove the timers it has dealt with from the lists.  To
+   prevent larger problems we simply disregard elements that are not
+   proper timers, and timers that are no longer ripe because they
+   were rescheduled or triggered in the meantime.
+
+   If a timer is ripe, we run it, with quitting turned off.  Return
+   true if we did, meaning that a new timer_check_2 call should be
+   done, and false if there is nothing left to run.  */
+
+static bool
+timer_check_2 (Lisp_Object *timers, Lisp_Object *idle_timers)
 {
-  struct timespec nexttime;
   struct timespec now;
   struct timespec idleness_now;
   Lisp_Object chosen_timer;
 
-  nexttime = invalid_timespec ();
-
-  chosen_timer = Qnil;
-
   /* First run the code that was delayed.  */
   while (CONSP (pending_funcalls))
     {
@@ -4327,7 +4559,7 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
       safe_call2 (Qapply, XCAR (funcall), XCDR (funcall));
     }
 
-  if (CONSP (timers) || CONSP (idle_timers))
+  if (CONSP (*timers) || CONSP (*idle_timers))
     {
       now = current_timespec ();
       idleness_now = (timespec_valid_p (timer_idleness_start_time)
@@ -4335,11 +4567,10 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 		      : make_timespec (0, 0));
     }
 
-  while (CONSP (timers) || CONSP (idle_timers))
+  while (CONSP (*timers) || CONSP (*idle_timers))
     {
       Lisp_Object timer = Qnil, idle_timer = Qnil;
       struct timespec timer_time, idle_timer_time;
-      struct timespec difference;
       struct timespec timer_difference = invalid_timespec ();
       struct timespec idle_timer_difference = invalid_timespec ();
       bool ripe, timer_ripe = 0, idle_timer_ripe = 0;
@@ -4349,12 +4580,12 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 	 TIMER_DIFFERENCE is the distance in time from NOW to when
 	 this timer becomes ripe.
          Skip past invalid timers and timers already handled.  */
-      if (CONSP (timers))
+      if (CONSP (*timers))
 	{
-	  timer = XCAR (timers);
+	  timer = XCAR (*timers);
 	  if (! decode_timer (timer, &timer_time))
 	    {
-	      timers = XCDR (timers);
+	      *timers = XCDR (*timers);
 	      continue;
 	    }
 
@@ -4366,12 +4597,12 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 
       /* Likewise for IDLE_TIMER and IDLE_TIMER_DIFFERENCE
 	 based on the next idle timer.  */
-      if (CONSP (idle_timers))
+      if (CONSP (*idle_timers))
 	{
-	  idle_timer = XCAR (idle_timers);
+	  idle_timer = XCAR (*idle_timers);
 	  if (! decode_timer (idle_timer, &idle_timer_time))
 	    {
-	      idle_timers = XCDR (idle_timers);
+	      *idle_timers = XCDR (*idle_timers);
 	      continue;
 	    }
 
@@ -4383,7 +4614,7 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 	}
 
       /* Decide which timer is the next timer,
-	 and set CHOSEN_TIMER, DIFFERENCE, and RIPE accordingly.
+	 and set CHOSEN_TIMER and RIPE accordingly.
 	 Also step down the list where we found that timer.  */
 
       if (timespec_valid_p (timer_difference)
@@ -4398,15 +4629,13 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 		      < 0))))
 	{
 	  chosen_timer = timer;
-	  timers = XCDR (timers);
-	  difference = timer_difference;
+	  *timers = XCDR (*timers);
 	  ripe = timer_ripe;
 	}
       else
 	{
 	  chosen_timer = idle_timer;
-	  idle_timers = XCDR (idle_timers);
-	  difference = idle_timer_difference;
+	  *idle_timers = XCDR (*idle_timers);
 	  ripe = idle_timer_ripe;
 	}
 
@@ -4428,27 +4657,13 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 	      Vdeactivate_mark = old_deactivate_mark;
 	      timers_run++;
 	      unbind_to (count, Qnil);
-
-	      /* Since we have handled the event,
-		 we don't need to tell the caller to wake up and do it.  */
-              /* But the caller must still wait for the next timer, so
-                 return 0 to indicate that.  */
 	    }
 
-	  nexttime = make_timespec (0, 0);
-          break;
-	}
-      else
-	/* When we encounter a timer that is still waiting,
-	   return the amount of time to wait before it is ripe.  */
-	{
-	  return difference;
+	  return true;
 	}
     }
 
-  /* No timers are pending in the future.  */
-  /* Return 0 if we generated an event, and -1 if not.  */
-  return nexttime;
+  return false;
 }
 
 
@@ -4464,35 +4679,85 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 struct timespec
 timer_check (void)
 {
-  struct timespec nexttime;
+  struct timespec nexttime, now, idleness_now = make_timespec (0, 0);
   Lisp_Object timers, idle_timers;
+  bool idle = timespec_valid_p (timer_idleness_start_time);
 
   Lisp_Object tem = Vinhibit_quit;
   Vinhibit_quit = Qt;
 
-  /* We use copies of the timers' lists to allow a timer to add itself
-     again, without locking up Emacs if the newly added timer is
-     already ripe when added.  */
+  /* Take the timers that are ripe now from the timers' lists.
+     Running only those allows a timer to add itself again, without
+     locking up Emacs if the newly added timer is already ripe when
+     added.  The lists are sorted by time, so this looks only at
+     their beginnings.  */
 
+  now = current_timespec ();
   /* Always consider the ordinary timers.  */
-  timers = Fcopy_sequence (Vtimer_list);
+  timers = ripe_timers (Vtimer_list, now);
   /* Consider the idle timers only if Emacs is idle.  */
-  if (timespec_valid_p (timer_idleness_start_time))
-    idle_timers = Fcopy_sequence (Vtimer_idle_list);
+  if (idle)
+    {
+      idleness_now = timespec_sub (now, timer_idleness_start_time);
+      idle_timers = ripe_timers (Vtimer_idle_list, idleness_now);
+    }
   else
     idle_timers = Qnil;
 
   Vinhibit_quit = tem;
 
-  do
+  while (timer_check_2 (&timers, &idle_timers))
+    continue;
+
+  /* Timers that were added or became ripe while the others ran are
+     due now, and run by the next call.  */
+  now = current_timespec ();
+  nexttime = timer_delay (Vtimer_list, now);
+  if (idle && timespec_valid_p (timer_idleness_start_time))
     {
-      nexttime = timer_check_2 (timers, idle_timers);
+      struct timespec idle_delay
+	= timer_delay (Vtimer_idle_list,
+		       timespec_sub (now, timer_idleness_start_time));
+      if (timespec_valid_p (idle_delay)
+	  && (! timespec_valid_p (nexttime)
+	      || timespec_cmp (idle_delay, nexttime) < 0))
+	nexttime = idle_delay;
     }
-  while (nexttime.tv_sec == 0 && nexttime.tv_nsec == 0);
 
   return nexttime;
 }
 
+DEFUN ("timer--insertion-point", Ftimer__insertion_point,
+       Stimer__insertion_point, 2, 2, 0,
+       doc: /* Return the last cons of TIMERS whose timer is earlier than TIMER.
+TIMERS is a list of timers sorted by time, such as `timer-list'.
+Return nil if no timer in TIMERS is earlier than TIMER.  Elements of
+TIMERS that are not valid timers count as earlier than TIMER.
+This is an internal function used by `timer--activate'.  */)
+  (Lisp_Object timer, Lisp_Object timers)
+{
+  struct lisp_time time;
+  Lisp_Object last = Qnil;
+
+  if (! timer_time (timer, &time))
+    error ("Invalid or uninitialized timer");
+
+  for (; CONSP (timers); timers = XCDR (timers))
+    {
+      struct lisp_time t;
+
+      if (timer_time (XCAR (timers), &t)
+	  && ! (t.hi != time.hi ? t.hi < time.hi
+		: t.lo != time.lo ? t.lo < time.lo
+		: t.us != time.us ? t.us < time.us
+		: t.ps < time.ps))
+	break;
+      last = timers;
+    }
+
+  return last;
+}
+
 DEFUN ("current-idle-time", Fcurrent_idle_time, Scurrent_idle_time, 0, 0, 0,
        doc: /* Return the current length of Emacs idleness, or nil.
 The value when Emacs is idle is a list of four integers (HIGH LOW USEC PSEC)
@@ -9932,6 +10197,113 @@ represented as events of the form (nil . COMMAND).  */)
     }
 }
 
+/* Return the stage of handling input that the symbol STAGE names.  */
+
+static enum latency_stage
+decode_latency_stage (Lisp_Object stage)
+{
+  int i;
+
+  for (i = 0; i < LATENCY_STAGES; i++)
+    if (EQ (stage, AREF (latency_stage_names, i)))
+      return i;
+  signal_error ("Invalid latency stage", stage);
+}
+
+DEFUN ("latency-samples", Flatency_samples, Slatency_samples, 1, 1, 0,
+       doc: /* Return the most recent durations of STAGE, in seconds.
+The most recent duration comes first; Emacs remembers the last 256 of
+each stage.  STAGE is one of these symbols:
+
+ `input'             From when Emacs receives a keystroke until
+                     redisplay finishes showing the effects of the
+                     commands it invoked.  When keystrokes arrive faster
+                     than Emacs displays them, this is measured from the
+                     oldest of them.
+ `read-char'         From when `read-char' and similar functions take an
+                     event from the input queue until they return it.
+ `pre-command-hook'  Running `pre-command-hook'.
+ `command'           Executing a command read by the command loop.
+ `post-command-hook' Running `post-command-hook'.
+ `redisplay'         A redisplay, including updating frames.
+ `update-frame'      Updating a frame, including flushing its output.
+ `flush'             Finishing a frame update and sending it to the
+                     display.  */)
+  (Lisp_Object stage)
+{
+  struct latency_ring *ring = &latency_rings[decode_latency_stage (stage)];
+  Lisp_Object samples = Qnil;
+  int i = ring->index + LATENCY_SAMPLES - ring->count;
+  int n;
+
+  for (n = 0; n < ring->count; n++)
+    samples = Fcons (make_float (timespectod (ring->samples
+					      [(i + n) % LATENCY_SAMPLES])),
+		     samples);
+  return samples;
+}
+
+/* The number of buckets of a latency histogram.  The upper bound of
+   bucket I is 2**I milliseconds, except that the last bucket has
+   none.  */
+enum { LATENCY_BUCKETS = 12 };
+
+DEFUN ("latency-histogram", Flatency_histogram, Slatency_histogram, 1, 1, 0,
+       doc: /* Return a histogram of the recent durations of STAGE.
+The value is an alist of elements (LIMIT . COUNT), where COUNT is the
+number of durations, among those `latency-samples' would return, that
+are at most LIMIT seconds and more than the LIMIT of the previous
+element.  The limits are 0.001, 0.002, 0.004 and so on up to 1.024; the
+last element's LIMIT is nil, and its COUNT is the number of durations
+longer than that.  See `latency-samples' for the possible values of
+STAGE.  */)
+  (Lisp_Object stage)
+{
+  struct latency_ring *ring = &latency_rings[decode_latency_stage (stage)];
+  EMACS_INT counts[LATENCY_BUCKETS] = { 0 };
+  Lisp_Object histogram = Qnil;
+  int i = ring->index + LATENCY_SAMPLES - ring->count;
+  int n;
+
+  for (n = 0; n < ring->count; n++)
+    {
+      struct timespec t = ring->samples[(i + n) % LATENCY_SAMPLES];
+      int bucket = 0;
+      intmax_t limit = TIMESPEC_RESOLUTION / 1000;
+
+      while (bucket < LATENCY_BUCKETS - 1
+	     && (t.tv_sec > limit / TIMESPEC_RESOLUTION
+		 || (t.tv_sec == limit / TIMESPEC_RESOLUTION
+		     && t.tv_nsec > limit % TIMESPEC_RESOLUTION)))
+	{
+	  bucket++;
+	  limit *= 2;
+	}
+      counts[bucket]++;
+    }
+
+  histogram = Fcons (Fcons (Qnil, make_number (counts[LATENCY_BUCKETS - 1])),
+		     histogram);
+  for (n = LATENCY_BUCKETS - 2; n >= 0; n--)
+    histogram = Fcons (Fcons (make_float ((1 << n) / 1000.0),
+			      make_number (counts[n])),
+		       histogram);
+  return histogram;
+}
+
+DEFUN ("clear-latencies", Fclear_latencies, Sclear_latencies, 0, 1, 0,
+       doc: /* Forget the recorded durations of STAGE.
+If STAGE is nil, forget those of all stages.  See `latency-samples' for
+the possible values of STAGE.  */)
+  (Lisp_Object stage)
+{
+  if (NILP (stage))
+    memset (latency_rings, 0, sizeof latency_rings);
+  else
+    latency_rings[decode_latency_stage (stage)].count = 0;
+  return Qnil;
+}
+
 DEFUN ("this-command-keys", Fthis_command_keys, Sthis_command_keys, 0, 0, 0,
        doc: /* Return the key sequence that invoked this command.
 However, if the command has called `read-key-sequence', it returns
@@ -10796,6 +11168,8 @@ init_keyboard (void)
   quit_char = Ctl ('g');
   Vunread_command_events = Qnil;
   timer_idleness_start_time = invalid_timespec ();
+  input_arrival_time = invalid_timespec ();
+  read_char_start = invalid_timespec ();
   total_keys = 0;
   recent_keys_index = 0;
   kbd_fetch_ptr = kbd_buffer;
@@ -10929,6 +11303,10 @@ syms_of_keyboard (void)
 
   DEFSYM (Qundefined, "undefined");
 
+  DEFSYM (Qnext_line, "next-line");
+  DEFSYM (Qprevious_line, "previous-line");
+  DEFSYM (Qline_move_coalesce_p, "line-move-coalesce-p");
+
   /* Hooks to run before and after each command.  */
   DEFSYM (Qpre_command_hook, "pre-command-hook");
   DEFSYM (Qpost_command_hook, "post-command-hook");
@@ -11089,6 +11467,20 @@ syms_of_keyboard (void)
     staticpro (&modifier_symbols);
   }
 
+  {
+    static char const *const names[LATENCY_STAGES] =
+      {
+	"input", "read-char", "pre-command-hook", "command",
+	"post-command-hook", "redisplay", "update-frame", "flush"
+      };
+    int i;
+
+    latency_stage_names = make_uninit_vector (LATENCY_STAGES);
+    for (i = 0; i < LATENCY_STAGES; i++)
+      ASET (latency_stage_names, i, intern_c_string (names[i]));
+    staticpro (&latency_stage_names);
+  }
+
   recent_keys = Fmake_vector (make_number (NUM_RECENT_KEYS), Qnil);
   staticpro (&recent_keys);
 
@@ -11131,6 +11523,7 @@ syms_of_keyboard (void)
   staticpro (&help_form_saved_window_configs);
 
   defsubr (&Scurrent_idle_time);
+  defsubr (&Stimer__insertion_point);
   defsubr (&Sevent_symbol_parse_modifiers);
   defsubr (&Sevent_convert_list);
   defsubr (&Sread_key_sequence);
@@ -11139,6 +11532,9 @@ syms_of_keyboard (void)
   defsubr (&Strack_mouse);
   defsubr (&Sinput_pending_p);
   defsubr (&Srecent_keys);
+  defsubr (&Slatency_samples);
+  defsubr (&Slatency_histogram);
+  defsubr (&Sclear_latencies);
   defsubr (&Sthis_command_keys);
   defsubr (&Sthis_command_keys_vector);
   defsubr (&Sthis_single_command_keys);
@@ -11683,6 +12079,23 @@ if the command is in this list, the selection is not updated.  */);
   Vselection_inhibit_update_commands
     = list2 (Qhandle_switch_frame, Qhandle_select_window);
 
+  DEFVAR_LISP ("coalesce-repeated-commands", Vcoalesce_repeated_commands,
+	       doc: /* Alist of commands that may run once for several repetitions of their key.
+When a command in this alist is invoked by a key without a prefix
+argument, and more of the same key are already waiting to be read,
+as happens when an autorepeating key outpaces the command and
+redisplay, Emacs reads them all and runs the command once, with their
+number as the prefix argument.
+
+Each element has the form (COMMAND . PREDICATE).  PREDICATE is called
+with COMMAND as its argument, before the repetitions are read, and
+should return non-nil if COMMAND would do the same with a numeric
+argument N as when invoked N times.  If PREDICATE is nil, COMMAND
+always does.  */);
+  Vcoalesce_repeated_commands
+    = list2 (Fcons (Qnext_line, Qline_move_coalesce_p),
+	     Fcons (Qprevious_line, Qline_move_coalesce_p));
+
   DEFVAR_LISP ("debug-on-event",
                Vdebug_on_event,
                doc: /* Enter debugger on this event.  When Emacs
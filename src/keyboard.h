@@ -415,6 +415,28 @@ extern void unuse_menu_items (void);
 #define EVENT_HEAD_KIND(event_head) \
   (Fget ((event_head), Qevent_kind))
 
+/* The stages of handling input whose durations Emacs records, for
+   latency-samples and latency-histogram.  Stages may nest: redisplay
+   includes updating frames, which includes flushing their output.  */
+
+enum latency_stage
+{
+  /* From the arrival of a keystroke until redisplay showed its
+     effects.  */
+  LATENCY_INPUT,
+  /* From taking an event from the input queue until read_char
+     returns it.  */
+  LATENCY_READ_CHAR,
+  LATENCY_PRE_COMMAND_HOOK,
+  LATENCY_COMMAND,
+  LATENCY_POST_COMMAND_HOOK,
+  LATENCY_REDISPLAY,
+  LATENCY_UPDATE_FRAME,
+  /* Finishing a frame update and sending it to the display.  */
+  LATENCY_FLUSH,
+  LATENCY_STAGES
+};
+
 /* True while doing kbd input.  */
 extern bool waiting_for_input;
 
@@ -449,6 +471,8 @@ extern void push_frame_kboard (struct frame *);
 extern void pop_kboard (void);
 extern void temporarily_switch_to_single_kboard (struct frame *);
 extern void record_asynch_buffer_change (void);
+extern void record_input_latency (void);
+extern void record_latency (enum latency_stage, struct timespec);
 extern void input_poll_signal (int);
 extern void start_polling (void);
 extern void stop_polling (void);
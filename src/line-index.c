@@ -0,0 +1,409 @@
+/* Sampled index of line starts in a buffer.
+
+Copyright (C) 2017 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
+
+
+#include <config.h>
+
+#include <count-one-bits.h>
+
+#include "lisp.h"
+#include "buffer.h"
+#include "line-index.h"
+
+/* Number of lines between two samples recorded by a forward scan.
+   This is also the smallest move for which find_newline consults the
+   index; shorter moves are as cheap to scan directly.  */
+#define LINE_INDEX_STRIDE 1024
+
+/* When a change spans more than this many bytes, the samples after it
+   are dropped rather than kept by counting the newlines it held.  */
+#define LINE_INDEX_MAX_RECOUNT (1024 * 1024)
+
+
+/* Data structures.  */
+
+struct line_sample
+{
+  /* The number of newlines between the beginning of the buffer and
+     this position.  */
+  ptrdiff_t line;
+
+  ptrdiff_t charpos, bytepos;
+};
+
+struct line_index
+{
+  /* The samples, sorted by position.  Each one is at the beginning of
+     a line.  */
+  struct line_sample *samples;
+  ptrdiff_t nsamples, size;
+
+  /* All the text before FRONTIER has been scanned.  Unlike the
+     samples, FRONTIER need not be at the beginning of a line.  */
+  struct line_sample frontier;
+
+  /* True if the text changed since the samples were last brought up
+     to date.  The changes are confined to the text between the first
+     HEAD and the last TAIL characters of the buffer, which held
+     OLD_LINES newlines before the changes, when the buffer ended at
+     OLD_Z and OLD_Z_BYTE.  A TAIL of zero means that the samples
+     after the changes will be dropped, and OLD_LINES is not kept.  */
+  bool pending;
+  ptrdiff_t head, tail;
+  ptrdiff_t old_lines;
+  ptrdiff_t old_z, old_z_byte;
+};
+
+/* The position every line index implicitly starts with.  */
+static const struct line_sample line_index_origin = { 0, BEG, BEG_BYTE };
+
+struct line_index *
+new_line_index (void)
+{
+  struct line_index *li = xzalloc (sizeof *li);
+
+  li->frontier = line_index_origin;
+  return li;
+}
+
+void
+free_line_index (struct line_index *li)
+{
+  xfree (li->samples);
+  xfree (li);
+}
+
+
+/* Counting newlines.  */
+
+/* Newlines are counted a word at a time.  The bytes are loaded with
+   memcpy, so the text needs no particular alignment.  */
+typedef unsigned long int nl_word;
+#define NL_WORD_ONES ((nl_word) -1 / UCHAR_MAX)
+#define NL_WORD_LOW_BITS (NL_WORD_ONES * 0x7f)
+
+/* Return the number of newlines in the word W.  */
+
+static int
+word_newlines (nl_word w)
+{
+  nl_word x = w ^ (NL_WORD_ONES * '\n');
+
+  /* The high bit of each byte of Y is set iff that byte of X is
+     nonzero, i.e. iff that byte of W is not a newline.  */
+  nl_word y = ((x & NL_WORD_LOW_BITS) + NL_WORD_LOW_BITS) | x;
+  return count_one_bits_l (~(y | NL_WORD_LOW_BITS));
+}
+
+/* Scan the NBYTES bytes at P for newlines.  If there are at least
+   *NEED of them, return the offset just after the *NEED'th one and
+   set *NEED to zero.  Otherwise subtract the number of newlines from
+   *NEED and return NBYTES.  */
+
+static ptrdiff_t
+scan_newlines (const unsigned char *p, ptrdiff_t nbytes, ptrdiff_t *need)
+{
+  ptrdiff_t i = 0, n = *need;
+  nl_word w;
+
+  for (; nbytes - i >= sizeof w; i += sizeof w)
+    {
+      int c;
+
+      memcpy (&w, p + i, sizeof w);
+      c = word_newlines (w);
+      if (c >= n)
+	break;
+      n -= c;
+    }
+  for (; i < nbytes; i++)
+    if (p[i] == '\n' && --n == 0)
+      {
+	*need = 0;
+	return i + 1;
+      }
+  *need = n;
+  return nbytes;
+}
+
+/* Like scan_newlines, for the text of BUF between FROM_BYTE and
+   TO_BYTE, which may straddle the gap.  Return a byte position.  */
+
+static ptrdiff_t
+buf_scan_newlines (struct buffer *buf, ptrdiff_t from_byte,
+		   ptrdiff_t to_byte, ptrdiff_t *need)
+{
+  if (from_byte < BUF_GPT_BYTE (buf))
+    {
+      ptrdiff_t stop = min (to_byte, BUF_GPT_BYTE (buf));
+
+      from_byte += scan_newlines (BUF_BYTE_ADDRESS (buf, from_byte),
+				  stop - from_byte, need);
+      if (*need == 0 || from_byte == to_byte)
+	return from_byte;
+    }
+  return from_byte + scan_newlines (BUF_BYTE_ADDRESS (buf, from_byte),
+				    to_byte - from_byte, need);
+}
+
+/* Return the number of newlines in BUF between FROM_BYTE and
+   TO_BYTE.  */
+
+static ptrdiff_t
+count_newlines (struct buffer *buf, ptrdiff_t from_byte, ptrdiff_t to_byte)
+{
+  ptrdiff_t need = PTRDIFF_MAX;
+
+  buf_scan_newlines (buf, from_byte, to_byte, &need);
+  return PTRDIFF_MAX - need;
+}
+
+
+/* Maintaining the samples.  */
+
+static void
+add_sample (struct line_index *li, struct line_sample s)
+{
+  if (li->nsamples == li->size)
+    li->samples = xpalloc (li->samples, &li->size, 1, -1,
+			   sizeof *li->samples);
+  li->samples[li->nsamples++] = s;
+}
+
+/* Return the index of the last sample of LI at or before CHARPOS, or
+   -1 if there is none.  */
+
+static ptrdiff_t
+sample_at_or_before (struct line_index *li, ptrdiff_t charpos)
+{
+  ptrdiff_t lo = 0, hi = li->nsamples;
+
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+
+      if (li->samples[mid].charpos <= charpos)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo - 1;
+}
+
+/* Return the index of the last sample of LI on line LINE or before
+   it, or -1 if there is none.  */
+
+static ptrdiff_t
+sample_at_or_before_line (struct line_index *li, ptrdiff_t line)
+{
+  ptrdiff_t lo = 0, hi = li->nsamples;
+
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+
+      if (li->samples[mid].line <= line)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo - 1;
+}
+
+void
+invalidate_line_index (struct buffer *buf, struct line_index *li,
+		       ptrdiff_t start, ptrdiff_t end)
+{
+  ptrdiff_t head, tail, nbytes;
+  ptrdiff_t left_from, left_to, right_from, right_to;
+
+  if (!li->pending)
+    {
+      /* If nothing after START was scanned yet, nothing is lost.  */
+      if (li->frontier.charpos <= start)
+	return;
+
+      /* Start with an empty changed region at START.  */
+      li->pending = true;
+      li->head = start - BUF_BEG (buf);
+      li->tail = BUF_Z (buf) - start;
+      li->old_lines = 0;
+      li->old_z = BUF_Z (buf);
+      li->old_z_byte = BUF_Z_BYTE (buf);
+    }
+
+  head = min (li->head, start - BUF_BEG (buf));
+  tail = min (li->tail, BUF_Z (buf) - end);
+  if (li->tail == 0)
+    {
+      li->head = head;
+      return;
+    }
+
+  /* The text about to be added to the changed region has not changed
+     yet, so count the newlines it holds now.  */
+  left_from = BUF_BEG (buf) + head;
+  left_to = BUF_BEG (buf) + li->head;
+  right_from = BUF_Z (buf) - li->tail;
+  right_to = BUF_Z (buf) - tail;
+  nbytes = 0;
+  if (left_from < left_to)
+    {
+      left_from = buf_charpos_to_bytepos (buf, left_from);
+      left_to = buf_charpos_to_bytepos (buf, left_to);
+      nbytes += left_to - left_from;
+    }
+  if (right_from < right_to)
+    {
+      right_from = buf_charpos_to_bytepos (buf, right_from);
+      right_to = buf_charpos_to_bytepos (buf, right_to);
+      nbytes += right_to - right_from;
+    }
+
+  if (nbytes > LINE_INDEX_MAX_RECOUNT)
+    tail = 0;
+  else
+    {
+      if (left_from < left_to)
+	li->old_lines += count_newlines (buf, left_from, left_to);
+      if (right_from < right_to)
+	li->old_lines += count_newlines (buf, right_from, right_to);
+    }
+  li->head = head;
+  li->tail = tail;
+}
+
+/* Bring the samples of LI up to date with the changes to BUF's text
+   recorded by invalidate_line_index.  */
+
+static void
+revalidate_line_index (struct buffer *buf, struct line_index *li)
+{
+  ptrdiff_t head_end, old_tail_start, i, j;
+  ptrdiff_t dlines = 0;
+  ptrdiff_t dchars = BUF_Z (buf) - li->old_z;
+  ptrdiff_t dbytes = BUF_Z_BYTE (buf) - li->old_z_byte;
+  bool keep_tail;
+
+  if (!li->pending)
+    return;
+  li->pending = false;
+
+  /* Samples up to HEAD_END and after OLD_TAIL_START are preceded by
+     an unchanged newline, so they are still at line starts.  */
+  head_end = BUF_BEG (buf) + li->head;
+  old_tail_start = li->old_z - li->tail;
+  keep_tail = li->tail > 0 && li->frontier.charpos > old_tail_start;
+  if (keep_tail)
+    dlines = (count_newlines (buf, buf_charpos_to_bytepos (buf, head_end),
+			      buf_charpos_to_bytepos (buf, (BUF_Z (buf)
+							    - li->tail)))
+	      - li->old_lines);
+
+  for (i = j = 0; i < li->nsamples; i++)
+    {
+      struct line_sample s = li->samples[i];
+
+      if (s.charpos <= head_end)
+	li->samples[j++] = s;
+      else if (keep_tail && s.charpos > old_tail_start)
+	{
+	  s.line += dlines;
+	  s.charpos += dchars;
+	  s.bytepos += dbytes;
+	  li->samples[j++] = s;
+	}
+    }
+  li->nsamples = j;
+
+  if (keep_tail)
+    {
+      li->frontier.line += dlines;
+      li->frontier.charpos += dchars;
+      li->frontier.bytepos += dbytes;
+    }
+  else if (li->frontier.charpos > head_end)
+    li->frontier = j > 0 ? li->samples[j - 1] : line_index_origin;
+}
+
+/* Scan BUF's text from the frontier of LI on, recording a sample
+   every LINE_INDEX_STRIDE lines, until the frontier reaches line LINE
+   or position LIMIT (LIMIT_BYTE).  */
+
+static void
+extend_line_index (struct buffer *buf, struct line_index *li,
+		   ptrdiff_t line, ptrdiff_t limit, ptrdiff_t limit_byte)
+{
+  while (li->frontier.line < line && li->frontier.bytepos < limit_byte)
+    {
+      ptrdiff_t last = (li->nsamples > 0
+			? li->samples[li->nsamples - 1].line : 0);
+      ptrdiff_t next = max (last + LINE_INDEX_STRIDE, li->frontier.line + 1);
+      ptrdiff_t need = next - li->frontier.line;
+      ptrdiff_t bytepos = buf_scan_newlines (buf, li->frontier.bytepos,
+					     limit_byte, &need);
+
+      li->frontier.line = next - need;
+      li->frontier.bytepos = bytepos;
+      li->frontier.charpos = (bytepos == limit_byte ? limit
+			      : buf_bytepos_to_charpos (buf, bytepos));
+      if (need == 0)
+	add_sample (li, li->frontier);
+    }
+}
+
+void
+line_index_forward (struct buffer *buf, struct line_index *li,
+		    ptrdiff_t *start, ptrdiff_t *start_byte,
+		    ptrdiff_t end, ptrdiff_t end_byte, ptrdiff_t *count)
+{
+  struct line_sample base;
+  ptrdiff_t i, start_line, target;
+
+  if (*count < LINE_INDEX_STRIDE)
+    return;
+  revalidate_line_index (buf, li);
+
+  /* Find the line number of START, counting from the nearest known
+     position before it.  */
+  if (li->frontier.charpos < *start)
+    extend_line_index (buf, li, PTRDIFF_MAX, *start, *start_byte);
+  if (li->frontier.charpos <= *start)
+    base = li->frontier;
+  else
+    {
+      i = sample_at_or_before (li, *start);
+      base = i < 0 ? line_index_origin : li->samples[i];
+    }
+  start_line = base.line + count_newlines (buf, base.bytepos, *start_byte);
+  target = (*count <= PTRDIFF_MAX - start_line
+	    ? start_line + *count : PTRDIFF_MAX);
+
+  /* Jump to the last sample that is neither past the target line nor
+     past END.  */
+  extend_line_index (buf, li, target, end, end_byte);
+  i = min (sample_at_or_before_line (li, target),
+	   sample_at_or_before (li, end));
+  if (i >= 0 && li->samples[i].charpos > *start)
+    {
+      *count -= li->samples[i].line - start_line;
+      *start = li->samples[i].charpos;
+      *start_byte = li->samples[i].bytepos;
+    }
+}
@@ -0,0 +1,65 @@
+/* Header file: Sampled index of line starts in a buffer.
+
+Copyright (C) 2017 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#ifndef EMACS_LINE_INDEX_H
+#define EMACS_LINE_INDEX_H
+
+/* The newline cache (see region-cache.h) lets find_newline skip long
+   stretches of text known to have no newlines, but moving forward by
+   N lines still costs O(N), which makes `goto-line' or
+   `line-number-at-pos' slow near the end of a buffer with millions
+   of lines.
+
+   The line index remembers the position of every few thousandth line
+   start, together with its line number, so that find_newline can
+   jump straight to the sampled line nearest to its target and scan
+   only from there.  Samples are recorded lazily, as find_newline
+   needs them.
+
+   Like the region caches, the index is invalidated by
+   invalidate_buffer_caches before each change to the buffer text.
+   Samples before the change stay valid; samples after it are kept
+   and shifted, by counting the newlines the change removed and
+   added, the next time the index is used.  */
+
+struct buffer;
+
+/* Allocate, initialize and return a new, empty line index.  */
+extern struct line_index *new_line_index (void);
+
+/* Free a line index.  */
+extern void free_line_index (struct line_index *);
+
+/* Indicate that the text of BUF between START and END (absolute
+   buffer positions, before the change) is about to change.  */
+extern void invalidate_line_index (struct buffer *BUF,
+				   struct line_index *INDEX,
+				   ptrdiff_t START, ptrdiff_t END);
+
+/* Advance *START (and *START_BYTE) toward the *COUNT'th newline after
+   it, not moving beyond END (END_BYTE), using INDEX for BUF's text.
+   *START is only moved to the beginning of a line, and *COUNT is
+   decreased by the number of newlines skipped.  BUF must be the
+   current buffer or its base buffer.  */
+extern void line_index_forward (struct buffer *BUF, struct line_index *INDEX,
+				ptrdiff_t *START, ptrdiff_t *START_BYTE,
+				ptrdiff_t END, ptrdiff_t END_BYTE,
+				ptrdiff_t *COUNT);
+
+#endif /* EMACS_LINE_INDEX_H */
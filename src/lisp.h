@@ -3429,6 +3429,14 @@ extern void syms_of_charset (void);
 struct charset;
 
 /* Defined in syntax.c.  */
+struct parse_state_cache;
+extern void free_parse_state_cache (struct parse_state_cache *);
+extern void mark_parse_state_cache (struct parse_state_cache *);
+extern void invalidate_parse_state_cache (struct buffer *, ptrdiff_t, bool);
+struct syntax_runs;
+extern void free_syntax_runs (struct syntax_runs *);
+extern void mark_syntax_runs (struct syntax_runs *);
+extern void invalidate_syntax_runs (struct buffer *, ptrdiff_t);
 extern void init_syntax_once (void);
 extern void syms_of_syntax (void);
 
@@ -3497,6 +3505,8 @@ extern void insert_and_inherit (const char *, ptrdiff_t);
 extern void insert_1_both (const char *, ptrdiff_t, ptrdiff_t,
 			   bool, bool, bool);
 extern void insert_from_gap (ptrdiff_t, ptrdiff_t, bool text_at_gap_tail);
+extern void advance_markers_at_insertion (ptrdiff_t, ptrdiff_t,
+					  ptrdiff_t, ptrdiff_t);
 extern void insert_from_string (Lisp_Object, ptrdiff_t, ptrdiff_t,
 				ptrdiff_t, ptrdiff_t, bool);
 extern void insert_from_buffer (struct buffer *, ptrdiff_t, ptrdiff_t, bool);
@@ -3999,6 +4009,7 @@ extern Lisp_Object make_temp_name (Lisp_Object, bool);
 
 /* Defined in search.c.  */
 extern void shrink_regexp_cache (void);
+extern void mark_regexp_cache (void);
 extern void restore_search_regs (void);
 extern void update_search_regs (ptrdiff_t oldstart,
                                 ptrdiff_t oldend, ptrdiff_t newend);
@@ -4183,6 +4194,7 @@ extern void setup_process_coding_systems (Lisp_Object);
  _Noreturn
 #endif
 extern int child_setup (int, int, int, char **, bool, Lisp_Object);
+extern Lisp_Object signal_description (int);
 extern void init_callproc_1 (void);
 extern void init_callproc (void);
 extern void set_initial_environment (void);
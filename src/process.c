@@ -89,6 +89,7 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #endif
 
 #include <c-ctype.h>
+#include <ignore-value.h>
 #include <sig2str.h>
 #include <verify.h>
 
@@ -101,6 +102,7 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "character.h"
 #include "buffer.h"
 #include "coding.h"
+#include "composite.h"
 #include "process.h"
 #include "frame.h"
 #include "termopts.h"
@@ -125,6 +127,14 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #endif
 #endif
 
+/* Wait with epoll rather than pselect where the kernel supports it
+   and no toolkit insists on doing the waiting itself.  */
+#if (defined HAVE_SYS_EPOLL_H && defined HAVE_EPOLL_CREATE1 \
+     && !defined HAVE_NS && !defined HAVE_GLIB)
+# define USE_EPOLL
+# include <sys/epoll.h>
+#endif
+
 #ifdef WINDOWSNT
 extern int sys_select (int, fd_set *, fd_set *, fd_set *,
 		       struct timespec *, void *);
@@ -236,6 +246,11 @@ static EMACS_INT update_tick;
 #define READ_OUTPUT_DELAY_MAX       (READ_OUTPUT_DELAY_INCREMENT * 5)
 #define READ_OUTPUT_DELAY_MAX_MAX   (READ_OUTPUT_DELAY_INCREMENT * 7)
 
+/* Number of bytes read_process_output first asks for from a process.
+   The size then grows while the process fills it, up to the process's
+   read_output_max, and shrinks again when its output slows down.  */
+enum { READ_OUTPUT_SIZE_MIN = 4096 };
+
 /* Number of processes which have a non-zero read_output_delay,
    and therefore might be delayed for adaptive read buffering.  */
 
@@ -246,6 +261,10 @@ static int process_output_delay_count;
 static bool process_output_skip;
 
 static void create_process (Lisp_Object, char **, Lisp_Object);
+static void send_queue_unwatch (struct Lisp_Process *);
+static void send_queue_clear (struct Lisp_Process *);
+static void send_queues_flush_ready (fd_set *);
+static void run_send_callbacks (void);
 #ifdef USABLE_SIGIO
 static bool keyboard_bit_set (fd_set *);
 #endif
@@ -285,6 +304,59 @@ static fd_set connect_wait_mask;
 static int num_pending_connects;
 #endif	/* NON_BLOCKING_CONNECT */
 
+/* Mask of output descriptors of processes that have data queued for
+   them, waiting for the descriptor to become writable.  These are
+   also in write_mask.  */
+static fd_set send_wait_mask;
+
+/* Number of bits set in send_wait_mask.  */
+static int num_pending_sends;
+
+/* True if some process may have send callbacks that are due to be
+   called.  */
+static bool send_callbacks_due;
+
+/* If non-null, the process whose send queue send_process is waiting
+   to drain.  wait_reading_process_output takes it on entry, and
+   returns once the queue is empty.  */
+static struct Lisp_Process *send_drain_process;
+
+/* The ends of a pipe that handle_child_signal writes a byte to, so
+   that a wait that began just after the last check for changes in
+   process status still wakes up when SIGCHLD arrives.  */
+static int child_signal_read_fd = -1;
+static int child_signal_write_fd = -1;
+
+/* True if wait_reading_process_output should return once it has
+   reported a change in the status of some process.  It takes the
+   value on entry, like send_drain_process.  */
+static bool wait_for_status_change;
+
+#ifdef USE_EPOLL
+/* The epoll instance that process_select waits on, or -1 if none has
+   been created yet.  Descriptors stay registered with it between
+   waits, so a wait costs time proportional to the descriptors whose
+   registration changed and those that are ready, not to the largest
+   descriptor waited for, as with pselect.  */
+static int epoll_fd = -1;
+
+/* The descriptors currently registered with epoll_fd for reading and
+   for writing.  */
+static fd_set epoll_read_set, epoll_write_set;
+
+/* Descriptors in the sets above that epoll cannot watch, such as
+   regular files.  Like pselect, treat them as always ready.  */
+static fd_set epoll_always_ready;
+static int num_epoll_always_ready;
+
+/* One more than the largest descriptor in any of the sets above.  */
+static int epoll_nfds;
+
+/* The most events taken from the kernel in one wait.  Any more stay
+   ready and are returned by the next wait.  */
+enum { EPOLL_MAX_EVENTS = 64 };
+#endif
+
 /* The largest descriptor currently in use for a process object; -1 if none.  */
 static int max_process_desc;
 
@@ -388,6 +460,11 @@ pset_plist (struct Lisp_Process *p, Lisp_Object val)
   p->plist = val;
 }
 static void
+pset_send_callbacks (struct Lisp_Process *p, Lisp_Object val)
+{
+  p->send_callbacks = val;
+}
+static void
 pset_sentinel (struct Lisp_Process *p, Lisp_Object val)
 {
   p->sentinel = NILP (val) ? Qinternal_default_process_sentinel : val;
@@ -408,11 +485,6 @@ pset_type (struct Lisp_Process *p, Lisp_Object val)
   p->type = val;
 }
 static void
-pset_write_queue (struct Lisp_Process *p, Lisp_Object val)
-{
-  p->write_queue = val;
-}
-static void
 pset_stderrproc (struct Lisp_Process *p, Lisp_Object val)
 {
   p->stderrproc = val;
@@ -435,6 +507,189 @@ static struct fd_callback_data
 } fd_callback_info[FD_SETSIZE];
 
 
+#ifdef USE_EPOLL
+
+/* Make the registration of descriptor FD with epoll_fd ask for
+   reading if READ, and for writing if WRITE.  Return 0 if successful,
+   -1 (setting errno) if not.  */
+
+static int
+epoll_register (int fd, bool read, bool write)
+{
+  bool was_registered = (FD_ISSET (fd, &epoll_read_set)
+			 || FD_ISSET (fd, &epoll_write_set));
+
+  if (FD_ISSET (fd, &epoll_always_ready))
+    {
+      if (! (read || write))
+	{
+	  FD_CLR (fd, &epoll_always_ready);
+	  num_epoll_always_ready--;
+	}
+    }
+  else
+    {
+      struct epoll_event event;
+      int op = (! (read || write) ? EPOLL_CTL_DEL
+		: was_registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD);
+      event.events = (read ? EPOLLIN : 0) | (write ? EPOLLOUT : 0);
+      event.data.fd = fd;
+      if (epoll_ctl (epoll_fd, op, fd, &event) != 0)
+	{
+	  if (op == EPOLL_CTL_ADD && errno == EEXIST)
+	    op = EPOLL_CTL_MOD;
+	  else if (op == EPOLL_CTL_MOD && errno == ENOENT)
+	    op = EPOLL_CTL_ADD;
+	  else
+	    op = -1;
+	  if (op < 0 || epoll_ctl (epoll_fd, op, fd, &event) != 0)
+	    {
+	      if (errno != EPERM)
+		return -1;
+	      FD_SET (fd, &epoll_always_ready);
+	      num_epoll_always_ready++;
+	    }
+	}
+    }
+
+  if (read)
+    FD_SET (fd, &epoll_read_set);
+  else
+    FD_CLR (fd, &epoll_read_set);
+  if (write)
+    FD_SET (fd, &epoll_write_set);
+  else
+    FD_CLR (fd, &epoll_write_set);
+  return 0;
+}
+
+/* Like pselect with no exception set and no signal mask, but wait on
+   epoll_fd.  */
+
+static int
+epoll_select (int nfds, fd_set *rfds, fd_set *wfds,
+	      struct timespec const *timeout)
+{
+  fd_set no_fds;
+  struct epoll_event events[EPOLL_MAX_EVENTS];
+  int fd, i, nevents, ms, count = 0;
+
+  if (!wfds)
+    {
+      FD_ZERO (&no_fds);
+      wfds = &no_fds;
+    }
+
+  /* Bring the registered sets up to date.  Usually nothing has
+     changed since the previous wait.  */
+  if (memcmp (rfds, &epoll_read_set, sizeof *rfds) != 0
+      || memcmp (wfds, &epoll_write_set, sizeof *wfds) != 0)
+    {
+      int n = max (nfds, epoll_nfds);
+      for (fd = 0; fd < n; fd++)
+	{
+	  bool read = fd < nfds && FD_ISSET (fd, rfds);
+	  bool write = fd < nfds && FD_ISSET (fd, wfds);
+
+	  if (read != FD_ISSET (fd, &epoll_read_set)
+	      || write != FD_ISSET (fd, &epoll_write_set))
+	    {
+	      if (epoll_register (fd, read, write) != 0)
+		return -1;
+	    }
+	}
+      epoll_nfds = nfds;
+    }
+
+  if (num_epoll_always_ready > 0 || !timeout)
+    ms = num_epoll_always_ready > 0 ? 0 : -1;
+  else if (timeout->tv_sec >= INT_MAX / 1000 - 1)
+    ms = INT_MAX;
+  else
+    /* Round up, so that a timer due in less than a millisecond is
+       not waited for by spinning.  */
+    ms = (timeout->tv_sec * 1000
+	  + (timeout->tv_nsec + 999999) / 1000000);
+
+  nevents = epoll_wait (epoll_fd, events, EPOLL_MAX_EVENTS, ms);
+  if (nevents < 0)
+    return -1;
+
+  FD_ZERO (rfds);
+  FD_ZERO (wfds);
+  for (i = 0; i < nevents; i++)
+    {
+      fd = events[i].data.fd;
+      if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)
+	  && FD_ISSET (fd, &epoll_read_set))
+	{
+	  FD_SET (fd, rfds);
+	  count++;
+	}
+      if (events[i].events & (EPOLLOUT | EPOLLERR)
+	  && FD_ISSET (fd, &epoll_write_set))
+	{
+	  FD_SET (fd, wfds);
+	  count++;
+	}
+    }
+  if (num_epoll_always_ready > 0)
+    for (fd = 0; fd < nfds; fd++)
+      if (FD_ISSET (fd, &epoll_always_ready))
+	{
+	  if (FD_ISSET (fd, &epoll_read_set))
+	    {
+	      FD_SET (fd, rfds);
+	      count++;
+	    }
+	  if (FD_ISSET (fd, &epoll_write_set))
+	    {
+	      FD_SET (fd, wfds);
+	      count++;
+	    }
+	}
+  return count;
+}
+
+#endif /* USE_EPOLL */
+
+/* Note that FD is no longer waited for.  This must be called before
+   FD is closed: epoll drops a registration by itself only when no
+   descriptor, in this process or in a child, refers to the open file
+   any more, and the registration cannot be removed once FD is gone.  */
+
+static void
+forget_wait_descriptor (int fd)
+{
+#ifdef USE_EPOLL
+  if (0 <= epoll_fd
+      && (FD_ISSET (fd, &epoll_read_set) || FD_ISSET (fd, &epoll_write_set))
+      && epoll_register (fd, false, false) != 0)
+    {
+      /* FD was closed already, or never registered.  */
+      FD_CLR (fd, &epoll_read_set);
+      FD_CLR (fd, &epoll_write_set);
+    }
+#endif
+}
+
+/* Wait as pselect does, with no exception set and no signal mask, for
+   one of the descriptors below NFDS in RFDS to become readable or one
+   in WFDS to become writable.  */
+
+static int
+process_select (int nfds, fd_set *rfds, fd_set *wfds,
+		struct timespec const *timeout)
+{
+#ifdef USE_EPOLL
+  if (epoll_fd < 0)
+    epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+  if (epoll_fd >= 0)
+    return epoll_select (nfds, rfds, wfds, timeout);
+#endif
+  return pselect (nfds, rfds, wfds, NULL, timeout, NULL);
+}
+
 /* Add a file descriptor FD to be monitored for when read is possible.
    When read is possible, call FUNC with argument DATA.  */
 
@@ -500,6 +755,7 @@ void
 delete_write_fd (int fd)
 {
   FD_CLR (fd, &write_mask);
+  forget_wait_descriptor (fd);
   fd_callback_info[fd].condition &= ~FOR_WRITE;
   if (fd_callback_info[fd].condition == 0)
     {
@@ -725,6 +981,10 @@ make_process (Lisp_Object name)
   p->gnutls_initstage = GNUTLS_STAGE_EMPTY;
 #endif
 
+  p->read_output_max = clip_to_bounds (1, read_process_output_max,
+				       INT_MAX / 2);
+  p->read_output_size = min (READ_OUTPUT_SIZE_MIN, p->read_output_max);
+
   /* If name is already in use, modify it until it is unused.  */
 
   name1 = name;
@@ -4121,6 +4381,14 @@ deactivate_process (Lisp_Object proc)
       p->read_output_skip = 0;
     }
 
+  /* Data not yet written can no longer be.  */
+  send_queue_unwatch (p);
+  send_queue_clear (p);
+  pset_send_callbacks (p, Qnil);
+
+  if (p->infd >= 0)
+    forget_wait_descriptor (p->infd);
+
   /* Beware SIGCHLD hereabouts.  */
 
   for (i = 0; i < PROCESS_OPEN_FDS; i++)
@@ -4244,6 +4512,211 @@ is nil, from any process) before the timeout expired.  */)
      ? Qnil : Qt);
 }
 
+/* The jobs of call-process-batch are vectors with these slots.  */
+enum
+  {
+    BATCH_JOB_INDEX,		/* Position of the command in the batch.  */
+    BATCH_JOB_OUTPUT,		/* Buffer for standard output.  */
+    BATCH_JOB_ERROR_OUTPUT,	/* Buffer for standard error.  */
+    BATCH_JOB_PROCESS,		/* The process, or nil.  */
+    BATCH_JOB_STDERR,		/* Pipe process reading standard error.  */
+    BATCH_JOB_SIZE
+  };
+
+/* Kill the processes and buffers of the jobs in the vector JOBS.  */
+
+static void
+call_process_batch_unwind (Lisp_Object jobs)
+{
+  for (ptrdiff_t i = 0; i < ASIZE (jobs); i++)
+    {
+      Lisp_Object job = AREF (jobs, i);
+      if (NILP (job))
+	continue;
+      if (PROCESSP (AREF (job, BATCH_JOB_PROCESS)))
+	Fdelete_process (AREF (job, BATCH_JOB_PROCESS));
+      if (PROCESSP (AREF (job, BATCH_JOB_STDERR)))
+	Fdelete_process (AREF (job, BATCH_JOB_STDERR));
+      Fkill_buffer (AREF (job, BATCH_JOB_OUTPUT));
+      Fkill_buffer (AREF (job, BATCH_JOB_ERROR_OUTPUT));
+      ASET (jobs, i, Qnil);
+    }
+}
+
+/* Return true if PROC has terminated and its sentinel has been run,
+   so that all of its output has been read.  */
+
+static bool
+process_reaped_p (Lisp_Object proc)
+{
+  struct Lisp_Process *p = XPROCESS (proc);
+  Lisp_Object symbol = CONSP (p->status) ? XCAR (p->status) : p->status;
+  return (p->tick == p->update_tick
+	  && (EQ (symbol, Qexit) || EQ (symbol, Qsignal)));
+}
+
+/* Return the text of BUFFER as a string without properties.  */
+
+static Lisp_Object
+buffer_text (Lisp_Object buffer)
+{
+  ptrdiff_t count = SPECPDL_INDEX ();
+  record_unwind_current_buffer ();
+  set_buffer_internal (XBUFFER (buffer));
+  return unbind_to (count, make_buffer_string (BEG, Z, false));
+}
+
+/* Return the result of the finished job JOB of call-process-batch.  */
+
+static Lisp_Object
+batch_job_result (Lisp_Object job)
+{
+  Lisp_Object symbol, status;
+  int code;
+  bool coredump;
+
+  decode_status (XPROCESS (AREF (job, BATCH_JOB_PROCESS))->status,
+		 &symbol, &code, &coredump);
+  status = (EQ (symbol, Qsignal)
+	    ? signal_description (code) : make_number (code));
+
+  return list3 (status, buffer_text (AREF (job, BATCH_JOB_OUTPUT)),
+		buffer_text (AREF (job, BATCH_JOB_ERROR_OUTPUT)));
+}
+
+DEFUN ("call-process-batch", Fcall_process_batch, Scall_process_batch,
+       1, 2, 0,
+       doc: /* Run COMMANDS in parallel subprocesses and wait for all of them.
+COMMANDS is a list of commands, each of the form (PROGRAM ARGS...),
+where PROGRAM is searched for in `exec-path' and ARGS are strings to
+give it as arguments.  They run in `default-directory' with no input,
+and their output is decoded as for `make-process'.
+
+At most MAX-PROCESSES commands run at the same time; nil means the
+value of `num-processors'.  The others are started, in order, as
+running ones finish.
+
+Value is a list with one element for each command, in the order of
+COMMANDS, of the form (STATUS OUTPUT ERROR-OUTPUT).  STATUS is the
+exit status of the command, or a string describing the signal that
+killed it, as for `call-process'.  OUTPUT and ERROR-OUTPUT are strings
+holding what the command wrote to its standard output and standard
+error.
+
+If a program cannot be started, or if you quit, the commands that are
+still running are killed.  */)
+  (Lisp_Object commands, Lisp_Object max_processes)
+{
+  EMACS_INT ncommands, limit;
+  ptrdiff_t count = SPECPDL_INDEX ();
+  Lisp_Object results, jobs;
+  EMACS_INT index = 0;
+  ptrdiff_t i, running = 0;
+
+  ncommands = XFASTINT (Flength (commands));
+  if (NILP (max_processes))
+    limit = XFASTINT (Fnum_processors ());
+  else
+    {
+      CHECK_NATNUM (max_processes);
+      limit = max (XFASTINT (max_processes), 1);
+    }
+  limit = min (limit, max (ncommands, 1));
+
+  results = Fmake_vector (make_number (ncommands), Qnil);
+  jobs = Fmake_vector (make_number (limit), Qnil);
+  record_unwind_protect (call_process_batch_unwind, jobs);
+
+  while (true)
+    {
+      bool reaped = false;
+
+      for (i = 0; i < limit; i++)
+	{
+	  Lisp_Object job = AREF (jobs, i);
+
+	  if (!NILP (job)
+	      && process_reaped_p (AREF (job, BATCH_JOB_PROCESS))
+	      && process_reaped_p (AREF (job, BATCH_JOB_STDERR)))
+	    {
+	      ASET (results, XFASTINT (AREF (job, BATCH_JOB_INDEX)),
+		    batch_job_result (job));
+	      Fdelete_process (AREF (job, BATCH_JOB_PROCESS));
+	      Fdelete_process (AREF (job, BATCH_JOB_STDERR));
+	      Fkill_buffer (AREF (job, BATCH_JOB_OUTPUT));
+	      Fkill_buffer (AREF (job, BATCH_JOB_ERROR_OUTPUT));
+	      ASET (jobs, i, job = Qnil);
+	      running--;
+	      reaped = true;
+	    }
+
+	  if (NILP (job) && CONSP (commands))
+	    {
+	      Lisp_Object command = XCAR (commands);
+	      Lisp_Object output_name
+		= build_string (" *call-process-batch*");
+	      Lisp_Object error_name
+		= build_string (" *call-process-batch stderr*");
+
+	      /* Record the buffers and processes as they are made, so
+		 that they are killed if making the next one fails.  */
+	      job = Fmake_vector (make_number (BATCH_JOB_SIZE), Qnil);
+	      ASET (job, BATCH_JOB_INDEX, make_number (index));
+	      ASET (job, BATCH_JOB_OUTPUT,
+		    Fget_buffer_create (Fgenerate_new_buffer_name (output_name,
+								   Qnil)));
+	      ASET (job, BATCH_JOB_ERROR_OUTPUT,
+		    Fget_buffer_create (Fgenerate_new_buffer_name (error_name,
+								   Qnil)));
+	      ASET (jobs, i, job);
+	      ASET (job, BATCH_JOB_STDERR,
+		    CALLN (Fmake_pipe_process,
+			   QCname, build_string ("call-process-batch stderr"),
+			   QCbuffer, AREF (job, BATCH_JOB_ERROR_OUTPUT),
+			   QCnoquery, Qt,
+			   QCsentinel, Qignore));
+	      ASET (job, BATCH_JOB_PROCESS,
+		    CALLN (Fmake_process,
+			   QCname, build_string ("call-process-batch"),
+			   QCbuffer, AREF (job, BATCH_JOB_OUTPUT),
+			   QCcommand, command,
+			   QCconnection_type, Qpipe,
+			   QCnoquery, Qt,
+			   QCstderr, AREF (job, BATCH_JOB_STDERR),
+			   QCsentinel, Qignore));
+	      /* The command gets no input, as with call-process and
+		 an INFILE of nil.  Close the pipe to its standard input
+		 directly: process-send-eof would signal an error if the
+		 command had already exited.  */
+	      {
+		struct Lisp_Process *p
+		  = XPROCESS (AREF (job, BATCH_JOB_PROCESS));
+		close_process_fd (&p->open_fd[WRITE_TO_SUBPROCESS]);
+		p->outfd = -1;
+	      }
+	      commands = XCDR (commands);
+	      index++;
+	      running++;
+	    }
+	}
+
+      if (running == 0)
+	break;
+
+      /* Wait for output, or for a process to change its status.
+	 The timeout only guards against missing a SIGCHLD that
+	 arrives just before waiting.  */
+      if (!reaped)
+	{
+	  wait_for_status_change = true;
+	  wait_reading_process_output (1, 0, 0, false, Qnil, NULL, 0);
+	}
+    }
+
+  unbind_to (count, Qnil);
+  return CALLN (Fappend, results, Qnil);
+}
+
 /* Accept a connection for server process SERVER on CHANNEL.  */
 
 static EMACS_INT connect_counter = 0;
@@ -4528,7 +5001,12 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 
   /* Close to the current time if known, an invalid timespec otherwise.  */
   struct timespec now = invalid_timespec ();
+  struct Lisp_Process *drain_process = send_drain_process;
+  bool status_change_wanted = wait_for_status_change;
+  EMACS_INT initial_update_tick = update_tick;
 
+  send_drain_process = NULL;
+  wait_for_status_change = false;
   FD_ZERO (&Available);
   FD_ZERO (&Writeok);
 
@@ -4591,6 +5069,9 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
       if (NILP (wait_for_cell)
 	  && just_wait_proc >= 0)
 	{
+	  if (send_callbacks_due)
+	    run_send_callbacks ();
+
 	  do
 	    {
 	      unsigned old_timers_run = timers_run;
@@ -4651,24 +5132,35 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	  Ctemp = write_mask;
 
 	  timeout = make_timespec (0, 0);
-	  if ((pselect (max (max_process_desc, max_input_desc) + 1,
-			&Atemp,
+	  if ((process_select (max (max_process_desc, max_input_desc) + 1,
+			       &Atemp,
 #ifdef NON_BLOCKING_CONNECT
-			(num_pending_connects > 0 ? &Ctemp : NULL),
+			       (num_pending_connects > 0 ? &Ctemp : NULL),
 #else
-			NULL,
+			       NULL,
 #endif
-			NULL, &timeout, NULL)
+			       &timeout)
 	       <= 0))
 	    {
 	      /* It's okay for us to do this and then continue with
 		 the loop, since timeout has already been zeroed out.  */
+	      int nread;
+
 	      clear_waiting_for_input ();
-	      got_some_output = status_notify (NULL, wait_proc);
+	      /* Keep any output already read from WAIT_PROC in this
+		 wait, which status_notify does not know about.  */
+	      nread = status_notify (NULL, wait_proc);
+	      if (got_some_output < nread)
+		got_some_output = nread;
 	      if (do_display) redisplay_preserve_echo_area (13);
 	    }
 	}
 
+      /* Exit now if a change of status was reported and the caller
+	 is waiting for one.  */
+      if (status_change_wanted && update_tick != initial_update_tick)
+	break;
+
       /* Don't wait for output from a non-running process.  Just
 	 read whatever data has already been received.  */
       if (wait_proc && wait_proc->raw_status_new)
@@ -4720,6 +5212,15 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	  FD_SET (wait_proc->infd, &Available);
 	  check_delay = 0;
           check_write = 0;
+	  /* Keep writing any input queued for the process, which it
+	     may need before it produces the output waited for.  */
+	  if (0 <= wait_proc->outfd
+	      && FD_ISSET (wait_proc->outfd, &send_wait_mask))
+	    {
+	      FD_ZERO (&Writeok);
+	      FD_SET (wait_proc->outfd, &Writeok);
+	      check_write = true;
+	    }
 	}
       else if (!NILP (wait_for_cell))
 	{
@@ -4825,17 +5326,21 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	  if (timeout.tv_sec > 0 || timeout.tv_nsec > 0)
 	    now = invalid_timespec ();
 
-#if defined (HAVE_NS)
+#if defined (HAVE_NS) || defined (HAVE_GLIB)
+# if defined (HAVE_NS)
           nfds = ns_select
-#elif defined (HAVE_GLIB)
+# else
 	  nfds = xg_select
-#else
-	  nfds = pselect
-#endif
+# endif
             (max (max_process_desc, max_input_desc) + 1,
              &Available,
              (check_write ? &Writeok : 0),
              NULL, &timeout, NULL);
+#else
+	  nfds = process_select (max (max_process_desc, max_input_desc) + 1,
+				 &Available, (check_write ? &Writeok : 0),
+				 &timeout);
+#endif
 
 #ifdef HAVE_GNUTLS
           /* GnuTLS buffers data internally.  In lowat mode it leaves
@@ -5030,6 +5535,14 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
             d->func (channel, d->data);
 	}
 
+      /* Write queued data to processes that are ready for it.  */
+      if (check_write && num_pending_sends > 0)
+	{
+	  send_queues_flush_ready (&Writeok);
+	  if (drain_process && drain_process->send_len == 0)
+	    break;
+	}
+
       for (channel = 0; channel <= max_process_desc; channel++)
 	{
 	  if (FD_ISSET (channel, &Available)
@@ -5242,12 +5755,39 @@ static void
 read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 				    ssize_t nbytes,
 				    struct coding_system *coding);
+static void insert_process_output (struct Lisp_Process *, Lisp_Object,
+				   struct coding_system *, char *, ptrdiff_t);
+
+/* Output of a process to be decoded into its buffer by
+   insert_process_output_call.  */
+
+struct process_output
+{
+  struct Lisp_Process *p;
+  struct coding_system *coding;
+  char *chars;
+  ptrdiff_t nbytes;
+};
+
+static Lisp_Object
+insert_process_output_call (Lisp_Object arg)
+{
+  struct process_output *output = XSAVE_POINTER (arg, 0);
+  insert_process_output (output->p, Qnil, output->coding,
+			 output->chars, output->nbytes);
+  return Qnil;
+}
 
 /* Read pending output from the process channel,
    starting with our buffered-ahead character if we have one.
    Yield number of decoded characters read.
 
-   This function reads at most 4096 characters.
+   This function reads at most PROC's read_output_size bytes, and
+   reads repeatedly until that many have arrived or the channel has
+   nothing more to offer for now, so that a process that writes a lot
+   of output has its filter called once per large batch rather than
+   once per pipe-sized chunk.  The size doubles whenever a call fills
+   it, up to PROC's read_output_max, and halves when output slows down.
    If you want to read all available subprocess output,
    you must call it repeatedly until it returns zero.
 
@@ -5261,10 +5801,13 @@ read_process_output (Lisp_Object proc, int channel)
   struct Lisp_Process *p = XPROCESS (proc);
   struct coding_system *coding = proc_decode_coding_system[channel];
   int carryover = p->decoding_carryover;
-  enum { readmax = 4096 };
+  int readmax = p->read_output_size;
   ptrdiff_t count = SPECPDL_INDEX ();
   Lisp_Object odeactivate;
-  char chars[sizeof coding->carryover + readmax];
+  char *chars;
+  USE_SAFE_ALLOCA;
+
+  chars = SAFE_ALLOCA (sizeof coding->carryover + readmax);
 
   if (carryover)
     /* See the comment above.  */
@@ -5293,8 +5836,31 @@ read_process_output (Lisp_Object proc, int channel)
 				    readmax - buffered);
       else
 #endif
-	nbytes = emacs_read (channel, chars + carryover + buffered,
-			     readmax - buffered);
+	{
+	  nbytes = emacs_read (channel, chars + carryover + buffered,
+			       readmax - buffered);
+
+	  /* Gather whatever else is already waiting, so that it is
+	     decoded and handed to the filter in one go.  Only do this
+	     on a non-blocking channel, where asking for more cannot
+	     hang; an error or EOF here is seen again by the next call.  */
+	  if (0 < nbytes && nbytes < readmax - buffered
+	      && (fcntl (channel, F_GETFL) & O_NONBLOCK))
+	    {
+	      int err = errno;
+	      while (nbytes < readmax - buffered)
+		{
+		  ssize_t more
+		    = emacs_read (channel, chars + carryover + buffered + nbytes,
+				  readmax - buffered - nbytes);
+		  if (more <= 0)
+		    break;
+		  nbytes += more;
+		}
+	      errno = err;
+	    }
+	}
+
       if (nbytes > 0 && p->adaptive_read_buffering)
 	{
 	  int delay = p->read_output_delay;
@@ -5324,6 +5890,14 @@ read_process_output (Lisp_Object proc, int channel)
       nbytes += buffered && nbytes <= 0;
     }
 
+  /* Adapt the size of the next read to how much arrived this time.  */
+  if (nbytes >= readmax)
+    p->read_output_size = (readmax <= p->read_output_max / 2
+			   ? readmax * 2 : p->read_output_max);
+  else if (0 < nbytes && nbytes < readmax / 4
+	   && readmax / 2 >= READ_OUTPUT_SIZE_MIN)
+    p->read_output_size = readmax / 2;
+
   p->decoding_carryover = 0;
 
   /* At this point, NBYTES holds number of bytes just received
@@ -5331,7 +5905,10 @@ read_process_output (Lisp_Object proc, int channel)
   if (nbytes <= 0)
     {
       if (nbytes < 0 || coding->mode & CODING_MODE_LAST_BLOCK)
-	return nbytes;
+	{
+	  SAFE_FREE ();
+	  return nbytes;
+	}
       coding->mode |= CODING_MODE_LAST_BLOCK;
     }
 
@@ -5350,6 +5927,7 @@ read_process_output (Lisp_Object proc, int channel)
   Vdeactivate_mark = odeactivate;
 
   unbind_to (count, Qnil);
+  SAFE_FREE ();
   return nbytes;
 }
 
@@ -5359,9 +5937,27 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 				    struct coding_system *coding)
 {
   Lisp_Object outstream = p->filter;
-  Lisp_Object text;
+  Lisp_Object text = Qnil;
   bool outer_running_asynch_code = running_asynch_code;
   int waiting = waiting_for_user_input_p;
+  Lisp_Object filter_function = (SYMBOLP (outstream)
+				 ? XSYMBOL (outstream)->function : Qnil);
+  /* Whether to decode the output straight into the process buffer
+     rather than into a string for the filter.  This is only
+     equivalent when the filter is the default one, and the buffer
+     would not need the decoded text converted to unibyte.  A read no
+     longer than the carryover area may be carried over whole and
+     produce no text; the string path then calls no filter, and so
+     runs no change hooks.  */
+  bool direct
+    = (nbytes > sizeof coding->carryover
+       && EQ (outstream, Qinternal_default_process_filter)
+       && SUBRP (filter_function)
+       && (XSUBR (filter_function)->function.a2
+	   == Finternal_default_process_filter)
+       && BUFFERP (p->buffer) && BUFFER_LIVE_P (XBUFFER (p->buffer))
+       && (! NILP (BVAR (XBUFFER (p->buffer), enable_multibyte_characters))
+	   || CODING_FOR_UNIBYTE (coding)));
 
 #if 0
   Lisp_Object obuffer, okeymap;
@@ -5392,8 +5988,25 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
      save the match data in a special nonrecursive fashion.  */
   running_asynch_code = 1;
 
-  decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
-  text = coding->dst_object;
+  if (direct)
+    {
+      struct process_output output = { p, coding, chars, nbytes };
+
+      /* Should inserting fail before decoding, there is nothing
+	 to carry over to the next read.  */
+      coding->carryover_bytes = 0;
+      /* FIXME: As below, it's wrong to wrap or not based on
+	 debug-on-error.  */
+      internal_condition_case_1 (insert_process_output_call,
+				 make_save_ptr (&output),
+				 !NILP (Vdebug_on_error) ? Qnil : Qerror,
+				 read_process_output_error_handler);
+    }
+  else
+    {
+      decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
+      text = coding->dst_object;
+    }
   Vlast_coding_system_used = CODING_ID_NAME (coding->id);
   /* A new coding system might be found.  */
   if (!EQ (p->decode_coding_system, Vlast_coding_system_used))
@@ -5429,7 +6042,7 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 	      coding->carryover_bytes);
       p->decoding_carryover = coding->carryover_bytes;
     }
-  if (SBYTES (text) > 0)
+  if (!direct && SBYTES (text) > 0)
     /* FIXME: It's wrong to wrap or not based on debug-on-error, and
        sometimes it's simply wrong to wrap (e.g. when called from
        accept-process-output).  */
@@ -5459,20 +6072,19 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
       record_asynch_buffer_change ();
 }
 
-DEFUN ("internal-default-process-filter", Finternal_default_process_filter,
-       Sinternal_default_process_filter, 2, 2, 0,
-       doc: /* Function used as default process filter.
-This inserts the process's output into its buffer, if there is one.
-Otherwise it discards the output.  */)
-  (Lisp_Object proc, Lisp_Object text)
+/* Insert output from process P into its buffer, if it has a live one,
+   at the process mark, and advance the mark past it.  The output is
+   TEXT if that is a string.  Otherwise it is the NBYTES bytes at
+   CHARS, which are decoded by CODING straight into the buffer's gap,
+   sparing the copy through a Lisp string.  */
+
+static void
+insert_process_output (struct Lisp_Process *p, Lisp_Object text,
+		       struct coding_system *coding,
+		       char *chars, ptrdiff_t nbytes)
 {
-  struct Lisp_Process *p;
   ptrdiff_t opoint;
 
-  CHECK_PROCESS (proc);
-  p = XPROCESS (proc);
-  CHECK_STRING (text);
-
   if (!NILP (p->buffer) && BUFFER_LIVE_P (XBUFFER (p->buffer)))
     {
       Lisp_Object old_read_only;
@@ -5507,16 +6119,41 @@ Otherwise it discards the output.  */)
       if (! (BEGV <= PT && PT <= ZV))
 	Fwiden ();
 
-      /* Adjust the multibyteness of TEXT to that of the buffer.  */
-      if (NILP (BVAR (current_buffer, enable_multibyte_characters))
-	  != ! STRING_MULTIBYTE (text))
-	text = (STRING_MULTIBYTE (text)
-		? Fstring_as_unibyte (text)
-		: Fstring_to_multibyte (text));
-      /* Insert before markers in case we are inserting where
-	 the buffer's mark is, and the user's next command is Meta-y.  */
-      insert_from_string_before_markers (text, 0, 0,
-					 SCHARS (text), SBYTES (text), 0);
+      if (STRINGP (text))
+	{
+	  /* Adjust the multibyteness of TEXT to that of the buffer.  */
+	  if (NILP (BVAR (current_buffer, enable_multibyte_characters))
+	      != ! STRING_MULTIBYTE (text))
+	    text = (STRING_MULTIBYTE (text)
+		    ? Fstring_as_unibyte (text)
+		    : Fstring_to_multibyte (text));
+	  /* Insert before markers in case we are inserting where
+	     the buffer's mark is, and the user's next command is Meta-y.  */
+	  insert_from_string_before_markers (text, 0, 0,
+					     SCHARS (text), SBYTES (text), 0);
+	}
+      else
+	{
+	  /* Do what insert_from_string_before_markers would, around
+	     decoding into the gap at point.  The hooks run by
+	     prepare_to_modify_buffer may move point, so insert
+	     wherever it is afterwards.  */
+	  ptrdiff_t from, from_byte;
+
+	  prepare_to_modify_buffer (PT, PT, NULL);
+	  from = PT;
+	  from_byte = PT_BYTE;
+	  decode_coding_c_string (coding, (unsigned char *) chars, nbytes,
+				  Fcurrent_buffer ());
+	  TEMP_SET_PT_BOTH (from + coding->produced_char,
+			    from_byte + coding->produced);
+	  if (coding->produced_char > 0)
+	    {
+	      advance_markers_at_insertion (from, from_byte, PT, PT_BYTE);
+	      signal_after_change (from, 0, PT - from);
+	      update_compositions (from, PT, CHECK_BORDER);
+	    }
+	}
 
       /* Make sure the process marker's position is valid when the
 	 process buffer is changed in the signal_after_change above.
@@ -5554,81 +6191,259 @@ Otherwise it discards the output.  */)
       bset_read_only (current_buffer, old_read_only);
       SET_PT_BOTH (opoint, opoint_byte);
     }
+}
+
+DEFUN ("internal-default-process-filter", Finternal_default_process_filter,
+       Sinternal_default_process_filter, 2, 2, 0,
+       doc: /* Function used as default process filter.
+This inserts the process's output into its buffer, if there is one.
+Otherwise it discards the output.  */)
+  (Lisp_Object proc, Lisp_Object text)
+{
+  CHECK_PROCESS (proc);
+  CHECK_STRING (text);
+  insert_process_output (XPROCESS (proc), text, NULL, NULL, 0);
   return Qnil;
 }
 
 /* Sending data to subprocess.  */
 
-/* In send_process, when a write fails temporarily,
-   wait_reading_process_output is called.  It may execute user code,
-   e.g. timers, that attempts to write new data to the same process.
-   We must ensure that data is sent in the right order, and not
-   interspersed half-completed with other writes (Bug#10815).  This is
-   handled by the write_queue element of struct process.  It is a list
-   with each entry having the form
-
-   (string . (offset . length))
+/* Data that a process's output descriptor does not accept at once is
+   copied into its send queue, a circular buffer in the send_buf
+   member of struct Lisp_Process, and written from there in order as
+   the descriptor becomes writable.  Data sent later, perhaps by timers
+   or filters run while send_process waits, is queued behind it rather
+   than written ahead of it, so that nothing is interspersed
+   half-completed with other writes (Bug#10815).  */
 
-   where STRING is a lisp string, OFFSET is the offset into the
-   string's byte sequence from which we should begin to send, and
-   LENGTH is the number of bytes left to send.  */
+/* When the send queue of a process drains and its buffer is larger
+   than this, free the buffer rather than keep it for later.  */
+enum { SEND_QUEUE_KEEP = 64 * 1024 };
 
-/* Create a new entry in write_queue.
-   INPUT_OBJ should be a buffer, string Qt, or Qnil.
-   BUF is a pointer to the string sequence of the input_obj or a C
-   string in case of Qt or Qnil.  */
+/* Append LEN bytes at BUF to the send queue of process P.  */
 
 static void
-write_queue_push (struct Lisp_Process *p, Lisp_Object input_obj,
-                  const char *buf, ptrdiff_t len, bool front)
+send_queue_push (struct Lisp_Process *p, const char *buf, ptrdiff_t len)
 {
-  ptrdiff_t offset;
-  Lisp_Object entry, obj;
+  ptrdiff_t tail, first;
 
-  if (STRINGP (input_obj))
+  if (p->send_size - p->send_len < len)
     {
-      offset = buf - SSDATA (input_obj);
-      obj = input_obj;
+      /* Grow the buffer, and move the queued data to its start.  */
+      ptrdiff_t size = p->send_size;
+      char *newbuf = xpalloc (NULL, &size,
+			      len - (p->send_size - p->send_len), -1, 1);
+      first = min (p->send_len, p->send_size - p->send_head);
+      memcpy (newbuf, p->send_buf + p->send_head, first);
+      memcpy (newbuf + first, p->send_buf, p->send_len - first);
+      xfree (p->send_buf);
+      p->send_buf = newbuf;
+      p->send_size = size;
+      p->send_head = 0;
     }
+
+  tail = (p->send_head + p->send_len) % p->send_size;
+  first = min (len, p->send_size - tail);
+  memcpy (p->send_buf + tail, buf, first);
+  memcpy (p->send_buf, buf + first, len - first);
+  p->send_len += len;
+}
+
+/* Discard the send queue of process P.  */
+
+static void
+send_queue_clear (struct Lisp_Process *p)
+{
+  xfree (p->send_buf);
+  p->send_buf = NULL;
+  p->send_size = p->send_head = p->send_len = 0;
+}
+
+/* Write up to LEN bytes at BUF to the output descriptor of process P.
+   Return the number of bytes written; if that is less than LEN, errno
+   says why.  */
+
+static ptrdiff_t
+process_write (struct Lisp_Process *p, const char *buf, ptrdiff_t len)
+{
+  ptrdiff_t written;
+
+#ifdef HAVE_GNUTLS
+  if (p->gnutls_p && p->gnutls_state)
+    written = emacs_gnutls_write (p, buf, len);
   else
+#endif
+    written = emacs_write_sig (p->outfd, buf, len);
+  if (p->read_output_delay > 0
+      && p->adaptive_read_buffering == 1)
     {
-      offset = 0;
-      obj = make_unibyte_string (buf, len);
+      p->read_output_delay = 0;
+      process_output_delay_count--;
+      p->read_output_skip = 0;
     }
+  return written;
+}
+
+/* Write as much of the send queue of process P as its output
+   descriptor accepts.  Return the number of bytes left in the queue;
+   if that is not zero, errno says why writing stopped.  */
+
+static ptrdiff_t
+send_queue_flush (struct Lisp_Process *p)
+{
+  EMACS_INT written_before = p->send_total - p->send_len;
+
+  while (p->send_len > 0)
+    {
+      ptrdiff_t len = min (p->send_len, p->send_size - p->send_head);
+      ptrdiff_t written = process_write (p, p->send_buf + p->send_head, len);
+      p->send_head = (p->send_head + written) % p->send_size;
+      p->send_len -= written;
+      if (written < len)
+	break;
+    }
+
+  if (p->send_len == 0)
+    {
+      if (p->send_size > SEND_QUEUE_KEEP)
+	send_queue_clear (p);
+      p->send_head = 0;
+    }
+
+  if (CONSP (p->send_callbacks)
+      && (XINT (XCAR (XCAR (p->send_callbacks)))
+	  <= p->send_total - p->send_len)
+      && written_before < p->send_total - p->send_len)
+    send_callbacks_due = true;
+
+  return p->send_len;
+}
+
+/* Have wait_reading_process_output write the send queue of process P
+   whenever P's output descriptor becomes writable, or stop doing so.  */
+
+static void
+send_queue_watch (struct Lisp_Process *p)
+{
+  int fd = p->outfd;
+
+  if (! FD_ISSET (fd, &send_wait_mask))
+    {
+      FD_SET (fd, &send_wait_mask);
+      FD_SET (fd, &write_mask);
+      if (fd > max_input_desc)
+	max_input_desc = fd;
+      num_pending_sends++;
+    }
+}
+
+static void
+send_queue_unwatch (struct Lisp_Process *p)
+{
+  int fd = p->outfd;
 
-  entry = Fcons (obj, Fcons (make_number (offset), make_number (len)));
+  if (0 <= fd && FD_ISSET (fd, &send_wait_mask))
+    {
+      FD_CLR (fd, &send_wait_mask);
+      FD_CLR (fd, &write_mask);
+      forget_wait_descriptor (fd);
+      if (fd_callback_info[fd].condition == 0)
+	delete_input_desc (fd);
+      num_pending_sends--;
+    }
+}
+
+/* Handle the failure, with errno ERR, of a write to process PROC.
+   Close the process if its output descriptor can no longer be written
+   to.  Signal an error if SIGNAL, and otherwise return.  */
 
-  if (front)
-    pset_write_queue (p, Fcons (entry, p->write_queue));
+static void
+send_process_failed (Lisp_Object proc, int err, bool signal)
+{
+  struct Lisp_Process *p = XPROCESS (proc);
+
+  if (err == EPIPE || !signal)
+    {
+      send_queue_unwatch (p);
+      p->raw_status_new = 0;
+      pset_status (p, list2 (Qexit, make_number (256)));
+      p->tick = ++process_tick;
+      deactivate_process (proc);
+      if (signal)
+	error ("process %s no longer connected to pipe; closed it",
+	       SDATA (p->name));
+    }
   else
-    pset_write_queue (p, nconc2 (p->write_queue, list1 (entry)));
+    /* This is a real error.  */
+    report_file_errno ("Writing to process", proc, err);
 }
 
-/* Remove the first element in the write_queue of process P, put its
-   contents in OBJ, BUF and LEN, and return true.  If the
-   write_queue is empty, return false.  */
+/* Write the send queues of the processes whose output descriptors are
+   in WRITEOK.  This does not run Lisp code.  */
 
-static bool
-write_queue_pop (struct Lisp_Process *p, Lisp_Object *obj,
-		 const char **buf, ptrdiff_t *len)
+static void
+send_queues_flush_ready (fd_set *writeok)
 {
-  Lisp_Object entry, offset_length;
-  ptrdiff_t offset;
+  Lisp_Object tail;
+
+  for (tail = Vprocess_alist; CONSP (tail); tail = XCDR (tail))
+    {
+      Lisp_Object proc = XCDR (XCAR (tail));
+      struct Lisp_Process *p = XPROCESS (proc);
+
+      if (0 <= p->outfd && FD_ISSET (p->outfd, &send_wait_mask)
+	  && FD_ISSET (p->outfd, writeok))
+	{
+	  if (send_queue_flush (p) == 0)
+	    send_queue_unwatch (p);
+	  else if (! would_block (errno))
+	    send_process_failed (proc, errno, false);
+	}
+    }
+}
 
-  if (NILP (p->write_queue))
-    return 0;
+static Lisp_Object
+send_callback_error_handler (Lisp_Object error_val)
+{
+  cmd_error_internal (error_val, "error in process send callback: ");
+  Vinhibit_quit = Qt;
+  update_echo_area ();
+  Fsleep_for (make_number (2), Qnil);
+  return Qt;
+}
 
-  entry = XCAR (p->write_queue);
-  pset_write_queue (p, XCDR (p->write_queue));
+/* Call the send callbacks of all processes whose data has been
+   written.  */
 
-  *obj = XCAR (entry);
-  offset_length = XCDR (entry);
+static void
+run_send_callbacks (void)
+{
+  Lisp_Object tail;
 
-  *len = XINT (XCDR (offset_length));
-  offset = XINT (XCAR (offset_length));
-  *buf = SSDATA (*obj) + offset;
+  send_callbacks_due = false;
+  for (tail = Vprocess_alist; CONSP (tail); tail = XCDR (tail))
+    {
+      Lisp_Object proc = XCDR (XCAR (tail));
+      struct Lisp_Process *p = XPROCESS (proc);
 
-  return 1;
+      while (CONSP (p->send_callbacks)
+	     && (XINT (XCAR (XCAR (p->send_callbacks)))
+		 <= p->send_total - p->send_len))
+	{
+	  ptrdiff_t count = SPECPDL_INDEX ();
+	  Lisp_Object function = XCDR (XCAR (p->send_callbacks));
+
+	  pset_send_callbacks (p, XCDR (p->send_callbacks));
+	  specbind (Qinhibit_quit, Qt);
+	  record_unwind_current_buffer ();
+	  record_unwind_save_match_data ();
+	  internal_condition_case_1 (read_process_output_call,
+				     list2 (function, proc),
+				     !NILP (Vdebug_on_error) ? Qnil : Qerror,
+				     send_callback_error_handler);
+	  unbind_to (count, Qnil);
+	}
+    }
 }
 
 /* Send some data to process PROC.
@@ -5639,14 +6454,18 @@ write_queue_pop (struct Lisp_Process *p, Lisp_Object *obj,
    If OBJECT is not nil, the data is encoded by PROC's coding-system
    for encoding before it is sent.
 
+   Data that cannot be written at once is queued.  If NOWAIT, return
+   without waiting for it to be written; wait_reading_process_output
+   writes it as PROC becomes ready for it.  Otherwise wait, accepting
+   output from processes, until all data queued for PROC is written.
+
    This function can evaluate Lisp code and can garbage collect.  */
 
 static void
 send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
-	      Lisp_Object object)
+	      Lisp_Object object, bool nowait)
 {
   struct Lisp_Process *p = XPROCESS (proc);
-  ssize_t rv;
   struct coding_system *coding;
 
   if (p->raw_status_new)
@@ -5693,7 +6512,7 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
 	    {
 	      /* But, before changing the coding, we must flush out data.  */
 	      coding->mode |= CODING_MODE_LAST_BLOCK;
-	      send_process (proc, "", 0, Qt);
+	      send_process (proc, "", 0, Qt, nowait);
 	      coding->mode &= CODING_MODE_LAST_BLOCK;
 	    }
 	  setup_coding_system (raw_text_coding_system
@@ -5741,117 +6560,92 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
       buf = SSDATA (object);
     }
 
-  /* If there is already data in the write_queue, put the new data
-     in the back of queue.  Otherwise, ignore it.  */
-  if (!NILP (p->write_queue))
-    write_queue_push (p, object, buf, len, 0);
-
-  do   /* while !NILP (p->write_queue) */
+#ifdef DATAGRAM_SOCKETS
+  /* Each send to a datagram socket is a separate datagram, so write
+     it whole, waiting until that is possible, instead of queuing it
+     to be joined with others.  */
+  if (DATAGRAM_CHAN_P (p->outfd))
     {
-      ptrdiff_t cur_len = -1;
-      const char *cur_buf;
-      Lisp_Object cur_object;
-
-      /* If write_queue is empty, ignore it.  */
-      if (!write_queue_pop (p, &cur_object, &cur_buf, &cur_len))
+      while (sendto (p->outfd, buf, len, 0, datagram_address[p->outfd].sa,
+		     datagram_address[p->outfd].len)
+	     < 0)
 	{
-	  cur_len = len;
-	  cur_buf = buf;
-	  cur_object = object;
+	  if (errno == EMSGSIZE)
+	    report_file_error ("Sending datagram", proc);
+	  if (! would_block (errno))
+	    send_process_failed (proc, errno, true);
+	  wait_reading_process_output (0, 20 * 1000 * 1000,
+				       0, 0, Qnil, NULL, 0);
+	  if (p->outfd < 0)
+	    error ("Output file descriptor of %s is closed", SDATA (p->name));
 	}
-
-      while (cur_len > 0)
-	{
-	  /* Send this batch, using one or more write calls.  */
-	  ptrdiff_t written = 0;
-	  int outfd = p->outfd;
-#ifdef DATAGRAM_SOCKETS
-	  if (DATAGRAM_CHAN_P (outfd))
-	    {
-	      rv = sendto (outfd, cur_buf, cur_len,
-			   0, datagram_address[outfd].sa,
-			   datagram_address[outfd].len);
-	      if (rv >= 0)
-		written = rv;
-	      else if (errno == EMSGSIZE)
-		report_file_error ("Sending datagram", proc);
-	    }
-	  else
-#endif
-	    {
-#ifdef HAVE_GNUTLS
-	      if (p->gnutls_p && p->gnutls_state)
-		written = emacs_gnutls_write (p, cur_buf, cur_len);
-	      else
+      p->send_total += len;
+      return;
+    }
 #endif
-		written = emacs_write_sig (outfd, cur_buf, cur_len);
-	      rv = (written ? 0 : -1);
-	      if (p->read_output_delay > 0
-		  && p->adaptive_read_buffering == 1)
-		{
-		  p->read_output_delay = 0;
-		  process_output_delay_count--;
-		  p->read_output_skip = 0;
-		}
-	    }
 
-	  if (rv < 0)
-	    {
-	      if (would_block (errno))
-		/* Buffer is full.  Wait, accepting input;
-		   that may allow the program
-		   to finish doing output and read more.  */
-		{
+  /* Write the data at once if nothing is queued ahead of it, and
+     queue what is not accepted.  */
+  p->send_total += len;
+  if (p->send_len == 0 && len > 0)
+    {
+      ptrdiff_t written = process_write (p, buf, len);
+      if (written < len && ! would_block (errno))
+	send_process_failed (proc, errno, true);
+      buf += written;
+      len -= written;
+    }
+  if (len > 0)
+    {
+      send_queue_push (p, buf, len);
+      send_queue_watch (p);
+    }
+
+  if (nowait)
+    return;
+
+  while (p->send_len > 0)
+    {
+      if (send_queue_flush (p) == 0)
+	break;
+      if (! would_block (errno))
+	send_process_failed (proc, errno, true);
+
+      /* Buffer is full.  Wait, accepting input;
+	 that may allow the program
+	 to finish doing output and read more.  */
 #ifdef BROKEN_PTY_READ_AFTER_EAGAIN
-		  /* A gross hack to work around a bug in FreeBSD.
-		     In the following sequence, read(2) returns
-		     bogus data:
-
-		     write(2)	 1022 bytes
-		     write(2)   954 bytes, get EAGAIN
-		     read(2)   1024 bytes in process_read_output
-		     read(2)     11 bytes in process_read_output
-
-		     That is, read(2) returns more bytes than have
-		     ever been written successfully.  The 1033 bytes
-		     read are the 1022 bytes written successfully
-		     after processing (for example with CRs added if
-		     the terminal is set up that way which it is
-		     here).  The same bytes will be seen again in a
-		     later read(2), without the CRs.  */
-
-		  if (errno == EAGAIN)
-		    {
-		      int flags = FWRITE;
-		      ioctl (p->outfd, TIOCFLUSH, &flags);
-		    }
+      /* A gross hack to work around a bug in FreeBSD.
+	 In the following sequence, read(2) returns
+	 bogus data:
+
+	 write(2)	 1022 bytes
+	 write(2)   954 bytes, get EAGAIN
+	 read(2)   1024 bytes in process_read_output
+	 read(2)     11 bytes in process_read_output
+
+	 That is, read(2) returns more bytes than have
+	 ever been written successfully.  The 1033 bytes
+	 read are the 1022 bytes written successfully
+	 after processing (for example with CRs added if
+	 the terminal is set up that way which it is
+	 here).  The same bytes will be seen again in a
+	 later read(2), without the CRs.  */
+
+      if (errno == EAGAIN)
+	{
+	  int flags = FWRITE;
+	  ioctl (p->outfd, TIOCFLUSH, &flags);
+	}
 #endif /* BROKEN_PTY_READ_AFTER_EAGAIN */
 
-		  /* Put what we should have written in wait_queue.  */
-		  write_queue_push (p, cur_object, cur_buf, cur_len, 1);
-		  wait_reading_process_output (0, 20 * 1000 * 1000,
-					       0, 0, Qnil, NULL, 0);
-		  /* Reread queue, to see what is left.  */
-		  break;
-		}
-	      else if (errno == EPIPE)
-		{
-		  p->raw_status_new = 0;
-		  pset_status (p, list2 (Qexit, make_number (256)));
-		  p->tick = ++process_tick;
-		  deactivate_process (proc);
-		  error ("process %s no longer connected to pipe; closed it",
-			 SDATA (p->name));
-		}
-	      else
-		/* This is a real error.  */
-		report_file_error ("Writing to process", proc);
-	    }
-	  cur_buf += written;
-	  cur_len -= written;
-	}
+      send_drain_process = p;
+      wait_reading_process_output (0, 20 * 1000 * 1000,
+				   0, 0, Qnil, NULL, 0);
+      if (p->outfd < 0)
+	error ("Output file descriptor of %s is closed", SDATA (p->name));
     }
-  while (!NILP (p->write_queue));
+  send_queue_unwatch (p);
 }
 
 DEFUN ("process-send-region", Fprocess_send_region, Sprocess_send_region,
@@ -5877,7 +6671,7 @@ Output from processes can arrive in between bunches.  */)
     move_gap_both (XINT (start), start_byte);
 
   send_process (proc, (char *) BYTE_POS_ADDR (start_byte),
-		end_byte - start_byte, Fcurrent_buffer ());
+		end_byte - start_byte, Fcurrent_buffer (), false);
 
   return Qnil;
 }
@@ -5896,9 +6690,60 @@ Output from processes can arrive in between bunches.  */)
   CHECK_STRING (string);
   proc = get_process (process);
   send_process (proc, SSDATA (string),
-		SBYTES (string), string);
+		SBYTES (string), string, false);
   return Qnil;
 }
+
+DEFUN ("process-send-string-nowait", Fprocess_send_string_nowait,
+       Sprocess_send_string_nowait, 2, 3, 0,
+       doc: /* Send PROCESS the contents of STRING as input, without waiting.
+PROCESS may be a process, a buffer, the name of a process or buffer, or
+nil, indicating the current buffer's process.
+
+Unlike `process-send-string', this returns as soon as STRING has been
+queued, even if PROCESS is not ready to read all of it.  The rest is
+written in the background, while Emacs waits for input or process
+output, after any data sent to PROCESS before.
+
+If CALLBACK is non-nil, it is a function to call with PROCESS as its
+argument once all of STRING has been written.  It is not called if
+PROCESS exits or is deleted first.
+
+Return the number of bytes waiting to be written to PROCESS,
+including those of STRING.  Callers that produce much data can use
+this to stop sending while the process falls behind, and CALLBACK to
+learn when to resume.  */)
+  (Lisp_Object process, Lisp_Object string, Lisp_Object callback)
+{
+  Lisp_Object proc;
+  struct Lisp_Process *p;
+
+  CHECK_STRING (string);
+  proc = get_process (process);
+  p = XPROCESS (proc);
+  send_process (proc, SSDATA (string), SBYTES (string), string, true);
+  if (!NILP (callback))
+    {
+      pset_send_callbacks
+	(p, nconc2 (p->send_callbacks,
+		    list1 (Fcons (make_number (p->send_total), callback))));
+      if (p->send_len == 0)
+	send_callbacks_due = true;
+    }
+  return make_number (p->send_len);
+}
+
+DEFUN ("process-send-queue-size", Fprocess_send_queue_size,
+       Sprocess_send_queue_size, 0, 1, 0,
+       doc: /* Return the number of bytes waiting to be written to PROCESS.
+These were sent by `process-send-string-nowait', or by other functions
+that were interrupted before PROCESS read all their data.
+PROCESS may be a process, a buffer, the name of a process or buffer, or
+nil, indicating the current buffer's process.  */)
+  (Lisp_Object process)
+{
+  return make_number (XPROCESS (get_process (process))->send_len);
+}
 
 /* Return the foreground process group for the tty/pty that
    the process P uses.  */
@@ -6031,7 +6876,7 @@ process_send_signal (Lisp_Object process, int signo, Lisp_Object current_group,
 
       if (sig_char && *sig_char != CDISABLE)
 	{
-	  send_process (proc, (char *) sig_char, 1, Qnil);
+	  send_process (proc, (char *) sig_char, 1, Qnil, false);
 	  return;
 	}
       /* If we can't send the signal with a character,
@@ -6323,14 +7168,18 @@ process has been transmitted to the serial port.  */)
   if (! EQ (XPROCESS (proc)->status, Qrun))
     error ("Process %s not running", SDATA (XPROCESS (proc)->name));
 
+  /* Write what process-send-string-nowait queued before the EOF.  */
+  if (XPROCESS (proc)->send_len > 0)
+    send_process (proc, "", 0, Qnil, false);
+
   if (coding && CODING_REQUIRE_FLUSHING (coding))
     {
       coding->mode |= CODING_MODE_LAST_BLOCK;
-      send_process (proc, "", 0, Qnil);
+      send_process (proc, "", 0, Qnil, false);
     }
 
   if (XPROCESS (proc)->pty_flag)
-    send_process (proc, "\004", 1, Qnil);
+    send_process (proc, "\004", 1, Qnil, false);
   else if (EQ (XPROCESS (proc)->type, Qserial))
     {
 #ifndef WINDOWSNT
@@ -6354,6 +7203,7 @@ process has been transmitted to the serial port.  */)
 	  && (EQ (p->type, Qnetwork) || p->infd == old_outfd))
 	shutdown (old_outfd, 1);
 #endif
+      send_queue_unwatch (p);
       close_process_fd (&p->open_fd[WRITE_TO_SUBPROCESS]);
       new_outfd = emacs_open (NULL_DEVICE, O_WRONLY, 0);
       if (new_outfd < 0)
@@ -6503,6 +7353,13 @@ handle_child_signal (int sig)
 	}
     }
 
+  if (0 <= child_signal_write_fd)
+    {
+      /* If the pipe is full, a wake-up is already pending.  */
+      char c = 0;
+      ignore_value (write (child_signal_write_fd, &c, 1));
+    }
+
   lib_child_handler (sig);
 #ifdef NS_IMPL_GNUSTEP
   /* NSTask in GNUstep sets its child handler each time it is called.
@@ -7139,6 +7996,7 @@ delete_keyboard_wait_descriptor (int desc)
 #ifdef subprocesses
   FD_CLR (desc, &input_wait_mask);
   FD_CLR (desc, &non_process_wait_mask);
+  forget_wait_descriptor (desc);
   delete_input_desc (desc);
 #endif
 }
@@ -7345,7 +8203,58 @@ integer or floating point values.
   return system_process_attributes (pid);
 }
 
+DEFUN ("num-processors", Fnum_processors, Snum_processors, 0, 0, 0,
+       doc: /* Return the number of processors available to Emacs.
+The value is at least 1; it is 1 if the number cannot be determined.  */)
+  (void)
+{
+  long n = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+  n = sysconf (_SC_NPROCESSORS_ONLN);
+#endif
+  return make_number (clip_to_bounds (1, n, MOST_POSITIVE_FIXNUM));
+}
+
 #ifdef subprocesses
+/* Discard the bytes that handle_child_signal wrote to FD, the
+   descriptor child_signal_read_fd.  */
+
+static void
+child_signal_read (int fd, void *data)
+{
+  char buf[64];
+  while (0 < read (fd, buf, sizeof buf))
+    continue;
+}
+
+/* Create the pipe through which handle_child_signal wakes up waits
+   for input, and add it to the set of non-keyboard input
+   descriptors.  */
+
+static void
+child_signal_init (void)
+{
+#ifndef WINDOWSNT
+  int fds[2];
+
+  child_signal_read_fd = child_signal_write_fd = -1;
+  if (emacs_pipe (fds) != 0)
+    return;
+  fcntl (fds[0], F_SETFL, O_NONBLOCK);
+  fcntl (fds[1], F_SETFL, O_NONBLOCK);
+  FD_SET (fds[0], &input_wait_mask);
+  FD_SET (fds[0], &non_keyboard_wait_mask);
+  FD_SET (fds[0], &non_process_wait_mask);
+  fd_callback_info[fds[0]].func = child_signal_read;
+  fd_callback_info[fds[0]].data = NULL;
+  fd_callback_info[fds[0]].condition |= FOR_READ;
+  if (fds[0] > max_input_desc)
+    max_input_desc = fds[0];
+  child_signal_read_fd = fds[0];
+  child_signal_write_fd = fds[1];
+#endif
+}
+
 /* Arrange to catch SIGCHLD if this hasn't already been arranged.
    Invoke this after init_process_emacs, and after glib and/or GNUstep
    futz with the SIGCHLD handler, but before Emacs forks any children.
@@ -7400,8 +8309,19 @@ init_process_emacs (void)
   FD_ZERO (&non_keyboard_wait_mask);
   FD_ZERO (&non_process_wait_mask);
   FD_ZERO (&write_mask);
+  FD_ZERO (&send_wait_mask);
+  num_pending_sends = 0;
   max_process_desc = max_input_desc = -1;
+#ifdef USE_EPOLL
+  epoll_fd = -1;
+  FD_ZERO (&epoll_read_set);
+  FD_ZERO (&epoll_write_set);
+  FD_ZERO (&epoll_always_ready);
+  num_epoll_always_ready = 0;
+  epoll_nfds = 0;
+#endif
   memset (fd_callback_info, 0, sizeof (fd_callback_info));
+  child_signal_init ();
 
 #ifdef NON_BLOCKING_CONNECT
   FD_ZERO (&connect_wait_mask);
@@ -7510,6 +8430,7 @@ syms_of_process (void)
   DEFSYM (QCstderr, ":stderr");
   DEFSYM (Qpty, "pty");
   DEFSYM (Qpipe, "pipe");
+  DEFSYM (Qignore, "ignore");
 
   DEFSYM (Qlast_nonmenu_event, "last-nonmenu-event");
 
@@ -7586,6 +8507,17 @@ non-nil value means that the delay is not reset on write.
 The variable takes effect when `start-process' is called.  */);
   Vprocess_adaptive_read_buffering = Qt;
 
+  DEFVAR_INT ("read-process-output-max", read_process_output_max,
+	      doc: /* Maximum number of bytes to read from a subprocess in one chunk.
+Emacs starts by reading a subprocess's output 4096 bytes at a time, and
+doubles the amount it asks for, up to this value, while the subprocess
+keeps producing output faster than Emacs reads it.  Each chunk is
+decoded and passed to the process filter in a single call, so a larger
+value means fewer filter calls for processes that produce a lot of
+output, at the cost of more memory per read.
+The variable takes effect when a process is created.  */);
+  read_process_output_max = 1024 * 1024;
+
   defsubr (&Sprocessp);
   defsubr (&Sget_process);
   defsubr (&Sdelete_process);
@@ -7624,8 +8556,11 @@ The variable takes effect when `start-process' is called.  */);
   defsubr (&Sset_process_datagram_address);
 #endif
   defsubr (&Saccept_process_output);
+  defsubr (&Scall_process_batch);
   defsubr (&Sprocess_send_region);
   defsubr (&Sprocess_send_string);
+  defsubr (&Sprocess_send_string_nowait);
+  defsubr (&Sprocess_send_queue_size);
   defsubr (&Sinterrupt_process);
   defsubr (&Skill_process);
   defsubr (&Squit_process);
@@ -7683,4 +8618,5 @@ The variable takes effect when `start-process' is called.  */);
   defsubr (&Sprocess_inherit_coding_system_flag);
   defsubr (&Slist_system_processes);
   defsubr (&Sprocess_attributes);
+  defsubr (&Snum_processors);
 }
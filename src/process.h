@@ -101,8 +101,10 @@ struct Lisp_Process
     /* Working buffer for encoding.  */
     Lisp_Object encoding_buf;
 
-    /* Queue for storing waiting writes.  */
-    Lisp_Object write_queue;
+    /* Functions to call once the data queued before them has been
+       written, as a list of (END . FUNCTION) ordered by END, the
+       value that send_total will have been written by then.  */
+    Lisp_Object send_callbacks;
 
 #ifdef HAVE_GNUTLS
     Lisp_Object gnutls_cred_type;
@@ -132,6 +134,14 @@ struct Lisp_Process
     EMACS_INT update_tick;
     /* Size of carryover in decoding.  */
     int decoding_carryover;
+    /* Data waiting to be written to outfd, in a circular buffer of
+       send_size bytes, of which send_len starting at send_head are in
+       use.  */
+    char *send_buf;
+    ptrdiff_t send_size, send_head, send_len;
+    /* Number of bytes ever sent to this process, whether already
+       written or still in send_buf.  */
+    EMACS_INT send_total;
     /* Hysteresis to try to read process output in larger blocks.
        On some systems, e.g. GNU/Linux, Emacs is seen as
        an interactive app also when reading process output, meaning
@@ -139,6 +149,11 @@ struct Lisp_Process
        time.  Value is nanoseconds to delay reading output from
        this process.  Range is 0 .. 50 * 1000 * 1000.  */
     int read_output_delay;
+    /* Number of bytes to ask for on the next read of this process's
+       output, and the most that number may grow to.  The latter is
+       initialized from `read-process-output-max'.  */
+    int read_output_size;
+    int read_output_max;
     /* Should we delay reading output from this process.
        Initialized from `Vprocess_adaptive_read_buffering'.
        0 = nil, 1 = t, 2 = other.  */
@@ -541,6 +541,14 @@ static regoff_t re_match_2_internal (struct re_pattern_buffer *bufp,
 				     ssize_t pos,
 				     struct re_registers *regs,
 				     ssize_t stop);
+#ifdef emacs
+static regoff_t re_search_2_nfa (struct re_pattern_buffer *bufp,
+				 re_char *string1, size_t size1,
+				 re_char *string2, size_t size2,
+				 ssize_t pos, ssize_t last,
+				 struct re_registers *regs,
+				 ssize_t stop, regoff_t *lenp);
+#endif
 
 /* These are the command codes that appear in compiled regular
    expressions.  Some opcodes are followed by argument bytes.  A
@@ -1327,6 +1335,12 @@ size_t re_max_failures = 40000;
 size_t re_max_failures = 4000;
 # endif
 
+#ifdef emacs
+/* Number of failure points re_match_2_internal pops before it leaves
+   a pattern that re_search_2_nfa can handle to that matcher.  */
+# define RE_NFA_FAILURE_LIMIT 100000
+#endif
+
 union fail_stack_elt
 {
   re_char *pointer;
@@ -4152,6 +4166,172 @@ analyze_first (const_re_char *p, const_re_char *pend, char *fastmap,
 
 } /* analyze_first */
 
+/* Return the address of the operation that follows the one at P.  */
+
+static re_char *
+skip_op (re_char *p)
+{
+  re_char *next = skip_one_char (p);
+
+  if (next)
+    return next;
+
+  switch (*p)
+    {
+    case start_memory:
+    case stop_memory:
+    case duplicate:
+      return p + 2;
+
+    case jump:
+    case on_failure_jump:
+    case on_failure_keep_string_jump:
+    case on_failure_jump_loop:
+    case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+      return p + 3;
+
+    case succeed_n:
+    case jump_n:
+    case set_number_at:
+      return p + 5;
+
+    default:
+      return p + 1;
+    }
+}
+
+/* Find a literal string that each match of the pattern in BUFP must
+   contain, and record it in the `must_offset', `must_len',
+   `must_prefix' and `must_ascii' fields of BUFP.
+
+   Only the operations that every match goes through are looked at.
+   Optional parts, loops and alternatives are stepped over by following
+   the jumps that regex_compile puts around them; a backward jump or an
+   interval ends the analysis.  When the pattern is to be matched with
+   a case table, only a single character whose case has no variants can
+   be used, as the other characters can match text with other bytes.  */
+
+static void
+analyze_must_literal (struct re_pattern_buffer *bufp)
+{
+  re_char *p = bufp->buffer;
+  re_char *pend = p + bufp->used;
+  boolean prefix = true;
+#ifdef emacs
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  Lisp_Object eqv_table = (RE_TRANSLATE_P (translate)
+			   ? XCHAR_TABLE (translate)->extras[2] : Qnil);
+#endif
+
+  bufp->must_len = 0;
+  bufp->must_prefix = 0;
+
+  while (p < pend)
+    {
+      re_char *next;
+      int mcnt;
+
+      switch (*p)
+	{
+	case exactn:
+	  next = p + 2 + p[1];
+#ifdef emacs
+	  if (!NILP (eqv_table))
+	    {
+	      /* Look for an ASCII character that matches only itself,
+		 preferring punctuation to letters and whitespace.  */
+	      re_char *q;
+
+	      if (!bufp->must_len)
+		for (q = p + 2; q < next; q++)
+		  if (IS_REAL_ASCII (*q) && ISGRAPH (*q)
+		      && RE_TRANSLATE (eqv_table, *q) == *q)
+		    {
+		      bufp->must_offset = q - bufp->buffer;
+		      bufp->must_len = 1;
+		      if (!ISALNUM (*q))
+			break;
+		    }
+	    }
+	  else
+#endif
+	  if (p[1] > bufp->must_len && !bufp->must_prefix)
+	    {
+	      bufp->must_offset = p + 2 - bufp->buffer;
+	      bufp->must_len = p[1];
+	      bufp->must_prefix = prefix;
+	    }
+	  prefix = false;
+	  p = next;
+	  break;
+
+	case jump:
+	  EXTRACT_NUMBER (mcnt, p + 1);
+	  if (mcnt < 0)
+	    goto done;
+	  p += 3 + mcnt;
+	  break;
+
+	case on_failure_jump:
+	case on_failure_keep_string_jump:
+	case on_failure_jump_loop:
+	case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  EXTRACT_NUMBER (mcnt, p + 1);
+	  if (mcnt < 0)
+	    goto done;
+	  next = p + 3 + mcnt;
+	  {
+	    /* NEXT is the end of an optional part or a loop, or the start
+	       of the next alternative.  In the last case, the operation
+	       before NEXT jumps past it, towards the end of the
+	       alternatives.  */
+	    re_char *q = p + 3, *last = NULL;
+
+	    while (q < next)
+	      last = q, q = skip_op (q);
+	    if (q != next)
+	      goto done;
+	    if (last && *last == jump)
+	      {
+		EXTRACT_NUMBER (mcnt, last + 1);
+		if (last + 3 + mcnt > next)
+		  next = last + 3 + mcnt;
+	      }
+	  }
+	  prefix = false;
+	  p = next;
+	  break;
+
+	case succeed_n:
+	case jump_n:
+	case set_number_at:
+	  goto done;
+
+	default:
+	  next = skip_one_char (p);
+	  if (next)
+	    prefix = false;
+	  else
+	    next = skip_op (p);
+	  p = next;
+	}
+    }
+
+ done:
+  if (bufp->must_len)
+    {
+      re_char *lit = bufp->buffer + bufp->must_offset;
+      int i;
+
+      bufp->must_ascii = 1;
+      for (i = 0; i < bufp->must_len; i++)
+	if (!IS_REAL_ASCII (lit[i]))
+	  bufp->must_ascii = 0;
+    }
+}
+
 /* re_compile_fastmap computes a ``fastmap'' for the compiled pattern in
    BUFP.  A fastmap records which of the (1 << BYTEWIDTH) possible
    characters can start a string that matches the pattern.  This fastmap
@@ -4164,8 +4344,8 @@ analyze_first (const_re_char *p, const_re_char *pend, char *fastmap,
    The caller must supply the address of a (1 << BYTEWIDTH)-byte data
    area as BUFP->fastmap.
 
-   We set the `fastmap', `fastmap_accurate', and `can_be_null' fields in
-   the pattern buffer.
+   We set the `fastmap', `fastmap_accurate', `can_be_null' and `must_*'
+   fields in the pattern buffer.
 
    Returns 0 if we succeed, -2 if an internal error.   */
 
@@ -4183,6 +4363,7 @@ re_compile_fastmap (struct re_pattern_buffer *bufp)
   analysis = analyze_first (bufp->buffer, bufp->buffer + bufp->used,
 			    fastmap, RE_MULTIBYTE_P (bufp));
   bufp->can_be_null = (analysis != 0);
+  analyze_must_literal (bufp);
   return 0;
 } /* re_compile_fastmap */
 
@@ -4240,6 +4421,96 @@ WEAK_ALIAS (__re_search, re_search)
 #define POS_ADDR_VSTRING(POS)					\
   (((POS) >= size1 ? string2 - size1 : string1) + (POS))
 
+/* Return the index of the byte among the LEN bytes at LIT that is
+   likely to be least frequent in text, judging from its class.  */
+
+static int
+rarest_byte (re_char *lit, int len)
+{
+  int i, best = 0, best_rank = -1;
+
+  for (i = 0; i < len; i++)
+    {
+      int c = lit[i];
+      int rank = (c == ' ' || c == '\t' || c == '\n' ? 0
+		  : (c >= 'a' && c <= 'z') || !IS_REAL_ASCII (c) ? 1
+		  : (c >= 'A' && c <= 'Z') || ISDIGIT (c) ? 2
+		  : 3);
+
+      if (rank > best_rank)
+	best = i, best_rank = rank;
+    }
+  return best;
+}
+
+/* Return the address of the first occurrence of the LEN bytes at LIT
+   among the SIZE bytes at P, or NULL if there is none.  RARE is the
+   index in LIT of the byte to look for with memchr.  */
+
+static re_char *
+find_literal (re_char *lit, int len, int rare, re_char *p, ssize_t size)
+{
+  re_char *q, *lim;
+
+  if (size < len)
+    return NULL;
+  lim = p + size - len + rare + 1;
+  for (q = p + rare; q < lim; q++)
+    {
+      q = memchr (q, lit[rare], lim - q);
+      if (!q)
+	return NULL;
+      if (memcmp (q - rare, lit, len) == 0)
+	return q - rare;
+    }
+  return NULL;
+}
+
+/* Return the position of the first occurrence of the LEN bytes at LIT
+   in the virtual concatenation of STRING1 and STRING2 that starts at or
+   after FROM and ends at or before LIMIT, or -1 if there is none.  */
+
+static ssize_t
+search_literal (re_char *lit, int len, int rare,
+		re_char *string1, ssize_t size1, re_char *string2,
+		ssize_t from, ssize_t limit)
+{
+  re_char *found;
+
+  if (from < size1)
+    {
+      ssize_t pos;
+
+      found = find_literal (lit, len, rare, string1 + from,
+			    min (limit, size1) - from);
+      if (found)
+	return found - string1;
+
+      /* Look for occurrences that straddle the two strings.  */
+      for (pos = max (from, size1 - len + 1);
+	   pos < size1 && pos + len <= limit; pos++)
+	{
+	  int i;
+
+	  for (i = 0; i < len; i++)
+	    if (*POS_ADDR_VSTRING (pos + i) != lit[i])
+	      break;
+	  if (i == len)
+	    return pos;
+	}
+      from = size1;
+    }
+
+  if (from < limit)
+    {
+      found = find_literal (lit, len, rare, string2 + (from - size1),
+			    limit - from);
+      if (found)
+	return found - string2 + size1;
+    }
+  return -1;
+}
+
 /* Using the compiled pattern in BUFP->buffer, first tries to match the
    virtual concatenation of STRING1 and STRING2, starting first at index
    STARTPOS, then at STARTPOS + 1, and so on.
@@ -4276,6 +4547,18 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
   boolean anchored_start;
   /* Nonzero if we are searching multibyte string.  */
   const boolean multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  /* The literal that every match contains, if we look for it, the
+     index of the byte in it to look for first, and the position of
+     its next occurrence.  */
+  re_char *must = NULL;
+  int must_rare;
+  ssize_t must_pos = -1;
+#ifdef emacs
+  /* Nonzero once the backtracking matcher has given up on this
+     pattern, so that we don't make it try again at each position.  */
+  boolean use_nfa = false;
+  regoff_t nfa_len;
+#endif
 
   /* Check for out-of-range STARTPOS.  */
   if (startpos < 0 || startpos > total_size)
@@ -4317,6 +4600,16 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
   /* See whether the pattern is anchored.  */
   anchored_start = (bufp->buffer[0] == begline);
 
+  /* In a forward search, if every match contains some literal text,
+     there is no need to try matching where that text doesn't follow.
+     If the text starts every match, go straight to its occurrences.  */
+  if (fastmap && bufp->must_len && range > 0
+      && (bufp->must_ascii || RE_MULTIBYTE_P (bufp) == multibyte))
+    {
+      must = bufp->buffer + bufp->must_offset;
+      must_rare = rarest_byte (must, bufp->must_len);
+    }
+
 #ifdef emacs
   gl_state.object = re_match_object; /* Used by SYNTAX_TABLE_BYTE_TO_CHAR. */
   {
@@ -4329,6 +4622,27 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
   /* Loop through the string, looking for a place to start matching.  */
   for (;;)
     {
+      if (must)
+	{
+	  if (must_pos < startpos)
+	    {
+	      ssize_t limit = min (stop, total_size);
+
+	      if (bufp->must_prefix)
+		limit = min (limit, startpos + range + bufp->must_len);
+	      must_pos = search_literal (must, bufp->must_len, must_rare,
+					 string1, size1, string2,
+					 startpos, limit);
+	      if (must_pos < 0)
+		return -1;
+	    }
+	  if (bufp->must_prefix)
+	    {
+	      range -= must_pos - startpos;
+	      startpos = must_pos;
+	    }
+	}
+
       /* If the pattern is anchored,
 	 skip quickly past places we cannot match.
 	 We don't bother to treat startpos == 0 specially
@@ -4445,8 +4759,30 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
 	  && !bufp->can_be_null)
 	return -1;
 
-      val = re_match_2_internal (bufp, string1, size1, string2, size2,
-				 startpos, regs, stop);
+#ifdef emacs
+      if (use_nfa)
+	val = re_search_2_nfa (bufp, string1, size1, string2, size2,
+			       startpos, startpos, regs, stop, &nfa_len);
+      else
+#endif
+	val = re_match_2_internal (bufp, string1, size1, string2, size2,
+				   startpos, regs, stop);
+
+#ifdef emacs
+      if (val < -1 && bufp->nfa && !use_nfa)
+	{
+	  /* The backtracker gave up.  Going forward, let the automaton
+	     scan the rest of the range in one pass; going backward,
+	     try it at each position from now on.  */
+	  if (range > 0)
+	    return re_search_2_nfa (bufp, string1, size1, string2, size2,
+				    startpos, startpos + range, regs, stop,
+				    &nfa_len);
+	  use_nfa = true;
+	  val = re_search_2_nfa (bufp, string1, size1, string2, size2,
+				 startpos, startpos, regs, stop, &nfa_len);
+	}
+#endif
 
       if (val >= 0)
 	return startpos;
@@ -4501,6 +4837,278 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
   return -1;
 } /* re_search_2 */
 WEAK_ALIAS (__re_search_2, re_search_2)
+
+#ifdef emacs
+
+/* Return the byte that the fastmap of a pattern compiled with
+   TRANSLATE must contain for a match to start at D, and set *LEN to
+   the length of the character at D.  MULTIBYTE says whether the text
+   is multibyte.  */
+
+static int
+fastmap_byte (re_char *d, boolean multibyte, RE_TRANSLATE_TYPE translate,
+	      int *len)
+{
+  re_wchar_t ch, translated;
+
+  if (!RE_TRANSLATE_P (translate) && IS_REAL_ASCII (*d))
+    {
+      *len = 1;
+      return *d;
+    }
+  if (multibyte)
+    {
+      ch = STRING_CHAR_AND_LENGTH (d, *len);
+      if (RE_TRANSLATE_P (translate))
+	ch = RE_TRANSLATE (translate, ch);
+      return CHAR_LEADING_CODE (ch);
+    }
+
+  *len = 1;
+  if (!RE_TRANSLATE_P (translate))
+    return *d;
+  ch = RE_CHAR_TO_MULTIBYTE (*d);
+  translated = RE_TRANSLATE (translate, ch);
+  if (translated != ch && (ch = RE_CHAR_TO_UNIBYTE (translated)) >= 0)
+    return ch;
+  return *d;
+}
+
+/* Like re_search_2 searching forward, but look for a match of any of
+   the N patterns in BUFPS at each position, and set *WHICH to the
+   index of the pattern that matched.  Where several patterns match at
+   the same position, the first of them wins.
+
+   The text is scanned only once, skipping positions where none of the
+   patterns can start a match according to their fastmaps, or for
+   patterns that start with a literal, according to where the literal
+   next occurs.  All the
+   patterns must have the same translation table and target.  */
+
+regoff_t
+re_search_2_any (struct re_pattern_buffer **bufps, int n,
+		 const char *str1, size_t size1,
+		 const char *str2, size_t size2, ssize_t startpos,
+		 ssize_t range, struct re_registers *regs, ssize_t stop,
+		 int *which)
+{
+  re_char *string1 = (re_char *) str1;
+  re_char *string2 = (re_char *) str2;
+  size_t total_size = size1 + size2;
+  RE_TRANSLATE_TYPE translate;
+  boolean multibyte;
+  /* The union of the fastmaps of the patterns that don't start with a
+     literal, with every byte set if one of them can match the empty
+     string, and whether there are such patterns.  */
+  char fastmap[1 << BYTEWIDTH];
+  boolean use_fastmap = false;
+  /* For each pattern that starts with a literal, the position of the
+     next occurrence of the literal, or if MUST_FOUND is false, a
+     position before which it doesn't occur.  Other patterns have a
+     MUST_NEXT of -1.  */
+  ssize_t *must_next;
+  boolean *must_found;
+  /* How far to look for each literal at a time.  Since the match is
+     usually found soon, this starts small and grows with each scan.  */
+  ssize_t *must_window;
+  /* For each pattern that the backtracking matcher gave up on, where
+     the automaton found that its next match starts, or PTRDIFF_MAX if
+     it has none; -1 for the other patterns.  */
+  ssize_t *nfa_next;
+  regoff_t nfa_len;
+  ssize_t i;
+  USE_SAFE_ALLOCA;
+
+  if (n == 0 || startpos < 0 || startpos > total_size)
+    return -1;
+  if (range < 0)
+    range = 0;
+  else if (startpos + range > total_size)
+    range = total_size - startpos;
+  stop = min (stop, total_size);
+
+  translate = bufps[0]->translate;
+  multibyte = RE_TARGET_MULTIBYTE_P (bufps[0]);
+
+  SAFE_NALLOCA (must_next, 1, n);
+  SAFE_NALLOCA (must_found, 1, n);
+  SAFE_NALLOCA (must_window, 1, n);
+  SAFE_NALLOCA (nfa_next, 1, n);
+  memset (fastmap, 0, sizeof fastmap);
+  for (i = 0; i < n; i++)
+    {
+      struct re_pattern_buffer *bufp = bufps[i];
+      size_t c;
+
+      nfa_next[i] = -1;
+
+      eassert (bufp->fastmap && EQ (bufp->translate, translate));
+      if (!bufp->fastmap_accurate)
+	re_compile_fastmap (bufp);
+
+      must_found[i] = false;
+      must_window[i] = 256;
+      if (bufp->must_len && bufp->must_prefix
+	  && (bufp->must_ascii || RE_MULTIBYTE_P (bufp) == multibyte))
+	must_next[i] = startpos;
+      else
+	{
+	  must_next[i] = -1;
+	  use_fastmap = true;
+	  if (bufp->can_be_null)
+	    memset (fastmap, 1, sizeof fastmap);
+	  else
+	    for (c = 0; c < sizeof fastmap; c += sizeof (size_t))
+	      {
+		size_t a, b;
+
+		memcpy (&a, fastmap + c, sizeof a);
+		memcpy (&b, bufp->fastmap + c, sizeof b);
+		a |= b;
+		memcpy (fastmap + c, &a, sizeof a);
+	      }
+	}
+    }
+
+  gl_state.object = re_match_object; /* Used by SYNTAX_TABLE_BYTE_TO_CHAR. */
+  {
+    ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (POS_AS_IN_BUFFER (startpos));
+
+    SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, charpos, 1);
+  }
+
+  for (;;)
+    {
+      ssize_t next = startpos + range + 1;
+      int c = -1, len = 1;
+
+      /* Find the next place where a literal might start a match.  */
+      for (i = 0; i < n; i++)
+	if (must_next[i] >= 0)
+	  {
+	    if (must_next[i] < startpos
+		|| (!must_found[i] && must_next[i] == startpos))
+	      {
+		struct re_pattern_buffer *bufp = bufps[i];
+		ssize_t limit = min (stop, startpos + range + bufp->must_len);
+		ssize_t pos = -1;
+
+		limit = min (limit, startpos + must_window[i] + bufp->must_len);
+		if (startpos + bufp->must_len <= limit)
+		  pos = search_literal (bufp->buffer + bufp->must_offset,
+					bufp->must_len,
+					rarest_byte (bufp->buffer
+						     + bufp->must_offset,
+						     bufp->must_len),
+					string1, size1, string2,
+					startpos, limit);
+		if (pos >= 0)
+		  must_next[i] = pos, must_found[i] = true;
+		else if (limit < min (stop, startpos + range + bufp->must_len))
+		  must_next[i] = limit - bufp->must_len + 1, must_found[i] = false;
+		else
+		  /* The literal doesn't occur any more.  */
+		  must_next[i] = PTRDIFF_MAX, must_found[i] = false;
+		must_window[i] = min (2 * must_window[i], 1 << 20);
+	      }
+	    next = min (next, must_next[i]);
+	  }
+
+      /* Skip quickly over places where no other pattern can match.  */
+      if (!use_fastmap)
+	{
+	  if (next > startpos + range)
+	    goto fail;
+	  if (next > startpos)
+	    {
+	      range -= next - startpos;
+	      startpos = next;
+	      continue;
+	    }
+	}
+      while (startpos < next && startpos < total_size)
+	{
+	  c = fastmap_byte (POS_ADDR_VSTRING (startpos), multibyte, translate,
+			    &len);
+	  if (fastmap[c])
+	    break;
+	  if (range < len)
+	    goto fail;
+	  range -= len;
+	  startpos += len;
+	}
+      if (startpos < total_size)
+	c = fastmap_byte (POS_ADDR_VSTRING (startpos), multibyte, translate,
+			  &len);
+      else
+	c = -1;
+
+      for (i = 0; i < n; i++)
+	{
+	  struct re_pattern_buffer *bufp = bufps[i];
+	  regoff_t val;
+
+	  if (must_next[i] >= 0
+	      ? !(must_found[i] && must_next[i] == startpos)
+	      : (!bufp->can_be_null && (c < 0 || !bufp->fastmap[c])))
+	    continue;
+	  if ((re_opcode_t) bufp->buffer[0] == begbuf && startpos > 0)
+	    continue;
+
+	  if (nfa_next[i] >= 0)
+	    {
+	      if (nfa_next[i] != startpos)
+		continue;
+	      val = re_search_2_nfa (bufp, string1, size1, string2, size2,
+				     startpos, startpos, regs, stop, &nfa_len);
+	    }
+	  else
+	    {
+	      val = re_match_2_internal (bufp, string1, size1, string2,
+					 size2, startpos, regs, stop);
+	      if (val < -1 && bufp->nfa)
+		{
+		  /* The backtracker gave up.  Let the automaton find
+		     where the next match of this pattern starts, in
+		     one pass over the rest of the range, and leave the
+		     pattern alone until then.  */
+		  val = re_search_2_nfa (bufp, string1, size1, string2, size2,
+					 startpos, startpos + range, regs,
+					 stop, &nfa_len);
+		  if (val == -1)
+		    nfa_next[i] = PTRDIFF_MAX;
+		  else if (val > startpos)
+		    {
+		      nfa_next[i] = val;
+		      val = -1;
+		    }
+		}
+	    }
+	  if (val >= 0)
+	    {
+	      *which = i;
+	      SAFE_FREE ();
+	      return startpos;
+	    }
+	  if (val == -2)
+	    {
+	      SAFE_FREE ();
+	      return -2;
+	    }
+	}
+
+      if (startpos == total_size || range < len)
+	break;
+      range -= len;
+      startpos += len;
+    }
+
+ fail:
+  SAFE_FREE ();
+  return -1;
+}
+
+#endif /* emacs */
 
 /* Declarations and macros for re_match_2.  */
 
@@ -4598,37 +5206,550 @@ static int bcmp_translate (re_char *s1, re_char *s2,
 #endif /* not MATCH_MAY_ALLOCATE */
 
 
-/* Optimization routines.  */
+/* Matching single opcodes.  These are shared by re_match_2_internal
+   and re_search_2_nfa, so that the two matchers agree on what each
+   opcode matches.  Their parameters are named after the variables of
+   re_match_2_internal, so that they can use the same macros.  */
 
-/* If the operation is a match against one or more chars,
-   return a pointer to the next operation, else return NULL.  */
+#ifdef emacs
+/* If the character at D matches the character of literal text at P
+   in the pattern of BUFP, return the address of the pattern text after
+   it and set *LEN to the length of the character at D.  Otherwise,
+   return NULL.  */
 static re_char *
-skip_one_char (const_re_char *p)
+match_literal_char (struct re_pattern_buffer *bufp, re_char *p,
+		    re_char *d, int *len)
 {
-  switch (*p++)
-    {
-    case anychar:
-      break;
-
-    case exactn:
-      p += *p + 1;
-      break;
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  const boolean multibyte = RE_MULTIBYTE_P (bufp);
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  int pat_charlen;
+  int pat_ch, buf_ch;
 
-    case charset_not:
-    case charset:
-      if (CHARSET_RANGE_TABLE_EXISTS_P (p - 1))
+  /* The cost of testing `translate' is comparatively small.  */
+  if (target_multibyte)
+    {
+      if (multibyte)
+	pat_ch = STRING_CHAR_AND_LENGTH (p, pat_charlen);
+      else
 	{
-	  int mcnt;
-	  p = CHARSET_RANGE_TABLE (p - 1);
-	  EXTRACT_NUMBER_AND_INCR (mcnt, p);
-	  p = CHARSET_RANGE_TABLE_END (p, mcnt);
+	  pat_ch = RE_CHAR_TO_MULTIBYTE (*p);
+	  pat_charlen = 1;
+	}
+      buf_ch = STRING_CHAR_AND_LENGTH (d, *len);
+      buf_ch = TRANSLATE (buf_ch);
+    }
+  else
+    {
+      if (multibyte)
+	{
+	  pat_ch = STRING_CHAR_AND_LENGTH (p, pat_charlen);
+	  pat_ch = RE_CHAR_TO_UNIBYTE (pat_ch);
 	}
       else
-	p += 1 + CHARSET_BITMAP_SIZE (p - 1);
-      break;
+	{
+	  pat_ch = *p;
+	  pat_charlen = 1;
+	}
+      buf_ch = RE_CHAR_TO_MULTIBYTE (*d);
+      if (! CHAR_BYTE8_P (buf_ch))
+	{
+	  buf_ch = TRANSLATE (buf_ch);
+	  buf_ch = RE_CHAR_TO_UNIBYTE (buf_ch);
+	  if (buf_ch < 0)
+	    buf_ch = *d;
+	}
+      else
+	buf_ch = *d;
+      *len = 1;
+    }
 
-    case syntaxspec:
-    case notsyntaxspec:
+  return buf_ch == pat_ch ? p + pat_charlen : NULL;
+}
+#endif /* emacs */
+
+/* The following functions return the address of the next opcode if
+   the character at D matches the opcode at P in the pattern of BUFP,
+   and set *LEN to the length of that character.  Otherwise, they
+   return NULL.  D must not be at the end of the text.  */
+
+/* Match any character except possibly a newline or a null.  */
+static re_char *
+match_anychar (struct re_pattern_buffer *bufp, re_char *p, re_char *d,
+	       int *len)
+{
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  re_wchar_t buf_ch = RE_STRING_CHAR_AND_LENGTH (d, *len,
+						 RE_TARGET_MULTIBYTE_P (bufp));
+
+  buf_ch = TRANSLATE (buf_ch);
+  if ((!(bufp->syntax & RE_DOT_NEWLINE) && buf_ch == '\n')
+      || ((bufp->syntax & RE_DOT_NOT_NULL) && buf_ch == '\000'))
+    return NULL;
+  return p + 1;
+}
+
+#ifdef emacs
+/* Return NOT if the character C, which was CORIG before translation,
+   is not in the range table of the `charset' or `charset_not' opcode
+   at P, and !NOT if it is.  */
+static boolean
+match_charset_range_table (re_char *p, unsigned int c, unsigned int corig,
+			   boolean not)
+{
+  re_char *range_table = CHARSET_RANGE_TABLE (p); /* Past the bitmap.  */
+  int class_bits = CHARSET_RANGE_TABLE_BITS (p);
+  int count;
+
+  EXTRACT_NUMBER_AND_INCR (count, range_table);
+  if (  (class_bits & BIT_LOWER
+	 && (ISLOWER (c)
+	     || (corig != c
+		 && c == upcase (corig) && ISUPPER(c))))
+      | (class_bits & BIT_MULTIBYTE)
+      | (class_bits & BIT_PUNCT && ISPUNCT (c))
+      | (class_bits & BIT_SPACE && ISSPACE (c))
+      | (class_bits & BIT_UPPER
+	 && (ISUPPER (c)
+	     || (corig != c
+		 && c == downcase (corig) && ISLOWER (c))))
+      | (class_bits & BIT_WORD  && ISWORD  (c))
+      | (class_bits & BIT_ALPHA && ISALPHA (c))
+      | (class_bits & BIT_ALNUM && ISALNUM (c))
+      | (class_bits & BIT_GRAPH && ISGRAPH (c))
+      | (class_bits & BIT_PRINT && ISPRINT (c)))
+    not = !not;
+  else
+    CHARSET_LOOKUP_RANGE_TABLE_RAW (not, c, range_table, count);
+  return not;
+}
+#endif /* emacs */
+
+/* Match a character in or not in a set.  */
+static re_char *
+match_charset (struct re_pattern_buffer *bufp, re_char *p, re_char *d,
+	       int *len)
+{
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  register unsigned int c, corig;
+  boolean not = (re_opcode_t) *p == charset_not;
+
+  /* Nonzero if there is a range table.  */
+  int range_table_exists = CHARSET_RANGE_TABLE_EXISTS_P (p);
+
+  /* Whether matching against a unibyte character.  */
+  boolean unibyte_char = false;
+
+  corig = c = RE_STRING_CHAR_AND_LENGTH (d, *len, target_multibyte);
+  if (target_multibyte)
+    {
+      int c1;
+
+      c = TRANSLATE (c);
+      c1 = RE_CHAR_TO_UNIBYTE (c);
+      if (c1 >= 0)
+	{
+	  unibyte_char = true;
+	  c = c1;
+	}
+    }
+  else
+    {
+      int c1 = RE_CHAR_TO_MULTIBYTE (c);
+
+      if (! CHAR_BYTE8_P (c1))
+	{
+	  c1 = TRANSLATE (c1);
+	  c1 = RE_CHAR_TO_UNIBYTE (c1);
+	  if (c1 >= 0)
+	    {
+	      unibyte_char = true;
+	      c = c1;
+	    }
+	}
+      else
+	unibyte_char = true;
+    }
+
+  if (unibyte_char && c < (1 << BYTEWIDTH))
+    {			/* Lookup bitmap.  */
+      /* Cast to `unsigned' instead of `unsigned char' in
+	 case the bit list is a full 32 bytes long.  */
+      if (c < (unsigned) (CHARSET_BITMAP_SIZE (p) * BYTEWIDTH)
+	  && p[2 + c / BYTEWIDTH] & (1 << (c % BYTEWIDTH)))
+	not = !not;
+    }
+#ifdef emacs
+  else if (range_table_exists)
+    not = match_charset_range_table (p, c, corig, not);
+#endif /* emacs */
+
+  if (!not)
+    return NULL;
+
+  if (range_table_exists)
+    {
+      re_char *range_table = CHARSET_RANGE_TABLE (p);
+      int count;
+
+      EXTRACT_NUMBER_AND_INCR (count, range_table);
+      return CHARSET_RANGE_TABLE_END (range_table, count);
+    }
+  return p + CHARSET_BITMAP_SIZE (p) + 2;
+}
+
+/* Match a character with or without a syntax class, or, in Emacs, a
+   category.  */
+static re_char *
+match_syntax_or_category (struct re_pattern_buffer *bufp, re_char *p,
+			  re_char *d, int *len, re_char *string1,
+			  size_t size1, re_char *string2)
+{
+#ifdef emacs
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+#endif
+  re_opcode_t op = *p;
+  re_wchar_t c;
+
+  GET_CHAR_AFTER (c, d, *len);
+  switch (op)
+    {
+    case syntaxspec:
+    case notsyntaxspec:
+#ifdef emacs
+      {
+	ssize_t offset = PTR_TO_OFFSET (d);
+	ssize_t pos1 = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
+	UPDATE_SYNTAX_TABLE_FAST (pos1);
+      }
+#endif
+      if ((SYNTAX (c) != (enum syntaxcode) p[1]) ^ (op == notsyntaxspec))
+	return NULL;
+      break;
+
+#ifdef emacs
+    case categoryspec:
+    case notcategoryspec:
+      if ((!CHAR_HAS_CATEGORY (c, p[1])) ^ (op == notcategoryspec))
+	return NULL;
+      break;
+#endif /* emacs */
+
+    default:
+      abort ();
+    }
+  return p + 2;
+}
+
+/* Return true if the opcode OP of BUFP, which must match the empty
+   string, matches at D.  DEND and END_MATCH_2 are as in
+   re_match_2_internal, and tell whether the text after D may be
+   looked at.  */
+static boolean
+match_zero_width (struct re_pattern_buffer *bufp, re_opcode_t op,
+		  re_char *d, re_char *dend, re_char *end_match_2,
+		  re_char *string1, size_t size1,
+		  re_char *string2, size_t size2)
+{
+  re_char *end1 = string1 + size1;
+  re_char *end2 = string2 + size2;
+#ifdef emacs
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+#endif
+
+  switch (op)
+    {
+    /* begline matches the empty string at the beginning of the string
+       (unless `not_bol' is set in `bufp'), and after newlines.  */
+    case begline:
+      if (AT_STRINGS_BEG (d))
+	return !bufp->not_bol;
+      else
+	{
+	  unsigned c;
+	  GET_CHAR_BEFORE_2 (c, d, string1, end1, string2, end2);
+	  return c == '\n';
+	}
+
+    /* endline is the dual of begline.  */
+    case endline:
+      if (AT_STRINGS_END (d))
+	return !bufp->not_eol;
+      else
+	{
+	  PREFETCH_NOLIMIT ();
+	  return *d == '\n';
+	}
+
+    /* Match at the very beginning of the data.  */
+    case begbuf:
+      return AT_STRINGS_BEG (d);
+
+    /* Match at the very end of the data.  */
+    case endbuf:
+      return AT_STRINGS_END (d);
+
+    case wordbound:
+    case notwordbound:
+      {
+	boolean not = op == notwordbound;
+
+	/* We SUCCEED (or FAIL) in one of the following cases: */
+
+	/* Case 1: D is at the beginning or the end of string.  */
+	if (AT_STRINGS_BEG (d) || AT_STRINGS_END (d))
+	  not = !not;
+	else
+	  {
+	    /* C1 is the character before D, S1 is the syntax of C1, C2
+	       is the character at D, and S2 is the syntax of C2.  */
+	    re_wchar_t c1, c2;
+	    int s1, s2;
+	    int dummy;
+#ifdef emacs
+	    ssize_t offset = PTR_TO_OFFSET (d - 1);
+	    ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
+	    UPDATE_SYNTAX_TABLE_FAST (charpos);
+#endif
+	    GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+	    s1 = SYNTAX (c1);
+#ifdef emacs
+	    UPDATE_SYNTAX_TABLE_FORWARD_FAST (charpos + 1);
+#endif
+	    PREFETCH_NOLIMIT ();
+	    GET_CHAR_AFTER (c2, d, dummy);
+	    s2 = SYNTAX (c2);
+
+	    if (/* Case 2: Only one of S1 and S2 is Sword.  */
+		((s1 == Sword) != (s2 == Sword))
+		/* Case 3: Both of S1 and S2 are Sword, and macro
+		   WORD_BOUNDARY_P (C1, C2) returns nonzero.  */
+		|| ((s1 == Sword) && WORD_BOUNDARY_P (c1, c2)))
+	      not = !not;
+	  }
+	return not;
+      }
+
+    case wordbeg:
+      /* We FAIL in one of the following cases: */
+
+      /* Case 1: D is at the end of string.  */
+      if (AT_STRINGS_END (d))
+	return false;
+      else
+	{
+	  /* C1 is the character before D, S1 is the syntax of C1, C2
+	     is the character at D, and S2 is the syntax of C2.  */
+	  re_wchar_t c1, c2;
+	  int s1, s2;
+	  int dummy;
+#ifdef emacs
+	  ssize_t offset = PTR_TO_OFFSET (d);
+	  ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
+	  UPDATE_SYNTAX_TABLE_FAST (charpos);
+#endif
+	  PREFETCH ();
+	  GET_CHAR_AFTER (c2, d, dummy);
+	  s2 = SYNTAX (c2);
+
+	  /* Case 2: S2 is not Sword. */
+	  if (s2 != Sword)
+	    return false;
+
+	  /* Case 3: D is not at the beginning of string ... */
+	  if (!AT_STRINGS_BEG (d))
+	    {
+	      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+#ifdef emacs
+	      UPDATE_SYNTAX_TABLE_BACKWARD (charpos - 1);
+#endif
+	      s1 = SYNTAX (c1);
+
+	      /* ... and S1 is Sword, and WORD_BOUNDARY_P (C1, C2)
+		 returns 0.  */
+	      if ((s1 == Sword) && !WORD_BOUNDARY_P (c1, c2))
+		return false;
+	    }
+	}
+      return true;
+
+    case wordend:
+      /* We FAIL in one of the following cases: */
+
+      /* Case 1: D is at the beginning of string.  */
+      if (AT_STRINGS_BEG (d))
+	return false;
+      else
+	{
+	  /* C1 is the character before D, S1 is the syntax of C1, C2
+	     is the character at D, and S2 is the syntax of C2.  */
+	  re_wchar_t c1, c2;
+	  int s1, s2;
+	  int dummy;
+#ifdef emacs
+	  ssize_t offset = PTR_TO_OFFSET (d) - 1;
+	  ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
+	  UPDATE_SYNTAX_TABLE_FAST (charpos);
+#endif
+	  GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+	  s1 = SYNTAX (c1);
+
+	  /* Case 2: S1 is not Sword.  */
+	  if (s1 != Sword)
+	    return false;
+
+	  /* Case 3: D is not at the end of string ... */
+	  if (!AT_STRINGS_END (d))
+	    {
+	      PREFETCH_NOLIMIT ();
+	      GET_CHAR_AFTER (c2, d, dummy);
+#ifdef emacs
+	      UPDATE_SYNTAX_TABLE_FORWARD_FAST (charpos);
+#endif
+	      s2 = SYNTAX (c2);
+
+	      /* ... and S2 is Sword, and WORD_BOUNDARY_P (C1, C2)
+		 returns 0.  */
+	      if ((s2 == Sword) && !WORD_BOUNDARY_P (c1, c2))
+		return false;
+	    }
+	}
+      return true;
+
+    case symbeg:
+      /* We FAIL in one of the following cases: */
+
+      /* Case 1: D is at the end of string.  */
+      if (AT_STRINGS_END (d))
+	return false;
+      else
+	{
+	  /* C1 is the character before D, S1 is the syntax of C1, C2
+	     is the character at D, and S2 is the syntax of C2.  */
+	  re_wchar_t c1, c2;
+	  int s1, s2;
+#ifdef emacs
+	  ssize_t offset = PTR_TO_OFFSET (d);
+	  ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
+	  UPDATE_SYNTAX_TABLE_FAST (charpos);
+#endif
+	  PREFETCH ();
+	  c2 = RE_STRING_CHAR (d, target_multibyte);
+	  s2 = SYNTAX (c2);
+
+	  /* Case 2: S2 is neither Sword nor Ssymbol. */
+	  if (s2 != Sword && s2 != Ssymbol)
+	    return false;
+
+	  /* Case 3: D is not at the beginning of string ... */
+	  if (!AT_STRINGS_BEG (d))
+	    {
+	      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+#ifdef emacs
+	      UPDATE_SYNTAX_TABLE_BACKWARD (charpos - 1);
+#endif
+	      s1 = SYNTAX (c1);
+
+	      /* ... and S1 is Sword or Ssymbol.  */
+	      if (s1 == Sword || s1 == Ssymbol)
+		return false;
+	    }
+	}
+      return true;
+
+    case symend:
+      /* We FAIL in one of the following cases: */
+
+      /* Case 1: D is at the beginning of string.  */
+      if (AT_STRINGS_BEG (d))
+	return false;
+      else
+	{
+	  /* C1 is the character before D, S1 is the syntax of C1, C2
+	     is the character at D, and S2 is the syntax of C2.  */
+	  re_wchar_t c1, c2;
+	  int s1, s2;
+#ifdef emacs
+	  ssize_t offset = PTR_TO_OFFSET (d) - 1;
+	  ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
+	  UPDATE_SYNTAX_TABLE_FAST (charpos);
+#endif
+	  GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+	  s1 = SYNTAX (c1);
+
+	  /* Case 2: S1 is neither Ssymbol nor Sword.  */
+	  if (s1 != Sword && s1 != Ssymbol)
+	    return false;
+
+	  /* Case 3: D is not at the end of string ... */
+	  if (!AT_STRINGS_END (d))
+	    {
+	      PREFETCH_NOLIMIT ();
+	      c2 = RE_STRING_CHAR (d, target_multibyte);
+#ifdef emacs
+	      UPDATE_SYNTAX_TABLE_FORWARD_FAST (charpos + 1);
+#endif
+	      s2 = SYNTAX (c2);
+
+	      /* ... and S2 is Sword or Ssymbol.  */
+	      if (s2 == Sword || s2 == Ssymbol)
+		return false;
+	    }
+	}
+      return true;
+
+#ifdef emacs
+    case before_dot:
+      return PTR_BYTE_POS (d) < PT_BYTE;
+
+    case at_dot:
+      return PTR_BYTE_POS (d) == PT_BYTE;
+
+    case after_dot:
+      return PTR_BYTE_POS (d) > PT_BYTE;
+#endif /* emacs */
+
+    default:
+      abort ();
+    }
+
+  /* PREFETCH comes here when the text after D may not be looked at.  */
+ fail:
+  return false;
+}
+
+/* Optimization routines.  */
+
+/* If the operation is a match against one or more chars,
+   return a pointer to the next operation, else return NULL.  */
+static re_char *
+skip_one_char (const_re_char *p)
+{
+  switch (*p++)
+    {
+    case anychar:
+      break;
+
+    case exactn:
+      p += *p + 1;
+      break;
+
+    case charset_not:
+    case charset:
+      if (CHARSET_RANGE_TABLE_EXISTS_P (p - 1))
+	{
+	  int mcnt;
+	  p = CHARSET_RANGE_TABLE (p - 1);
+	  EXTRACT_NUMBER_AND_INCR (mcnt, p);
+	  p = CHARSET_RANGE_TABLE_END (p, mcnt);
+	}
+      else
+	p += 1 + CHARSET_BITMAP_SIZE (p - 1);
+      break;
+
+    case syntaxspec:
+    case notsyntaxspec:
 #ifdef emacs
     case categoryspec:
     case notcategoryspec:
@@ -4924,11 +6045,65 @@ re_match_2 (struct re_pattern_buffer *bufp, const char *string1,
   result = re_match_2_internal (bufp, (re_char*) string1, size1,
 				(re_char*) string2, size2,
 				pos, regs, stop);
+#ifdef emacs
+  if (result < -1 && bufp->nfa)
+    {
+      regoff_t len;
+
+      result = re_search_2_nfa (bufp, (re_char*) string1, size1,
+				(re_char*) string2, size2,
+				pos, pos, regs, stop, &len);
+      if (result >= 0)
+	result = len;
+    }
+#endif
   return result;
 }
 WEAK_ALIAS (__re_match_2, re_match_2)
 
 
+/* Make sure REGS has room for the NUM_REGS registers of a match of
+   BUFP, plus the `-1' marker GNU code uses, allocating or growing
+   them as BUFP->regs_allocated says.  Return zero if memory is
+   exhausted.  */
+static boolean
+allocate_match_registers (struct re_pattern_buffer *bufp,
+			  struct re_registers *regs, size_t num_regs)
+{
+  /* Have the register data arrays been allocated?	*/
+  if (bufp->regs_allocated == REGS_UNALLOCATED)
+    { /* No.  So allocate them with malloc.  We need one
+	 extra element beyond `num_regs' for the `-1' marker
+	 GNU code uses.  */
+      regs->num_regs = max (RE_NREGS, num_regs + 1);
+      regs->start = TALLOC (regs->num_regs, regoff_t);
+      regs->end = TALLOC (regs->num_regs, regoff_t);
+      if (regs->start == NULL || regs->end == NULL)
+	return false;
+      bufp->regs_allocated = REGS_REALLOCATE;
+    }
+  else if (bufp->regs_allocated == REGS_REALLOCATE)
+    { /* Yes.  If we need more elements than were already
+	 allocated, reallocate them.  If we need fewer, just
+	 leave it alone.  */
+      if (regs->num_regs < num_regs + 1)
+	{
+	  regs->num_regs = num_regs + 1;
+	  RETALLOC (regs->start, regs->num_regs, regoff_t);
+	  RETALLOC (regs->end, regs->num_regs, regoff_t);
+	  if (regs->start == NULL || regs->end == NULL)
+	    return false;
+	}
+    }
+  else
+    {
+      /* These braces fend off a "empty body in an else-statement"
+	 warning under GCC when assert expands to nothing.  */
+      assert (bufp->regs_allocated == REGS_FIXED);
+    }
+  return true;
+}
+
 /* This is a separate function so that we can force an alloca cleanup
    afterwards.  */
 static regoff_t
@@ -4963,9 +6138,6 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
   /* We use this to map every character in the string.	*/
   RE_TRANSLATE_TYPE translate = bufp->translate;
 
-  /* Nonzero if BUFP is setup from a multibyte regex.  */
-  const boolean multibyte = RE_MULTIBYTE_P (bufp);
-
   /* Nonzero if STRING1/STRING2 are multibyte.  */
   const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
 
@@ -5029,6 +6201,11 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
   unsigned num_regs_pushed = 0;
 #endif
 
+#ifdef emacs
+  /* Number of failure points popped so far.  */
+  size_t nfailures = 0;
+#endif
+
   DEBUG_PRINT ("\n\nEntering re_match_2.\n");
 
   REGEX_USE_SAFE_ALLOCA;
@@ -5218,42 +6395,10 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
 	  /* If caller wants register contents data back, do it.  */
 	  if (regs && !bufp->no_sub)
 	    {
-	      /* Have the register data arrays been allocated?	*/
-	      if (bufp->regs_allocated == REGS_UNALLOCATED)
-		{ /* No.  So allocate them with malloc.  We need one
-		     extra element beyond `num_regs' for the `-1' marker
-		     GNU code uses.  */
-		  regs->num_regs = max (RE_NREGS, num_regs + 1);
-		  regs->start = TALLOC (regs->num_regs, regoff_t);
-		  regs->end = TALLOC (regs->num_regs, regoff_t);
-		  if (regs->start == NULL || regs->end == NULL)
-		    {
-		      FREE_VARIABLES ();
-		      return -2;
-		    }
-		  bufp->regs_allocated = REGS_REALLOCATE;
-		}
-	      else if (bufp->regs_allocated == REGS_REALLOCATE)
-		{ /* Yes.  If we need more elements than were already
-		     allocated, reallocate them.  If we need fewer, just
-		     leave it alone.  */
-		  if (regs->num_regs < num_regs + 1)
-		    {
-		      regs->num_regs = num_regs + 1;
-		      RETALLOC (regs->start, regs->num_regs, regoff_t);
-		      RETALLOC (regs->end, regs->num_regs, regoff_t);
-		      if (regs->start == NULL || regs->end == NULL)
-			{
-			  FREE_VARIABLES ();
-			  return -2;
-			}
-		    }
-		}
-	      else
+	      if (!allocate_match_registers (bufp, regs, num_regs))
 		{
-		  /* These braces fend off a "empty body in an else-statement"
-		     warning under GCC when assert expands to nothing.  */
-		  assert (bufp->regs_allocated == REGS_FIXED);
+		  FREE_VARIABLES ();
+		  return -2;
 		}
 
 	      /* Convert the pointer data in `regstart' and `regend' to
@@ -5350,70 +6495,23 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
 	      }
 	    while (--mcnt);
 #else  /* emacs */
-	  /* The cost of testing `translate' is comparatively small.  */
-	  if (target_multibyte)
-	    do
-	      {
-		int pat_charlen, buf_charlen;
-		int pat_ch, buf_ch;
-
-		PREFETCH ();
-		if (multibyte)
-		  pat_ch = STRING_CHAR_AND_LENGTH (p, pat_charlen);
-		else
-		  {
-		    pat_ch = RE_CHAR_TO_MULTIBYTE (*p);
-		    pat_charlen = 1;
-		  }
-		buf_ch = STRING_CHAR_AND_LENGTH (d, buf_charlen);
-
-		if (TRANSLATE (buf_ch) != pat_ch)
-		  {
-		    d = dfail;
-		    goto fail;
-		  }
-
-		p += pat_charlen;
-		d += buf_charlen;
-		mcnt -= pat_charlen;
-	      }
-	    while (mcnt > 0);
-	  else
-	    do
-	      {
-		int pat_charlen;
-		int pat_ch, buf_ch;
+	  do
+	    {
+	      re_char *next;
+	      int buf_charlen;
 
-		PREFETCH ();
-		if (multibyte)
-		  {
-		    pat_ch = STRING_CHAR_AND_LENGTH (p, pat_charlen);
-		    pat_ch = RE_CHAR_TO_UNIBYTE (pat_ch);
-		  }
-		else
-		  {
-		    pat_ch = *p;
-		    pat_charlen = 1;
-		  }
-		buf_ch = RE_CHAR_TO_MULTIBYTE (*d);
-		if (! CHAR_BYTE8_P (buf_ch))
-		  {
-		    buf_ch = TRANSLATE (buf_ch);
-		    buf_ch = RE_CHAR_TO_UNIBYTE (buf_ch);
-		    if (buf_ch < 0)
-		      buf_ch = *d;
-		  }
-		else
-		  buf_ch = *d;
-		if (buf_ch != pat_ch)
-		  {
-		    d = dfail;
-		    goto fail;
-		  }
-		p += pat_charlen;
-		d++;
-	      }
-	    while (--mcnt);
+	      PREFETCH ();
+	      next = match_literal_char (bufp, p, d, &buf_charlen);
+	      if (!next)
+		{
+		  d = dfail;
+		  goto fail;
+		}
+	      d += buf_charlen;
+	      mcnt -= target_multibyte ? next - p : 1;
+	      p = next;
+	    }
+	  while (mcnt > 0);
 #endif
 	  break;
 
@@ -5421,24 +6519,17 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
 	/* Match any character except possibly a newline or a null.  */
 	case anychar:
 	  {
-	    int buf_charlen;
-	    re_wchar_t buf_ch;
+	    int len;
 
 	    DEBUG_PRINT ("EXECUTING anychar.\n");
 
 	    PREFETCH ();
-	    buf_ch = RE_STRING_CHAR_AND_LENGTH (d, buf_charlen,
-						target_multibyte);
-	    buf_ch = TRANSLATE (buf_ch);
-
-	    if ((!(bufp->syntax & RE_DOT_NEWLINE)
-		 && buf_ch == '\n')
-		|| ((bufp->syntax & RE_DOT_NOT_NULL)
-		    && buf_ch == '\000'))
+	    p = match_anychar (bufp, p - 1, d, &len);
+	    if (!p)
 	      goto fail;
 
 	    DEBUG_PRINT ("  Matched \"%d\".\n", *d);
-	    d += buf_charlen;
+	    d += len;
 	  }
 	  break;
 
@@ -5446,108 +6537,15 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
 	case charset:
 	case charset_not:
 	  {
-	    register unsigned int c, corig;
-	    boolean not = (re_opcode_t) *(p - 1) == charset_not;
 	    int len;
 
-	    /* Start of actual range_table, or end of bitmap if there is no
-	       range table.  */
-	    re_char *range_table IF_LINT (= NULL);
-
-	    /* Nonzero if there is a range table.  */
-	    int range_table_exists;
-
-	    /* Number of ranges of range table.  This is not included
-	       in the initial byte-length of the command.  */
-	    int count = 0;
-
-	    /* Whether matching against a unibyte character.  */
-	    boolean unibyte_char = false;
-
-	    DEBUG_PRINT ("EXECUTING charset%s.\n", not ? "_not" : "");
-
-	    range_table_exists = CHARSET_RANGE_TABLE_EXISTS_P (&p[-1]);
-
-	    if (range_table_exists)
-	      {
-		range_table = CHARSET_RANGE_TABLE (&p[-1]); /* Past the bitmap.  */
-		EXTRACT_NUMBER_AND_INCR (count, range_table);
-	      }
+	    DEBUG_PRINT ("EXECUTING charset%s.\n",
+			 p[-1] == charset_not ? "_not" : "");
 
 	    PREFETCH ();
-	    corig = c = RE_STRING_CHAR_AND_LENGTH (d, len, target_multibyte);
-	    if (target_multibyte)
-	      {
-		int c1;
-
-		c = TRANSLATE (c);
-		c1 = RE_CHAR_TO_UNIBYTE (c);
-		if (c1 >= 0)
-		  {
-		    unibyte_char = true;
-		    c = c1;
-		  }
-	      }
-	    else
-	      {
-		int c1 = RE_CHAR_TO_MULTIBYTE (c);
-
-		if (! CHAR_BYTE8_P (c1))
-		  {
-		    c1 = TRANSLATE (c1);
-		    c1 = RE_CHAR_TO_UNIBYTE (c1);
-		    if (c1 >= 0)
-		      {
-			unibyte_char = true;
-			c = c1;
-		      }
-		  }
-		else
-		  unibyte_char = true;
-	      }
-
-	    if (unibyte_char && c < (1 << BYTEWIDTH))
-	      {			/* Lookup bitmap.  */
-		/* Cast to `unsigned' instead of `unsigned char' in
-		   case the bit list is a full 32 bytes long.  */
-		if (c < (unsigned) (CHARSET_BITMAP_SIZE (&p[-1]) * BYTEWIDTH)
-		    && p[1 + c / BYTEWIDTH] & (1 << (c % BYTEWIDTH)))
-		  not = !not;
-	      }
-#ifdef emacs
-	    else if (range_table_exists)
-	      {
-		int class_bits = CHARSET_RANGE_TABLE_BITS (&p[-1]);
-
-		if (  (class_bits & BIT_LOWER
-		       && (ISLOWER (c)
-			   || (corig != c
-			       && c == upcase (corig) && ISUPPER(c))))
-		    | (class_bits & BIT_MULTIBYTE)
-		    | (class_bits & BIT_PUNCT && ISPUNCT (c))
-		    | (class_bits & BIT_SPACE && ISSPACE (c))
-		    | (class_bits & BIT_UPPER
-		       && (ISUPPER (c)
-			   || (corig != c
-			       && c == downcase (corig) && ISLOWER (c))))
-		    | (class_bits & BIT_WORD  && ISWORD  (c))
-		    | (class_bits & BIT_ALPHA && ISALPHA (c))
-		    | (class_bits & BIT_ALNUM && ISALNUM (c))
-		    | (class_bits & BIT_GRAPH && ISGRAPH (c))
-		    | (class_bits & BIT_PRINT && ISPRINT (c)))
-		  not = !not;
-		else
-		  CHARSET_LOOKUP_RANGE_TABLE_RAW (not, c, range_table, count);
-	      }
-#endif /* emacs */
-
-	    if (range_table_exists)
-	      p = CHARSET_RANGE_TABLE_END (range_table, count);
-	    else
-	      p += CHARSET_BITMAP_SIZE (&p[-1]) + 1;
-
-	    if (!not) goto fail;
-
+	    p = match_charset (bufp, p - 1, d, &len);
+	    if (!p)
+	      goto fail;
 	    d += len;
 	  }
 	  break;
@@ -5670,55 +6668,18 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
 	  break;
 
 
-	/* begline matches the empty string at the beginning of the string
-	   (unless `not_bol' is set in `bufp'), and after newlines.  */
+	/* Match the empty string at the beginning or end of a line or
+	   of the data.  */
 	case begline:
-	  DEBUG_PRINT ("EXECUTING begline.\n");
-
-	  if (AT_STRINGS_BEG (d))
-	    {
-	      if (!bufp->not_bol) break;
-	    }
-	  else
-	    {
-	      unsigned c;
-	      GET_CHAR_BEFORE_2 (c, d, string1, end1, string2, end2);
-	      if (c == '\n')
-		break;
-	    }
-	  /* In all other cases, we fail.  */
-	  goto fail;
-
-
-	/* endline is the dual of begline.  */
 	case endline:
-	  DEBUG_PRINT ("EXECUTING endline.\n");
-
-	  if (AT_STRINGS_END (d))
-	    {
-	      if (!bufp->not_eol) break;
-	    }
-	  else
-	    {
-	      PREFETCH_NOLIMIT ();
-	      if (*d == '\n')
-		break;
-	    }
-	  goto fail;
-
-
-	/* Match at the very beginning of the data.  */
 	case begbuf:
-	  DEBUG_PRINT ("EXECUTING begbuf.\n");
-	  if (AT_STRINGS_BEG (d))
-	    break;
-	  goto fail;
-
-
-	/* Match at the very end of the data.  */
 	case endbuf:
-	  DEBUG_PRINT ("EXECUTING endbuf.\n");
-	  if (AT_STRINGS_END (d))
+	  DEBUG_PRINT ("EXECUTING %s.\n",
+		       p[-1] == begline ? "begline"
+		       : p[-1] == endline ? "endline"
+		       : p[-1] == begbuf ? "begbuf" : "endbuf");
+	  if (match_zero_width (bufp, p[-1], d, dend, end_match_2,
+				string1, size1, string2, size2))
 	    break;
 	  goto fail;
 
@@ -5932,295 +6893,47 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
 	    break;
 	  }
 
+	/* Match the empty string at or not at a word or symbol
+	   boundary, or before, at or after point.  */
 	case wordbound:
 	case notwordbound:
-	  {
-	    boolean not = (re_opcode_t) *(p - 1) == notwordbound;
-	    DEBUG_PRINT ("EXECUTING %swordbound.\n", not ? "not" : "");
-
-	    /* We SUCCEED (or FAIL) in one of the following cases: */
-
-	    /* Case 1: D is at the beginning or the end of string.  */
-	    if (AT_STRINGS_BEG (d) || AT_STRINGS_END (d))
-	      not = !not;
-	    else
-	      {
-		/* C1 is the character before D, S1 is the syntax of C1, C2
-		   is the character at D, and S2 is the syntax of C2.  */
-		re_wchar_t c1, c2;
-		int s1, s2;
-		int dummy;
-#ifdef emacs
-		ssize_t offset = PTR_TO_OFFSET (d - 1);
-		ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
-		UPDATE_SYNTAX_TABLE_FAST (charpos);
-#endif
-		GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
-		s1 = SYNTAX (c1);
-#ifdef emacs
-		UPDATE_SYNTAX_TABLE_FORWARD_FAST (charpos + 1);
-#endif
-		PREFETCH_NOLIMIT ();
-		GET_CHAR_AFTER (c2, d, dummy);
-		s2 = SYNTAX (c2);
-
-		if (/* Case 2: Only one of S1 and S2 is Sword.  */
-		    ((s1 == Sword) != (s2 == Sword))
-		    /* Case 3: Both of S1 and S2 are Sword, and macro
-		       WORD_BOUNDARY_P (C1, C2) returns nonzero.  */
-		    || ((s1 == Sword) && WORD_BOUNDARY_P (c1, c2)))
-		  not = !not;
-	      }
-	    if (not)
-	      break;
-	    else
-	      goto fail;
-	  }
-
 	case wordbeg:
-	  DEBUG_PRINT ("EXECUTING wordbeg.\n");
-
-	  /* We FAIL in one of the following cases: */
-
-	  /* Case 1: D is at the end of string.  */
-	  if (AT_STRINGS_END (d))
-	    goto fail;
-	  else
-	    {
-	      /* C1 is the character before D, S1 is the syntax of C1, C2
-		 is the character at D, and S2 is the syntax of C2.  */
-	      re_wchar_t c1, c2;
-	      int s1, s2;
-	      int dummy;
-#ifdef emacs
-	      ssize_t offset = PTR_TO_OFFSET (d);
-	      ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
-	      UPDATE_SYNTAX_TABLE_FAST (charpos);
-#endif
-	      PREFETCH ();
-	      GET_CHAR_AFTER (c2, d, dummy);
-	      s2 = SYNTAX (c2);
-
-	      /* Case 2: S2 is not Sword. */
-	      if (s2 != Sword)
-		goto fail;
-
-	      /* Case 3: D is not at the beginning of string ... */
-	      if (!AT_STRINGS_BEG (d))
-		{
-		  GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
-#ifdef emacs
-		  UPDATE_SYNTAX_TABLE_BACKWARD (charpos - 1);
-#endif
-		  s1 = SYNTAX (c1);
-
-		  /* ... and S1 is Sword, and WORD_BOUNDARY_P (C1, C2)
-		     returns 0.  */
-		  if ((s1 == Sword) && !WORD_BOUNDARY_P (c1, c2))
-		    goto fail;
-		}
-	    }
-	  break;
-
 	case wordend:
-	  DEBUG_PRINT ("EXECUTING wordend.\n");
-
-	  /* We FAIL in one of the following cases: */
-
-	  /* Case 1: D is at the beginning of string.  */
-	  if (AT_STRINGS_BEG (d))
-	    goto fail;
-	  else
-	    {
-	      /* C1 is the character before D, S1 is the syntax of C1, C2
-		 is the character at D, and S2 is the syntax of C2.  */
-	      re_wchar_t c1, c2;
-	      int s1, s2;
-	      int dummy;
-#ifdef emacs
-	      ssize_t offset = PTR_TO_OFFSET (d) - 1;
-	      ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
-	      UPDATE_SYNTAX_TABLE_FAST (charpos);
-#endif
-	      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
-	      s1 = SYNTAX (c1);
-
-	      /* Case 2: S1 is not Sword.  */
-	      if (s1 != Sword)
-		goto fail;
-
-	      /* Case 3: D is not at the end of string ... */
-	      if (!AT_STRINGS_END (d))
-		{
-		  PREFETCH_NOLIMIT ();
-		  GET_CHAR_AFTER (c2, d, dummy);
-#ifdef emacs
-		  UPDATE_SYNTAX_TABLE_FORWARD_FAST (charpos);
-#endif
-		  s2 = SYNTAX (c2);
-
-		  /* ... and S2 is Sword, and WORD_BOUNDARY_P (C1, C2)
-		     returns 0.  */
-		  if ((s2 == Sword) && !WORD_BOUNDARY_P (c1, c2))
-	  goto fail;
-		}
-	    }
-	  break;
-
 	case symbeg:
-	  DEBUG_PRINT ("EXECUTING symbeg.\n");
-
-	  /* We FAIL in one of the following cases: */
-
-	  /* Case 1: D is at the end of string.  */
-	  if (AT_STRINGS_END (d))
-	    goto fail;
-	  else
-	    {
-	      /* C1 is the character before D, S1 is the syntax of C1, C2
-		 is the character at D, and S2 is the syntax of C2.  */
-	      re_wchar_t c1, c2;
-	      int s1, s2;
-#ifdef emacs
-	      ssize_t offset = PTR_TO_OFFSET (d);
-	      ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
-	      UPDATE_SYNTAX_TABLE_FAST (charpos);
-#endif
-	      PREFETCH ();
-	      c2 = RE_STRING_CHAR (d, target_multibyte);
-	      s2 = SYNTAX (c2);
-
-	      /* Case 2: S2 is neither Sword nor Ssymbol. */
-	      if (s2 != Sword && s2 != Ssymbol)
-		goto fail;
-
-	      /* Case 3: D is not at the beginning of string ... */
-	      if (!AT_STRINGS_BEG (d))
-		{
-		  GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
-#ifdef emacs
-		  UPDATE_SYNTAX_TABLE_BACKWARD (charpos - 1);
-#endif
-		  s1 = SYNTAX (c1);
-
-		  /* ... and S1 is Sword or Ssymbol.  */
-		  if (s1 == Sword || s1 == Ssymbol)
-		    goto fail;
-		}
-	    }
-	  break;
-
 	case symend:
-	  DEBUG_PRINT ("EXECUTING symend.\n");
-
-	  /* We FAIL in one of the following cases: */
-
-	  /* Case 1: D is at the beginning of string.  */
-	  if (AT_STRINGS_BEG (d))
-	    goto fail;
-	  else
-	    {
-	      /* C1 is the character before D, S1 is the syntax of C1, C2
-		 is the character at D, and S2 is the syntax of C2.  */
-	      re_wchar_t c1, c2;
-	      int s1, s2;
-#ifdef emacs
-	      ssize_t offset = PTR_TO_OFFSET (d) - 1;
-	      ssize_t charpos = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
-	      UPDATE_SYNTAX_TABLE_FAST (charpos);
-#endif
-	      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
-	      s1 = SYNTAX (c1);
-
-	      /* Case 2: S1 is neither Ssymbol nor Sword.  */
-	      if (s1 != Sword && s1 != Ssymbol)
-		goto fail;
-
-	      /* Case 3: D is not at the end of string ... */
-	      if (!AT_STRINGS_END (d))
-		{
-		  PREFETCH_NOLIMIT ();
-		  c2 = RE_STRING_CHAR (d, target_multibyte);
 #ifdef emacs
-		  UPDATE_SYNTAX_TABLE_FORWARD_FAST (charpos + 1);
+	case before_dot:
+	case at_dot:
+	case after_dot:
 #endif
-		  s2 = SYNTAX (c2);
-
-		  /* ... and S2 is Sword or Ssymbol.  */
-		  if (s2 == Sword || s2 == Ssymbol)
-                    goto fail;
-		}
-	    }
-	  break;
+	  DEBUG_PRINT ("EXECUTING zero-width opcode %d.\n", p[-1]);
+	  if (match_zero_width (bufp, p[-1], d, dend, end_match_2,
+				string1, size1, string2, size2))
+	    break;
+	  goto fail;
 
+	/* Match a character with or without a syntax class or
+	   category.  */
 	case syntaxspec:
 	case notsyntaxspec:
-	  {
-	    boolean not = (re_opcode_t) *(p - 1) == notsyntaxspec;
-	    mcnt = *p++;
-	    DEBUG_PRINT ("EXECUTING %ssyntaxspec %d.\n", not ? "not" : "",
-			 mcnt);
-	    PREFETCH ();
-#ifdef emacs
-	    {
-	      ssize_t offset = PTR_TO_OFFSET (d);
-	      ssize_t pos1 = SYNTAX_TABLE_BYTE_TO_CHAR (offset);
-	      UPDATE_SYNTAX_TABLE_FAST (pos1);
-	    }
-#endif
-	    {
-	      int len;
-	      re_wchar_t c;
-
-	      GET_CHAR_AFTER (c, d, len);
-	      if ((SYNTAX (c) != (enum syntaxcode) mcnt) ^ not)
-		goto fail;
-	      d += len;
-	    }
-	  }
-	  break;
-
 #ifdef emacs
-	case before_dot:
-	  DEBUG_PRINT ("EXECUTING before_dot.\n");
-	  if (PTR_BYTE_POS (d) >= PT_BYTE)
-	    goto fail;
-	  break;
-
-	case at_dot:
-	  DEBUG_PRINT ("EXECUTING at_dot.\n");
-	  if (PTR_BYTE_POS (d) != PT_BYTE)
-	    goto fail;
-	  break;
-
-	case after_dot:
-	  DEBUG_PRINT ("EXECUTING after_dot.\n");
-	  if (PTR_BYTE_POS (d) <= PT_BYTE)
-	    goto fail;
-	  break;
-
 	case categoryspec:
 	case notcategoryspec:
+#endif
 	  {
-	    boolean not = (re_opcode_t) *(p - 1) == notcategoryspec;
-	    mcnt = *p++;
-	    DEBUG_PRINT ("EXECUTING %scategoryspec %d.\n",
-			 not ? "not" : "", mcnt);
-	    PREFETCH ();
+	    int len;
 
-	    {
-	      int len;
-	      re_wchar_t c;
-	      GET_CHAR_AFTER (c, d, len);
-	      if ((!CHAR_HAS_CATEGORY (c, mcnt)) ^ not)
-		goto fail;
-	      d += len;
-	    }
+	    DEBUG_PRINT ("EXECUTING syntax or category opcode %d %d.\n",
+			 p[-1], *p);
+	    PREFETCH ();
+	    p = match_syntax_or_category (bufp, p - 1, d, &len,
+					  string1, size1, string2);
+	    if (!p)
+	      goto fail;
+	    d += len;
 	  }
 	  break;
 
-#endif /* emacs */
-
 	default:
 	  abort ();
 	}
@@ -6233,6 +6946,15 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
       if (!FAIL_STACK_EMPTY ())
 	{
 	  re_char *str, *pat;
+#ifdef emacs
+	  /* Backtracking is getting out of hand; if there is a
+	     matcher that doesn't need it, let it take over.  */
+	  if (bufp->nfa && ++nfailures > RE_NFA_FAILURE_LIMIT)
+	    {
+	      FREE_VARIABLES ();
+	      return -3;
+	    }
+#endif
 	  /* A restart point is known.  Restore to that state.  */
 	  DEBUG_PRINT ("\nFAIL:\n");
 	  POP_FAILURE_POINT (str, pat);
@@ -6281,6 +7003,629 @@ re_match_2_internal (struct re_pattern_buffer *bufp, const_re_char *string1,
   return -1;         			/* Failure to match.  */
 }
 
+#ifdef emacs
+
+/* Matching without backtracking.
+
+   re_match_2_internal tries the alternatives of a pattern one after
+   the other, so that a pattern like `\(a*\)*b' takes exponential
+   time to fail, and `.*' pushes one failure point per character of a
+   long line until the failure stack overflows.
+
+   re_search_2_nfa instead runs all the alternatives in lock step, as
+   "threads" that all sit at the same position in the text and move
+   forward together one character at a time.  The threads are kept in
+   the order in which the backtracker would try them, so the match it
+   finds and the registers it sets are those the backtracker would
+   return.  Two threads waiting at the same place in the pattern can
+   only behave the same from then on, so all but the first one are
+   dropped, and the time taken is at most proportional to the length
+   of the text times the length of the pattern.  A search forward
+   doesn't start over at each position: it adds a new thread at each
+   one, behind the others, and stops adding them once a match has been
+   found, so a single pass finds the leftmost match.
+
+   Between two characters, what a thread does also depends on which
+   loops that can match the empty string it has entered at the current
+   position: re_match_2_internal leaves such a loop when it comes back
+   to its on_failure_jump_loop (or on_failure_jump_nastyloop) without
+   having matched anything.  So while following a thread through
+   jumps, we keep track of that set of loops, and only consider two
+   visits of the same place to be the same if they have the same set.
+
+   This only works if what remains to be matched depends on nothing but
+   the position in the pattern and in the text: patterns with back
+   references, with interval counters or that need POSIX longest-match
+   backtracking are left to the backtracker.
+
+   On ordinary patterns the backtracker is faster, so it still runs
+   first; when it has popped RE_NFA_FAILURE_LIMIT failure points or
+   overflowed its failure stack, re_search_2 and re_match_2 retry with
+   re_search_2_nfa.  A search backward still calls it at each
+   position, since it must find the last match, not the first.  */
+
+struct re_nfa
+{
+  /* The number of places in PROG where a thread can wait for the next
+     character: one per byte of literal text, and one per `succeed' or
+     other opcode that matches a character.  */
+  size_t nthreads;
+
+  /* A copy of the compiled pattern.  re_match_2_internal rewrites
+     on_failure_jump_smart loops in place into a form that only works
+     with backtracking, so the copy is taken before it gets a chance.  */
+  unsigned char prog[FLEXIBLE_ARRAY_MEMBER];
+};
+
+/* Set BUFP->nfa for the pattern that was just compiled into BUFP, or
+   clear it if the pattern uses features re_search_2_nfa doesn't
+   support.  */
+
+void
+re_compile_nfa (struct re_pattern_buffer *bufp)
+{
+  re_char *p = bufp->buffer;
+  re_char *pend = p + bufp->used;
+  re_opcode_t op = no_op;
+  size_t nthreads = 0;
+
+  free (bufp->nfa);
+  bufp->nfa = NULL;
+
+  while (p < pend)
+    switch (op = *p++)
+      {
+      case succeed:
+      case anychar:
+	nthreads++;
+	break;
+
+      case exactn:
+	nthreads += *p;
+	p += *p + 1;
+	break;
+
+      case charset:
+      case charset_not:
+	nthreads++;
+	if (CHARSET_RANGE_TABLE_EXISTS_P (p - 1))
+	  {
+	    re_char *range_table = CHARSET_RANGE_TABLE (p - 1);
+	    int count;
+
+	    EXTRACT_NUMBER_AND_INCR (count, range_table);
+	    p = CHARSET_RANGE_TABLE_END (range_table, count);
+	  }
+	else
+	  p += CHARSET_BITMAP_SIZE (p - 1) + 1;
+	break;
+
+      case syntaxspec:
+      case notsyntaxspec:
+      case categoryspec:
+      case notcategoryspec:
+	nthreads++;
+	p++;
+	break;
+
+      case start_memory:
+      case stop_memory:
+	p++;
+	break;
+
+      case jump:
+      case on_failure_jump:
+      case on_failure_keep_string_jump:
+      case on_failure_jump_loop:
+      case on_failure_jump_nastyloop:
+      case on_failure_jump_smart:
+	p += 2;
+	break;
+
+      case no_op:
+      case begline:
+      case endline:
+      case begbuf:
+      case endbuf:
+      case wordbeg:
+      case wordend:
+      case wordbound:
+      case notwordbound:
+      case symbeg:
+      case symend:
+      case before_dot:
+      case at_dot:
+      case after_dot:
+	break;
+
+      default:
+	/* `duplicate', `succeed_n', `jump_n' and `set_number_at'.  */
+	return;
+      }
+
+  /* Patterns compiled for POSIX backtracking don't end in `succeed'.  */
+  if (op != succeed)
+    return;
+
+  bufp->nfa = malloc (offsetof (struct re_nfa, prog) + bufp->used);
+  bufp->nfa->nthreads = nthreads;
+  memcpy (bufp->nfa->prog, bufp->buffer, bufp->used);
+}
+
+/* A place where a thread waits for the next character: an opcode,
+   or a byte in the literal text of an `exactn' that ends at LIT_END.  */
+struct re_nfa_thread
+{
+  re_char *pc, *lit_end;
+};
+
+/* An entry of the stack re_search_2_nfa uses to follow a thread through
+   jumps and zero-width opcodes.  LOOPS is the set of loops entered at
+   the current position, as an index in the table of such sets.  If PC
+   is null, the entry says to restore register slot REG to VALUE.  */
+struct re_nfa_frame
+{
+  re_char *pc, *lit_end;
+  re_char *value;
+  size_t reg, loops;
+};
+
+/* Maximum number of different sets of loops re_search_2_nfa keeps
+   track of at one position in the text.  */
+#define RE_NFA_MAX_LOOP_SETS 64
+
+/* Look for a match of BUFP, which must have an automaton form, that
+   starts at a character boundary between positions POS and LAST,
+   inclusive, of the virtual concatenation of STRING1 and STRING2 and
+   ends by STOP.  Return the position where the leftmost such match
+   starts, set *LENP to its length and set REGS as re_match_2_internal
+   does.  Return -1 if there is no match, or -2 on error.
+
+   The text is scanned only once, whatever the distance between POS and
+   LAST: a new thread is started at each position, behind all the
+   threads started before it, until a match is found.  A thread started
+   earlier thus takes priority over one started later, just as the
+   backtracker would find it first trying each position in turn.  */
+
+static regoff_t
+re_search_2_nfa (struct re_pattern_buffer *bufp, re_char *string1,
+		 size_t size1, re_char *string2, size_t size2,
+		 ssize_t pos, ssize_t last, struct re_registers *regs,
+		 ssize_t stop, regoff_t *lenp)
+{
+  /* These have the same meaning as in re_match_2_internal, so that
+     the same macros can be used here.  */
+  re_char *end1, *end2, *end_match_1, *end_match_2;
+  re_char *d, *dend;
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  int mcnt;
+
+  re_char *prog = bufp->nfa->prog;
+  re_char *pend = prog + bufp->used;
+
+  /* Each thread has its own copy of the registers: two slots, for the
+     start and the end, per register.  The start of register 0 is where
+     the thread started.  */
+  size_t num_regs = bufp->re_nsub + 1;
+  size_t nslots = 2 * num_regs;
+  size_t nthreads = bufp->nfa->nthreads + 2;
+  size_t nframes = 4 * bufp->used + 8;
+
+  /* The threads waiting at D, in order of priority, and the ones that
+     will carry on from the next character.  */
+  struct re_nfa_thread *run, *next;
+  re_char **run_slots, **next_slots;
+  size_t nrun, nnext;
+
+  /* The registers of the thread being followed, and of the best match
+     found so far.  */
+  re_char **slots, **match_slots;
+  re_char *match_end = NULL;
+
+  /* The sets of loops entered at D.  Set 0 is the empty set, and set
+     I > 0 is set LOOP_PARENT[I] plus the loop at LOOP_PC[I].
+     LOOP_MARK[I][J] is GEN if PROG + J has been visited at D with set
+     I; places where threads wait only use LOOP_MARK[0].  */
+  re_char *loop_pc[RE_NFA_MAX_LOOP_SETS];
+  size_t loop_parent[RE_NFA_MAX_LOOP_SETS];
+  size_t *loop_mark[RE_NFA_MAX_LOOP_SETS];
+  size_t nloop_sets;
+  size_t gen;
+
+  struct re_nfa_frame *stack;
+  size_t sp, i, reg;
+
+  REGEX_USE_SAFE_ALLOCA;
+
+  if (pos < 0 || pos > size1 + size2)
+    return -1;
+
+  run = REGEX_TALLOC (nthreads, struct re_nfa_thread);
+  next = REGEX_TALLOC (nthreads, struct re_nfa_thread);
+  run_slots = REGEX_TALLOC (nthreads * nslots, re_char *);
+  next_slots = REGEX_TALLOC (nthreads * nslots, re_char *);
+  slots = REGEX_TALLOC (nslots, re_char *);
+  match_slots = REGEX_TALLOC (nslots, re_char *);
+  stack = REGEX_TALLOC (nframes, struct re_nfa_frame);
+  for (i = 0; i < RE_NFA_MAX_LOOP_SETS; i++)
+    loop_mark[i] = NULL;
+  loop_mark[0] = REGEX_TALLOC (bufp->used + 1, size_t);
+  memset (loop_mark[0], 0, (bufp->used + 1) * sizeof (size_t));
+
+  /* Set up D, DEND and the limits as re_match_2_internal does.  */
+  if (size2 == 0 && string1 != NULL)
+    {
+      string2 = string1;
+      size2 = size1;
+      string1 = 0;
+      size1 = 0;
+    }
+  end1 = string1 + size1;
+  end2 = string2 + size2;
+  if (pos >= size1)
+    {
+      d = string2 + pos - size1;
+      dend = end_match_2 = string2 + stop - size1;
+      end_match_1 = end1;
+    }
+  else
+    {
+      if (stop < size1)
+	{
+	  end_match_1 = string1 + stop;
+	  end_match_2 = end_match_1;
+	}
+      else
+	{
+	  end_match_1 = end1;
+	  end_match_2 = string2 + stop - size1;
+	}
+      d = string1 + pos;
+      dend = end_match_1;
+    }
+
+  nnext = 0;
+  for (gen = 1; ; gen++)
+    {
+      re_char *dnext;
+      int len = 0;
+
+      /* Until a match is found, start a thread at the beginning of
+	 the pattern, with all registers unset, at each position up to
+	 LAST.  */
+      if (!match_end && POINTER_TO_OFFSET (d) <= last)
+	{
+	  next[nnext].pc = prog;
+	  next[nnext].lit_end = NULL;
+	  for (reg = 0; reg < nslots; reg++)
+	    next_slots[nnext * nslots + reg] = NULL;
+	  next_slots[nnext * nslots] = d;
+	  nnext++;
+	}
+
+      /* Follow each thread that carries on at D through jumps and
+	 zero-width opcodes, depth first and in order of priority, to
+	 the places where it waits for a character.  */
+      nrun = 0;
+      nloop_sets = 1;
+      for (i = 0; i < nnext; i++)
+	{
+	  memcpy (slots, next_slots + i * nslots, nslots * sizeof *slots);
+	  stack[0].pc = next[i].pc;
+	  stack[0].lit_end = next[i].lit_end;
+	  stack[0].loops = 0;
+	  sp = 1;
+
+	  while (sp > 0)
+	    {
+	      struct re_nfa_frame *f = &stack[--sp];
+	      re_char *p = f->pc;
+	      re_char *lit_end = f->lit_end;
+	      size_t loops = f->loops, l;
+
+#define NFA_PUSH(pc_, lit_end_, loops_)					\
+  (stack[sp].pc = (pc_), stack[sp].lit_end = (lit_end_),		\
+   stack[sp].loops = (loops_), sp++)
+#define NFA_SAVE_SLOT(reg_)						\
+  (stack[sp].pc = NULL, stack[sp].reg = (reg_),				\
+   stack[sp].value = slots[reg_], sp++)
+
+	      if (!p)
+		{
+		  slots[f->reg] = f->value;
+		  continue;
+		}
+
+	      if (lit_end || p == pend)
+		goto add_thread;
+
+	      switch (*p)
+		{
+		case succeed:
+		case anychar:
+		case charset:
+		case charset_not:
+		case syntaxspec:
+		case notsyntaxspec:
+		case categoryspec:
+		case notcategoryspec:
+		  goto add_thread;
+
+		case exactn:
+		  lit_end = p + 2 + p[1];
+		  p += 2;
+		  goto add_thread;
+
+		default:
+		  break;
+		}
+
+	      if (loop_mark[loops][p - prog] == gen)
+		continue;
+	      loop_mark[loops][p - prog] = gen;
+
+	      /* Each opcode pushes at most three frames.  */
+	      if (sp + 3 > nframes)
+		{
+		  REGEX_SAFE_FREE ();
+		  return -2;
+		}
+
+	      switch (*p)
+		{
+		case no_op:
+		  NFA_PUSH (p + 1, NULL, loops);
+		  continue;
+
+		case start_memory:
+		  reg = 2 * p[1];
+		  NFA_SAVE_SLOT (reg);
+		  NFA_SAVE_SLOT (reg + 1);
+		  slots[reg] = d;
+		  slots[reg + 1] = NULL;
+		  NFA_PUSH (p + 2, NULL, loops);
+		  continue;
+
+		case stop_memory:
+		  reg = 2 * p[1] + 1;
+		  NFA_SAVE_SLOT (reg);
+		  slots[reg] = d;
+		  NFA_PUSH (p + 2, NULL, loops);
+		  continue;
+
+		case jump:
+		  EXTRACT_NUMBER (mcnt, p + 1);
+		  NFA_PUSH (p + 3 + mcnt, NULL, loops);
+		  continue;
+
+		case on_failure_jump:
+		case on_failure_keep_string_jump:
+		case on_failure_jump_smart:
+		  /* Try what follows first and the jump target
+		     after that.  */
+		  EXTRACT_NUMBER (mcnt, p + 1);
+		  NFA_PUSH (p + 3 + mcnt, NULL, loops);
+		  NFA_PUSH (p + 3, NULL, loops);
+		  continue;
+
+		case on_failure_jump_loop:
+		case on_failure_jump_nastyloop:
+		  EXTRACT_NUMBER (mcnt, p + 1);
+		  for (l = loops; l > 0; l = loop_parent[l])
+		    if (loop_pc[l] == p)
+		      break;
+		  if (l > 0)
+		    {
+		      /* An iteration of the loop matched the empty
+			 string: leave the loop.  */
+		      if (*p == on_failure_jump_loop)
+			NFA_PUSH (p + 3 + mcnt, NULL, loops);
+		      else
+			NFA_PUSH (p + 3, NULL, loops);
+		      continue;
+		    }
+
+		  /* Enter the loop, noting that we did.  */
+		  for (l = 1; l < nloop_sets; l++)
+		    if (loop_parent[l] == loops && loop_pc[l] == p)
+		      break;
+		  if (l == nloop_sets)
+		    {
+		      if (nloop_sets == RE_NFA_MAX_LOOP_SETS)
+			{
+			  REGEX_SAFE_FREE ();
+			  return -2;
+			}
+		      if (!loop_mark[l])
+			{
+			  loop_mark[l] = REGEX_TALLOC (bufp->used + 1, size_t);
+			  memset (loop_mark[l], 0,
+				  (bufp->used + 1) * sizeof (size_t));
+			}
+		      loop_parent[l] = loops;
+		      loop_pc[l] = p;
+		      nloop_sets++;
+		    }
+
+		  /* Try what follows first and the jump target after
+		     that, except that the body of a loop must be
+		     tried with the loop entered.  */
+		  if (*p == on_failure_jump_loop)
+		    {
+		      NFA_PUSH (p + 3 + mcnt, NULL, loops);
+		      NFA_PUSH (p + 3, NULL, l);
+		    }
+		  else
+		    {
+		      NFA_PUSH (p + 3 + mcnt, NULL, l);
+		      NFA_PUSH (p + 3, NULL, loops);
+		    }
+		  continue;
+
+		case begline:
+		case endline:
+		case begbuf:
+		case endbuf:
+		case wordbound:
+		case notwordbound:
+		case wordbeg:
+		case wordend:
+		case symbeg:
+		case symend:
+		case before_dot:
+		case at_dot:
+		case after_dot:
+		  if (!match_zero_width (bufp, *p, d, dend, end_match_2,
+					 string1, size1, string2, size2))
+		    continue;
+		  break;
+
+		default:
+		  abort ();
+		}
+
+	      /* A zero-width opcode that succeeded.  */
+	      NFA_PUSH (p + 1, NULL, loops);
+	      continue;
+
+	    add_thread:
+	      if (loop_mark[0][p - prog] == gen)
+		continue;
+	      loop_mark[0][p - prog] = gen;
+	      run[nrun].pc = p;
+	      run[nrun].lit_end = lit_end;
+	      memcpy (run_slots + nrun * nslots, slots,
+		      nslots * sizeof *slots);
+	      nrun++;
+	      continue;
+	    }
+#undef NFA_PUSH
+#undef NFA_SAVE_SLOT
+	}
+
+      /* Move each thread past the character at D, in order of
+	 priority.  A thread at the end of the pattern is a match,
+	 better than any that the threads after it could find.  */
+      while (d == dend && dend != end_match_2)
+	{
+	  d = string2;
+	  dend = end_match_2;
+	}
+      if (d != dend)
+	len = target_multibyte ? BYTES_BY_CHAR_HEAD (*d) : 1;
+      dnext = d + len;
+
+      nnext = 0;
+      for (i = 0; i < nrun; i++)
+	{
+	  re_char *p = run[i].pc;
+	  re_char *lit_end = run[i].lit_end;
+	  int dummy;
+
+	  if (!lit_end && (p == pend || *p == succeed))
+	    {
+	      match_end = d;
+	      memcpy (match_slots, run_slots + i * nslots,
+		      nslots * sizeof *slots);
+	      break;
+	    }
+
+	  if (d == dend)
+	    continue;
+
+	  if (lit_end)
+	    {
+	      /* A character of the literal text of an `exactn'.  */
+	      p = match_literal_char (bufp, p, d, &dummy);
+	      if (p == lit_end)
+		lit_end = NULL;
+	    }
+	  else
+	    switch (*p)
+	      {
+	      case anychar:
+		p = match_anychar (bufp, p, d, &dummy);
+		break;
+
+	      case charset:
+	      case charset_not:
+		p = match_charset (bufp, p, d, &dummy);
+		break;
+
+	      case syntaxspec:
+	      case notsyntaxspec:
+	      case categoryspec:
+	      case notcategoryspec:
+		p = match_syntax_or_category (bufp, p, d, &dummy,
+					      string1, size1, string2);
+		break;
+
+	      default:
+		abort ();
+	      }
+
+	  if (p)
+	    {
+	      next[nnext].pc = p;
+	      next[nnext].lit_end = lit_end;
+	      memcpy (next_slots + nnext * nslots, run_slots + i * nslots,
+		      nslots * sizeof *slots);
+	      nnext++;
+	    }
+	}
+
+      /* Stop at the end of the text, or when no thread is left and
+	 no more are to be started.  */
+      if (d == dend
+	  || (nnext == 0 && (match_end || POINTER_TO_OFFSET (d) >= last)))
+	break;
+      d = dnext;
+      IMMEDIATE_QUIT_CHECK;
+    }
+
+  if (!match_end)
+    {
+      REGEX_SAFE_FREE ();
+      return -1;
+    }
+
+  if (regs && !bufp->no_sub)
+    {
+      if (!allocate_match_registers (bufp, regs, num_regs))
+	{
+	  REGEX_SAFE_FREE ();
+	  return -2;
+	}
+
+      if (regs->num_regs > 0)
+	{
+	  regs->start[0] = POINTER_TO_OFFSET (match_slots[0]);
+	  regs->end[0] = POINTER_TO_OFFSET (match_end);
+	}
+      for (reg = 1; reg < min (num_regs, regs->num_regs); reg++)
+	{
+	  re_char *start = match_slots[2 * reg];
+	  re_char *end = match_slots[2 * reg + 1];
+
+	  if (REG_UNSET (start) || REG_UNSET (end))
+	    regs->start[reg] = regs->end[reg] = -1;
+	  else
+	    {
+	      regs->start[reg] = POINTER_TO_OFFSET (start);
+	      regs->end[reg] = POINTER_TO_OFFSET (end);
+	    }
+	}
+      for (reg = num_regs; reg < regs->num_regs; reg++)
+	regs->start[reg] = regs->end[reg] = -1;
+    }
+
+  *lenp = POINTER_TO_OFFSET (match_end) - POINTER_TO_OFFSET (match_slots[0]);
+  REGEX_SAFE_FREE ();
+  return POINTER_TO_OFFSET (match_slots[0]);
+}
+
+#endif /* emacs */
+
 /* Subroutine definitions for re_match_2.  */
 
 /* Return zero if TRANSLATE[S1] and TRANSLATE[S2] are identical for LEN
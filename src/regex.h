@@ -359,6 +359,13 @@ struct re_pattern_buffer
            starting points for matches.  */
   char *fastmap;
 
+        /* Offset in `buffer' and length of a literal string that every
+           match contains, or a length of zero if there is none.  Set by
+           `re_compile_fastmap'; re_search uses it to skip over text in
+           which the pattern cannot match.  */
+  size_t must_offset;
+  unsigned char must_len;
+
         /* Either a translate table to apply to all characters before
            comparing them, or zero for no translation.  The translation
            is applied to a pattern when it is compiled and to a string
@@ -374,6 +381,13 @@ struct re_pattern_buffer
            this absolutely perfectly; see `re_compile_fastmap'.  */
   unsigned can_be_null : 1;
 
+        /* If set, every match starts with the `must' literal.  */
+  unsigned must_prefix : 1;
+
+        /* If set, the `must' literal only consists of ASCII characters,
+           so it has the same form in unibyte and multibyte text.  */
+  unsigned must_ascii : 1;
+
         /* If REGS_UNALLOCATED, allocate space in the `regs' structure
              for `max (RE_NREGS, re_nsub + 1)' groups.
            If REGS_REALLOCATE, reallocate space if necessary.
@@ -413,6 +427,10 @@ struct re_pattern_buffer
 
   /* Charset of unibyte characters at compiling time. */
   int charset_unibyte;
+
+  /* What re_match_2 needs to match this pattern without backtracking,
+     or null if it cannot; see re_compile_nfa.  */
+  struct re_nfa *nfa;
 #endif
 
 /* [[[end pattern_buffer]]] */
@@ -473,6 +491,12 @@ extern const char *re_compile_pattern (const char *__pattern, size_t __length,
    internal error.  */
 extern int re_compile_fastmap (struct re_pattern_buffer *__buffer);
 
+#ifdef emacs
+/* Prepare the compiled pattern in BUFFER for matching without
+   backtracking, when the backtracking matcher gives up on it.  */
+extern void re_compile_nfa (struct re_pattern_buffer *__buffer);
+#endif
+
 
 /* Search in the string STRING (with length LENGTH) for the pattern
    compiled into BUFFER.  Start searching at position START, for RANGE
@@ -495,6 +519,20 @@ extern regoff_t re_search_2 (struct re_pattern_buffer *__buffer,
 			     ssize_t __stop);
 
 
+#ifdef emacs
+/* Like `re_search_2' searching forward, but search for any of the N
+   patterns in BUFFERS, and store in WHICH the index of the one that
+   matched.  */
+extern regoff_t re_search_2_any (struct re_pattern_buffer **__buffers,
+				 int __n,
+				 const char *__string1, size_t __length1,
+				 const char *__string2, size_t __length2,
+				 ssize_t __start, ssize_t __range,
+				 struct re_registers *__regs,
+				 ssize_t __stop, int *__which);
+#endif
+
+
 /* Like `re_search', but return how many characters in STRING the regexp
    in BUFFER matched, starting at position START.  */
 extern regoff_t re_match (struct re_pattern_buffer *__buffer,
@@ -78,6 +78,12 @@ struct region_cache {
      gap.  */
   ptrdiff_t cache_len;
 
+  /* The index of the boundary that find_cache_boundary found last
+     time.  Callers tend to look up nearby positions one after the
+     other, so this is checked before doing a binary search.  It may
+     be out of date, and so it is only a hint.  */
+  ptrdiff_t last_found;
+
   /* The areas that haven't changed since the last time we cleaned out
      invalid entries from the cache.  These overlap when the buffer is
      entirely unchanged.  */
@@ -135,6 +141,7 @@ new_region_cache (void)
   c->gap_start = 0;
   c->gap_len = NEW_CACHE_GAP;
   c->cache_len = 0;
+  c->last_found = 0;
   c->boundaries = xmalloc ((c->gap_len + c->cache_len)
 			   * sizeof (*c->boundaries));
 
@@ -163,17 +170,35 @@ free_region_cache (struct region_cache *c)
 
 /* Finding positions in the cache.  */
 
+/* Return true if boundary I of cache C is the last one at or before
+   POS.  */
+static bool
+cache_boundary_governs (struct region_cache *c, ptrdiff_t i, ptrdiff_t pos)
+{
+  return (0 <= i && i < c->cache_len
+	  && BOUNDARY_POS (c, i) <= pos
+	  && (i + 1 == c->cache_len || pos < BOUNDARY_POS (c, i + 1)));
+}
+
 /* Return the index of the last boundary in cache C at or before POS.
    In other words, return the boundary that specifies the value for
    the region POS..(POS + 1).
 
-   This operation should be logarithmic in the number of cache
-   entries.  It would be nice if it took advantage of locality of
-   reference, too, by searching entries near the last entry found.  */
+   This operation is logarithmic in the number of cache entries, and
+   constant when POS is governed by the boundary found last time or
+   by one of its neighbors, as it is when scanning the buffer.  */
 static ptrdiff_t
 find_cache_boundary (struct region_cache *c, ptrdiff_t pos)
 {
   ptrdiff_t low = 0, high = c->cache_len;
+  ptrdiff_t hint = c->last_found;
+
+  if (cache_boundary_governs (c, hint, pos))
+    return hint;
+  if (cache_boundary_governs (c, hint + 1, pos))
+    return c->last_found = hint + 1;
+  if (cache_boundary_governs (c, hint - 1, pos))
+    return c->last_found = hint - 1;
 
   while (low + 1 < high)
     {
@@ -193,7 +218,7 @@ find_cache_boundary (struct region_cache *c, ptrdiff_t pos)
 	     || (low + 1 < c->cache_len
 		 && BOUNDARY_POS (c, low + 1) <= pos)));
 
-  return low;
+  return c->last_found = low;
 }
 
 
@@ -237,21 +262,16 @@ move_cache_gap (struct region_cache *c, ptrdiff_t pos, ptrdiff_t min_size)
      when the portion after the gap is smallest.  */
   if (gap_len < min_size)
     {
-      ptrdiff_t i, nboundaries = c->cache_len;
+      ptrdiff_t nboundaries = c->cache_len;
 
       c->boundaries =
 	xpalloc (c->boundaries, &nboundaries, min_size - gap_len, -1,
 		 sizeof *c->boundaries);
 
-      /* Some systems don't provide a version of the copy routine that
-         can be trusted to shift memory upward into an overlapping
-         region.  memmove isn't widely available.  */
       min_size = nboundaries - c->cache_len - gap_len;
-      for (i = c->cache_len - 1; i >= gap_start; i--)
-        {
-          c->boundaries[i + min_size].pos   = c->boundaries[i + gap_len].pos;
-          c->boundaries[i + min_size].value = c->boundaries[i + gap_len].value;
-        }
+      memmove (c->boundaries + gap_start + min_size,
+	       c->boundaries + gap_start + gap_len,
+	       (c->cache_len - gap_start) * sizeof *c->boundaries);
 
       gap_len = min_size;
     }
@@ -664,10 +684,19 @@ revalidate_region_cache (struct buffer *buf, struct region_cache *c)
 void
 know_region_cache (struct buffer *buf, struct region_cache *c,
 		   ptrdiff_t start, ptrdiff_t end)
+{
+  set_region_cache (buf, c, start, end, 1);
+}
+
+/* Record that the text of BUF between START and END has VALUE, for the
+   purposes of CACHE.  A VALUE of zero makes the region unknown.  */
+void
+set_region_cache (struct buffer *buf, struct region_cache *c,
+		  ptrdiff_t start, ptrdiff_t end, int value)
 {
   revalidate_region_cache (buf, c);
 
-  set_cache_region (c, start, end, 1);
+  set_cache_region (c, start, end, value);
 }
 
 
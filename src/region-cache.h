@@ -60,7 +60,12 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
    of the buffer, you could use this code pretty much unchanged.  So
    this cache really holds "known/unknown" information --- "I know
    this region has property P" vs. "I don't know if this region has
-   property P or not."  */
+   property P or not."
+
+   More generally, the cache maps each region to an int, where zero
+   means "unknown".  The width run cache, for instance, records the
+   common display width of the characters in a region, and
+   set_region_cache stores such values.  */
 
 struct buffer;
 
@@ -77,6 +82,13 @@ extern void know_region_cache (struct buffer *BUF,
                                struct region_cache *CACHE,
                                ptrdiff_t START, ptrdiff_t END);
 
+/* Record that the region of BUF between START and END has VALUE, for
+   the purposes of CACHE.  A VALUE of zero forgets what is known about
+   the region.  know_region_cache is the same with a VALUE of 1.  */
+extern void set_region_cache (struct buffer *BUF,
+                              struct region_cache *CACHE,
+                              ptrdiff_t START, ptrdiff_t END, int VALUE);
+
 /* Indicate that a section of BUF has changed, to invalidate CACHE.
    HEAD is the number of chars unchanged at the beginning of the buffer.
    TAIL is the number of chars unchanged at the end of the buffer.
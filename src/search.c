@@ -27,19 +27,24 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "syntax.h"
 #include "charset.h"
 #include "region-cache.h"
+#include "line-index.h"
 #include "blockinput.h"
+#include "systime.h"
 #include "intervals.h"
 
 #include <sys/types.h>
 #include "regex.h"
 
-#define REGEXP_CACHE_SIZE 20
-
 /* If the regexp is non-nil, then the buffer contains the compiled form
    of that regexp, suitable for searching.  */
 struct regexp_cache
 {
-  struct regexp_cache *next;
+  /* The neighboring entries in order of use, most recent first.  */
+  struct regexp_cache *next, *prev;
+  /* The next entry in the same bucket of the hash table, and the hash
+     code of the pattern, translation table and POSIX flag.  */
+  struct regexp_cache *hash_next;
+  EMACS_UINT hash;
   Lisp_Object regexp, whitespace_regexp;
   /* Syntax table for which the regexp applies.  We need this because
      of character classes.  If this is t, then the compiled pattern is valid
@@ -49,13 +54,28 @@ struct regexp_cache
   char fastmap[0400];
   /* True means regexp was compiled to do full POSIX backtracking.  */
   bool posix;
+  /* True while a search uses the compiled pattern, so that compiling
+     other patterns must not evict it.  */
+  bool pinned;
 };
 
-/* The instances of that struct.  */
-static struct regexp_cache searchbufs[REGEXP_CACHE_SIZE];
+/* The entries of the cache, from the most recently used one to the
+   least recently used one.  Entries whose regexp is nil are not in
+   use, and come last.  */
+static struct regexp_cache *searchbuf_head, *searchbuf_tail;
+
+/* The number of entries.  This is at most `regexp-cache-size', unless
+   more entries than that are pinned.  */
+static EMACS_INT searchbuf_count;
 
-/* The head of the linked list; points to the most recently used buffer.  */
-static struct regexp_cache *searchbuf_head;
+/* The entries in use, hashed by their `hash' field.  The number of
+   buckets is a power of 2.  */
+static struct regexp_cache **searchbuf_buckets;
+static ptrdiff_t searchbuf_nbuckets;
+
+/* What `regexp-cache-statistics' reports.  */
+static EMACS_INT regexp_cache_hits, regexp_cache_misses;
+static double regexp_cache_compile_time;
 
 
 /* Every call to re_match, etc., must pass &search_regs as the regs
@@ -87,6 +107,9 @@ static void save_search_regs (void);
 static EMACS_INT simple_search (EMACS_INT, unsigned char *, ptrdiff_t,
 				ptrdiff_t, Lisp_Object, ptrdiff_t, ptrdiff_t,
                                 ptrdiff_t, ptrdiff_t);
+static EMACS_INT anchor_search (EMACS_INT, unsigned char *, ptrdiff_t,
+				ptrdiff_t, Lisp_Object, Lisp_Object,
+				ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t);
 static EMACS_INT boyer_moore (EMACS_INT, unsigned char *, ptrdiff_t,
                               Lisp_Object, Lisp_Object, ptrdiff_t,
                               ptrdiff_t, int);
@@ -153,6 +176,10 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   if (val)
     xsignal1 (Qinvalid_regexp, build_string (val));
 
+  /* Let patterns that make the backtracking matcher blow up be
+     matched in linear time instead.  */
+  re_compile_nfa (&cp->buf);
+
   cp->regexp = Fcopy_sequence (pattern);
 }
 
@@ -172,6 +199,167 @@ shrink_regexp_cache (void)
     }
 }
 
+/* Return the hash code for compiling PATTERN with TRANSLATE, a
+   translation table or 0, and POSIX.  */
+static EMACS_UINT
+regexp_cache_hash (Lisp_Object pattern, Lisp_Object translate, bool posix)
+{
+  EMACS_UINT hash = hash_string (SSDATA (pattern), SBYTES (pattern));
+
+  hash = sxhash_combine (hash, XHASH (translate));
+  return sxhash_combine (hash, STRING_MULTIBYTE (pattern) * 2 + posix);
+}
+
+/* Remove CP from the list of entries.  */
+static void
+unlink_regexp_cache (struct regexp_cache *cp)
+{
+  if (cp->prev)
+    cp->prev->next = cp->next;
+  else
+    searchbuf_head = cp->next;
+  if (cp->next)
+    cp->next->prev = cp->prev;
+  else
+    searchbuf_tail = cp->prev;
+}
+
+/* Put CP at the front of the list of entries if FRONT, else at its
+   end.  CP must not be in the list.  */
+static void
+link_regexp_cache (struct regexp_cache *cp, bool front)
+{
+  if (front)
+    {
+      cp->prev = NULL;
+      cp->next = searchbuf_head;
+      if (searchbuf_head)
+	searchbuf_head->prev = cp;
+      else
+	searchbuf_tail = cp;
+      searchbuf_head = cp;
+    }
+  else
+    {
+      cp->next = NULL;
+      cp->prev = searchbuf_tail;
+      if (searchbuf_tail)
+	searchbuf_tail->next = cp;
+      else
+	searchbuf_head = cp;
+      searchbuf_tail = cp;
+    }
+}
+
+/* Remove CP from the hash table, and mark it as unused.  */
+static void
+unhash_regexp_cache (struct regexp_cache *cp)
+{
+  struct regexp_cache **cpp;
+
+  if (NILP (cp->regexp))
+    return;
+  for (cpp = &searchbuf_buckets[cp->hash & (searchbuf_nbuckets - 1)];
+       *cpp != cp; cpp = &(*cpp)->hash_next)
+    eassert (*cpp);
+  *cpp = cp->hash_next;
+  cp->regexp = Qnil;
+}
+
+/* Add CP to the hash table.  */
+static void
+hash_regexp_cache (struct regexp_cache *cp)
+{
+  struct regexp_cache **bucket
+    = &searchbuf_buckets[cp->hash & (searchbuf_nbuckets - 1)];
+
+  cp->hash_next = *bucket;
+  *bucket = cp;
+}
+
+/* Return an unused entry of the cache, at the end of the list of
+   entries.  Unless the cache can still grow, this is the least
+   recently used entry, which is evicted.  */
+static struct regexp_cache *
+regexp_cache_entry (void)
+{
+  EMACS_INT size = max (regexp_cache_size, 1);
+  struct regexp_cache *cp;
+
+  /* Free entries if `regexp-cache-size' was decreased, or if pinned
+     entries made the cache grow.  */
+  while (searchbuf_count > size && !searchbuf_tail->pinned)
+    {
+      cp = searchbuf_tail;
+      unhash_regexp_cache (cp);
+      unlink_regexp_cache (cp);
+      xfree (cp->buf.buffer);
+      xfree (cp->buf.nfa);
+      xfree (cp);
+      searchbuf_count--;
+    }
+
+  /* Make the hash table bigger if `regexp-cache-size' was increased.  */
+  if (searchbuf_nbuckets < size)
+    {
+      ptrdiff_t nbuckets = 16;
+
+      while (nbuckets < size)
+	nbuckets *= 2;
+      xfree (searchbuf_buckets);
+      searchbuf_buckets = xzalloc (nbuckets * sizeof *searchbuf_buckets);
+      searchbuf_nbuckets = nbuckets;
+      for (cp = searchbuf_head; cp; cp = cp->next)
+	if (!NILP (cp->regexp))
+	  hash_regexp_cache (cp);
+    }
+
+  cp = searchbuf_tail;
+  if (cp && NILP (cp->regexp))
+    return cp;
+
+  /* Pinned entries are the most recently used ones, so if the least
+     recently used one is pinned, they all are.  */
+  if (searchbuf_count < size || (cp && cp->pinned))
+    {
+      cp = xzalloc (sizeof *cp);
+      cp->buf.allocated = 100;
+      cp->buf.buffer = xmalloc (100);
+      cp->buf.fastmap = cp->fastmap;
+      cp->regexp = Qnil;
+      cp->whitespace_regexp = Qnil;
+      cp->syntax_table = Qnil;
+      link_regexp_cache (cp, false);
+      searchbuf_count++;
+      return cp;
+    }
+
+  unhash_regexp_cache (cp);
+  return cp;
+}
+
+/* Pin the cache entry of BUFP, a pattern returned by compile_pattern,
+   until unpin_regexp_cache is called.  */
+static void
+pin_regexp_cache (struct re_pattern_buffer *bufp)
+{
+  struct regexp_cache *cp
+    = (struct regexp_cache *) ((char *) bufp
+			       - offsetof (struct regexp_cache, buf));
+
+  cp->pinned = true;
+}
+
+/* Unpin all the entries of the cache.  */
+static void
+unpin_regexp_cache (void)
+{
+  struct regexp_cache *cp;
+
+  for (cp = searchbuf_head; cp; cp = cp->next)
+    cp->pinned = false;
+}
+
 /* Clear the regexp cache w.r.t. a particular syntax table,
    because it was changed.
    There is no danger of memory leak here because re_compile_pattern
@@ -180,14 +368,38 @@ shrink_regexp_cache (void)
 void
 clear_regexp_cache (void)
 {
-  int i;
+  struct regexp_cache *cp, *next;
+  EMACS_INT i;
+
+  for (cp = searchbuf_head, i = 0; i < searchbuf_count; cp = next, i++)
+    {
+      next = cp->next;
+      /* It's tempting to compare with the syntax-table we've actually changed,
+	 but it's not sufficient because char-table inheritance means that
+	 modifying one syntax-table can change others at the same time.  */
+      if (!NILP (cp->regexp) && !EQ (cp->syntax_table, Qt))
+	{
+	  unhash_regexp_cache (cp);
+	  unlink_regexp_cache (cp);
+	  link_regexp_cache (cp, false);
+	}
+    }
+}
+
+/* Mark the Lisp objects the regexp cache refers to.  This is called
+   from garbage collection.  */
+void
+mark_regexp_cache (void)
+{
+  struct regexp_cache *cp;
 
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    /* It's tempting to compare with the syntax-table we've actually changed,
-       but it's not sufficient because char-table inheritance means that
-       modifying one syntax-table can change others at the same time.  */
-    if (!EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+  for (cp = searchbuf_head; cp; cp = cp->next)
+    {
+      mark_object (cp->regexp);
+      mark_object (cp->whitespace_regexp);
+      mark_object (cp->syntax_table);
+      mark_object (cp->buf.translate);
+    }
 }
 
 /* Compile a regexp if necessary, but first check to see if there's one in
@@ -205,46 +417,46 @@ struct re_pattern_buffer *
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
-  struct regexp_cache *cp, **cpp;
-
-  for (cpp = &searchbuf_head; ; cpp = &cp->next)
-    {
-      cp = *cpp;
-      /* Entries are initialized to nil, and may be set to nil by
-	 compile_pattern_1 if the pattern isn't valid.  Don't apply
-	 string accessors in those cases.  However, compile_pattern_1
-	 is only applied to the cache entry we pick here to reuse.  So
-	 nil should never appear before a non-nil entry.  */
-      if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
+  struct regexp_cache *cp = NULL;
+  Lisp_Object trt = ! NILP (translate) ? translate : make_number (0);
+  EMACS_UINT hash = regexp_cache_hash (pattern, trt, posix);
+
+  if (searchbuf_nbuckets)
+    for (cp = searchbuf_buckets[hash & (searchbuf_nbuckets - 1)];
+	 cp; cp = cp->hash_next)
+      if (cp->hash == hash
+	  && SCHARS (cp->regexp) == SCHARS (pattern)
+	  && SBYTES (cp->regexp) == SBYTES (pattern)
 	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
-	  && !NILP (Fstring_equal (cp->regexp, pattern))
-	  && EQ (cp->buf.translate, (! NILP (translate) ? translate : make_number (0)))
+	  && memcmp (SDATA (cp->regexp), SDATA (pattern), SBYTES (pattern)) == 0
+	  && EQ (cp->buf.translate, trt)
 	  && cp->posix == posix
 	  && (EQ (cp->syntax_table, Qt)
 	      || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
-	  && !NILP (Fequal (cp->whitespace_regexp, Vsearch_spaces_regexp))
+	  && (EQ (cp->whitespace_regexp, Vsearch_spaces_regexp)
+	      || !NILP (Fequal (cp->whitespace_regexp, Vsearch_spaces_regexp)))
 	  && cp->buf.charset_unibyte == charset_unibyte)
 	break;
 
-      /* If we're at the end of the cache, compile into the nil cell
-	 we found, or the last (least recently used) cell with a
-	 string value.  */
-      if (cp->next == 0)
-	{
-	compile_it:
-	  compile_pattern_1 (cp, pattern, translate, posix);
-	  break;
-	}
+  if (cp)
+    regexp_cache_hits++;
+  else
+    {
+      struct timespec start = current_timespec ();
+
+      regexp_cache_misses++;
+      cp = regexp_cache_entry ();
+      /* This leaves CP unused if PATTERN is invalid.  */
+      compile_pattern_1 (cp, pattern, translate, posix);
+      cp->hash = hash;
+      hash_regexp_cache (cp);
+      regexp_cache_compile_time
+	+= timespectod (timespec_sub (current_timespec (), start));
     }
 
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
-     Move it to the front of the queue to mark it as most recently used.  */
-  *cpp = cp->next;
-  cp->next = searchbuf_head;
-  searchbuf_head = cp;
+  /* Move CP to the front of the list to mark it as most recently used.  */
+  unlink_regexp_cache (cp);
+  link_regexp_cache (cp, true);
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -619,6 +831,11 @@ newline_cache_on_off (struct buffer *buf)
 	      free_region_cache (base_buf->newline_cache);
 	      base_buf->newline_cache = 0;
 	    }
+	  if (base_buf->line_index)
+	    {
+	      free_line_index (base_buf->line_index);
+	      base_buf->line_index = 0;
+	    }
 	}
       return NULL;
     }
@@ -630,6 +847,8 @@ newline_cache_on_off (struct buffer *buf)
 	  /* It should be on.  */
 	  if (base_buf->newline_cache == 0)
 	    base_buf->newline_cache = new_region_cache ();
+	  if (base_buf->line_index == 0)
+	    base_buf->line_index = new_line_index ();
 	}
       return base_buf->newline_cache;
     }
@@ -692,6 +911,22 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
   if (shortage != 0)
     *shortage = 0;
 
+  /* When moving over many lines, let the line index skip most of
+     them.  */
+  if (count > 0 && newline_cache)
+    {
+      if (start_byte == -1)
+	start_byte = CHAR_TO_BYTE (start);
+      line_index_forward (cache_buffer, cache_buffer->line_index,
+			  &start, &start_byte, end, end_byte, &count);
+      if (count == 0)
+	{
+	  if (bytepos)
+	    *bytepos = start_byte;
+	  return start;
+	}
+    }
+
   immediate_quit = allow_quit;
 
   if (count > 0)
@@ -1531,6 +1766,9 @@ search_buffer (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
 	   ? boyer_moore (n, pat, len_byte, trt, inverse_trt,
 			  pos_byte, lim_byte,
 			  char_base)
+	   : multibyte
+	   ? anchor_search (n, pat, raw_pattern_size, len_byte, trt,
+			    inverse_trt, pos, pos_byte, lim, lim_byte)
 	   : simple_search (n, pat, raw_pattern_size, len_byte, trt,
 			    pos, pos_byte, lim, lim_byte));
       SAFE_FREE ();
@@ -1745,6 +1983,290 @@ simple_search (EMACS_INT n, unsigned char *pat,
     return n;
 }
 
+/* Maximum number of case equivalents of a character that
+   anchor_search looks for at once.  */
+
+enum { ANCHOR_MAX_EQUIVALENTS = 8 };
+
+/* Number of bytes of the text to be searched that anchor_search
+   samples to choose its anchor.  */
+
+enum { ANCHOR_SAMPLE_SIZE = 4096 };
+
+/* Return the byte position of the first byte of the current buffer in
+   [FROM, TO) that is set in TABLE, or TO if there is none.  If SINGLE
+   is nonnegative, it is the only byte set in TABLE.  */
+
+static ptrdiff_t
+scan_table_forward (unsigned char const *table, int single,
+		    ptrdiff_t from, ptrdiff_t to)
+{
+  while (from < to)
+    {
+      ptrdiff_t seg_end = from < GPT_BYTE && GPT_BYTE < to ? GPT_BYTE : to;
+      unsigned char *start = BYTE_POS_ADDR (from);
+      unsigned char *p = start, *end = start + (seg_end - from);
+
+      if (single >= 0)
+	p = memchr (p, single, end - p);
+      else
+	{
+	  while (p < end && !table[*p])
+	    p++;
+	  if (p == end)
+	    p = NULL;
+	}
+      if (p)
+	return from + (p - start);
+      from = seg_end;
+    }
+  return to;
+}
+
+/* Return the byte position of the last byte of the current buffer in
+   [TO, FROM) that is set in TABLE, or TO - 1 if there is none.  SINGLE
+   is as for scan_table_forward.  */
+
+static ptrdiff_t
+scan_table_backward (unsigned char const *table, int single,
+		     ptrdiff_t from, ptrdiff_t to)
+{
+  while (from > to)
+    {
+      ptrdiff_t seg_start = to < GPT_BYTE && GPT_BYTE < from ? GPT_BYTE : to;
+      unsigned char *start = BYTE_POS_ADDR (seg_start);
+      unsigned char *p = start + (from - seg_start);
+
+      if (single >= 0)
+	p = memrchr (start, single, p - start);
+      else
+	{
+	  while (p > start && !table[p[-1]])
+	    p--;
+	  p = p > start ? p - 1 : NULL;
+	}
+      if (p)
+	return seg_start + (p - start);
+      from = seg_start;
+    }
+  return to - 1;
+}
+
+/* If the text at byte position POS_BYTE, translated by TRT, matches
+   the LEN characters of PAT and ends at or before LIM_BYTE, return the
+   byte position of the end of the match.  Otherwise return -1.  */
+
+static ptrdiff_t
+translated_match_end (unsigned char const *pat, ptrdiff_t len,
+		      Lisp_Object trt, ptrdiff_t pos_byte, ptrdiff_t lim_byte)
+{
+  for (; len > 0; len--)
+    {
+      int charlen, buf_charlen;
+      int pat_ch, buf_ch;
+
+      if (pos_byte >= lim_byte)
+	return -1;
+      pat_ch = STRING_CHAR_AND_LENGTH (pat, charlen);
+      buf_ch = STRING_CHAR_AND_LENGTH (BYTE_POS_ADDR (pos_byte),
+				       buf_charlen);
+      TRANSLATE (buf_ch, trt, buf_ch);
+      if (buf_ch != pat_ch)
+	return -1;
+      pat += charlen;
+      pos_byte += buf_charlen;
+    }
+  return pos_byte;
+}
+
+/* Return the byte position where a match would start if the
+   character whose last byte is at byte position Q were the character
+   ANCHOR_CH, after translation by TRT, at index ANCHOR of the pattern.
+   Return -1 if it is not, or if the match would start before
+   FLOOR.  */
+
+static ptrdiff_t
+anchor_match_start (ptrdiff_t q, ptrdiff_t floor, ptrdiff_t anchor,
+		    int anchor_ch, Lisp_Object trt)
+{
+  ptrdiff_t h = q;
+  int c, charlen;
+
+  while (h > floor && ! CHAR_HEAD_P (FETCH_BYTE (h)))
+    h--;
+  c = STRING_CHAR_AND_LENGTH (BYTE_POS_ADDR (h), charlen);
+  TRANSLATE (c, trt, c);
+  if (h + charlen != q + 1 || c != anchor_ch)
+    return -1;
+  for (; anchor > 0; anchor--)
+    {
+      if (h <= floor)
+	return -1;
+      DEC_POS (h);
+    }
+  return h;
+}
+
+/* Do a string search N times for the string PAT, whose length is
+   LEN/LEN_BYTE, from buffer position POS/POS_BYTE until LIM/LIM_BYTE,
+   in a multibyte buffer.  TRT and INVERSE_TRT are translation tables,
+   and the characters of PAT are already translated by TRT.
+
+   Return the character position where the match is found.
+   Otherwise, if M matches remained to be found, return -M.
+
+   This is for patterns that boyer_moore cannot handle, such as
+   case-insensitive Cyrillic or Greek text, whose case equivalents lie
+   in different groups of 64 characters.  It picks one character of
+   PAT, the anchor, and finds every case equivalent of it with
+   INVERSE_TRT.  It then scans the buffer with memchr, or with a byte
+   table, for the last bytes of those equivalents, and compares the
+   whole of PAT only around each hit.  The anchor is the character
+   whose equivalents end in the bytes least frequent in a sample of
+   the text to be searched.
+
+   If no character of PAT can serve as the anchor, because its
+   equivalents under INVERSE_TRT are inconsistent with TRT, fall back
+   to simple_search.  */
+
+static EMACS_INT
+anchor_search (EMACS_INT n, unsigned char *pat,
+	       ptrdiff_t len, ptrdiff_t len_byte,
+	       Lisp_Object trt, Lisp_Object inverse_trt,
+	       ptrdiff_t pos, ptrdiff_t pos_byte,
+	       ptrdiff_t lim, ptrdiff_t lim_byte)
+{
+  bool forward = n > 0;
+  ptrdiff_t freq[0400];
+  unsigned char table[0400];
+  int single = -1;
+  /* The index of the anchor in PAT, the anchor itself, and the last
+     bytes of its equivalents.  */
+  ptrdiff_t anchor = -1;
+  int anchor_ch = -1;
+  unsigned char anchor_bytes[ANCHOR_MAX_EQUIVALENTS];
+  int nanchor_bytes = 0;
+  ptrdiff_t best_cost = PTRDIFF_MAX;
+  ptrdiff_t match_byte = 0;
+  ptrdiff_t i, b, scan;
+  unsigned char *p;
+  int charlen;
+
+  /* Count the bytes in a sample of the text to be searched.  */
+  memset (freq, 0, sizeof freq);
+  if (forward)
+    for (b = pos_byte; b < min (lim_byte, pos_byte + ANCHOR_SAMPLE_SIZE); b++)
+      freq[FETCH_BYTE (b)]++;
+  else
+    for (b = max (lim_byte, pos_byte - ANCHOR_SAMPLE_SIZE); b < pos_byte; b++)
+      freq[FETCH_BYTE (b)]++;
+
+  for (i = 0, p = pat; i < len; i++, p += charlen)
+    {
+      int c = STRING_CHAR_AND_LENGTH (p, charlen);
+      int equiv = c, translated;
+      unsigned char bytes[ANCHOR_MAX_EQUIVALENTS];
+      int nbytes = 0, j;
+      ptrdiff_t cost = 0;
+
+      do
+	{
+	  unsigned char str[MAX_MULTIBYTE_LENGTH];
+	  unsigned char last = str[CHAR_STRING (equiv, str) - 1];
+
+	  TRANSLATE (translated, trt, equiv);
+	  if (translated != c || nbytes == ANCHOR_MAX_EQUIVALENTS)
+	    {
+	      cost = PTRDIFF_MAX;
+	      break;
+	    }
+	  for (j = 0; j < nbytes && bytes[j] != last; j++)
+	    continue;
+	  if (j == nbytes)
+	    {
+	      bytes[nbytes++] = last;
+	      cost += freq[last] + 1;
+	    }
+	  TRANSLATE (equiv, inverse_trt, equiv);
+	}
+      while (equiv != c);
+
+      if (cost < best_cost)
+	{
+	  best_cost = cost;
+	  anchor = i;
+	  anchor_ch = c;
+	  memcpy (anchor_bytes, bytes, nbytes);
+	  nanchor_bytes = nbytes;
+	}
+    }
+
+  if (anchor < 0)
+    return simple_search (n, pat, len, len_byte, trt,
+			  pos, pos_byte, lim, lim_byte);
+
+  memset (table, 0, sizeof table);
+  for (i = 0; i < nanchor_bytes; i++)
+    table[anchor_bytes[i]] = 1;
+  if (nanchor_bytes == 1)
+    single = anchor_bytes[0];
+
+  if (forward)
+    {
+      scan = pos_byte;
+      while (n > 0)
+	{
+	  ptrdiff_t q = scan_table_forward (table, single, scan, lim_byte);
+	  ptrdiff_t start, end;
+
+	  if (q == lim_byte)
+	    break;
+	  scan = q + 1;
+	  start = anchor_match_start (q, pos_byte, anchor, anchor_ch, trt);
+	  if (start < 0)
+	    continue;
+	  end = translated_match_end (pat, len, trt, start, lim_byte);
+	  if (end < 0)
+	    continue;
+	  match_byte = end - start;
+	  pos_byte = scan = end;
+	  n--;
+	}
+      if (n > 0)
+	return -n;
+      pos = BYTE_TO_CHAR (pos_byte);
+      set_search_regs (pos_byte - match_byte, match_byte);
+    }
+  else
+    {
+      scan = pos_byte;
+      while (n < 0)
+	{
+	  ptrdiff_t q = scan_table_backward (table, single, scan, lim_byte);
+	  ptrdiff_t start, end;
+
+	  if (q < lim_byte)
+	    break;
+	  scan = q;
+	  start = anchor_match_start (q, lim_byte, anchor, anchor_ch, trt);
+	  if (start < 0)
+	    continue;
+	  end = translated_match_end (pat, len, trt, start, pos_byte);
+	  if (end < 0)
+	    continue;
+	  match_byte = end - start;
+	  pos_byte = scan = start;
+	  n++;
+	}
+      if (n < 0)
+	return n;
+      pos = BYTE_TO_CHAR (pos_byte);
+      set_search_regs (pos_byte, match_byte);
+    }
+
+  return pos;
+}
+
 /* Do Boyer-Moore search N times for the string BASE_PAT,
    whose length is LEN_BYTE,
    from buffer position POS_BYTE until LIM_BYTE.
@@ -2337,6 +2859,133 @@ and `replace-match'.  */)
   return search_command (regexp, bound, noerror, count, -1, 1, 1);
 }
 
+DEFUN ("re-search-forward-any", Fre_search_forward_any,
+       Sre_search_forward_any, 1, 3, 0,
+       doc: /* Search forward from point for any of the regular expressions REGEXPS.
+REGEXPS is a list of regexps.  Find the match that starts first, set
+point to its end, and return the index in REGEXPS of the regexp that
+matched.  If several regexps match at the same position, the first
+one in REGEXPS is used.  The match data are those of the regexp that
+matched.
+
+This gives the same result as searching for each regexp separately
+and keeping the match that starts first, but scans the text only
+once.
+
+The optional arguments BOUND and NOERROR are as for
+`re-search-forward'.  Search case-sensitivity is determined by the
+value of the variable `case-fold-search', which see.  */)
+  (Lisp_Object regexps, Lisp_Object bound, Lisp_Object noerror)
+{
+  EMACS_INT n;
+  ptrdiff_t lim, lim_byte, val, i;
+  unsigned char *p1, *p2;
+  ptrdiff_t s1, s2;
+  struct re_pattern_buffer **bufps;
+  struct re_registers *regs = (NILP (Vinhibit_changing_match_data)
+			       ? &search_regs : &search_regs_1);
+  Lisp_Object trt = (!NILP (BVAR (current_buffer, case_fold_search))
+		     ? BVAR (current_buffer, case_canon_table) : Qnil);
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  Lisp_Object tail;
+  int which;
+  ptrdiff_t count;
+  USE_SAFE_ALLOCA;
+
+  CHECK_LIST (regexps);
+  n = XFASTINT (Flength (regexps));
+
+  if (NILP (bound))
+    lim = ZV, lim_byte = ZV_BYTE;
+  else
+    {
+      CHECK_NUMBER_COERCE_MARKER (bound);
+      lim = XINT (bound);
+      if (lim < PT)
+	error ("Invalid search bound (wrong side of point)");
+      if (lim > ZV)
+	lim = ZV, lim_byte = ZV_BYTE;
+      else
+	lim_byte = CHAR_TO_BYTE (lim);
+    }
+
+  /* This is so set_image_of_range_1 in regex.c can find the EQV table.  */
+  set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
+			 BVAR (current_buffer, case_eqv_table));
+
+  if (running_asynch_code)
+    save_search_regs ();
+
+  /* Pin each compiled pattern, so that compiling the others doesn't
+     evict it, however many there are.  The cache grows if need be,
+     and shrinks back when patterns are next compiled.  */
+  SAFE_NALLOCA (bufps, 1, n);
+  count = SPECPDL_INDEX ();
+  record_unwind_protect_void (unpin_regexp_cache);
+  for (tail = regexps, i = 0; i < n; tail = XCDR (tail), i++)
+    {
+      CHECK_STRING (XCAR (tail));
+      bufps[i] = compile_pattern (XCAR (tail), regs, trt, false, multibyte);
+      pin_regexp_cache (bufps[i]);
+    }
+
+  immediate_quit = 1;
+  QUIT;
+
+  p1 = BEGV_ADDR;
+  s1 = GPT_BYTE - BEGV_BYTE;
+  p2 = GAP_END_ADDR;
+  s2 = ZV_BYTE - GPT_BYTE;
+  if (s1 < 0)
+    {
+      p2 = p1;
+      s2 = ZV_BYTE - BEGV_BYTE;
+      s1 = 0;
+    }
+  if (s2 < 0)
+    {
+      s1 = ZV_BYTE - BEGV_BYTE;
+      s2 = 0;
+    }
+  re_match_object = Qnil;
+
+  val = re_search_2_any (bufps, n, (char *) p1, s1, (char *) p2, s2,
+			 PT_BYTE - BEGV_BYTE, lim_byte - PT_BYTE, regs,
+			 lim_byte - BEGV_BYTE, &which);
+  immediate_quit = 0;
+  unbind_to (count, Qnil);
+  SAFE_FREE ();
+
+  if (val == -2)
+    matcher_overflow ();
+  if (val < 0)
+    {
+      if (NILP (noerror))
+	xsignal1 (Qsearch_failed, regexps);
+      if (!EQ (noerror, Qt))
+	SET_PT_BOTH (lim, lim_byte);
+      return Qnil;
+    }
+
+  if (regs == &search_regs)
+    {
+      for (i = 0; i < search_regs.num_regs; i++)
+	if (search_regs.start[i] >= 0)
+	  {
+	    search_regs.start[i]
+	      = BYTE_TO_CHAR (search_regs.start[i] + BEGV_BYTE);
+	    search_regs.end[i]
+	      = BYTE_TO_CHAR (search_regs.end[i] + BEGV_BYTE);
+	  }
+      XSETBUFFER (last_thing_searched, current_buffer);
+      SET_PT (search_regs.end[0]);
+    }
+  else
+    SET_PT (BYTE_TO_CHAR (search_regs_1.end[0] + BEGV_BYTE));
+
+  return make_number (which);
+}
+
 DEFUN ("posix-search-forward", Fposix_search_forward, Sposix_search_forward, 1, 4,
        "sPosix search: ",
        doc: /* Search forward from point for regular expression REGEXP.
@@ -3396,26 +4045,25 @@ the buffer.  If the buffer doesn't have a cache, the value is nil.  */)
   return val;
 }
 
+DEFUN ("regexp-cache-statistics", Fregexp_cache_statistics,
+       Sregexp_cache_statistics, 0, 0, 0,
+       doc: /* Return statistics about the cache of compiled regexps.
+The value is a list (HITS MISSES COMPILE-TIME ENTRIES).  HITS is the
+number of times a regexp to search for was found in the cache, MISSES
+the number of times it had to be compiled, COMPILE-TIME the total
+time in seconds spent compiling, and ENTRIES the number of compiled
+regexps the cache holds now.  See also `regexp-cache-size'.  */)
+  (void)
+{
+  return list4 (make_fixnum_or_float (regexp_cache_hits),
+		make_fixnum_or_float (regexp_cache_misses),
+		make_float (regexp_cache_compile_time),
+		make_number (searchbuf_count));
+}
+
 void
 syms_of_search (void)
 {
-  register int i;
-
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      searchbufs[i].buf.allocated = 100;
-      searchbufs[i].buf.buffer = xmalloc (100);
-      searchbufs[i].buf.fastmap = searchbufs[i].fastmap;
-      searchbufs[i].regexp = Qnil;
-      searchbufs[i].whitespace_regexp = Qnil;
-      searchbufs[i].syntax_table = Qnil;
-      staticpro (&searchbufs[i].regexp);
-      staticpro (&searchbufs[i].whitespace_regexp);
-      staticpro (&searchbufs[i].syntax_table);
-      searchbufs[i].next = (i == REGEXP_CACHE_SIZE-1 ? 0 : &searchbufs[i+1]);
-    }
-  searchbuf_head = &searchbufs[0];
-
   /* Error condition used for failing searches.  */
   DEFSYM (Qsearch_failed, "search-failed");
 
@@ -3438,6 +4086,14 @@ syms_of_search (void)
   saved_last_thing_searched = Qnil;
   staticpro (&saved_last_thing_searched);
 
+  DEFVAR_INT ("regexp-cache-size", regexp_cache_size,
+    doc: /* Maximum number of compiled regexps to keep for reuse.
+Searching for a regexp compiles it unless it is among the compiled
+regexps kept from previous searches.  Setting this to a higher value
+makes sense if many regexps are searched for repeatedly, as by
+font-lock.  See also `regexp-cache-statistics'.  */);
+  regexp_cache_size = 128;
+
   DEFVAR_LISP ("search-spaces-regexp", Vsearch_spaces_regexp,
       doc: /* Regexp to substitute for bunches of spaces in regexp search.
 Some commands use this for user-specified regexps.
@@ -3465,6 +4121,7 @@ is to bind it with `let' around a small expression.  */);
   defsubr (&Sre_search_backward);
   defsubr (&Sposix_search_forward);
   defsubr (&Sposix_search_backward);
+  defsubr (&Sre_search_forward_any);
   defsubr (&Sreplace_match);
   defsubr (&Smatch_beginning);
   defsubr (&Smatch_end);
@@ -3472,4 +4129,5 @@ is to bind it with `let' around a small expression.  */);
   defsubr (&Sset_match_data);
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
+  defsubr (&Sregexp_cache_statistics);
 }
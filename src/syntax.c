@@ -170,6 +170,222 @@ static struct buffer *find_start_buffer;
 static ptrdiff_t find_start_begv;
 static EMACS_INT find_start_modiff;
 
+/* A level of parentheses in scan_sexps_forward.  LAST is the start of
+   the most recent sexp at that level, PREV that of the last complete
+   one.  */
+struct level { ptrdiff_t last, prev; };
+
+/* Parsing from the beginning of a large buffer is made cheaper by
+   keeping, for each buffer, the state of a parse starting at BEG
+   about every PARSE_STATE_CACHE_INTERVAL characters.  Like the newline
+   cache, these checkpoints are kept in base buffers while
+   `cache-long-scans' is non-nil, and are dropped from a position on
+   when the text there changes.  */
+
+#define PARSE_STATE_CACHE_INTERVAL 4096
+
+struct parse_checkpoint
+{
+  /* The position of the checkpoint, which is never in a comment or
+     string or after an escape character.  */
+  ptrdiff_t charpos, bytepos;
+  EMACS_INT depth, mindepth;
+  ptrdiff_t comstr_start;
+  /* The levels of the scan, from the outermost one.  */
+  int nlevels;
+  struct level levels[FLEXIBLE_ARRAY_MEMBER];
+};
+
+struct parse_state_cache
+{
+  /* The checkpoints, sorted by position.  */
+  struct parse_checkpoint **checkpoints;
+  ptrdiff_t ncheckpoints, size;
+
+  /* The settings the checkpoints were computed with.  When they
+     change, the checkpoints are dropped.  */
+  Lisp_Object syntax_table;
+  EMACS_INT syntax_modiff;
+  bool lookup_properties;
+  bool comment_end_can_be_escaped;
+
+  /* A value that changes whenever checkpoints are dropped, so that a
+     scan can tell whether what it is about to record is still valid.  */
+  EMACS_INT tick;
+};
+
+/* Incremented whenever a syntax table is modified.  */
+static EMACS_INT syntax_modiff;
+
+/* The source of parse state cache ticks.  */
+static EMACS_INT parse_state_cache_ticks;
+
+void
+free_parse_state_cache (struct parse_state_cache *cache)
+{
+  ptrdiff_t i;
+
+  for (i = 0; i < cache->ncheckpoints; i++)
+    xfree (cache->checkpoints[i]);
+  xfree (cache->checkpoints);
+  xfree (cache);
+}
+
+void
+mark_parse_state_cache (struct parse_state_cache *cache)
+{
+  mark_object (cache->syntax_table);
+}
+
+/* Drop the checkpoints of CACHE from the Nth one on.  */
+
+static void
+drop_parse_checkpoints (struct parse_state_cache *cache, ptrdiff_t n)
+{
+  while (cache->ncheckpoints > n)
+    xfree (cache->checkpoints[--cache->ncheckpoints]);
+  cache->tick = ++parse_state_cache_ticks;
+}
+
+/* Return true if the checkpoints of CACHE are valid for the current
+   buffer's syntax settings.  */
+
+static bool
+parse_state_cache_valid_p (struct parse_state_cache *cache)
+{
+  return (EQ (cache->syntax_table, BVAR (current_buffer, syntax_table))
+	  && cache->syntax_modiff == syntax_modiff
+	  && cache->lookup_properties == parse_sexp_lookup_properties
+	  && cache->comment_end_can_be_escaped == Vcomment_end_can_be_escaped);
+}
+
+/* Return the parse state cache to use for the current buffer, creating
+   it if needed, or NULL if `cache-long-scans' is nil.  */
+
+static struct parse_state_cache *
+parse_state_cache (void)
+{
+  struct buffer *buf = (current_buffer->base_buffer
+			? current_buffer->base_buffer : current_buffer);
+  struct parse_state_cache *cache = buf->parse_state_cache;
+
+  if (NILP (BVAR (current_buffer, cache_long_scans)))
+    {
+      if (cache && buf == current_buffer)
+	{
+	  free_parse_state_cache (cache);
+	  buf->parse_state_cache = NULL;
+	}
+      return NULL;
+    }
+
+  if (!cache)
+    cache = buf->parse_state_cache = xzalloc (sizeof *cache);
+  else if (parse_state_cache_valid_p (cache))
+    return cache;
+
+  drop_parse_checkpoints (cache, 0);
+  cache->syntax_table = BVAR (current_buffer, syntax_table);
+  cache->syntax_modiff = syntax_modiff;
+  cache->lookup_properties = parse_sexp_lookup_properties;
+  cache->comment_end_can_be_escaped = Vcomment_end_can_be_escaped;
+  return cache;
+}
+
+/* Return the last checkpoint of CACHE at or before CHARPOS, or NULL
+   if there is none.  */
+
+static struct parse_checkpoint *
+parse_checkpoint_before (struct parse_state_cache *cache, ptrdiff_t charpos)
+{
+  ptrdiff_t lo = 0, hi = cache->ncheckpoints;
+
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (cache->checkpoints[mid]->charpos <= charpos)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo > 0 ? cache->checkpoints[lo - 1] : NULL;
+}
+
+/* Record in CACHE a checkpoint of a scan that started with CACHE's
+   tick equal to TICK.  The levels of the scan are those from
+   LEVELSTART to CURLEVEL.  Return the position of the next checkpoint
+   to record.  */
+
+static ptrdiff_t
+add_parse_checkpoint (struct parse_state_cache *cache, EMACS_INT tick,
+		      ptrdiff_t charpos, ptrdiff_t bytepos,
+		      EMACS_INT depth, EMACS_INT mindepth,
+		      ptrdiff_t comstr_start,
+		      struct level *levelstart, struct level *curlevel)
+{
+  struct buffer *buf = (current_buffer->base_buffer
+			? current_buffer->base_buffer : current_buffer);
+  int nlevels = curlevel - levelstart + 1;
+  struct parse_checkpoint *cp;
+
+  /* Lisp code run during the scan, by `syntax-propertize' for
+     instance, may have changed what the scan so far depends on.  */
+  if (buf->parse_state_cache != cache || cache->tick != tick
+      || !parse_state_cache_valid_p (cache))
+    return PTRDIFF_MAX;
+
+  if (cache->ncheckpoints == 0
+      || cache->checkpoints[cache->ncheckpoints - 1]->charpos < charpos)
+    {
+      cp = xmalloc (offsetof (struct parse_checkpoint, levels)
+		    + nlevels * sizeof *levelstart);
+      cp->charpos = charpos;
+      cp->bytepos = bytepos;
+      cp->depth = depth;
+      cp->mindepth = mindepth;
+      cp->comstr_start = comstr_start;
+      cp->nlevels = nlevels;
+      memcpy (cp->levels, levelstart, nlevels * sizeof *levelstart);
+      if (cache->ncheckpoints == cache->size)
+	cache->checkpoints = xpalloc (cache->checkpoints, &cache->size, 1, -1,
+				      sizeof *cache->checkpoints);
+      cache->checkpoints[cache->ncheckpoints++] = cp;
+    }
+  return charpos + PARSE_STATE_CACHE_INTERVAL;
+}
+
+/* Drop the checkpoints of BUF that depend on the text from START on.
+   If PROPERTIES, only the text properties there are changing, which
+   matters only if the checkpoints were computed looking them up.  */
+
+void
+invalidate_parse_state_cache (struct buffer *buf, ptrdiff_t start,
+			      bool properties)
+{
+  struct parse_state_cache *cache;
+  ptrdiff_t lo, hi;
+
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+  cache = buf->parse_state_cache;
+  if (!cache || (properties && !cache->lookup_properties))
+    return;
+
+  /* The state at a checkpoint depends on the character there as well
+     as those before it, since the scan looks at it to tell whether
+     the previous one starts a comment.  */
+  lo = 0, hi = cache->ncheckpoints;
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (cache->checkpoints[mid]->charpos < start)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  drop_parse_checkpoints (cache, lo);
+}
+
 
 static Lisp_Object skip_chars (bool, Lisp_Object, Lisp_Object, bool);
 static Lisp_Object skip_syntaxes (bool, Lisp_Object, Lisp_Object);
@@ -199,6 +415,192 @@ struct gl_state_s gl_state;		/* Global state of syntax parser.  */
 enum { INTERVALS_AT_ONCE = 10 };	/* 1 + max-number of intervals
 					   to scan to property-change.  */
 
+/* Text with many intervals, fontified text for instance, makes
+   update_syntax_table walk the interval tree every INTERVALS_AT_ONCE
+   intervals even where the `syntax-table' property does not change.
+   So while `cache-long-scans' is non-nil, each base buffer keeps the
+   runs of text with the same `syntax-table' property, from BEG up to
+   a frontier which is pushed forward as needed, and update_syntax_table
+   moves from one whole run to the next.  The runs after a position
+   are dropped when the text or text properties there change.  */
+
+/* How many intervals beyond the position looked up to add to the runs
+   at once.  */
+enum { SYNTAX_RUNS_LOOKAHEAD = 256 };
+
+struct syntax_run
+{
+  /* Where the run starts; it ends where the next one starts.  */
+  ptrdiff_t start;
+  /* The `syntax-table' property of the text in the run.  */
+  Lisp_Object value;
+};
+
+struct syntax_runs
+{
+  struct syntax_run *runs;
+  ptrdiff_t nruns, size;
+
+  /* The runs describe the text before FRONTIER.  The last run may go
+     on after FRONTIER.  */
+  ptrdiff_t frontier;
+
+  /* True if the runs cannot go past FRONTIER, because the interval
+     there has a `category' property, through which the `syntax-table'
+     property could change without the text properties changing.  */
+  bool blocked;
+
+  /* The index of the run last looked up.  */
+  ptrdiff_t last;
+};
+
+void
+free_syntax_runs (struct syntax_runs *sr)
+{
+  xfree (sr->runs);
+  xfree (sr);
+}
+
+void
+mark_syntax_runs (struct syntax_runs *sr)
+{
+  ptrdiff_t i;
+
+  for (i = 0; i < sr->nruns; i++)
+    mark_object (sr->runs[i].value);
+}
+
+/* Drop the runs of BUF that describe the text from START on.  */
+
+void
+invalidate_syntax_runs (struct buffer *buf, ptrdiff_t start)
+{
+  struct syntax_runs *sr;
+
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+  sr = buf->syntax_runs;
+  if (!sr || sr->frontier <= start)
+    return;
+
+  sr->frontier = max (start, BUF_BEG (buf));
+  sr->blocked = false;
+  while (sr->nruns > 0 && sr->runs[sr->nruns - 1].start >= sr->frontier)
+    sr->nruns--;
+  sr->last = 0;
+}
+
+/* Add to SR the runs of the current buffer's text up to at least
+   CHARPOS.  Return false if that is not possible.  */
+
+static bool
+extend_syntax_runs (struct syntax_runs *sr, ptrdiff_t charpos)
+{
+  INTERVAL i = buffer_intervals (current_buffer);
+  int n = 0;
+
+  if (!i)
+    {
+      /* There are no text properties at all.  */
+      if (sr->nruns == 0 || !NILP (sr->runs[sr->nruns - 1].value))
+	{
+	  if (sr->nruns == sr->size)
+	    sr->runs = xpalloc (sr->runs, &sr->size, 1, -1, sizeof *sr->runs);
+	  sr->runs[sr->nruns].start = sr->frontier;
+	  sr->runs[sr->nruns++].value = Qnil;
+	}
+      sr->frontier = Z;
+      return true;
+    }
+
+  for (i = find_interval (i, sr->frontier);
+       i && !sr->blocked && (sr->frontier <= charpos
+			     || n++ < SYNTAX_RUNS_LOOKAHEAD);
+       i = next_interval (i))
+    {
+      Lisp_Object value;
+
+      if (!NILP (Fplist_get (i->plist, Qcategory)))
+	{
+	  sr->blocked = true;
+	  break;
+	}
+      value = textget (i->plist, Qsyntax_table);
+      if (sr->nruns == 0 || !EQ (value, sr->runs[sr->nruns - 1].value))
+	{
+	  if (sr->nruns == sr->size)
+	    sr->runs = xpalloc (sr->runs, &sr->size, 1, -1, sizeof *sr->runs);
+	  sr->runs[sr->nruns].start = sr->frontier;
+	  sr->runs[sr->nruns++].value = value;
+	}
+      sr->frontier = INTERVAL_LAST_POS (i);
+    }
+  return charpos < sr->frontier;
+}
+
+static void set_syntax_table_property (Lisp_Object);
+
+/* Update gl_state for CHARPOS in the current buffer from the runs of
+   its `syntax-table' property.  Return false if the runs cannot be
+   used, in which case gl_state is left alone.  */
+
+static bool
+update_syntax_table_from_runs (ptrdiff_t charpos)
+{
+  struct buffer *buf = (current_buffer->base_buffer
+			? current_buffer->base_buffer : current_buffer);
+  struct syntax_runs *sr = buf->syntax_runs;
+  ptrdiff_t lo, hi, end;
+
+  if (NILP (BVAR (current_buffer, cache_long_scans))
+      || !NILP (Fassq (Qsyntax_table, Vchar_property_alias_alist))
+      || charpos < BEG || charpos >= Z)
+    return false;
+
+  if (!sr)
+    {
+      sr = buf->syntax_runs = xzalloc (sizeof *sr);
+      sr->frontier = BEG;
+    }
+  if (charpos >= sr->frontier && !extend_syntax_runs (sr, charpos))
+    return false;
+
+  /* Scans mostly move to the next or previous run.  */
+  lo = sr->last;
+  if (lo >= sr->nruns)
+    lo = 0;
+  if (sr->runs[lo].start <= charpos
+      && (lo + 1 == sr->nruns || charpos < sr->runs[lo + 1].start))
+    ;
+  else if (lo + 2 <= sr->nruns && sr->runs[lo + 1].start <= charpos
+	   && (lo + 2 == sr->nruns || charpos < sr->runs[lo + 2].start))
+    lo++;
+  else if (lo > 0 && sr->runs[lo - 1].start <= charpos
+	   && charpos < sr->runs[lo].start)
+    lo--;
+  else
+    {
+      lo = 0, hi = sr->nruns;
+      while (hi - lo > 1)
+	{
+	  ptrdiff_t mid = lo + (hi - lo) / 2;
+	  if (sr->runs[mid].start <= charpos)
+	    lo = mid;
+	  else
+	    hi = mid;
+	}
+    }
+  sr->last = lo;
+
+  end = lo + 1 < sr->nruns ? sr->runs[lo + 1].start : sr->frontier;
+  gl_state.b_property = sr->runs[lo].start - gl_state.offset;
+  gl_state.e_property = end == Z ? gl_state.stop : end - gl_state.offset;
+  /* The intervals are not kept up to date any more.  */
+  gl_state.forward_i = gl_state.backward_i = NULL;
+  set_syntax_table_property (sr->runs[lo].value);
+  return true;
+}
+
 /* Set the syntax entry VAL for char C in table TABLE.  */
 
 static void
@@ -326,6 +728,14 @@ update_syntax_table (ptrdiff_t charpos, EMACS_INT count, bool init,
       gl_state.old_prop = Qnil;
       gl_state.start = gl_state.b_property;
       gl_state.stop = gl_state.e_property;
+    }
+
+  if (NILP (object) && update_syntax_table_from_runs (charpos))
+    return;
+
+  /* If the runs were used before, find the interval afresh.  */
+  if (init || (!gl_state.forward_i && !gl_state.backward_i))
+    {
       i = interval_of (charpos, object);
       gl_state.backward_i = gl_state.forward_i = i;
       invalidate = false;
@@ -404,25 +814,7 @@ update_syntax_table (ptrdiff_t charpos, EMACS_INT count, bool init,
 	}
     }
 
-  if (!EQ (tmp_table, gl_state.old_prop))
-    {
-      gl_state.current_syntax_table = tmp_table;
-      gl_state.old_prop = tmp_table;
-      if (EQ (Fsyntax_table_p (tmp_table), Qt))
-	{
-	  gl_state.use_global = 0;
-	}
-      else if (CONSP (tmp_table))
-	{
-	  gl_state.use_global = 1;
-	  gl_state.global_code = tmp_table;
-	}
-      else
-	{
-	  gl_state.use_global = 0;
-	  gl_state.current_syntax_table = BVAR (current_buffer, syntax_table);
-	}
-    }
+  set_syntax_table_property (tmp_table);
 
   while (i)
     {
@@ -473,6 +865,33 @@ update_syntax_table (ptrdiff_t charpos, EMACS_INT count, bool init,
     gl_state.b_property = gl_state.start;
 }
 
+/* Make gl_state use the syntax described by the `syntax-table'
+   property value PROP.  */
+
+static void
+set_syntax_table_property (Lisp_Object prop)
+{
+  if (!EQ (prop, gl_state.old_prop))
+    {
+      gl_state.current_syntax_table = prop;
+      gl_state.old_prop = prop;
+      if (EQ (Fsyntax_table_p (prop), Qt))
+	{
+	  gl_state.use_global = 0;
+	}
+      else if (CONSP (prop))
+	{
+	  gl_state.use_global = 1;
+	  gl_state.global_code = prop;
+	}
+      else
+	{
+	  gl_state.use_global = 0;
+	  gl_state.current_syntax_table = BVAR (current_buffer, syntax_table);
+	}
+    }
+}
+
 static void
 parse_sexp_propertize (ptrdiff_t charpos)
 {
@@ -1243,6 +1662,7 @@ usage: (modify-syntax-entry CHAR NEWENTRY &optional SYNTAX-TABLE)  */)
   /* We clear the regexp cache, since character classes can now have
      different values from those in the compiled regexps.*/
   clear_regexp_cache ();
+  syntax_modiff++;
 
   return Qnil;
 }
@@ -1615,6 +2035,91 @@ of this is the distance traveled.  */)
   return skip_syntaxes (0, syntax, lim);
 }
 
+/* Return the first address in [P, STOP) whose byte B does not have
+   MAP[B] set, or whose value is not below LIMIT; return STOP if there
+   is none.  Every entry of MAP must be 0 or 1.  LIMIT is 0200 when
+   only ASCII bytes may be skipped, as in a multibyte buffer, where
+   each such byte is a whole character.
+
+   The loop looks at eight bytes per iteration, combining their table
+   entries without branching, so long runs of skippable text such as
+   indentation or words are crossed several times faster than one
+   byte at a time.  */
+
+static unsigned char *
+skip_byte_run_forward (unsigned char const *map, int limit,
+		       unsigned char *p, unsigned char *stop)
+{
+  while (stop - p >= 8
+	 && (map[p[0]] & map[p[1]] & map[p[2]] & map[p[3]]
+	     & map[p[4]] & map[p[5]] & map[p[6]] & map[p[7]])
+	 && (p[0] | p[1] | p[2] | p[3] | p[4] | p[5] | p[6] | p[7]) < limit)
+    p += 8;
+  while (p < stop && *p < limit && map[*p])
+    p++;
+  return p;
+}
+
+/* Likewise, but scan backward from P, looking at the bytes before it,
+   and return the address just after the last byte in [STOP, P) that
+   cannot be skipped.  */
+
+static unsigned char *
+skip_byte_run_backward (unsigned char const *map, int limit,
+			unsigned char *p, unsigned char *stop)
+{
+  while (p - stop >= 8
+	 && (map[p[-1]] & map[p[-2]] & map[p[-3]] & map[p[-4]]
+	     & map[p[-5]] & map[p[-6]] & map[p[-7]] & map[p[-8]])
+	 && (p[-1] | p[-2] | p[-3] | p[-4]
+	     | p[-5] | p[-6] | p[-7] | p[-8]) < limit)
+    p -= 8;
+  while (p > stop && p[-1] < limit && map[p[-1]])
+    p--;
+  return p;
+}
+
+/* Number of characters skip_syntaxes examines one at a time before it
+   builds a table of the syntax of each byte and switches to the
+   kernels above.  Short skips, which are the common case, never pay
+   for the table.  */
+
+enum { SKIP_SYNTAX_MAP_THRESHOLD = 32 };
+
+/* Return the syntax table that gl_state currently uses for every
+   character, or the syntax entry that it uses for all of them.  */
+
+static Lisp_Object
+syntax_byte_map_key (void)
+{
+  return (gl_state.use_global
+	  ? gl_state.global_code : gl_state.current_syntax_table);
+}
+
+/* Return true if a byte map filled while syntax_byte_map_key returned
+   KEY and syntax_modiff was MODIFF is still good.  */
+
+static bool
+syntax_byte_map_valid_p (Lisp_Object key, EMACS_INT modiff)
+{
+  return EQ (key, syntax_byte_map_key ()) && modiff == syntax_modiff;
+}
+
+/* Store in MAP, for each byte B below LIMIT, the entry of FASTMAP for
+   the syntax of the character B in gl_state's current syntax; clear
+   the entries of the other bytes.  */
+
+static void
+fill_syntax_byte_map (unsigned char *map, unsigned char const *fastmap,
+		      int limit)
+{
+  int b;
+
+  for (b = 0; b < limit; b++)
+    map[b] = fastmap[SYNTAX (b)];
+  memset (map + limit, 0, 0400 - limit);
+}
+
 static Lisp_Object
 skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim,
 	    bool handle_iso_classes)
@@ -1977,6 +2482,15 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim,
 		  p = GAP_END_ADDR;
 		  stop = endp;
 		}
+	      if (NILP (iso_classes))
+		{
+		  unsigned char *q
+		    = skip_byte_run_forward ((unsigned char *) fastmap, 0200,
+					     p, stop);
+		  pos += q - p, pos_byte += q - p, p = q;
+		  if (p >= stop)
+		    continue;
+		}
 	      c = STRING_CHAR_AND_LENGTH (p, nbytes);
 	      if (! NILP (iso_classes) && in_classes (c, iso_classes))
 		{
@@ -2017,6 +2531,15 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim,
 		  p = GAP_END_ADDR;
 		  stop = endp;
 		}
+	      if (NILP (iso_classes))
+		{
+		  unsigned char *q
+		    = skip_byte_run_forward ((unsigned char *) fastmap, 0400,
+					     p, stop);
+		  pos += q - p, pos_byte += q - p, p = q;
+		  if (p >= stop)
+		    continue;
+		}
 
 	      if (!NILP (iso_classes) && in_classes (*p, iso_classes))
 		{
@@ -2046,6 +2569,15 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim,
 		  p = GPT_ADDR;
 		  stop = endp;
 		}
+	      if (NILP (iso_classes))
+		{
+		  unsigned char *q
+		    = skip_byte_run_backward ((unsigned char *) fastmap, 0200,
+					      p, stop);
+		  pos -= p - q, pos_byte -= p - q, p = q;
+		  if (p <= stop)
+		    continue;
+		}
 	      prev_p = p;
 	      while (--p >= stop && ! CHAR_HEAD_P (*p));
 	      c = STRING_CHAR (p);
@@ -2082,6 +2614,15 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim,
 		  p = GPT_ADDR;
 		  stop = endp;
 		}
+	      if (NILP (iso_classes))
+		{
+		  unsigned char *q
+		    = skip_byte_run_backward ((unsigned char *) fastmap, 0400,
+					      p, stop);
+		  pos -= p - q, pos_byte -= p - q, p = q;
+		  if (p <= stop)
+		    continue;
+		}
 
 	      if (! NILP (iso_classes) && in_classes (p[-1], iso_classes))
 		{
@@ -2172,6 +2713,13 @@ skip_syntaxes (bool forwardp, Lisp_Object string, Lisp_Object lim)
     ptrdiff_t pos = PT;
     ptrdiff_t pos_byte = PT_BYTE;
     unsigned char *p, *endp, *stop;
+    /* The syntax of each byte that can be skipped as a whole
+       character, valid while syntax_byte_map_valid_p says so.  */
+    unsigned char map[0400];
+    Lisp_Object map_key = Qnil;
+    EMACS_INT map_modiff = 0;
+    int map_limit = multibyte ? 0200 : 0400;
+    int slow = 0;
 
     immediate_quit = 1;
     SETUP_SYNTAX_TABLE (pos, forwardp ? 1 : -1);
@@ -2195,6 +2743,21 @@ skip_syntaxes (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		    p = GAP_END_ADDR;
 		    stop = endp;
 		  }
+		if (syntax_byte_map_valid_p (map_key, map_modiff))
+		  {
+		    unsigned char *run_end = stop, *q;
+
+		    if (parse_sexp_lookup_properties
+			&& gl_state.e_property - pos < stop - p)
+		      run_end = p + (gl_state.e_property - pos);
+		    if (p < run_end)
+		      {
+			q = skip_byte_run_forward (map, map_limit, p, run_end);
+			pos += q - p, pos_byte += q - p, p = q;
+			if (p >= run_end)
+			  continue;
+		      }
+		  }
 		if (multibyte)
 		  c = STRING_CHAR_AND_LENGTH (p, nbytes);
 		else
@@ -2202,6 +2765,13 @@ skip_syntaxes (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		if (! fastmap[SYNTAX (c)])
 		  goto done;
 		p += nbytes, pos++, pos_byte += nbytes;
+		if (++slow == SKIP_SYNTAX_MAP_THRESHOLD)
+		  {
+		    fill_syntax_byte_map (map, fastmap, map_limit);
+		    map_key = syntax_byte_map_key ();
+		    map_modiff = syntax_modiff;
+		    slow = 0;
+		  }
 	      }
 	    while (!parse_sexp_lookup_properties
 		   || pos < gl_state.e_property);
@@ -2230,12 +2800,31 @@ skip_syntaxes (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		    stop = endp;
 		  }
 		UPDATE_SYNTAX_TABLE_BACKWARD (pos - 1);
+		if (syntax_byte_map_valid_p (map_key, map_modiff))
+		  {
+		    unsigned char *run_end = stop, *q;
+
+		    if (parse_sexp_lookup_properties
+			&& pos - gl_state.b_property < p - stop)
+		      run_end = p - (pos - gl_state.b_property);
+		    q = skip_byte_run_backward (map, map_limit, p, run_end);
+		    pos -= p - q, pos_byte -= p - q, p = q;
+		    if (p <= run_end)
+		      continue;
+		  }
 		prev_p = p;
 		while (--p >= stop && ! CHAR_HEAD_P (*p));
 		c = STRING_CHAR (p);
 		if (! fastmap[SYNTAX (c)])
 		  break;
 		pos--, pos_byte -= prev_p - p;
+		if (++slow == SKIP_SYNTAX_MAP_THRESHOLD)
+		  {
+		    fill_syntax_byte_map (map, fastmap, map_limit);
+		    map_key = syntax_byte_map_key ();
+		    map_modiff = syntax_modiff;
+		    slow = 0;
+		  }
 	      }
 	  }
 	else
@@ -2250,9 +2839,28 @@ skip_syntaxes (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		    stop = endp;
 		  }
 		UPDATE_SYNTAX_TABLE_BACKWARD (pos - 1);
+		if (syntax_byte_map_valid_p (map_key, map_modiff))
+		  {
+		    unsigned char *run_end = stop, *q;
+
+		    if (parse_sexp_lookup_properties
+			&& pos - gl_state.b_property < p - stop)
+		      run_end = p - (pos - gl_state.b_property);
+		    q = skip_byte_run_backward (map, map_limit, p, run_end);
+		    pos -= p - q, pos_byte -= p - q, p = q;
+		    if (p <= run_end)
+		      continue;
+		  }
 		if (! fastmap[SYNTAX (p[-1])])
 		  break;
 		p--, pos--, pos_byte--;
+		if (++slow == SKIP_SYNTAX_MAP_THRESHOLD)
+		  {
+		    fill_syntax_byte_map (map, fastmap, map_limit);
+		    map_key = syntax_byte_map_key ();
+		    map_modiff = syntax_modiff;
+		    slow = 0;
+		  }
 	      }
 	  }
       }
@@ -3126,7 +3734,6 @@ scan_sexps_forward (struct lisp_parse_state *stateptr,
   enum syntaxcode code;
   int c1;
   bool comnested;
-  struct level { ptrdiff_t last, prev; };
   struct level levelstart[100];
   struct level *curlevel = levelstart;
   struct level *endlevel = levelstart + 100;
@@ -3144,11 +3751,12 @@ scan_sexps_forward (struct lisp_parse_state *stateptr,
   bool found;
   ptrdiff_t out_bytepos, out_charpos;
   int temp;
-
-  prev_from = from;
-  prev_from_byte = from_byte;
-  if (from != BEGV)
-    DEC_BOTH (prev_from, prev_from_byte);
+  /* The parse state cache, if this scan can use it, the checkpoint it
+     resumes from, and where to record the next checkpoint.  */
+  struct parse_state_cache *cache = NULL;
+  EMACS_INT cache_tick = 0;
+  struct parse_checkpoint *checkpoint = NULL;
+  ptrdiff_t next_checkpoint = PTRDIFF_MAX;
 
   /* Use this macro instead of `from++'.  */
 #define INC_FROM				\
@@ -3164,7 +3772,37 @@ do { prev_from = from;				\
   immediate_quit = 1;
   QUIT;
 
-  if (NILP (oldstate))
+  /* A scan from the beginning of the buffer that stops only at END
+     can resume from the last checkpoint before END.  */
+  if (from == BEG && NILP (oldstate) && targetdepth == TYPE_MINIMUM (EMACS_INT)
+      && !stopbefore && !commentstop)
+    cache = parse_state_cache ();
+  if (cache)
+    {
+      cache_tick = cache->tick;
+      checkpoint = parse_checkpoint_before (cache, end);
+      if (checkpoint)
+	{
+	  from = checkpoint->charpos;
+	  from_byte = checkpoint->bytepos;
+	}
+      next_checkpoint = from + PARSE_STATE_CACHE_INTERVAL;
+    }
+
+  prev_from = from;
+  prev_from_byte = from_byte;
+  if (from != BEGV)
+    DEC_BOTH (prev_from, prev_from_byte);
+
+  if (checkpoint)
+    {
+      depth = checkpoint->depth;
+      state.instring = -1;
+      state.incomment = 0;
+      state.comstyle = 0;
+      state.comstr_start = checkpoint->comstr_start;
+    }
+  else if (NILP (oldstate))
     {
       depth = 0;
       state.instring = -1;
@@ -3234,6 +3872,14 @@ do { prev_from = from;				\
   curlevel->prev = -1;
   curlevel->last = -1;
 
+  if (checkpoint)
+    {
+      mindepth = checkpoint->mindepth;
+      memcpy (levelstart, checkpoint->levels,
+	      checkpoint->nlevels * sizeof *levelstart);
+      curlevel = levelstart + checkpoint->nlevels - 1;
+    }
+
   SETUP_SYNTAX_TABLE (prev_from, 1);
   temp = FETCH_CHAR (prev_from_byte);
   prev_from_syntax = SYNTAX_WITH_FLAGS (temp);
@@ -3256,6 +3902,13 @@ do { prev_from = from;				\
   while (from < end)
     {
       int syntax;
+
+      if (from >= next_checkpoint)
+	next_checkpoint = add_parse_checkpoint (cache, cache_tick,
+						from, from_byte,
+						depth, mindepth,
+						state.comstr_start,
+						levelstart, curlevel);
       INC_FROM;
       code = prev_from_syntax & 0xff;
 
@@ -1568,7 +1568,7 @@ handle_arith_signal (int sig)
 
 /* Alternate stack used by SIGSEGV handler below.  */
 
-static unsigned char sigsegv_stack[SIGSTKSZ];
+static unsigned char sigsegv_stack[65536];
 
 
 /* Return true if SIGINFO indicates a stack overflow.  */
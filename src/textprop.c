@@ -85,6 +85,8 @@ modify_text_properties (Lisp_Object buffer, Lisp_Object start, Lisp_Object end)
   set_buffer_internal (buf);
 
   prepare_to_modify_buffer_1 (b, e, NULL);
+  invalidate_parse_state_cache (buf, b, true);
+  invalidate_syntax_runs (buf, b);
 
   BUF_COMPUTE_UNCHANGED (buf, b - 1, e);
   if (MODIFF <= SAVE_MODIFF)
@@ -31,6 +31,14 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
    an undo-boundary.  */
 static Lisp_Object pending_boundary;
 
+/* The longest text that record_delete and record_change accumulate
+   in one undo entry by merging a change with the one recorded just
+   before it.  Each merge copies the text recorded so far, so this
+   bounds the copying while still cutting the number of entries, and
+   of the strings they hold, by a large factor when a Lisp loop
+   deletes or replaces one character at a time.  */
+enum { UNDO_COALESCE_MAX = 64 };
+
 /* Prepare the undo info for recording a change. */
 static void
 prepare_record (void)
@@ -160,13 +168,30 @@ record_marker_adjustments (ptrdiff_t from, ptrdiff_t to)
     }
 }
 
+/* Return true if ELT is a deletion entry (TEXT . POSITION) of the
+   undo list LIST, as pushed by record_delete, with no marker
+   adjustments recorded for it, and with text short enough for
+   another change to be merged into it.  */
+
+static bool
+mergeable_deletion_p (Lisp_Object elt, Lisp_Object list)
+{
+  Lisp_Object next;
+
+  if (! (CONSP (elt) && STRINGP (XCAR (elt)) && INTEGERP (XCDR (elt))
+	 && SCHARS (XCAR (elt)) < UNDO_COALESCE_MAX))
+    return false;
+  next = CONSP (list) ? XCAR (list) : Qnil;
+  return ! (CONSP (next) && MARKERP (XCAR (next)));
+}
+
 /* Record that a deletion is about to take place, of the characters in
    STRING, at location BEG.  Optionally record adjustments for markers
    in the region STRING occupies in the current buffer.  */
 void
 record_delete (ptrdiff_t beg, Lisp_Object string, bool record_markers)
 {
-  Lisp_Object sbeg;
+  Lisp_Object sbeg, list;
 
   if (EQ (BVAR (current_buffer, undo_list), Qt))
     return;
@@ -187,9 +212,34 @@ record_delete (ptrdiff_t beg, Lisp_Object string, bool record_markers)
   /* primitive-undo assumes marker adjustments are recorded
      immediately before the deletion is recorded.  See bug 16818
      discussion.  */
+  list = BVAR (current_buffer, undo_list);
   if (record_markers)
     record_marker_adjustments (beg, beg + SCHARS (string));
 
+  /* If this deletion continues the one recorded just before it, as
+     when deleting forward or backward a character at a time, and no
+     markers had to be adjusted for either, combine the two.  */
+  if (EQ (list, BVAR (current_buffer, undo_list))
+      && CONSP (list)
+      && mergeable_deletion_p (XCAR (list), XCDR (list)))
+    {
+      Lisp_Object elt = XCAR (list);
+      EMACS_INT prev = XINT (XCDR (elt));
+
+      if (XINT (sbeg) > 0 && prev == XINT (sbeg))
+	{
+	  XSETCAR (elt, concat2 (XCAR (elt), string));
+	  return;
+	}
+      if (XINT (sbeg) < 0 && prev < 0
+	  && beg + SCHARS (string) == -prev)
+	{
+	  XSETCAR (elt, concat2 (string, XCAR (elt)));
+	  XSETCDR (elt, sbeg);
+	  return;
+	}
+    }
+
   bset_undo_list
     (current_buffer,
      Fcons (Fcons (string, sbeg), BVAR (current_buffer, undo_list)));
@@ -202,6 +252,33 @@ record_delete (ptrdiff_t beg, Lisp_Object string, bool record_markers)
 void
 record_change (ptrdiff_t beg, ptrdiff_t length)
 {
+  Lisp_Object list = BVAR (current_buffer, undo_list);
+
+  /* If the last change recorded was a replacement of the text just
+     before BEG, as when a Lisp loop or translate-region replaces
+     characters one at a time, extend its entries to cover this one.
+     Don't do this when record_point would need to record anything,
+     so that the entries stay in the order it expects.  */
+  if (CONSP (list) && CONSP (XCDR (list))
+      && MODIFF > SAVE_MODIFF
+      && PT != beg + length)
+    {
+      Lisp_Object ins = XCAR (list), del = XCAR (XCDR (list));
+
+      if (CONSP (ins) && INTEGERP (XCAR (ins)) && INTEGERP (XCDR (ins))
+	  && XINT (XCDR (ins)) == beg
+	  && mergeable_deletion_p (del, XCDR (XCDR (list)))
+	  && XINT (XCDR (del)) == XINT (XCAR (ins))
+	  && SCHARS (XCAR (del)) == beg - XINT (XCAR (ins)))
+	{
+	  prepare_record ();
+	  XSETCAR (del, concat2 (XCAR (del),
+				 make_buffer_string (beg, beg + length, true)));
+	  XSETCDR (ins, make_number (beg + length));
+	  return;
+	}
+    }
+
   record_delete (beg, make_buffer_string (beg, beg + length, true), false);
   record_insert (beg, length);
 }
@@ -13524,6 +13524,9 @@ redisplay_internal (void)
   /* True means redisplay has to redisplay the miniwindow.  */
   bool update_miniwindow_p = false;
 
+  /* When this redisplay started.  */
+  struct timespec start;
+
   TRACE ((stderr, "redisplay_internal %d\n", redisplaying_p));
 
   /* No redisplay if running in batch mode or frame is not yet fully
@@ -13551,6 +13554,8 @@ redisplay_internal (void)
   if (redisplaying_p)
     return;
 
+  start = current_timespec ();
+
   /* Record a function that clears redisplaying_p
      when we leave this function.  */
   count = SPECPDL_INDEX ();
@@ -14291,6 +14296,10 @@ redisplay_internal (void)
   if (interrupt_input && interrupts_deferred)
     request_sigio ();
 
+  record_latency (LATENCY_REDISPLAY, start);
+  if (!pending)
+    record_input_latency ();
+
   unbind_to (count, Qnil);
   RESUME_POLLING;
 }
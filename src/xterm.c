@@ -12518,6 +12518,9 @@ x_delete_terminal (struct terminal *terminal)
     xim_close_dpy (dpyinfo);
 #endif
 
+  /* No more input on this descriptor.  */
+  delete_keyboard_wait_descriptor (dpyinfo->connection);
+
   /* Normally, the display is available...  */
   if (dpyinfo->display)
     {
@@ -12571,8 +12574,6 @@ x_delete_terminal (struct terminal *terminal)
   else if (dpyinfo->connection >= 0)
     emacs_close (dpyinfo->connection);
 
-  /* No more input on this descriptor.  */
-  delete_keyboard_wait_descriptor (dpyinfo->connection);
   /* Mark as dead. */
   dpyinfo->connection = -1;
 
@@ -20,6 +20,7 @@
 ;;; Code:
 
 (require 'ert)
+(require 'cl-lib)
 
 (ert-deftest overlay-modification-hooks-message-other-buf ()
   "Test for bug#21824.
@@ -45,4 +46,72 @@ with parameters from the *Messages* buffer modification."
             (should (eq buf (current-buffer))))
         (when msg-ov (delete-overlay msg-ov))))))
 
+(ert-deftest gap-motion-bytes-insert-before-full-gap ()
+  "Growing the gap before point should copy the moved text only once."
+  (with-temp-buffer
+    (insert (make-string 1000 ?a))
+    (should (= (gap-position) (point-max)))
+    (goto-char 501)
+    (let ((before (gap-motion-bytes)))
+      (insert (make-string (1+ (gap-size)) ?b))
+      (should (= (- (gap-motion-bytes) before) 500)))))
+
+(ert-deftest compute-motion-width-run-cache ()
+  "Test that the width run cache agrees with scanning the text.
+The display table makes some characters two columns wide, so the
+cache records runs of width 2 as well as runs of width 1."
+  (let ((buf (generate-new-buffer " *compute-motion*")))
+    (unwind-protect
+        (save-window-excursion
+          (switch-to-buffer buf)
+          (set-buffer-multibyte nil)
+          (let ((table (make-display-table)))
+            (aset table ?x (vector ?x ?x))
+            (setq buffer-display-table table))
+          (dotimes (_ 3)
+            (insert (make-string 50 ?a) (make-string 3000 ?x)
+                    (make-string 20 ?b) "\n"))
+          (cl-flet ((motions ()
+                      (mapcar (lambda (args)
+                                (apply #'compute-motion 1 '(0 . 0) args))
+                              `((,(point-max) (10000 . 200) 80 nil nil)
+                                (2000 (10000 . 200) 80 nil nil)
+                                (,(point-max) (31 . 5) 80 nil nil)
+                                (,(point-max) (30 . 5) 200 nil nil)))))
+            (let ((plain (progn (setq cache-long-scans nil) (motions))))
+              (setq cache-long-scans t)
+              ;; The first pass fills the cache and the second uses it.
+              (should (equal (motions) plain))
+              (should (equal (motions) plain))
+              ;; Changing the text invalidates the cached runs.
+              (goto-char 2000)
+              (insert "yyy")
+              (let ((changed (motions)))
+                (setq cache-long-scans nil)
+                (should (equal changed (motions)))))))
+      (kill-buffer buf))))
+
+(ert-deftest compute-motion-width-run-cache-newline-glyph ()
+  "Test the width run cache with a display vector holding a newline.
+Characters displayed as such vectors, like whitespace-mode's `$'
+marker for newlines, have no fixed width and must not be cached."
+  (let ((buf (generate-new-buffer " *compute-motion*")))
+    (unwind-protect
+        (save-window-excursion
+          (switch-to-buffer buf)
+          (set-buffer-multibyte nil)
+          (let ((table (make-display-table)))
+            (aset table ?\n (vector ?$ ?\n))
+            (setq buffer-display-table table))
+          (insert (make-string 150 ?\n) "abc\n")
+          (cl-flet ((motion ()
+                      (compute-motion 1 '(0 . 0) (point-max) '(10000 . 10000)
+                                      80 nil nil)))
+            (let ((plain (progn (setq cache-long-scans nil) (motion))))
+              (should (= (nth 2 plain) 151))
+              (setq cache-long-scans t)
+              (should (equal (motion) plain))
+              (should (equal (motion) plain)))))
+      (kill-buffer buf))))
+
 ;;; buffer-tests.el ends here
@@ -30,5 +30,115 @@
   (let ((last-command-event ?a))
     (should-error (self-insert-command -1))))
 
+(defun cmds-tests--forward-line-expected (start n)
+  "Return what `forward-line' N from START should return, and where.
+The value is (SHORTAGE . POSITION).  It is computed by counting the
+newlines in a copy of the buffer text, independently of the line
+index and the newline cache."
+  (let ((text (buffer-substring-no-properties (point-min) (point-max)))
+        (pos (- start (point-min)))
+        (count 0)
+        found)
+    (while (and (< count n)
+                (setq found (string-match "\n" text pos)))
+      (setq count (1+ count)
+            pos (1+ found)))
+    (cons (if (and (< count n) (< pos (length text)))
+              (- n count 1)
+            (- n count))
+          (if (< count n) (point-max) (+ pos (point-min))))))
+
+(ert-deftest forward-line-over-many-lines-after-edits ()
+  "Test `forward-line' over many lines with `cache-long-scans' on.
+Long moves use the sampled line index, which must survive edits
+before and after the sampled positions."
+  (with-temp-buffer
+    (setq-local cache-long-scans t)
+    (dotimes (i 20000)
+      (insert (format "line %d\n" i)))
+    (let ((check
+           (lambda ()
+             (dolist (start '(1 5000 60000 100000))
+               (dolist (n '(1500 15000 25000))
+                 (goto-char start)
+                 (let ((shortage (forward-line n)))
+                   (should (equal (cons shortage (point))
+                                  (cmds-tests--forward-line-expected
+                                   start n)))))))))
+      (funcall check)
+      (goto-char 100)
+      (insert "one\ntwo\n")
+      (funcall check)
+      (delete-region 200 2000)
+      (funcall check)
+      (goto-char 90000)
+      (insert (make-string 3000 ?\n))
+      (funcall check)
+      (subst-char-in-region 3000 3100 ?\n ?x)
+      (funcall check)
+      (delete-region 50000 60000)
+      (funcall check)
+      (goto-char (point-max))
+      (insert "last")
+      (funcall check))))
+
+(ert-deftest latency-histogram-buckets ()
+  "Test the shape of `latency-histogram' and `clear-latencies'."
+  (dolist (stage '(input read-char pre-command-hook command
+                   post-command-hook redisplay update-frame flush))
+    (let ((histogram (latency-histogram stage)))
+      (should (= (length histogram) 12))
+      (should (equal (car (nth 0 histogram)) 0.001))
+      (should (equal (car (nth 10 histogram)) 1.024))
+      (should (null (car (nth 11 histogram))))
+      (should (= (apply #'+ (mapcar #'cdr histogram))
+                 (length (latency-samples stage))))
+      (clear-latencies stage)
+      (should (null (latency-samples stage)))))
+  (should-error (latency-samples 'no-such-stage))
+  (should-error (latency-histogram 'no-such-stage)))
+
+(ert-deftest latency-samples-recorded ()
+  "Test that the command loop records the latencies of its stages."
+  (dolist (stage '(pre-command-hook command post-command-hook))
+    (clear-latencies stage))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    ;; Two self-inserting keys, then one that exits the command loop
+    ;; before the command stage ends.
+    (setq unread-command-events (list ?a ?b ?\C-\M-c))
+    (recursive-edit)
+    (should (equal (buffer-string) "ab")))
+  (should (= (length (latency-samples 'pre-command-hook)) 3))
+  (should (= (length (latency-samples 'command)) 2))
+  (should (= (length (latency-samples 'post-command-hook)) 2))
+  (dolist (sample (latency-samples 'command))
+    (should (and (floatp sample) (>= sample 0))))
+  ;; The histogram counts the samples that are left after clearing a
+  ;; stage, not those of earlier, slower commands.
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (let ((map (make-sparse-keymap)))
+      (define-key map "s" (lambda () (interactive) (sleep-for 0.1)))
+      (use-local-map map))
+    (clear-latencies)
+    (setq unread-command-events (list ?s ?s ?s ?\C-\M-c))
+    (recursive-edit)
+    (clear-latencies 'command)
+    (setq unread-command-events (list ?a ?b ?\C-\M-c))
+    (recursive-edit))
+  (let ((samples (latency-samples 'command))
+        (low -1))
+    (should (= (length samples) 2))
+    (dolist (bucket (latency-histogram 'command))
+      (let ((high (car bucket)))
+        (should (= (cdr bucket)
+                   (length (delq nil (mapcar (lambda (sample)
+                                               (and (> sample low)
+                                                    (or (null high)
+                                                        (<= sample high))))
+                                             samples)))))
+        (setq low high)))))
+
 (provide 'cmds-tests)
 ;;; cmds-tests.el ends here
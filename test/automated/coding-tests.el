@@ -48,3 +48,16 @@
          (let ((coding-system-for-write (intern "\"us-ascii\"")))
            (write-region "some text" nil test-file))))
     (coding-tests-remove-files)))
+
+(ert-deftest ert-test-coding-decode-dos-eol ()
+  ;; Only CRs that are followed by an LF are removed.
+  (should (equal (decode-coding-string "a\r\nb\r\rc\r\n\r" 'latin-1-dos)
+                 "a\nb\r\rc\n\r"))
+  (should (equal (decode-coding-string "a\rb\rc" 'latin-1-mac) "a\nb\nc"))
+  ;; Decoding in a buffer with undo enabled deletes the CRs one by
+  ;; one; make sure both ways agree.
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert "p\r\nq\r\r\nz\r\n")
+    (decode-coding-region (point-min) (point-max) 'utf-8-dos)
+    (should (equal (buffer-string) "p\nq\r\nz\n"))))
@@ -0,0 +1,139 @@
+;;; keyboard-tests.el --- Test suite for src/keyboard.c
+
+;; Copyright (C) 2017 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Keystrokes only go through the input queue of keyboard.c when
+;; Emacs reads them from a terminal, so these tests type them into an
+;; Emacs running on a pty.
+
+;;; Code:
+
+(require 'ert)
+
+(defun keyboard-tests--wait-for (file proc)
+  "Wait until FILE exists, reading output from PROC meanwhile."
+  (with-timeout (30 (error "Timed out waiting for %s" file))
+    (while (not (file-exists-p file))
+      (accept-process-output proc 0.05))))
+
+(defun keyboard-tests--type (setup keys)
+  "Type KEYS at once into an Emacs on a terminal and return a log.
+The Emacs visits a buffer of 100 lines, with point at its start, and
+evaluates SETUP.  KEYS all arrive before it reads the first of them,
+so they are queued in its input buffer.  The log lists, for each
+`next-line' command run, its numeric prefix argument and the line
+number of point after it."
+  (let* ((dir (make-temp-file "keyboard-tests" t))
+         (ready (expand-file-name "ready" dir))
+         (out (expand-file-name "out" dir))
+         (script (expand-file-name "script.el" dir))
+         (process-environment (cons "TERM=xterm" process-environment))
+         proc)
+    (unwind-protect
+        (progn
+          (with-temp-file script
+            (prin1
+             `(progn
+                (switch-to-buffer (get-buffer-create "lines"))
+                (dotimes (i 100)
+                  (insert (format "line %d\n" i)))
+                (goto-char (point-min))
+                ,setup
+                (defvar keyboard-tests--log nil)
+                (add-hook 'post-command-hook
+                          (lambda ()
+                            (when (eq this-command 'next-line)
+                              (push (list (prefix-numeric-value
+                                           current-prefix-arg)
+                                          (line-number-at-pos))
+                                    keyboard-tests--log))))
+                (global-set-key
+                 "\C-q"
+                 (lambda ()
+                   (interactive)
+                   (write-region (prin1-to-string
+                                  (nreverse keyboard-tests--log))
+                                 nil ,out)
+                   (kill-emacs 0)))
+                (add-hook 'emacs-startup-hook
+                          (lambda () (write-region "" nil ,ready))))
+             (current-buffer)))
+          (setq proc (make-process
+                      :name "keyboard-tests"
+                      :connection-type 'pty
+                      :noquery t
+                      :command
+                      (list "sh" "-c"
+                            "stty rows 24 columns 80; exec \"$0\" -nw -Q -l \"$1\""
+                            (expand-file-name invocation-name
+                                              invocation-directory)
+                            script)))
+          (keyboard-tests--wait-for ready proc)
+          (process-send-string proc (concat keys "\C-q"))
+          (keyboard-tests--wait-for out proc)
+          (with-temp-buffer
+            (insert-file-contents out)
+            (read (current-buffer))))
+      (when (process-live-p proc)
+        (delete-process proc))
+      (delete-directory dir t))))
+
+(ert-deftest keyboard-coalesce-repeated-commands ()
+  "Queued repetitions of a key are run as one command."
+  (skip-unless (and (executable-find "sh") (executable-find "stty")))
+  ;; All the queued repetitions are taken at once...
+  (should (equal (keyboard-tests--type nil (make-string 10 ?\C-n))
+                 '((10 11))))
+  ;; ...but not past another key.
+  (should (equal (keyboard-tests--type nil "\C-n\C-n\C-f\C-n\C-n\C-n")
+                 '((2 3) (3 6))))
+  ;; Keys are compared after `keyboard-translate-table'.
+  (should (equal (keyboard-tests--type
+                  '(setq keyboard-translate-table
+                         (let ((table (make-char-table
+                                       'keyboard-translate-table)))
+                           (aset table ?\C-t ?\C-n)
+                           table))
+                  "\C-n\C-t\C-t\C-f\C-t")
+                 '((3 4) (1 5))))
+  ;; With `next-line-add-newlines', C-n at the end of the buffer adds
+  ;; a line each time, which a numeric argument doesn't do.
+  (should (equal (keyboard-tests--type
+                  '(progn (setq next-line-add-newlines t)
+                          (forward-line 98))
+                  (make-string 5 ?\C-n))
+                 '((1 100) (1 101) (1 102) (1 103) (1 104))))
+  ;; A command's predicate decides, and nil allows it always.
+  (should (equal (keyboard-tests--type
+                  '(setq coalesce-repeated-commands '((next-line . ignore)))
+                  "\C-n\C-n\C-n")
+                 '((1 2) (1 3) (1 4))))
+  (should (equal (keyboard-tests--type
+                  '(setq coalesce-repeated-commands '((next-line)))
+                  "\C-n\C-n\C-n")
+                 '((3 4))))
+  ;; Nothing is coalesced when the alist is empty.
+  (should (equal (keyboard-tests--type
+                  '(setq coalesce-repeated-commands nil)
+                  "\C-n\C-n\C-n")
+                 '((1 2) (1 3) (1 4)))))
+
+(provide 'keyboard-tests)
+;;; keyboard-tests.el ends here
@@ -162,4 +162,258 @@
                               (error nil))))
     (should (equal path samepath))))
 
+(ert-deftest process-test-output-after-descriptor-reuse ()
+  "Output arrives from many processes, and from processes that reuse
+the descriptors of deleted ones."
+  (skip-unless (executable-find "cat"))
+  (let ((process-connection-type nil)
+        (procs nil)
+        (output (make-hash-table)))
+    (unwind-protect
+        (let ((start (lambda (i)
+                       (let ((proc (start-process "cat" nil "cat")))
+                         (process-put proc 'index i)
+                         (set-process-filter
+                          proc (lambda (proc string)
+                                 (let ((i (process-get proc 'index)))
+                                   (puthash i (concat (gethash i output "")
+                                                      string)
+                                            output))))
+                         proc))))
+          (dotimes (i 50)
+            (push (funcall start i) procs))
+          ;; Replace every other process, so that its successor is
+          ;; likely to get the same descriptor.
+          (dotimes (i 50)
+            (when (= (% i 2) 0)
+              (let ((old (nth i procs)))
+                (delete-process old)
+                (setcar (nthcdr i procs) (funcall start (+ 50 i))))))
+          (dolist (proc procs)
+            (process-send-string proc "hello\n"))
+          (let ((start-time (float-time)))
+            (while (and (< (hash-table-count output) 50)
+                        (< (- (float-time) start-time) 10))
+              (accept-process-output nil 0.1)))
+          (should (= (hash-table-count output) 50))
+          (maphash (lambda (i string)
+                     (should (equal (list i string) (list i "hello\n"))))
+                   output))
+      (mapc #'delete-process procs))))
+
+;; Return the sizes of the chunks in which a process printing SIZE
+;; bytes passes its output to the filter.
+(defun process-tests--output-chunk-sizes (size)
+  (let* ((process-connection-type nil)
+         (sizes nil)
+         (proc (start-process "head" nil "head" "-c"
+                              (number-to-string size) "/dev/zero")))
+    (set-process-coding-system proc 'binary 'binary)
+    (set-process-filter proc (lambda (_proc string)
+                               (push (length string) sizes)))
+    (while (accept-process-output proc 10))
+    (nreverse sizes)))
+
+(ert-deftest process-test-read-output-max ()
+  "A process's output arrives intact, in chunks no larger than
+`read-process-output-max'."
+  (skip-unless (executable-find "head"))
+  (let* ((read-process-output-max 1000)
+         (sizes (process-tests--output-chunk-sizes 300000)))
+    (should (= (apply #'+ sizes) 300000))
+    (should (<= (apply #'max sizes) 1000)))
+  (let ((sizes (process-tests--output-chunk-sizes 3000000)))
+    (should (= (apply #'+ sizes) 3000000))
+    (should (<= (apply #'max sizes) read-process-output-max))))
+
+(ert-deftest process-test-default-filter-insertion ()
+  "The default filter inserts output before markers, and decodes it
+correctly even when characters are split between reads."
+  (skip-unless (executable-find "printf"))
+  (with-temp-buffer
+    (insert "prompt> ")
+    (let* ((process-connection-type nil)
+           (read-process-output-max 7)
+           (marker (copy-marker (point-max)))
+           (before-change nil)
+           (after-change nil)
+           (proc (start-process "printf" (current-buffer) "printf"
+                                (concat "h\\303\\251llo w\\303\\266rld\\n"
+                                        "\\303\\247a va\\n"))))
+      (add-hook 'before-change-functions
+                (lambda (beg end) (push (list beg end) before-change))
+                nil t)
+      (add-hook 'after-change-functions
+                (lambda (beg end len) (push (list beg end len) after-change))
+                nil t)
+      (set-process-sentinel proc #'ignore)
+      (set-process-coding-system proc 'utf-8-unix 'utf-8-unix)
+      (set-marker (process-mark proc) (point-max))
+      (goto-char (point-min))
+      (while (accept-process-output proc 10))
+      (should (equal (buffer-string)
+                     "prompt> héllo wörld\nça va\n"))
+      (should (= (point) (point-min)))
+      (should (= (marker-position marker) (point-max)))
+      (should (= (marker-position (process-mark proc)) (point-max)))
+      (should (= (length before-change) (length after-change)))
+      (should (equal (apply #'+ (mapcar (lambda (c) (- (nth 1 c) (nth 0 c)))
+                                        after-change))
+                     (- (point-max) (length "prompt> ") 1))))))
+
+(ert-deftest process-test-default-filter-change-hooks ()
+  "The default filter runs the change hooks only for output that
+inserts text, whether it is decoded straight into the buffer or not."
+  (skip-unless (executable-find "sh"))
+  (dolist (test '(("printf '\\303'; sleep 0.5; printf '\\251\\n'"
+                   . "é\n")
+                  ("for i in 1 2 3; do printf '%0200d' 0 | tr 0 a; printf '\\303\\251'; done"
+                   . nil)))
+    (with-temp-buffer
+      (let* ((process-connection-type nil)
+             (read-process-output-max 101)
+             (before-change nil)
+             (after-change nil)
+             (proc (start-process "sh" (current-buffer) "sh" "-c"
+                                  (car test))))
+        (add-hook 'before-change-functions
+                  (lambda (beg end) (push (list beg end) before-change))
+                  nil t)
+        (add-hook 'after-change-functions
+                  (lambda (beg end len) (push (list beg end len) after-change))
+                  nil t)
+        (set-process-sentinel proc #'ignore)
+        (set-process-coding-system proc 'utf-8-unix 'utf-8-unix)
+        (while (accept-process-output proc 10))
+        (should (equal (buffer-string)
+                       (or (cdr test)
+                           (apply #'concat
+                                  (make-list 3 (concat (make-string 200 ?a)
+                                                       "é"))))))
+        (should (= (length before-change) (length after-change)))
+        (dolist (change after-change)
+          (should (< (nth 0 change) (nth 1 change))))))))
+
+(ert-deftest process-test-send-string-nowait ()
+  "Data sent without waiting arrives whole and in order, and callbacks
+run once their data has been written."
+  (skip-unless (executable-find "cat"))
+  (let* ((process-connection-type nil)
+         (output nil)
+         (written nil)
+         (proc (start-process "cat" nil "cat")))
+    (set-process-filter proc (lambda (_proc string)
+                               (push string output)))
+    (set-process-sentinel proc #'ignore)
+    (let ((queued (process-send-string-nowait
+                   proc (make-string 1000000 ?a)
+                   (lambda (p) (push (list 1 p) written)))))
+      (should (integerp queued))
+      (should (<= queued 1000000)))
+    (process-send-string proc (make-string 1000 ?b))
+    (process-send-string-nowait proc (make-string 1000000 ?c)
+                                (lambda (p) (push (list 2 p) written)))
+    (let ((start-time (float-time)))
+      (while (and (< (length written) 2)
+                  (< (- (float-time) start-time) 10))
+        (accept-process-output nil 0.1)))
+    (should (equal written (list (list 2 proc) (list 1 proc))))
+    (should (= (process-send-queue-size proc) 0))
+    (process-send-eof proc)
+    (while (accept-process-output proc 10))
+    (should (equal (apply #'concat (nreverse output))
+                   (concat (make-string 1000000 ?a) (make-string 1000 ?b)
+                           (make-string 1000000 ?c))))))
+
+(ert-deftest process-test-send-string-nowait-eof ()
+  "EOF sent to a process comes after the data still queued for it."
+  (skip-unless (and (executable-find "sh") (executable-find "wc")))
+  (let* ((process-connection-type nil)
+         (output nil)
+         (proc (start-process "wc" nil "sh" "-c" "sleep 1; wc -c")))
+    (set-process-filter proc (lambda (_proc string)
+                               (push string output)))
+    (set-process-sentinel proc #'ignore)
+    (should (> (process-send-string-nowait proc (make-string 934464 ?a)) 0))
+    (process-send-eof proc)
+    (should (= (process-send-queue-size proc) 0))
+    (accept-process-output nil 0.5)
+    (while (accept-process-output proc 10))
+    (should (equal (split-string (apply #'concat (nreverse output)))
+                   '("934464")))))
+
+;; Return the environment that a subprocess sees, as an alist.
+(defun process-tests--child-environment ()
+  (with-temp-buffer
+    (call-process "env" nil t)
+    (mapcar (lambda (line)
+              (let ((i (string-match "=" line)))
+                (cons (substring line 0 i) (substring line (1+ i)))))
+            (split-string (buffer-string) "\n" t))))
+
+(ert-deftest process-test-child-environment ()
+  "Subprocesses see `process-environment' as it is when they start."
+  (skip-unless (executable-find "env"))
+  (let ((process-environment
+         (append '("PROCESS_TESTS_A=1" "PROCESS_TESTS_A=2"
+                   "PROCESS_TESTS_B" "PROCESS_TESTS_B=3"
+                   "PWD=/nonexistent")
+                 process-environment))
+        (default-directory temporary-file-directory))
+    (let ((env (process-tests--child-environment)))
+      (should (equal (assoc "PROCESS_TESTS_A" env) '("PROCESS_TESTS_A" . "1")))
+      (should-not (assoc "PROCESS_TESTS_B" env))
+      (should (equal (file-name-as-directory (cdr (assoc "PWD" env)))
+                     (file-name-as-directory
+                      (expand-file-name temporary-file-directory))))
+      (should-not (assoc "PWD" (cdr (member (assoc "PWD" env) env)))))
+    (setenv "PROCESS_TESTS_A" "4")
+    (should (equal (assoc "PROCESS_TESTS_A" (process-tests--child-environment))
+                   '("PROCESS_TESTS_A" . "4")))
+    (let ((process-environment (cons "PWD" process-environment)))
+      (should-not (assoc "PWD" (process-tests--child-environment))))))
+
+;; Return the names of the live buffers and processes whose names
+;; start with "call-process-batch" or " *call-process-batch".
+(defun process-tests--batch-leftovers ()
+  (delq nil
+        (append
+         (mapcar (lambda (b)
+                   (and (string-match "\\` \\*call-process-batch"
+                                      (buffer-name b))
+                        (buffer-name b)))
+                 (buffer-list))
+         (mapcar (lambda (p)
+                   (and (string-match "\\`call-process-batch"
+                                      (process-name p))
+                        (process-name p)))
+                 (process-list)))))
+
+(ert-deftest process-test-call-process-batch ()
+  "Commands run in parallel report their status and output in order."
+  (skip-unless (executable-find "sh"))
+  (should (natnump (num-processors)))
+  (let ((results (call-process-batch
+                  (append
+                   '(("sh" "-c" "echo out; echo err >&2; exit 3")
+                     ("sh" "-c" "kill -9 $$"))
+                   (mapcar (lambda (i)
+                             (list "sh" "-c" (format "echo %d" i)))
+                           (number-sequence 1 20)))
+                  4)))
+    (should (equal (nth 0 results) '(3 "out\n" "err\n")))
+    (should (stringp (car (nth 1 results))))
+    (should (equal (nthcdr 2 results)
+                   (mapcar (lambda (i) (list 0 (format "%d\n" i) ""))
+                           (number-sequence 1 20)))))
+  ;; Commands that read their input see its end at once.
+  (should (equal (call-process-batch '(("sh" "-c" "read x; echo \"[$x]\"")
+                                       ("cat")))
+                 '((0 "[]\n" "") (0 "" ""))))
+  (should (equal (call-process-batch nil) nil))
+  (should-error (call-process-batch '(("sh" "-c" "sleep 10")
+                                      ("process-tests-no-such-program")))
+                :type 'file-error)
+  (should-not (process-tests--batch-leftovers)))
+
 (provide 'process-tests)
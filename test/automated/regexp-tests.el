@@ -30,4 +30,190 @@
 The test data is in `compile-tests--test-regexps-data'."
   (should (string-match (regexp-opt-charset '(?^)) "a^b")))
 
+;; Patterns on which the backtracking matcher explodes are finished
+;; by the automaton-based matcher instead.
+(ert-deftest regexp-test-exponential-backtracking ()
+  (let ((s (make-string 30 ?a)))
+    (should-not (string-match "\\(a*\\)*b" s))
+    (should (equal (string-match "\\(a*\\)*\\(a\\)$" s) 0))
+    (should (equal (match-data) '(0 30 29 29 29 30)))))
+
+;; A forward search that the backtracker gives up on is finished in a
+;; single pass, which must still find the leftmost match and set the
+;; groups as the backtracker would.
+(ert-deftest regexp-test-automaton-unanchored-search ()
+  (with-temp-buffer
+    (insert "xx" (make-string 20000 ?a) "x aab")
+    (let ((case-fold-search nil)
+          (regexp "\\(\\(a\\|aa\\)+\\)[bc]"))
+      (goto-char (point-min))
+      (should (re-search-forward regexp nil t))
+      (should (equal (butlast (match-data t))
+                     '(20005 20008 20005 20007 20006 20007)))
+      (goto-char (point-min))
+      (should (equal (re-search-forward-any (list "zzz" regexp) nil t) 1))
+      (should (equal (butlast (match-data t))
+                     '(20005 20008 20005 20007 20006 20007)))
+      (goto-char (point-min))
+      (should-not (re-search-forward regexp 20004 t))
+      (should (= (point) (point-min))))))
+
+(ert-deftest regexp-test-long-line-no-stack-overflow ()
+  (with-temp-buffer
+    (insert (make-string 200000 ?x) "y")
+    (goto-char (point-min))
+    (should (re-search-forward "\\(x\\|z\\)*y" nil t))
+    (should (= (match-beginning 0) (point-min)))
+    (should (= (match-end 0) (point-max)))))
+
+;; Literal text that every match contains is searched for before
+;; trying to match, also when it straddles the gap.
+(ert-deftest regexp-test-required-literal ()
+  (with-temp-buffer
+    (insert "foo barbaz bar-baz")
+    (goto-char 14)
+    (insert "x")
+    (delete-char -1)
+    (let ((case-fold-search nil))
+      (goto-char (point-min))
+      (should (re-search-forward "\\(r\\|z\\)-baz" nil t))
+      (should (equal (list (match-beginning 0) (match-beginning 1)) '(14 14)))
+      (goto-char (point-min))
+      (should (re-search-forward "b?ar-b" nil t))
+      (should (= (match-beginning 0) 12))
+      (goto-char (point-min))
+      (should-not (re-search-forward "[a-z]+-bax" nil t))
+      (should-not (re-search-forward "bar-baz" 18 t)))
+    (let ((case-fold-search t))
+      (goto-char (point-min))
+      (should (re-search-forward "BAR-B" nil t))
+      (should (= (match-beginning 0) 12))))
+  (should (equal (string-match "a\\(?:x\\|y\\)*é" "aé aé") 0))
+  (should (equal (string-match "é" (string-to-unibyte "a\351")) nil))
+  (let ((case-fold-search nil))
+    (should (equal (string-match "\\(?:ab\\)+c" "ababac abababc") 7))))
+
+(ert-deftest regexp-test-cache ()
+  (let* ((word (format "cache-test-%s" (random)))
+         (re (concat word "\\(x\\)"))
+         (before (regexp-cache-statistics)))
+    (should (string-match re (concat word "x")))
+    (should-not (string-match re "x"))
+    (let ((after (regexp-cache-statistics)))
+      (should (= (nth 1 after) (1+ (nth 1 before))))
+      (should (>= (nth 0 after) (1+ (nth 0 before))))
+      (should (floatp (nth 2 after)))))
+  ;; A smaller cache evicts the least recently used regexps, and
+  ;; still finds those in use.
+  (let ((regexp-cache-size 3))
+    (dotimes (i 10)
+      (should (string-match (format "a%d\\|b" i) "b")))
+    (string-match "x" "x")
+    (should (<= (nth 3 (regexp-cache-statistics)) 3))
+    (let ((hits (car (regexp-cache-statistics))))
+      (should (string-match "a9\\|b" "a9"))
+      (should (= (car (regexp-cache-statistics)) (1+ hits)))))
+  ;; Patterns that depend on the syntax table are recompiled after it
+  ;; changes.
+  (with-temp-buffer
+    (insert "a-b")
+    (let ((table (make-syntax-table)))
+      (set-syntax-table table)
+      (modify-syntax-entry ?- "." table)
+      (goto-char (point-min))
+      (should (equal (re-search-forward "\\sw+" nil t) 2))
+      (modify-syntax-entry ?- "w" table)
+      (goto-char (point-min))
+      (should (equal (re-search-forward "\\sw+" nil t) 4)))))
+
+(ert-deftest regexp-test-search-forward-any ()
+  "Test `re-search-forward-any'."
+  (with-temp-buffer
+    (insert "(let ((x 1)) (when x (setq y 2)))")
+    (let ((case-fold-search nil)
+          (regexps '("\\_<when\\_>" "(\\(\\sw+\\)" "\\_<setq\\_>")))
+      (goto-char (point-min))
+      ;; The match that starts first wins.
+      (should (equal (re-search-forward-any regexps) 1))
+      (should (equal (match-string 1) "let"))
+      (should (= (point) 5))
+      (should (equal (re-search-forward-any regexps) 1))
+      (should (equal (match-string 0) "(x"))
+      ;; At the same position, the earlier regexp in the list wins.
+      (goto-char 13)
+      (should (equal (re-search-forward-any (reverse regexps)) 1))
+      (should (equal (match-string 1) "when"))
+      (goto-char 13)
+      (should (equal (re-search-forward-any regexps) 1))
+      (should (equal (match-string 0) "(when"))
+      (should (equal (re-search-forward-any regexps) 1))
+      (should (equal (match-string 1) "setq"))
+      ;; The bound limits the end of the match.
+      (goto-char (point-min))
+      (should (equal (re-search-forward-any '("setq" "when") 19 t) 1))
+      (should-not (re-search-forward-any '("setq" "when") 26 t))
+      (should (= (point) 19))
+      (should-not (re-search-forward-any '("setq" "when") 26 'move))
+      (should (= (point) 26))
+      (should-error (re-search-forward-any '("foo" "bar")) :type 'search-failed)
+      ;; The result agrees with searching for each regexp separately.
+      (dolist (start '(1 3 10 20 30))
+        (let (best)
+          (dotimes (i (length regexps))
+            (goto-char start)
+            (when (and (re-search-forward (nth i regexps) nil t)
+                       (or (null best) (< (match-beginning 0) (cdr best))))
+              (setq best (cons i (match-beginning 0)))))
+          (goto-char start)
+          (should (equal (re-search-forward-any regexps nil t) (car best)))
+          (when best
+            (should (equal (match-beginning 0) (cdr best))))))
+      ;; There can be more regexps than the cache holds; those in use
+      ;; stay compiled, and the cache shrinks back afterwards.
+      (let ((regexp-cache-size 3)
+            (many (append (mapcar (lambda (i) (format "zz%d" i))
+                                  (number-sequence 1 20))
+                          '("(\\(setq\\)" "(\\(when\\)"))))
+        (goto-char (point-min))
+        (should (equal (re-search-forward-any many) 21))
+        (should (equal (match-string 1) "when"))
+        (should (equal (re-search-forward-any many) 20))
+        (should (equal (match-string 1) "setq"))
+        (string-match "x" "x")
+        (should (<= (nth 3 (regexp-cache-statistics)) 3))))))
+
+(ert-deftest regexp-test-search-case-fold-multibyte ()
+  "Test case-insensitive `search-forward' for Cyrillic and Greek text.
+The case equivalents of these characters are too far apart for the
+Boyer-Moore search, so this exercises the anchored search instead."
+  (with-temp-buffer
+    (dotimes (i 100)
+      (insert (format "строка %d: Σοφία и РЕКА\n" i)))
+    ;; Put the gap in the middle of the text.
+    (goto-char 1000)
+    (insert "x")
+    (delete-char -1)
+    (let ((case-fold-search t))
+      (dolist (pat '("река" "СТРОКА 42" "σΟΦΊΑ" "ς"))
+        (let ((re (concat "\\(?:" (regexp-quote pat) "\\)")))
+          (dolist (start '(1 500 1000 1500))
+            (dolist (count '(1 3))
+              (goto-char start)
+              (let ((found (search-forward pat nil t count))
+                    (data (match-data t)))
+                (goto-char start)
+                (should (equal found (re-search-forward re nil t count)))
+                (when found
+                  (should (equal data (match-data t)))))
+              (goto-char start)
+              (let ((found (search-backward pat nil t count))
+                    (data (match-data t)))
+                (goto-char start)
+                (should (equal found (re-search-backward re nil t count)))
+                (when found
+                  (should (equal data (match-data t))))))))))
+    (let ((case-fold-search nil))
+      (goto-char (point-min))
+      (should-not (search-forward "строка 1: σοφία" nil t)))))
+
 ;;; regexp-tests.el ends here.
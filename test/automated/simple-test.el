@@ -20,6 +20,7 @@
 ;;; Code:
 
 (require 'ert)
+(eval-when-compile (require 'cl-lib))
 
 (defmacro simple-test--dummy-buffer (&rest body)
   (declare (indent 0)
@@ -360,5 +361,39 @@ See Bug#21722."
        (undo)
        (point)))))
 
+(ert-deftest line-move-coalesce-p ()
+  "Repeated line moves are coalesced only when a single move would
+just move a line."
+  (let ((noninteractive nil)
+        (auto-window-vscroll t)
+        (scroll-conservatively 0)
+        (next-line-add-newlines nil)
+        (vscroll 0)
+        ;; The last line of the window, fully visible.
+        (last-line '(16 23 368 0)))
+    (cl-letf (((symbol-function 'window-vscroll)
+               (lambda (&rest _) vscroll))
+              ((symbol-function 'window-line-height)
+               (lambda (&rest _) last-line)))
+      (should (line-move-coalesce-p 'next-line))
+      (should (line-move-coalesce-p 'previous-line))
+      ;; A single `next-line' would add a newline at the end of the
+      ;; buffer.
+      (let ((next-line-add-newlines t))
+        (should-not (line-move-coalesce-p 'next-line))
+        (should (line-move-coalesce-p 'previous-line)))
+      ;; A single `next-line' would vscroll a partially visible last
+      ;; line.
+      (setq last-line '(48 23 368 32))
+      (should-not (line-move-coalesce-p 'next-line))
+      (should (line-move-coalesce-p 'previous-line))
+      (let ((auto-window-vscroll nil))
+        (should (line-move-coalesce-p 'next-line)))
+      ;; Both would change the vscroll of a vscrolled window.
+      (setq last-line '(16 23 368 0)
+            vscroll 8)
+      (should-not (line-move-coalesce-p 'next-line))
+      (should-not (line-move-coalesce-p 'previous-line)))))
+
 (provide 'simple-test)
 ;;; simple-test.el ends here
@@ -93,5 +93,102 @@
   ;;   abcdefghijklmnopqrstuv
   i f a scan-error)
 
+(ert-deftest parse-partial-sexp-checkpoints ()
+  "Test that parsing from checkpoints gives the same result."
+  (with-temp-buffer
+    (emacs-lisp-mode)
+    (set-syntax-table (copy-syntax-table))
+    (setq cache-long-scans t)
+    (dotimes (i 2000)
+      (insert (format "(defun f-%d (x) \"doc (\" ; c (\n  (list ?\\( x))\n" i)))
+    (let ((fresh-state '(0 nil nil nil nil nil 0 nil nil nil))
+          (positions '(1 100 5000 20000 40000 60000)))
+      (cl-flet ((check ()
+                  (dolist (pos (append positions (list (point-max))))
+                    (setq pos (min pos (point-max)))
+                    ;; A non-nil OLDSTATE keeps the checkpoints from
+                    ;; being used.
+                    (should (equal (parse-partial-sexp (point-min) pos)
+                                   (parse-partial-sexp (point-min) pos nil nil
+                                                       fresh-state))))))
+        (check)
+        ;; Changes to the text drop the checkpoints after them.
+        (goto-char 30000)
+        (insert "(\"")
+        (check)
+        (delete-region 30000 30002)
+        (check)
+        ;; So do changes to `syntax-table' properties, when they are
+        ;; used.
+        (setq-local parse-sexp-lookup-properties t)
+        (put-text-property 10000 10001 'syntax-table (string-to-syntax "("))
+        (check)
+        ;; And changes to the syntax table.
+        (modify-syntax-entry ?\; "." (syntax-table))
+        (check)))))
+
+(ert-deftest syntax-table-property-runs ()
+  "Test scanning text with many intervals and `syntax-table' properties."
+  (with-temp-buffer
+    (setq-local parse-sexp-lookup-properties t)
+    (dotimes (_ 200)
+      (insert "(a b) (c \"d\") "))
+    ;; Split the text into many intervals, as fontification does.
+    (let ((pos (point-min)))
+      (while (< pos (point-max))
+        (put-text-property pos (1+ pos) 'face (if (cl-oddp pos) 'bold 'italic))
+        (setq pos (1+ pos))))
+    (cl-flet ((sexps ()
+                (goto-char (point-min))
+                (let (ends)
+                  (while (< (point) (1- (point-max)))
+                    (forward-sexp 1)
+                    (push (point) ends))
+                  ends)))
+      (let ((plain (let ((cache-long-scans nil)) (sexps))))
+        (setq cache-long-scans t)
+        (should (equal (sexps) plain))
+        ;; Changing the property is noticed.
+        (put-text-property 6 7 'syntax-table (string-to-syntax "w"))
+        (let ((ends (sexps)))
+          (should-not (equal ends plain))
+          (should (equal ends (let ((cache-long-scans nil)) (sexps)))))
+        (remove-text-properties 6 7 '(syntax-table nil))
+        (should (equal (sexps) plain))))))
+
+;; `skip-chars-forward' and `skip-syntax-forward' skip ASCII runs
+;; several bytes at a time; check them against a character-by-character
+;; scan, over the gap and with runs of every length modulo 8.
+(ert-deftest skip-chars-and-syntax-long-runs ()
+  (dolist (multibyte '(t nil))
+    (dotimes (len 20)
+      (with-temp-buffer
+        (set-buffer-multibyte multibyte)
+        (insert "x(" (make-string (* 3 len) ?\s) "é)" (make-string len ?a) "(")
+        (let ((spaces-end (+ 3 (* 3 len))))
+          ;; Put the gap in the middle of the spaces.
+          (goto-char (+ 3 len))
+          (insert "a")
+          (delete-char -1)
+          (goto-char 3)
+          (should (= (skip-chars-forward " \t") (* 3 len)))
+          (should (= (point) spaces-end))
+          (goto-char 3)
+          (should (= (skip-syntax-forward " ") (* 3 len)))
+          (should (= (skip-syntax-backward " ") (- (* 3 len))))
+          (goto-char spaces-end)
+          (should (= (skip-chars-backward " ") (- (* 3 len))))
+          (should (= (point) 3))
+          (goto-char (1- (point-max)))
+          (should (= (skip-syntax-backward "w") (- len)))
+          ;; A non-ASCII character stops or continues the run as the
+          ;; set says.
+          (when multibyte
+            (should (= (skip-syntax-backward "^w") -1))
+            (goto-char 3)
+            (should (= (skip-chars-forward " é") (1+ (* 3 len))))
+            (goto-char 3)
+            (should (= (skip-chars-forward "^)") (1+ (* 3 len))))))))))
+
 (provide 'syntax-tests)
 ;;; syntax-tests.el ends here
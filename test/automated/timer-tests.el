@@ -34,6 +34,31 @@
     (sit-for 0 t)
     (should timer-ran)))
 
+(ert-deftest timer-tests-list-sorted ()
+  (let ((timers nil))
+    (unwind-protect
+        (progn
+          (dotimes (_ 200)
+            (push (run-at-time (+ 1000 (random 1000)) nil #'ignore) timers))
+          (let ((prev nil))
+            (dolist (timer timer-list)
+              (when prev
+                (should-not (timer--time-less-p timer prev)))
+              (setq prev timer))))
+      (mapc #'cancel-timer timers))))
+
+(ert-deftest timer-tests-added-by-timer ()
+  (let ((timer-ran nil))
+    ;; A ripe timer added while timers run must run too, without the
+    ;; first one having to wait for another timer to become ripe.
+    (run-at-time 0 nil
+                 (lambda ()
+                   (run-at-time 0 nil (lambda () (setq timer-ran t)))))
+    (with-timeout (1 nil)
+      (while (not timer-ran)
+        (accept-process-output nil 0.5)))
+    (should timer-ran)))
+
 (ert-deftest timer-tests-debug-timer-check ()
   ;; This function exists only if --enable-checking.
   (if (fboundp 'debug-timer-check)
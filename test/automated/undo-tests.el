@@ -44,6 +44,7 @@
 ;;; Code:
 
 (require 'ert)
+(require 'cl-lib)
 
 (ert-deftest undo-test0 ()
   "Test basics of \\[undo]."
@@ -437,6 +438,69 @@ Demonstrates bug 16818."
 
     (should (string= (buffer-string) "aaaFirst line\nSecond line\nbbb"))))
 
+(ert-deftest undo-test-coalesce-single-character-changes ()
+  "Test undoing runs of changes that are recorded as single entries."
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert (mapconcat #'number-to-string (number-sequence 1 300) " "))
+    (let ((orig (buffer-string))
+          (marker (copy-marker 20)))
+      (undo-boundary)
+      (set-buffer-modified-p nil)
+      (cl-flet ((check-undo (entries)
+                  ;; The run was recorded as a few entries, and
+                  ;; undoing them restores the text and the marker.
+                  (should (< (length (cl-remove nil buffer-undo-list))
+                             entries))
+                  (primitive-undo 1 buffer-undo-list)
+                  (should (equal (buffer-string) orig))
+                  (should (= marker 20))
+                  (setq buffer-undo-list nil)))
+        ;; Deleting forward a character at a time.
+        (goto-char 100)
+        (dotimes (_ 200) (delete-char 1))
+        (check-undo 10)
+        ;; Deleting backward.
+        (goto-char 300)
+        (dotimes (_ 200) (delete-char -1))
+        (check-undo 10)
+        ;; Replacing one character at a time.
+        (let ((table (make-string 128 ?x)))
+          (dotimes (i 128) (aset table i i))
+          (dotimes (i 10) (aset table (+ ?0 i) ?!))
+          (aset table ?\s ?_)
+          (dotimes (i 400)
+            (translate-region (+ 50 i) (+ 51 i) table))
+          (should-not (equal (buffer-string) orig))
+          (check-undo 30))))))
+
+(ert-deftest undo-test-coalesce-change-group ()
+  "Test that a change group doesn't merge into the entry before it.
+Otherwise cancelling the group would leave part of its changes in."
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert "abcdefghij")
+    (undo-boundary)
+    (goto-char 3)
+    (delete-char 1)
+    (should-error (atomic-change-group
+                    (delete-char 1)
+                    (error "x")))
+    (should (equal (buffer-string) "abdefghij"))
+    ;; The same with a run of replacements.
+    (let ((table (make-string 128 ?x)))
+      (dotimes (i 128) (aset table i i))
+      (aset table ?d ?x)
+      (aset table ?e ?y)
+      (translate-region 3 4 table)
+      (should-error (atomic-change-group
+                      (translate-region 4 5 table)
+                      (error "x"))))
+    (should (equal (buffer-string) "abxefghij"))
+    ;; Undoing still restores the text from before the group.
+    (primitive-undo 1 buffer-undo-list)
+    (should (equal (buffer-string) "abcdefghij"))))
+
 (defun undo-test-all (&optional interactive)
   "Run all tests for \\[undo]."
   (interactive "p")
@@ -0,0 +1,85 @@
+;;; regexp-benchmark.el --- Timing corpus for the regexp matcher.
+
+;; Copyright (C) 2017 Free Software Foundation, Inc.
+
+;; Keywords:       internal
+;; Human-Keywords: internal
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; A handful of regexps that are typical of font-lock keywords and of
+;; patterns that make a backtracking matcher take exponential time,
+;; each searched for in a generated buffer.  Type
+;; M-x regexp-benchmark RET, or run
+;;
+;;   emacs -Q --batch -l test/regexp-benchmark.el -f regexp-benchmark
+;;
+;; to print the time each search takes.
+
+;;; Code:
+
+(defvar regexp-benchmark-corpus
+  `(("font-lock keyword"
+     "\\_<\\(defun\\|defvar\\|defmacro\\)\\_>[ \t]+\\(\\(?:\\sw\\|\\s_\\)+\\)"
+     ,(lambda () (dotimes (i 20000) (insert (format "(foo-%d bar)\n" i)))))
+    ("string literal"
+     "\"\\(?:[^\"\\\\]\\|\\\\.\\)*\""
+     ,(lambda () (dotimes (_ 2000)
+                   (insert "x = \"" (make-string 100 ?a) "\\\"b\";\n"))))
+    ("required literal, no match"
+     "^\\(?:\\sw+ \\)+TODO"
+     ,(lambda () (dotimes (_ 20000) (insert "some words on a line\n"))))
+    ("trailing whitespace"
+     "[ \t]+$"
+     ,(lambda () (dotimes (_ 20000) (insert "some text  \t text\n"))))
+    ("nested star"
+     "\\(a*\\)*b"
+     ,(lambda () (insert (make-string 40 ?a))))
+    ("alternation loop on a long line"
+     "\\(x\\|y\\)*z"
+     ,(lambda () (insert (make-string 500000 ?x) "z")))
+    ("unanchored nested group"
+     "\\(\\(a\\|aa\\)+\\)c"
+     ,(lambda () (insert (make-string 20000 ?a)))))
+  "List of (NAME REGEXP SETUP) entries timed by `regexp-benchmark'.
+SETUP is called in an empty buffer to generate the text to search.")
+
+(defun regexp-benchmark-1 (regexp setup)
+  "Return the seconds taken to search for all matches of REGEXP.
+The buffer searched is generated by calling SETUP.  The search is
+case-sensitive, as font-lock searches usually are."
+  (with-temp-buffer
+    (funcall setup)
+    (goto-char (point-min))
+    (let ((case-fold-search nil)
+          (start (float-time)))
+      (while (and (re-search-forward regexp nil t)
+                  (or (> (match-end 0) (match-beginning 0))
+                      (not (eobp))))
+        (when (= (match-end 0) (match-beginning 0))
+          (forward-char 1)))
+      (- (float-time) start))))
+
+(defun regexp-benchmark ()
+  "Time the searches in `regexp-benchmark-corpus'."
+  (interactive)
+  (dolist (entry regexp-benchmark-corpus)
+    (message "%-35s %8.3fs" (car entry)
+             (regexp-benchmark-1 (nth 1 entry) (nth 2 entry)))))
+
+;;; regexp-benchmark.el ends here